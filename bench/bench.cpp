@@ -0,0 +1,518 @@
+/**
+ * Kernel benchmark suite
+ *
+ * Times the kernels through the C API in blas.h on random data and prints
+ * one line per routine and size:
+ *
+ *   routine  size  time_us  gflops
+ *
+ * Built natively (blas-bench) and as a standalone WASI command
+ * (blas-bench-wasi.wasm, see examples/wasi/), so the same numbers can be
+ * compared between native code, wasmtime/WAMR and the browser build.
+ *
+ * With --roofline the suite first measures the machine as this build sees
+ * it: the peak multiply-add rate of independent chains of f64 and f32
+ * arithmetic (vectorized like the kernels: SIMD128 in WebAssembly, the
+ * target's vector ISA natively) and the bandwidth of a STREAM triad larger
+ * than the caches. Each case then also reports its arithmetic intensity
+ * (flops per byte of compulsory memory traffic: every operand read once,
+ * every output written once), whether the roofline
+ * min(peak, intensity * bandwidth) puts it under the compute or the memory
+ * roof, that roof and the percentage of it reached:
+ *
+ *   routine  size  time_us  gflops  flop/byte  bound  roof_gflops  roof_%
+ *
+ * Operands that fit in cache can run above the memory roof. Integer kernels
+ * have no measured compute roof and only report their intensity; dcopy,
+ * dswap, dlacpy, dlaset and the precision conversions do no arithmetic, and
+ * roof_% is their bandwidth relative to the triad's.
+ *
+ * Usage: blas-bench [--roofline] [filter] [min_seconds]
+ *   filter       only run routines whose name contains this string
+ *   min_seconds  minimum measuring time per case (default 0.2)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/cpp/blas.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Arithmetic of a case, for its compute roof
+enum class Arith { F64, F32, INT };
+
+struct Case {
+    std::string routine;
+    std::string size;
+    double flops;                 // floating point (or integer) operations per call
+    double bytes;                 // compulsory memory traffic per call
+    Arith arith;
+    std::function<void()> run;
+};
+
+std::mt19937 rng(42);
+
+std::vector<double> random_f64(size_t n) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> v(n);
+    for (double& x : v) x = dist(rng);
+    return v;
+}
+
+std::vector<uint16_t> random_bf16(size_t n) {
+    std::vector<double> d = random_f64(n);
+    std::vector<uint16_t> v(n);
+    sbdtobf16(static_cast<int>(n), d.data(), 1, v.data(), 1);
+    return v;
+}
+
+template <typename T>
+std::vector<T> random_int(size_t n, int lo, int hi) {
+    std::uniform_int_distribution<int> dist(lo, hi);
+    std::vector<T> v(n);
+    for (T& x : v) x = static_cast<T>(dist(rng));
+    return v;
+}
+
+// Best time per call in seconds: repeat until min_seconds have been spent
+double measure(const std::function<void()>& run, double min_seconds) {
+    run();  // warm up caches and page in buffers
+    double best = 1e30;
+    double total = 0.0;
+    int reps = 1;
+    while (total < min_seconds) {
+        auto t0 = Clock::now();
+        for (int r = 0; r < reps; r++) run();
+        double t = std::chrono::duration<double>(Clock::now() - t0).count();
+        total += t;
+        best = std::min(best, t / reps);
+        if (t < min_seconds / 10) reps *= 2;
+    }
+    return best;
+}
+
+// Peak multiply-add rate in flop/s: CHAIN_BYTES of independent chains
+// acc = acc * m + a, enough to hide the latency of the vector units
+const int CHAIN_BYTES = 256;
+
+template <typename T>
+T multiply_add_chains(int steps, T m, T a) {
+    const int chains = CHAIN_BYTES / sizeof(T);
+    T acc[chains];
+    for (int i = 0; i < chains; i++) acc[i] = static_cast<T>(i);
+    for (int s = 0; s < steps; s++) {
+        for (int i = 0; i < chains; i++) acc[i] = acc[i] * m + a;
+    }
+    T sum = 0;
+    for (int i = 0; i < chains; i++) sum += acc[i];
+    return sum;
+}
+
+template <typename T>
+double peak_flops(double min_seconds) {
+    const int steps = 4096;
+    volatile T m = static_cast<T>(0.999);   // not known to the compiler
+    volatile T a = static_cast<T>(1e-3);
+    double t = measure(
+        [&] {
+            volatile T r = multiply_add_chains<T>(steps, m, a);
+            (void)r;
+        },
+        min_seconds);
+    return 2.0 * (CHAIN_BYTES / sizeof(T)) * steps / t;
+}
+
+// Memory bandwidth in bytes/s: STREAM triad a = b + s * c on 3 x 32 MiB
+double triad_bandwidth(double min_seconds) {
+    const size_t n = size_t(1) << 22;
+    std::vector<double> a(n), b = random_f64(n), c = random_f64(n);
+    volatile double vs = 0.5;
+    double s = vs;
+    double t = measure(
+        [&] {
+            for (size_t i = 0; i < n; i++) a[i] = b[i] + s * c[i];
+        },
+        min_seconds);
+    volatile double r = a[n / 2];
+    (void)r;
+    return 24.0 * n / t;
+}
+
+void add_level1(std::vector<Case>& cases) {
+    const Arith d = Arith::F64;
+    for (int n : {1000, 100000, 1000000}) {
+        auto x = std::make_shared<std::vector<double>>(random_f64(n));
+        auto y = std::make_shared<std::vector<double>>(random_f64(n));
+        std::string size = std::to_string(n);
+        double v = 8.0 * n;   // bytes of one vector
+        cases.push_back({"daxpy", size, 2.0 * n, 3 * v, d,
+                         [=] { daxpy(n, 1e-9, x->data(), 1, y->data(), 1); }});
+        cases.push_back({"daxpby", size, 3.0 * n, 3 * v, d,
+                         [=] { daxpby(n, 1e-9, x->data(), 1, 1.0 - 1e-9, y->data(), 1); }});
+        cases.push_back({"dcopy", size, 0.0, 2 * v, d,
+                         [=] { dcopy(n, x->data(), 1, y->data(), 1); }});
+        cases.push_back({"dswap", size, 0.0, 4 * v, d,
+                         [=] { dswap(n, x->data(), 1, y->data(), 1); }});
+        cases.push_back({"dscal", size, 1.0 * n, 2 * v, d,
+                         [=] { dscal(n, 1.0 - 1e-9, y->data(), 1); }});
+        cases.push_back({"drot", size, 6.0 * n, 4 * v, d,
+                         [=] { drot(n, x->data(), 1, y->data(), 1, 0.6, 0.8); }});
+        cases.push_back({"drotm", size, 6.0 * n, 4 * v, d, [=] {
+                             const double param[5] = {-1.0, 0.6, -0.8, 0.8, 0.6};
+                             drotm(n, x->data(), 1, y->data(), 1, param);
+                         }});
+        cases.push_back({"ddot", size, 2.0 * n, 2 * v, d, [=] {
+                             volatile double r = ddot(n, x->data(), 1, y->data(), 1);
+                             (void)r;
+                         }});
+        cases.push_back({"dasum", size, 1.0 * n, v, d, [=] {
+                             volatile double r = dasum(n, x->data(), 1);
+                             (void)r;
+                         }});
+        cases.push_back({"dnrm2", size, 2.0 * n, v, d, [=] {
+                             volatile double r = dnrm2(n, x->data(), 1);
+                             (void)r;
+                         }});
+
+        // Conversions to and from 16-bit storage
+        auto h = std::make_shared<std::vector<uint16_t>>(random_bf16(n));
+        double hv = 2.0 * n;
+        cases.push_back({"sbdtobf16", size, 0.0, v + hv, d,
+                         [=] { sbdtobf16(n, x->data(), 1, h->data(), 1); }});
+        cases.push_back({"dbf16tod", size, 0.0, hv + v, d,
+                         [=] { dbf16tod(n, h->data(), 1, y->data(), 1); }});
+        cases.push_back({"shdtof16", size, 0.0, v + hv, d,
+                         [=] { shdtof16(n, x->data(), 1, h->data(), 1); }});
+        cases.push_back({"df16tod", size, 0.0, hv + v, d,
+                         [=] { df16tod(n, h->data(), 1, y->data(), 1); }});
+    }
+}
+
+void add_level2(std::vector<Case>& cases) {
+    const Arith d = Arith::F64;
+    for (int n : {64, 256, 1024}) {
+        size_t nn = static_cast<size_t>(n) * n;
+        auto a = std::make_shared<std::vector<double>>(random_f64(nn));
+        auto ap = std::make_shared<std::vector<double>>(random_f64(nn / 2 + n));
+        auto x = std::make_shared<std::vector<double>>(random_f64(n));
+        auto y = std::make_shared<std::vector<double>>(random_f64(n));
+        std::string size = std::to_string(n) + "x" + std::to_string(n);
+        double full = 8.0 * nn;            // bytes of the matrix
+        double half = 4.0 * nn;            // and of one triangle
+        double v = 8.0 * n;
+        cases.push_back({"dgemv_n", size, 2.0 * nn, full + 2 * v, d, [=] {
+                             dgemv(0, n, n, 1.0, a->data(), n, x->data(), 1, 0.0, y->data(), 1);
+                         }});
+        cases.push_back({"dgemv_t", size, 2.0 * nn, full + 2 * v, d, [=] {
+                             dgemv(1, n, n, 1.0, a->data(), n, x->data(), 1, 0.0, y->data(), 1);
+                         }});
+        cases.push_back({"dger", size, 2.0 * nn, 2 * full + 2 * v, d, [=] {
+                             dger(n, n, 1e-9, x->data(), 1, y->data(), 1, a->data(), n);
+                         }});
+        cases.push_back({"dsymv", size, 2.0 * nn, half + 2 * v, d, [=] {
+                             dsymv('U', n, 1.0, a->data(), n, x->data(), 1, 0.0, y->data(), 1);
+                         }});
+        cases.push_back({"dspmv", size, 2.0 * nn, half + 2 * v, d, [=] {
+                             dspmv(0, n, 1.0, ap->data(), x->data(), 1, 0.0, y->data(), 1);
+                         }});
+        cases.push_back({"dsyr2", size, 2.0 * nn, 2 * half + 2 * v, d, [=] {
+                             dsyr2('U', n, 1e-9, x->data(), 1, y->data(), 1, a->data(), n);
+                         }});
+        cases.push_back({"dtrmv", size, 1.0 * nn, half + 2 * v, d, [=] {
+                             dtrmv('U', 'N', 'U', n, a->data(), n, y->data(), 1);
+                         }});
+        cases.push_back({"dtrsv", size, 1.0 * nn, half + 2 * v, d, [=] {
+                             dtrsv('U', 'N', 'U', n, a->data(), n, y->data(), 1);
+                         }});
+        cases.push_back({"dsyr", size, 1.0 * nn, 2 * half + v, d, [=] {
+                             dsyr('U', n, 1e-9, x->data(), 1, a->data(), n);
+                         }});
+        cases.push_back({"dspr", size, 1.0 * nn, 2 * half + v, d,
+                         [=] { dspr(0, n, 1e-9, x->data(), 1, ap->data()); }});
+        cases.push_back({"dspr2", size, 2.0 * nn, 2 * half + 2 * v, d, [=] {
+                             dspr2(0, n, 1e-9, x->data(), 1, y->data(), 1, ap->data());
+                         }});
+        cases.push_back({"dtpmv", size, 1.0 * nn, half + 2 * v, d,
+                         [=] { dtpmv(0, 0, 1, n, ap->data(), y->data(), 1); }});
+        cases.push_back({"dtpsv", size, 1.0 * nn, half + 2 * v, d,
+                         [=] { dtpsv(0, 0, 1, n, ap->data(), y->data(), 1); }});
+
+        // Band matrices with k = 16 sub- and superdiagonals, stored in the
+        // leading 2k + 1 (general) or k + 1 (symmetric, triangular) rows of a
+        const int k = 16;
+        double band = 8.0 * n * (2 * k + 1);
+        double half_band = 8.0 * n * (k + 1);
+        cases.push_back({"dgbmv", size, 2.0 * n * (2 * k + 1), band + 2 * v, d, [=] {
+                             dgbmv(0, n, n, k, k, 1.0, a->data(), 2 * k + 1, x->data(), 1, 0.0,
+                                   y->data(), 1);
+                         }});
+        cases.push_back({"dsbmv", size, 2.0 * n * (2 * k + 1), half_band + 2 * v, d, [=] {
+                             dsbmv(0, n, k, 1.0, a->data(), k + 1, x->data(), 1, 0.0, y->data(),
+                                   1);
+                         }});
+        cases.push_back({"dtbmv", size, 2.0 * n * k, half_band + 2 * v, d,
+                         [=] { dtbmv(0, 0, 1, n, k, a->data(), k + 1, y->data(), 1); }});
+        cases.push_back({"dtbsv", size, 2.0 * n * k, half_band + 2 * v, d,
+                         [=] { dtbsv(0, 0, 1, n, k, a->data(), k + 1, y->data(), 1); }});
+
+        auto ah = std::make_shared<std::vector<uint16_t>>(random_bf16(nn));
+        auto xh = std::make_shared<std::vector<uint16_t>>(random_bf16(n));
+        auto yf = std::make_shared<std::vector<float>>(n);
+        cases.push_back({"sbgemv_n", size, 2.0 * nn, 2.0 * nn + 6.0 * n, Arith::F32, [=] {
+                             sbgemv('N', n, n, 1.0f, ah->data(), n, xh->data(), 1, 0.0f,
+                                    yf->data(), 1);
+                         }});
+    }
+}
+
+void add_level3(std::vector<Case>& cases) {
+    const Arith d = Arith::F64;
+    for (int n : {64, 256, 512}) {
+        size_t nn = static_cast<size_t>(n) * n;
+        auto a = std::make_shared<std::vector<double>>(random_f64(nn));
+        auto b = std::make_shared<std::vector<double>>(random_f64(nn));
+        auto c = std::make_shared<std::vector<double>>(random_f64(nn));
+        std::string size = std::to_string(n) + "^3";
+        double flops = 2.0 * n * n * n;
+        double full = 8.0 * nn;
+        double half = 4.0 * nn;
+        cases.push_back({"dgemm_nn", size, flops, 3 * full, d, [=] {
+                             dgemm('N', 'N', n, n, n, 1.0, a->data(), n, b->data(), n, 0.0,
+                                   c->data(), n);
+                         }});
+        cases.push_back({"dgemm_tn", size, flops, 3 * full, d, [=] {
+                             dgemm('T', 'N', n, n, n, 1.0, a->data(), n, b->data(), n, 0.0,
+                                   c->data(), n);
+                         }});
+        cases.push_back({"dgemmtr", size, flops / 2, 2 * full + half, d, [=] {
+                             dgemmtr(0, 0, 0, n, n, 1.0, a->data(), n, b->data(), n, 0.0,
+                                     c->data(), n);
+                         }});
+        cases.push_back({"dsymm", size, flops, half + 2 * full, d, [=] {
+                             dsymm('L', 'U', n, n, 1.0, a->data(), n, b->data(), n, 0.0,
+                                   c->data(), n);
+                         }});
+        cases.push_back({"dsyrk", size, flops / 2, full + half, d, [=] {
+                             dsyrk('U', 'N', n, n, 1.0, a->data(), n, 0.0, c->data(), n);
+                         }});
+        cases.push_back({"dsyr2k", size, flops, 2 * full + half, d, [=] {
+                             dsyr2k('U', 'N', n, n, 1.0, a->data(), n, b->data(), n, 0.0,
+                                    c->data(), n);
+                         }});
+        cases.push_back({"dtrmm", size, flops / 2, half + 2 * full, d, [=] {
+                             dtrmm('L', 'U', 'N', 'U', n, n, 1.0, a->data(), n, c->data(), n);
+                         }});
+        cases.push_back({"dtrsm", size, flops / 2, half + 2 * full, d, [=] {
+                             dtrsm('L', 'U', 'N', 'U', n, n, 1.0, a->data(), n, c->data(), n);
+                         }});
+
+        auto ah = std::make_shared<std::vector<uint16_t>>(random_bf16(nn));
+        auto bh = std::make_shared<std::vector<uint16_t>>(random_bf16(nn));
+        auto cf = std::make_shared<std::vector<float>>(nn);
+        cases.push_back({"sbgemm", size, flops, 8.0 * nn, Arith::F32, [=] {
+                             sbgemm('N', 'N', n, n, n, 1.0f, ah->data(), n, bh->data(), n, 0.0f,
+                                    cf->data(), n);
+                         }});
+
+        auto a8 = std::make_shared<std::vector<uint8_t>>(random_int<uint8_t>(nn, 0, 255));
+        auto b8 = std::make_shared<std::vector<int8_t>>(random_int<int8_t>(nn, -128, 127));
+        auto c32 = std::make_shared<std::vector<int32_t>>(nn);
+        cases.push_back({"gemm_u8s8s32", size, flops, 6.0 * nn, Arith::INT, [=] {
+                             gemm_u8s8s32('N', 'N', n, n, n, a8->data(), n, 128, b8->data(), n,
+                                          0, c32->data(), n);
+                         }});
+    }
+}
+
+// Many small problems of the same size in one call; each size string is
+// batch x problem
+void add_batch(std::vector<Case>& cases) {
+    const Arith d = Arith::F64;
+    const int elements = 1 << 18;   // of all matrices (or vectors) of a case together
+
+    for (int n : {16, 256}) {
+        int batch = elements / n;
+        auto x = std::make_shared<std::vector<double>>(random_f64(elements));
+        auto y = std::make_shared<std::vector<double>>(random_f64(elements));
+        auto r = std::make_shared<std::vector<double>>(batch);
+        std::string size = std::to_string(batch) + "x" + std::to_string(n);
+        double v = 8.0 * elements;
+        double out = 8.0 * batch;
+        cases.push_back({"ddot_batch", size, 2.0 * elements, 2 * v + out, d, [=] {
+                             ddot_batch_strided(n, x->data(), 1, n, y->data(), 1, n, r->data(),
+                                                batch);
+                         }});
+        cases.push_back({"dnrm2_batch", size, 2.0 * elements, v + out, d, [=] {
+                             dnrm2_batch_strided(n, x->data(), 1, n, r->data(), batch);
+                         }});
+        cases.push_back({"dasum_batch", size, 1.0 * elements, v + out, d, [=] {
+                             dasum_batch_strided(n, x->data(), 1, n, r->data(), batch);
+                         }});
+        cases.push_back({"daxpy_batch", size, 2.0 * elements, 3 * v, d, [=] {
+                             daxpy_batch_strided(n, 1e-9, x->data(), 1, n, y->data(), 1, n,
+                                                 batch);
+                         }});
+        cases.push_back({"dscal_batch", size, 1.0 * elements, 2 * v, d, [=] {
+                             dscal_batch_strided(n, 1.0 - 1e-9, y->data(), 1, n, batch);
+                         }});
+    }
+
+    for (int n : {8, 32, 128}) {
+        int nn = n * n;
+        int batch = elements / nn;
+        auto a = std::make_shared<std::vector<double>>(random_f64(elements));
+        auto x = std::make_shared<std::vector<double>>(random_f64(n * batch));
+        auto y = std::make_shared<std::vector<double>>(random_f64(n * batch));
+        std::string size = std::to_string(batch) + "x" + std::to_string(n) + "x" +
+                           std::to_string(n);
+        double full = 8.0 * elements;
+        double half = 4.0 * elements;
+        double v = 8.0 * n * batch;
+        double flops = 2.0 * elements;
+        cases.push_back({"dgemv_batch", size, flops, full + 2 * v, d, [=] {
+                             dgemv_batch_strided(0, n, n, 1.0, a->data(), n, nn, x->data(), 1, n,
+                                                 0.0, y->data(), 1, n, batch);
+                         }});
+        cases.push_back({"dsymv_batch", size, flops, half + 2 * v, d, [=] {
+                             dsymv_batch_strided('U', n, 1.0, a->data(), n, nn, x->data(), 1, n,
+                                                 0.0, y->data(), 1, n, batch);
+                         }});
+        cases.push_back({"dtrmv_batch", size, flops / 2, half + 2 * v, d, [=] {
+                             dtrmv_batch_strided('U', 'N', 'U', n, a->data(), n, nn, y->data(),
+                                                 1, n, batch);
+                         }});
+        cases.push_back({"dtrsv_batch", size, flops / 2, half + 2 * v, d, [=] {
+                             dtrsv_batch_strided('U', 'N', 'U', n, a->data(), n, nn, y->data(),
+                                                 1, n, batch);
+                         }});
+        cases.push_back({"dger_batch", size, flops, 2 * full + 2 * v, d, [=] {
+                             dger_batch_strided(n, n, 1e-9, x->data(), 1, n, y->data(), 1, n,
+                                                a->data(), n, nn, batch);
+                         }});
+    }
+
+    // dgemm_batch with one group of equally sized problems
+    for (int n : {8, 32, 64}) {
+        int nn = n * n;
+        int batch = elements / nn;
+        auto a = std::make_shared<std::vector<double>>(random_f64(elements));
+        auto b = std::make_shared<std::vector<double>>(random_f64(elements));
+        auto c = std::make_shared<std::vector<double>>(random_f64(elements));
+        auto offsets = std::make_shared<std::vector<int>>(batch);
+        for (int p = 0; p < batch; p++) (*offsets)[p] = p * nn;
+        std::string size = std::to_string(batch) + "x" + std::to_string(n) + "^3";
+        cases.push_back({"dgemm_batch", size, 2.0 * nn * n * batch, 3 * 8.0 * elements, d, [=] {
+                             const int notrans = 'N';
+                             const double one = 1.0, zero = 0.0;
+                             dgemm_batch(1, &batch, &notrans, &notrans, &n, &n, &n, &one,
+                                         a->data(), &n, offsets->data(), b->data(), &n,
+                                         offsets->data(), &zero, c->data(), &n, offsets->data());
+                         }});
+    }
+}
+
+void add_lapack(std::vector<Case>& cases) {
+    const Arith d = Arith::F64;
+    for (int n : {64, 256, 1024}) {
+        size_t nn = static_cast<size_t>(n) * n;
+        auto a = std::make_shared<std::vector<double>>(random_f64(nn));
+        auto b = std::make_shared<std::vector<double>>(random_f64(nn));
+        auto r = std::make_shared<std::vector<double>>(n);
+        std::string size = std::to_string(n) + "x" + std::to_string(n);
+        double full = 8.0 * nn;
+        double v = 8.0 * n;
+        cases.push_back({"dlacpy", size, 0.0, 2 * full, d,
+                         [=] { dlacpy('A', n, n, a->data(), n, b->data(), n); }});
+        cases.push_back({"dlaset", size, 0.0, full, d,
+                         [=] { dlaset('A', n, n, 0.0, 1.0, b->data(), n); }});
+        cases.push_back({"dlascl", size, 1.0 * nn, 2 * full, d,
+                         [=] { dlascl('G', 1.0, 1.0 - 1e-9, n, n, a->data(), n); }});
+        cases.push_back({"dlange", size, 1.0 * nn, full, d, [=] {
+                             volatile double norm = dlange('1', n, n, a->data(), n);
+                             (void)norm;
+                         }});
+        cases.push_back({"dreduce_c", size, 1.0 * nn, full + v, d,
+                         [=] { dreduce('S', 'C', n, n, a->data(), n, r->data()); }});
+        cases.push_back({"dreduce_r", size, 1.0 * nn, full + v, d,
+                         [=] { dreduce('S', 'R', n, n, a->data(), n, r->data()); }});
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool roofline = argc > 1 && std::strcmp(argv[1], "--roofline") == 0;
+    if (roofline) {
+        argc--;
+        argv++;
+    }
+    const char* filter = argc > 1 ? argv[1] : "";
+    double min_seconds = argc > 2 ? std::atof(argv[2]) : 0.2;
+
+    std::vector<Case> cases;
+    add_level1(cases);
+    add_level2(cases);
+    add_level3(cases);
+    add_batch(cases);
+    add_lapack(cases);
+
+    if (!roofline) {
+        std::printf("%-14s %-12s %12s %10s\n", "routine", "size", "time_us", "gflops");
+        for (const Case& c : cases) {
+            if (std::strstr(c.routine.c_str(), filter) == nullptr) continue;
+            double t = measure(c.run, min_seconds);
+            std::printf("%-14s %-12s %12.2f %10.3f\n", c.routine.c_str(), c.size.c_str(),
+                        t * 1e6, c.flops / t * 1e-9);
+            std::fflush(stdout);
+        }
+        return 0;
+    }
+
+    double peak_f64 = peak_flops<double>(min_seconds);
+    double peak_f32 = peak_flops<float>(min_seconds);
+    double bandwidth = triad_bandwidth(min_seconds);
+    std::printf("peak %.2f gflops f64, %.2f gflops f32; triad bandwidth %.2f GB/s; "
+                "ridge point %.2f flop/byte f64\n\n",
+                peak_f64 * 1e-9, peak_f32 * 1e-9, bandwidth * 1e-9, peak_f64 / bandwidth);
+
+    std::printf("%-14s %-12s %12s %10s %10s %8s %12s %8s\n", "routine", "size", "time_us",
+                "gflops", "flop/byte", "bound", "roof_gflops", "roof_%");
+    for (const Case& c : cases) {
+        if (std::strstr(c.routine.c_str(), filter) == nullptr) continue;
+        double t = measure(c.run, min_seconds);
+        double intensity = c.flops / c.bytes;
+        double memory_roof = intensity * bandwidth;
+        double peak = c.arith == Arith::F64 ? peak_f64 : peak_f32;
+        bool memory_bound = memory_roof < peak;
+        double roof = memory_bound ? memory_roof : peak;
+
+        char bound[16] = "-";
+        char roof_gflops[32] = "-";
+        char percent[32] = "-";
+        if (c.flops == 0.0) {
+            std::snprintf(bound, sizeof bound, "memory");
+            std::snprintf(percent, sizeof percent, "%.1f", 100.0 * c.bytes / t / bandwidth);
+        } else if (c.arith != Arith::INT) {
+            std::snprintf(bound, sizeof bound, memory_bound ? "memory" : "compute");
+            std::snprintf(roof_gflops, sizeof roof_gflops, "%.3f", roof * 1e-9);
+            std::snprintf(percent, sizeof percent, "%.1f", 100.0 * c.flops / t / roof);
+        }
+        std::printf("%-14s %-12s %12.2f %10.3f %10.3f %8s %12s %8s\n", c.routine.c_str(),
+                    c.size.c_str(), t * 1e6, c.flops / t * 1e-9, intensity, bound, roof_gflops,
+                    percent);
+        std::fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,739 @@
+/**
+ * Comparison with other BLAS implementations
+ *
+ * Runs the same cases through up to three implementations of the BLAS and
+ * prints one line per routine and size:
+ *
+ *   routine  size  ref_us  cpp_us  openblas_us  vs_ref  vs_openblas  max_diff
+ *
+ * - ref:      the netlib sources in reference/double, compiled with gfortran
+ * - cpp:      the kernels in src/cpp, through the C API in blas.h
+ * - openblas: a system OpenBLAS found at configure time (column left empty
+ *             otherwise), restricted to one thread like the kernels here.
+ *             It exports the same Fortran symbols as the reference build, so
+ *             it is loaded with dlopen() instead of being linked.
+ *
+ * Times are the best of repeated calls, with the output operand restored
+ * before each call. vs_ref and vs_openblas are the speedups of the C++
+ * kernels (the other time divided by cpp_us). max_diff is the largest
+ * difference of the cpp and openblas results from the reference, relative to
+ * the largest element of the reference result; cases above TOLERANCE are
+ * marked MISMATCH and make the exit status 1. The last lines give the
+ * geometric mean of each speedup.
+ *
+ * Built natively as blas-compare when a Fortran compiler is available.
+ *
+ * Usage: blas-compare [filter] [min_seconds]
+ *   filter       only run routines whose name contains this string
+ *   min_seconds  minimum measuring time per case and implementation (default 0.2)
+ */
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cctype>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/cpp/blas.h"
+
+// Fortran BLAS interface: every argument by reference, followed by one
+// hidden length per character argument. Defined by the reference build (and
+// by OpenBLAS, which is loaded separately)
+extern "C" {
+void daxpy_(const int* n, const double* alpha, const double* x, const int* incx, double* y,
+            const int* incy);
+double ddot_(const int* n, const double* x, const int* incx, const double* y, const int* incy);
+double dnrm2_(const int* n, const double* x, const int* incx);
+double dasum_(const int* n, const double* x, const int* incx);
+void dscal_(const int* n, const double* alpha, double* x, const int* incx);
+void dcopy_(const int* n, const double* x, const int* incx, double* y, const int* incy);
+void dswap_(const int* n, double* x, const int* incx, double* y, const int* incy);
+void drot_(const int* n, double* x, const int* incx, double* y, const int* incy, const double* c,
+           const double* s);
+void drotm_(const int* n, double* x, const int* incx, double* y, const int* incy,
+            const double* param);
+void daxpby_(const int* n, const double* alpha, const double* x, const int* incx,
+             const double* beta, double* y, const int* incy);
+void dgemv_(const char* trans, const int* m, const int* n, const double* alpha, const double* a,
+            const int* lda, const double* x, const int* incx, const double* beta, double* y,
+            const int* incy, size_t);
+void dgbmv_(const char* trans, const int* m, const int* n, const int* kl, const int* ku,
+            const double* alpha, const double* a, const int* lda, const double* x, const int* incx,
+            const double* beta, double* y, const int* incy, size_t);
+void dsbmv_(const char* uplo, const int* n, const int* k, const double* alpha, const double* a,
+            const int* lda, const double* x, const int* incx, const double* beta, double* y,
+            const int* incy, size_t);
+void dspmv_(const char* uplo, const int* n, const double* alpha, const double* ap, const double* x,
+            const int* incx, const double* beta, double* y, const int* incy, size_t);
+void dsymv_(const char* uplo, const int* n, const double* alpha, const double* a, const int* lda,
+            const double* x, const int* incx, const double* beta, double* y, const int* incy,
+            size_t);
+void dger_(const int* m, const int* n, const double* alpha, const double* x, const int* incx,
+           const double* y, const int* incy, double* a, const int* lda);
+void dsyr_(const char* uplo, const int* n, const double* alpha, const double* x, const int* incx,
+           double* a, const int* lda, size_t);
+void dsyr2_(const char* uplo, const int* n, const double* alpha, const double* x, const int* incx,
+            const double* y, const int* incy, double* a, const int* lda, size_t);
+void dspr_(const char* uplo, const int* n, const double* alpha, const double* x, const int* incx,
+           double* ap, size_t);
+void dspr2_(const char* uplo, const int* n, const double* alpha, const double* x, const int* incx,
+            const double* y, const int* incy, double* ap, size_t);
+void dtrmv_(const char* uplo, const char* trans, const char* diag, const int* n, const double* a,
+            const int* lda, double* x, const int* incx, size_t, size_t, size_t);
+void dtbmv_(const char* uplo, const char* trans, const char* diag, const int* n, const int* k,
+            const double* a, const int* lda, double* x, const int* incx, size_t, size_t, size_t);
+void dtbsv_(const char* uplo, const char* trans, const char* diag, const int* n, const int* k,
+            const double* a, const int* lda, double* x, const int* incx, size_t, size_t, size_t);
+void dtpmv_(const char* uplo, const char* trans, const char* diag, const int* n, const double* ap,
+            double* x, const int* incx, size_t, size_t, size_t);
+void dtpsv_(const char* uplo, const char* trans, const char* diag, const int* n, const double* ap,
+            double* x, const int* incx, size_t, size_t, size_t);
+void dtrsv_(const char* uplo, const char* trans, const char* diag, const int* n, const double* a,
+            const int* lda, double* x, const int* incx, size_t, size_t, size_t);
+void dgemm_(const char* transa, const char* transb, const int* m, const int* n, const int* k,
+            const double* alpha, const double* a, const int* lda, const double* b, const int* ldb,
+            const double* beta, double* c, const int* ldc, size_t, size_t);
+void dgemmtr_(const char* uplo, const char* transa, const char* transb, const int* n,
+              const int* k, const double* alpha, const double* a, const int* lda, const double* b,
+              const int* ldb, const double* beta, double* c, const int* ldc, size_t, size_t,
+              size_t);
+void dsyrk_(const char* uplo, const char* trans, const int* n, const int* k, const double* alpha,
+            const double* a, const int* lda, const double* beta, double* c, const int* ldc, size_t,
+            size_t);
+void dsyr2k_(const char* uplo, const char* trans, const int* n, const int* k, const double* alpha,
+             const double* a, const int* lda, const double* b, const int* ldb, const double* beta,
+             double* c, const int* ldc, size_t, size_t);
+void dsymm_(const char* side, const char* uplo, const int* m, const int* n, const double* alpha,
+            const double* a, const int* lda, const double* b, const int* ldb, const double* beta,
+            double* c, const int* ldc, size_t, size_t);
+void dtrmm_(const char* side, const char* uplo, const char* transa, const char* diag, const int* m,
+            const int* n, const double* alpha, const double* a, const int* lda, double* b,
+            const int* ldb, size_t, size_t, size_t, size_t);
+void dtrsm_(const char* side, const char* uplo, const char* transa, const char* diag, const int* m,
+            const int* n, const double* alpha, const double* a, const int* lda, double* b,
+            const int* ldb, size_t, size_t, size_t, size_t);
+
+// LSAME and XERBLA, which reference/double leaves to the caller
+
+int lsame_(const char* ca, const char* cb, size_t, size_t) {
+    return std::toupper(static_cast<unsigned char>(*ca)) ==
+           std::toupper(static_cast<unsigned char>(*cb));
+}
+
+void xerbla_(const char* srname, const int* info, size_t len) {
+    std::fprintf(stderr, " ** On entry to %.*s parameter number %d had an illegal value\n",
+                 static_cast<int>(len), srname, *info);
+    std::exit(2);
+}
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Largest relative difference from the reference still counted as agreement
+const double TOLERANCE = 1e-10;
+
+// One Fortran BLAS implementation
+struct Fortran {
+    decltype(&daxpy_) daxpy;
+    decltype(&ddot_) ddot;
+    decltype(&dnrm2_) dnrm2;
+    decltype(&dasum_) dasum;
+    decltype(&dscal_) dscal;
+    decltype(&dcopy_) dcopy;
+    decltype(&dswap_) dswap;
+    decltype(&drot_) drot;
+    decltype(&drotm_) drotm;
+    decltype(&daxpby_) daxpby;
+    decltype(&dgemv_) dgemv;
+    decltype(&dgbmv_) dgbmv;
+    decltype(&dsymv_) dsymv;
+    decltype(&dsbmv_) dsbmv;
+    decltype(&dspmv_) dspmv;
+    decltype(&dger_) dger;
+    decltype(&dsyr_) dsyr;
+    decltype(&dsyr2_) dsyr2;
+    decltype(&dspr_) dspr;
+    decltype(&dspr2_) dspr2;
+    decltype(&dtrmv_) dtrmv;
+    decltype(&dtrsv_) dtrsv;
+    decltype(&dtbmv_) dtbmv;
+    decltype(&dtbsv_) dtbsv;
+    decltype(&dtpmv_) dtpmv;
+    decltype(&dtpsv_) dtpsv;
+    decltype(&dgemm_) dgemm;
+    decltype(&dgemmtr_) dgemmtr;  // Missing from OpenBLAS before 0.3.27
+    decltype(&dsyrk_) dsyrk;
+    decltype(&dsyr2k_) dsyr2k;
+    decltype(&dsymm_) dsymm;
+    decltype(&dtrmm_) dtrmm;
+    decltype(&dtrsm_) dtrsm;
+};
+
+const Fortran reference = {
+    daxpy_, ddot_,  dnrm2_, dasum_, dscal_, dcopy_,   dswap_, drot_,   drotm_, daxpby_, dgemv_,
+    dgbmv_, dsymv_, dsbmv_, dspmv_, dger_,  dsyr_,    dsyr2_, dspr_,   dspr2_, dtrmv_,  dtrsv_,
+    dtbmv_, dtbsv_, dtpmv_, dtpsv_, dgemm_, dgemmtr_, dsyrk_, dsyr2k_, dsymm_, dtrmm_,  dtrsm_};
+
+template <typename T>
+bool load(void* lib, const char* name, T& f) {
+    f = reinterpret_cast<T>(dlsym(lib, name));
+    return f != nullptr;
+}
+
+// The system OpenBLAS, or false if there is none
+bool load_openblas(Fortran& f) {
+#ifdef BLAS_COMPARE_OPENBLAS
+    void* lib = dlopen(BLAS_COMPARE_OPENBLAS, RTLD_NOW | RTLD_LOCAL);
+    if (lib == nullptr) {
+        std::fprintf(stderr, "cannot load %s: %s\n", BLAS_COMPARE_OPENBLAS, dlerror());
+        return false;
+    }
+    void (*set_num_threads)(int) = nullptr;
+    if (load(lib, "openblas_set_num_threads", set_num_threads)) set_num_threads(1);
+    if (!load(lib, "dgemmtr_", f.dgemmtr)) load(lib, "dgemmt_", f.dgemmtr);
+    return load(lib, "daxpy_", f.daxpy) && load(lib, "ddot_", f.ddot) &&
+           load(lib, "dnrm2_", f.dnrm2) && load(lib, "dasum_", f.dasum) &&
+           load(lib, "dscal_", f.dscal) && load(lib, "dcopy_", f.dcopy) &&
+           load(lib, "dswap_", f.dswap) && load(lib, "drot_", f.drot) &&
+           load(lib, "drotm_", f.drotm) && load(lib, "daxpby_", f.daxpby) &&
+           load(lib, "dgemv_", f.dgemv) && load(lib, "dgbmv_", f.dgbmv) &&
+           load(lib, "dsymv_", f.dsymv) && load(lib, "dsbmv_", f.dsbmv) &&
+           load(lib, "dspmv_", f.dspmv) && load(lib, "dger_", f.dger) &&
+           load(lib, "dsyr_", f.dsyr) && load(lib, "dsyr2_", f.dsyr2) &&
+           load(lib, "dspr_", f.dspr) && load(lib, "dspr2_", f.dspr2) &&
+           load(lib, "dtrmv_", f.dtrmv) && load(lib, "dtrsv_", f.dtrsv) &&
+           load(lib, "dtbmv_", f.dtbmv) && load(lib, "dtbsv_", f.dtbsv) &&
+           load(lib, "dtpmv_", f.dtpmv) && load(lib, "dtpsv_", f.dtpsv) &&
+           load(lib, "dgemm_", f.dgemm) && load(lib, "dsyrk_", f.dsyrk) &&
+           load(lib, "dsyr2k_", f.dsyr2k) && load(lib, "dsymm_", f.dsymm) &&
+           load(lib, "dtrmm_", f.dtrmm) && load(lib, "dtrsm_", f.dtrsm);
+#else
+    (void)f;
+    return false;
+#endif
+}
+
+// A call of one routine. run(f, out) calls implementation f (nullptr: the
+// C++ kernels) with `out` as the output operand, which starts as `init`;
+// routines returning a scalar store it in out[0]
+struct Case {
+    std::string routine;
+    std::string size;
+    std::vector<double> init;
+    std::function<void(const Fortran*, double*)> run;
+    // Whether implementation f has the routine; null if all have it
+    bool (*available)(const Fortran& f) = nullptr;
+};
+
+std::mt19937 rng(42);
+
+std::vector<double> random_f64(size_t n) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> v(n);
+    for (double& x : v) x = dist(rng);
+    return v;
+}
+
+// Random n x n matrix with a dominant diagonal, well conditioned for the solvers
+std::shared_ptr<std::vector<double>> triangular(int n) {
+    auto a = std::make_shared<std::vector<double>>(random_f64(static_cast<size_t>(n) * n));
+    for (int i = 0; i < n; i++) (*a)[i + static_cast<size_t>(i) * n] += n;
+    return a;
+}
+
+// Random n x n triangular band with k off-diagonals (lda = k + 1) and a
+// dominant diagonal
+std::shared_ptr<std::vector<double>> triangular_band(int n, int k, bool upper) {
+    auto a = std::make_shared<std::vector<double>>(random_f64(static_cast<size_t>(k + 1) * n));
+    for (int j = 0; j < n; j++) (*a)[(upper ? k : 0) + static_cast<size_t>(j) * (k + 1)] += n;
+    return a;
+}
+
+// Random packed n x n triangle with a dominant diagonal
+std::shared_ptr<std::vector<double>> triangular_packed(int n, bool upper) {
+    size_t np = static_cast<size_t>(n) * (n + 1) / 2;
+    auto a = std::make_shared<std::vector<double>>(random_f64(np));
+    size_t p = 0;
+    for (int j = 0; j < n; j++) {
+        (*a)[upper ? p + j : p] += n;
+        p += upper ? j + 1 : n - j;
+    }
+    return a;
+}
+
+std::shared_ptr<std::vector<double>> shared(std::vector<double> v) {
+    return std::make_shared<std::vector<double>>(std::move(v));
+}
+
+// Best time of a single call in seconds, restoring the output before each
+double measure(const Case& c, const Fortran* f, std::vector<double>& out, double min_seconds) {
+    double best = 1e30;
+    double total = 0.0;
+    do {
+        std::copy(c.init.begin(), c.init.end(), out.begin());
+        auto t0 = Clock::now();
+        c.run(f, out.data());
+        double t = std::chrono::duration<double>(Clock::now() - t0).count();
+        total += t;
+        best = std::min(best, t);
+    } while (total < min_seconds);
+    return best;
+}
+
+void add_level1(std::vector<Case>& cases) {
+    const int inc = 1;
+    for (int n : {1000, 100000, 1000000}) {
+        auto x = shared(random_f64(n));
+        auto y = shared(random_f64(n));
+        std::string size = std::to_string(n);
+        cases.push_back({"daxpy", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             const double alpha = 0.5;
+                             if (f) {
+                                 f->daxpy(&n, &alpha, x->data(), &inc, out, &inc);
+                             } else {
+                                 daxpy(n, alpha, x->data(), 1, out, 1);
+                             }
+                         }});
+        cases.push_back({"ddot", size, {0.0}, [=](const Fortran* f, double* out) {
+                             out[0] = f ? f->ddot(&n, x->data(), &inc, y->data(), &inc)
+                                        : ddot(n, x->data(), 1, y->data(), 1);
+                         }});
+        cases.push_back({"dnrm2", size, {0.0}, [=](const Fortran* f, double* out) {
+                             out[0] = f ? f->dnrm2(&n, x->data(), &inc) : dnrm2(n, x->data(), 1);
+                         }});
+        cases.push_back({"dasum", size, {0.0}, [=](const Fortran* f, double* out) {
+                             out[0] = f ? f->dasum(&n, x->data(), &inc) : dasum(n, x->data(), 1);
+                         }});
+        cases.push_back({"dscal", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             const double alpha = 0.5;
+                             if (f) {
+                                 f->dscal(&n, &alpha, out, &inc);
+                             } else {
+                                 dscal(n, alpha, out, 1);
+                             }
+                         }});
+        cases.push_back({"dcopy", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dcopy(&n, x->data(), &inc, out, &inc);
+                             } else {
+                                 dcopy(n, x->data(), 1, out, 1);
+                             }
+                         }});
+        cases.push_back({"daxpby", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             const double alpha = 0.5;
+                             const double beta = -2.0;
+                             if (f) {
+                                 f->daxpby(&n, &alpha, x->data(), &inc, &beta, out, &inc);
+                             } else {
+                                 daxpby(n, alpha, x->data(), 1, beta, out, 1);
+                             }
+                         }});
+
+        // The two-vector routines update both halves of out
+        cases.push_back({"dswap", size, random_f64(2 * n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dswap(&n, out, &inc, out + n, &inc);
+                             } else {
+                                 dswap(n, out, 1, out + n, 1);
+                             }
+                         }});
+        cases.push_back({"drot", size, random_f64(2 * n), [=](const Fortran* f, double* out) {
+                             const double c = 0.6;
+                             const double s = 0.8;
+                             if (f) {
+                                 f->drot(&n, out, &inc, out + n, &inc, &c, &s);
+                             } else {
+                                 drot(n, out, 1, out + n, 1, c, s);
+                             }
+                         }});
+        cases.push_back({"drotm", size, random_f64(2 * n), [=](const Fortran* f, double* out) {
+                             // Full H (flag -1): h11, h21, h12, h22
+                             const double param[5] = {-1.0, 0.6, -0.8, 0.8, 0.6};
+                             if (f) {
+                                 f->drotm(&n, out, &inc, out + n, &inc, param);
+                             } else {
+                                 drotm(n, out, 1, out + n, 1, param);
+                             }
+                         }});
+    }
+}
+
+void add_level2(std::vector<Case>& cases) {
+    const int inc = 1;
+    const double one = 1.0;
+    const double half = 0.5;
+    for (int n : {256, 1024}) {
+        size_t nn = static_cast<size_t>(n) * n;
+        auto a = shared(random_f64(nn));
+        auto t = triangular(n);
+        auto x = shared(random_f64(n));
+        auto y = shared(random_f64(n));
+        // General band with k sub- and superdiagonals, symmetric band and packed
+        // triangles use its leading rows and a's leading elements
+        const int k = 16;
+        const int ldband = 2 * k + 1;
+        auto band = shared(random_f64(static_cast<size_t>(ldband) * n));
+        size_t np = static_cast<size_t>(n) * (n + 1) / 2;
+        std::string size = std::to_string(n) + "x" + std::to_string(n);
+        cases.push_back({"dgemv_n", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dgemv("N", &n, &n, &one, a->data(), &n, x->data(), &inc, &half,
+                                          out, &inc, 1);
+                             } else {
+                                 dgemv(0, n, n, 1.0, a->data(), n, x->data(), 1, 0.5, out, 1);
+                             }
+                         }});
+        cases.push_back({"dgemv_t", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dgemv("T", &n, &n, &one, a->data(), &n, x->data(), &inc, &half,
+                                          out, &inc, 1);
+                             } else {
+                                 dgemv(1, n, n, 1.0, a->data(), n, x->data(), 1, 0.5, out, 1);
+                             }
+                         }});
+        cases.push_back({"dsymv", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dsymv("U", &n, &one, a->data(), &n, x->data(), &inc, &half, out,
+                                          &inc, 1);
+                             } else {
+                                 dsymv('U', n, 1.0, a->data(), n, x->data(), 1, 0.5, out, 1);
+                             }
+                         }});
+        cases.push_back({"dger", size, random_f64(nn), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dger(&n, &n, &half, x->data(), &inc, y->data(), &inc, out, &n);
+                             } else {
+                                 dger(n, n, 0.5, x->data(), 1, y->data(), 1, out, n);
+                             }
+                         }});
+        cases.push_back({"dtrsv", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dtrsv("U", "N", "N", &n, t->data(), &n, out, &inc, 1, 1, 1);
+                             } else {
+                                 dtrsv('U', 'N', 'N', n, t->data(), n, out, 1);
+                             }
+                         }});
+        cases.push_back({"dgbmv_n", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dgbmv("N", &n, &n, &k, &k, &one, band->data(), &ldband,
+                                          x->data(), &inc, &half, out, &inc, 1);
+                             } else {
+                                 dgbmv(0, n, n, k, k, 1.0, band->data(), ldband, x->data(), 1, 0.5,
+                                       out, 1);
+                             }
+                         }});
+        cases.push_back({"dgbmv_t", size, random_f64(n), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dgbmv("T", &n, &n, &k, &k, &one, band->data(), &ldband,
+                                          x->data(), &inc, &half, out, &inc, 1);
+                             } else {
+                                 dgbmv(1, n, n, k, k, 1.0, band->data(), ldband, x->data(), 1, 0.5,
+                                       out, 1);
+                             }
+                         }});
+
+        // Both triangles of the symmetric routines, as their flags are coded
+        // differently in blas.h (0/1 for the band and packed ones)
+        for (int lower : {0, 1}) {
+            const char* uplo = lower ? "L" : "U";
+            const char cuplo = *uplo;
+            const std::string tri = lower ? "_l" : "_u";
+            const int ldsb = k + 1;
+            cases.push_back({"dsbmv" + tri, size, random_f64(n),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dsbmv(uplo, &n, &k, &one, band->data(), &ldsb, x->data(),
+                                              &inc, &half, out, &inc, 1);
+                                 } else {
+                                     dsbmv(lower, n, k, 1.0, band->data(), ldsb, x->data(), 1, 0.5,
+                                           out, 1);
+                                 }
+                             }});
+            cases.push_back({"dspmv" + tri, size, random_f64(n),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dspmv(uplo, &n, &one, a->data(), x->data(), &inc, &half,
+                                              out, &inc, 1);
+                                 } else {
+                                     dspmv(lower, n, 1.0, a->data(), x->data(), 1, 0.5, out, 1);
+                                 }
+                             }});
+            cases.push_back({"dsyr" + tri, size, random_f64(nn),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dsyr(uplo, &n, &half, x->data(), &inc, out, &n, 1);
+                                 } else {
+                                     dsyr(cuplo, n, 0.5, x->data(), 1, out, n);
+                                 }
+                             }});
+            cases.push_back({"dsyr2" + tri, size, random_f64(nn),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dsyr2(uplo, &n, &half, x->data(), &inc, y->data(), &inc,
+                                              out, &n, 1);
+                                 } else {
+                                     dsyr2(cuplo, n, 0.5, x->data(), 1, y->data(), 1, out, n);
+                                 }
+                             }});
+            cases.push_back({"dspr" + tri, size, random_f64(np),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dspr(uplo, &n, &half, x->data(), &inc, out, 1);
+                                 } else {
+                                     dspr(lower, n, 0.5, x->data(), 1, out);
+                                 }
+                             }});
+            cases.push_back({"dspr2" + tri, size, random_f64(np),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dspr2(uplo, &n, &half, x->data(), &inc, y->data(), &inc,
+                                              out, 1);
+                                 } else {
+                                     dspr2(lower, n, 0.5, x->data(), 1, y->data(), 1, out);
+                                 }
+                             }});
+        }
+
+        // Triangular routines: upper without and lower with transpose
+        for (int lower : {0, 1}) {
+            const char* uplo = lower ? "L" : "U";
+            const char* trans = lower ? "T" : "N";
+            const char cuplo = *uplo;
+            const char ctrans = *trans;
+            const std::string tri = lower ? "_lt" : "_un";
+            const int ldtb = k + 1;
+            auto tb = triangular_band(n, k, !lower);
+            auto tp = triangular_packed(n, !lower);
+            cases.push_back({"dtrmv" + tri, size, random_f64(n),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dtrmv(uplo, trans, "N", &n, t->data(), &n, out, &inc, 1, 1,
+                                              1);
+                                 } else {
+                                     dtrmv(cuplo, ctrans, 'N', n, t->data(), n, out, 1);
+                                 }
+                             }});
+            cases.push_back({"dtbmv" + tri, size, random_f64(n),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dtbmv(uplo, trans, "N", &n, &k, tb->data(), &ldtb, out,
+                                              &inc, 1, 1, 1);
+                                 } else {
+                                     dtbmv(lower, lower, 0, n, k, tb->data(), ldtb, out, 1);
+                                 }
+                             }});
+            cases.push_back({"dtbsv" + tri, size, random_f64(n),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dtbsv(uplo, trans, "N", &n, &k, tb->data(), &ldtb, out,
+                                              &inc, 1, 1, 1);
+                                 } else {
+                                     dtbsv(lower, lower, 0, n, k, tb->data(), ldtb, out, 1);
+                                 }
+                             }});
+            cases.push_back({"dtpmv" + tri, size, random_f64(n),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dtpmv(uplo, trans, "N", &n, tp->data(), out, &inc, 1, 1, 1);
+                                 } else {
+                                     dtpmv(lower, lower, 0, n, tp->data(), out, 1);
+                                 }
+                             }});
+            cases.push_back({"dtpsv" + tri, size, random_f64(n),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dtpsv(uplo, trans, "N", &n, tp->data(), out, &inc, 1, 1, 1);
+                                 } else {
+                                     dtpsv(lower, lower, 0, n, tp->data(), out, 1);
+                                 }
+                             }});
+        }
+    }
+}
+
+void add_level3(std::vector<Case>& cases) {
+    const double one = 1.0;
+    const double half = 0.5;
+    for (int n : {64, 256, 512}) {
+        size_t nn = static_cast<size_t>(n) * n;
+        auto a = shared(random_f64(nn));
+        auto b = shared(random_f64(nn));
+        auto t = triangular(n);
+        std::string size = std::to_string(n) + "^3";
+        cases.push_back({"dgemm_nn", size, random_f64(nn), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dgemm("N", "N", &n, &n, &n, &one, a->data(), &n, b->data(), &n,
+                                          &half, out, &n, 1, 1);
+                             } else {
+                                 dgemm('N', 'N', n, n, n, 1.0, a->data(), n, b->data(), n, 0.5, out,
+                                       n);
+                             }
+                         }});
+        cases.push_back({"dgemm_tn", size, random_f64(nn), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dgemm("T", "N", &n, &n, &n, &one, a->data(), &n, b->data(), &n,
+                                          &half, out, &n, 1, 1);
+                             } else {
+                                 dgemm('T', 'N', n, n, n, 1.0, a->data(), n, b->data(), n, 0.5, out,
+                                       n);
+                             }
+                         }});
+        cases.push_back({"dsyrk", size, random_f64(nn), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dsyrk("U", "N", &n, &n, &one, a->data(), &n, &half, out, &n, 1,
+                                          1);
+                             } else {
+                                 dsyrk('U', 'N', n, n, 1.0, a->data(), n, 0.5, out, n);
+                             }
+                         }});
+        cases.push_back({"dsymm", size, random_f64(nn), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dsymm("L", "U", &n, &n, &one, a->data(), &n, b->data(), &n,
+                                          &half, out, &n, 1, 1);
+                             } else {
+                                 dsymm('L', 'U', n, n, 1.0, a->data(), n, b->data(), n, 0.5, out,
+                                       n);
+                             }
+                         }});
+        cases.push_back({"dtrmm", size, random_f64(nn), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dtrmm("L", "U", "N", "N", &n, &n, &one, t->data(), &n, out, &n,
+                                          1, 1, 1, 1);
+                             } else {
+                                 dtrmm('L', 'U', 'N', 'N', n, n, 1.0, t->data(), n, out, n);
+                             }
+                         }});
+        cases.push_back({"dtrsm", size, random_f64(nn), [=](const Fortran* f, double* out) {
+                             if (f) {
+                                 f->dtrsm("L", "U", "N", "N", &n, &n, &one, t->data(), &n, out, &n,
+                                          1, 1, 1, 1);
+                             } else {
+                                 dtrsm('L', 'U', 'N', 'N', n, n, 1.0, t->data(), n, out, n);
+                             }
+                         }});
+
+        // Upper triangle without and lower with transpose
+        for (int lower : {0, 1}) {
+            const char* uplo = lower ? "L" : "U";
+            const char* trans = lower ? "T" : "N";
+            const char cuplo = *uplo;
+            const char ctrans = *trans;
+            const std::string tri = lower ? "_lt" : "_un";
+            cases.push_back({"dsyr2k" + tri, size, random_f64(nn),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dsyr2k(uplo, trans, &n, &n, &one, a->data(), &n, b->data(),
+                                               &n, &half, out, &n, 1, 1);
+                                 } else {
+                                     dsyr2k(cuplo, ctrans, n, n, 1.0, a->data(), n, b->data(), n,
+                                            0.5, out, n);
+                                 }
+                             }});
+            cases.push_back({"dgemmtr" + tri, size, random_f64(nn),
+                             [=](const Fortran* f, double* out) {
+                                 if (f) {
+                                     f->dgemmtr(uplo, trans, "N", &n, &n, &one, a->data(), &n,
+                                                b->data(), &n, &half, out, &n, 1, 1, 1);
+                                 } else {
+                                     dgemmtr(lower, lower, 0, n, n, 1.0, a->data(), n, b->data(), n,
+                                             0.5, out, n);
+                                 }
+                             },
+                             [](const Fortran& f) { return f.dgemmtr != nullptr; }});
+        }
+    }
+}
+
+// Largest difference of x from the reference r, relative to max |r|
+double max_diff(const std::vector<double>& x, const std::vector<double>& r) {
+    double diff = 0.0;
+    double scale = 0.0;
+    for (size_t i = 0; i < r.size(); i++) {
+        diff = std::max(diff, std::fabs(x[i] - r[i]));
+        scale = std::max(scale, std::fabs(r[i]));
+    }
+    return scale > 0.0 ? diff / scale : diff;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : "";
+    double min_seconds = argc > 2 ? std::atof(argv[2]) : 0.2;
+
+    Fortran openblas_impl;
+    const Fortran* openblas = load_openblas(openblas_impl) ? &openblas_impl : nullptr;
+
+    std::vector<Case> cases;
+    add_level1(cases);
+    add_level2(cases);
+    add_level3(cases);
+
+    std::printf("%-10s %-11s %11s %11s %11s %8s %11s %10s\n", "routine", "size", "ref_us",
+                "cpp_us", "openblas_us", "vs_ref", "vs_openblas", "max_diff");
+    bool agree = true;
+    double log_vs_ref = 0.0;
+    double log_vs_openblas = 0.0;
+    int count = 0;
+    int count_openblas = 0;
+    for (const Case& c : cases) {
+        if (std::strstr(c.routine.c_str(), filter) == nullptr) continue;
+
+        // Results of one call each
+        std::vector<double> ref = c.init;
+        c.run(&reference, ref.data());
+        std::vector<double> out = c.init;
+        c.run(nullptr, out.data());
+        double diff = max_diff(out, ref);
+        const Fortran* other = openblas && (!c.available || c.available(*openblas)) ? openblas
+                                                                                    : nullptr;
+        if (other) {
+            std::vector<double> ob = c.init;
+            c.run(other, ob.data());
+            diff = std::max(diff, max_diff(ob, ref));
+        }
+
+        double t_ref = measure(c, &reference, out, min_seconds);
+        double t_cpp = measure(c, nullptr, out, min_seconds);
+        log_vs_ref += std::log(t_ref / t_cpp);
+        count++;
+
+        char openblas_us[32] = "-";
+        char vs_openblas[32] = "-";
+        if (other) {
+            double t_ob = measure(c, other, out, min_seconds);
+            log_vs_openblas += std::log(t_ob / t_cpp);
+            count_openblas++;
+            std::snprintf(openblas_us, sizeof openblas_us, "%.2f", t_ob * 1e6);
+            std::snprintf(vs_openblas, sizeof vs_openblas, "%.2f", t_ob / t_cpp);
+        }
+
+        bool ok = diff <= TOLERANCE;
+        agree = agree && ok;
+        std::printf("%-10s %-11s %11.2f %11.2f %11s %8.2f %11s %10.1e%s\n", c.routine.c_str(),
+                    c.size.c_str(), t_ref * 1e6, t_cpp * 1e6, openblas_us, t_ref / t_cpp,
+                    vs_openblas, diff, ok ? "" : "  MISMATCH");
+        std::fflush(stdout);
+    }
+
+    if (count > 0) {
+        std::printf("\ngeometric mean speedup: %.2f over ref", std::exp(log_vs_ref / count));
+        if (count_openblas > 0) {
+            std::printf(", %.2f over openblas", std::exp(log_vs_openblas / count_openblas));
+        }
+        std::printf("\n");
+    }
+    return agree ? 0 : 1;
+}
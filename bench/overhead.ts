@@ -0,0 +1,682 @@
+/**
+ * Binding overhead microbenchmark
+ *
+ * Times each phase of a call through the BLAS functions of src/ on the
+ * WebAssembly backend, for operands of 1 to 10^6 elements (the size is the
+ * element count of the largest operand):
+ *
+ *   validate  argument checks, up to the first allocation
+ *   malloc    _malloc / _malloc_aligned
+ *   copy_in   packing the operands into the heap (HEAPF64.set and friends)
+ *   kernel    the call into WebAssembly, boundary crossing included
+ *   copy_out  copying the results back (subarray().set)
+ *   free      _free
+ *   other     everything after the first _free
+ *
+ * The phases are told apart by timestamps taken around every call of the
+ * module's exports, less the calibrated cost of a timestamp. A phase is the
+ * mean over the faster half of the calls at that size.
+ *
+ * The summary gives, per function, the fixed overhead (the least time spent
+ * outside the kernel at sizes up to 10) and the crossover: the smallest size at which the
+ * kernel takes longer than the rest of the call. `--json file` saves the
+ * summary; `--baseline file` compares with a saved one and exits with status
+ * 1 if a fixed overhead grew by more than 25% and 0.5 us, so that
+ * regressions in the binding layer fail CI. Every BLAS function exported by
+ * src/index must have an entry in BENCHES; the benchmark refuses to run
+ * otherwise.
+ *
+ * Usage (after npm run build):
+ *   node -r ts-node/register bench/overhead.ts [filter] [--json out.json] [--baseline in.json]
+ */
+
+import { readFileSync, writeFileSync } from 'fs';
+import * as blas from '../src/index';
+import { BlasModule, KronFactor, LinearOperator } from '../src/index';
+import * as memory from '../src/memory';
+import * as raw from '../src/raw';
+import * as trace from '../src/trace';
+import {
+  Axis,
+  Diagonal,
+  MatrixType,
+  Norm,
+  Reduction,
+  Side,
+  Transpose,
+  Triangular,
+  Which,
+} from '../src/types';
+import * as wasmModule from '../src/wasm-module';
+
+const SIZES = [1, 3, 10, 30, 100, 300, 1e3, 3e3, 1e4, 3e4, 1e5, 3e5, 1e6];
+
+// Largest size whose time outside the kernel counts as fixed overhead
+const FIXED_SIZE = 10;
+
+// Growth of a fixed overhead over the baseline reported as a regression:
+// more than REGRESSION_RATIO times and REGRESSION_US microseconds
+const REGRESSION_RATIO = 1.25;
+const REGRESSION_US = 0.5;
+
+// Measuring and warm-up time per function and size, and the number of calls
+const MIN_SECONDS = 0.05;
+const MIN_CALLS = 3;
+const MAX_CALLS = 20000;
+const WARMUP_SECONDS = 0.01;
+
+const PHASES = ['validate', 'malloc', 'copy_in', 'kernel', 'copy_out', 'free', 'other'] as const;
+type Phase = (typeof PHASES)[number];
+type Phases = Record<Phase, number>;
+
+/** Summary of one function, as saved by --json */
+interface Summary {
+  /** Microseconds spent outside the kernel, least over sizes up to FIXED_SIZE */
+  overhead: number;
+  /** Smallest size at which the kernel dominates, null if none */
+  crossover: number | null;
+}
+
+// A call under test, or a call with a reset of the operands it overwrites,
+// run before each call outside the timing
+type Call = (() => unknown) | { call: () => unknown; reset: () => void };
+
+// A function under test: setup(size) prepares operands whose largest has
+// about `size` elements and returns the call
+interface Bench {
+  name: string;
+  setup: (size: number) => Call;
+}
+
+const N = Transpose.NoTranspose;
+const U = Triangular.Upper;
+
+const f64 = (n: number) => Float64Array.from({ length: n }, () => Math.random() - 0.5);
+const f32 = (n: number) => Float32Array.from({ length: n }, () => Math.random() - 0.5);
+const u16 = (n: number) => new Uint16Array(n).fill(0x3f80); // 1.0 in bfloat16 and ~1.9 in fp16
+const u8 = (n: number) => Uint8Array.from({ length: n }, () => Math.random() * 256);
+const i8 = (n: number) => Int8Array.from({ length: n }, () => Math.random() * 256 - 128);
+const list = (count: number, make: () => Float64Array) => Array.from({ length: count }, make);
+
+// Order of a square matrix and of a packed triangle of about `size` elements
+const order = (size: number) => Math.max(1, Math.round(Math.sqrt(size)));
+const packedOrder = (size: number) => Math.max(1, Math.floor((Math.sqrt(8 * size + 1) - 1) / 2));
+
+const ROTM_PARAM = new Float64Array([-1, 1, 0, 0, 1]);
+
+// Symmetric, diagonally dominant d x d matrix: every factorization succeeds
+function symmetric(d: number): Float64Array {
+  const a = f64(d * d);
+  for (let j = 0; j < d; j++) {
+    for (let i = 0; i < j; i++) a[j + i * d] = a[i + j * d];
+    a[j + j * d] += d;
+  }
+  return a;
+}
+
+// Level 1 style functions of two vectors of `size` elements
+function vector(name: string, call: (n: number, x: Float64Array, y: Float64Array) => unknown) {
+  return {
+    name,
+    setup: (n: number) => {
+      const x = f64(n);
+      const y = f64(n);
+      return () => call(n, x, y);
+    },
+  };
+}
+
+// Functions of a d x d matrix a, d x d matrices b and c, and vectors x and y
+function matrix(
+  name: string,
+  call: (
+    d: number,
+    a: Float64Array,
+    x: Float64Array,
+    y: Float64Array,
+    b: Float64Array,
+    c: Float64Array
+  ) => unknown
+) {
+  return {
+    name,
+    setup: (size: number) => {
+      const d = order(size);
+      const a = f64(d * d);
+      // Well conditioned for the triangular solvers
+      for (let i = 0; i < d; i++) a[i + i * d] += d;
+      const [x, y, b, c] = [f64(d), f64(d), f64(d * d), f64(d * d)];
+      return () => call(d, a, x, y, b, c);
+    },
+  };
+}
+
+// Functions of a packed triangle of order n and vectors x and y
+function packed(
+  name: string,
+  call: (n: number, ap: Float64Array, x: Float64Array, y: Float64Array) => unknown
+) {
+  return {
+    name,
+    setup: (size: number) => {
+      const n = packedOrder(size);
+      const ap = f64((n * (n + 1)) / 2);
+      for (let j = 0; j < n; j++) ap[(j * (j + 1)) / 2 + j] += n;
+      const [x, y] = [f64(n), f64(n)];
+      return () => call(n, ap, x, y);
+    },
+  };
+}
+
+// Functions of a band matrix of order n with kl = ku = 2 (5 stored diagonals)
+function band(
+  name: string,
+  call: (n: number, a: Float64Array, x: Float64Array, y: Float64Array) => unknown
+) {
+  return {
+    name,
+    setup: (size: number) => {
+      const n = Math.max(1, Math.floor(size / 5));
+      const a = f64(5 * n);
+      for (let j = 0; j < n; j++) a[2 + 5 * j] += 5;
+      const [x, y] = [f64(n), f64(n)];
+      return () => call(n, a, x, y);
+    },
+  };
+}
+
+// LAPACK drivers on a symmetric d x d matrix a and d x d right-hand sides b,
+// with pivots and scalar factors from `prepare` (a factorization of a); a
+// and b are restored before each call
+function lapack(
+  name: string,
+  call: (
+    d: number,
+    a: Float64Array,
+    b: Float64Array,
+    ipiv: Int32Array,
+    tau: Float64Array
+  ) => unknown,
+  prepare?: (d: number, a: Float64Array, ipiv: Int32Array, tau: Float64Array) => unknown
+) {
+  return {
+    name,
+    setup: (size: number) => {
+      const d = order(size);
+      const a0 = symmetric(d);
+      const ipiv = new Int32Array(d);
+      const tau = new Float64Array(d);
+      prepare?.(d, a0, ipiv, tau);
+      const b0 = f64(d * d);
+      const [a, b] = [a0.slice(), b0.slice()];
+      return {
+        call: () => call(d, a, b, ipiv, tau),
+        reset: () => {
+          a.set(a0);
+          b.set(b0);
+        },
+      };
+    },
+  };
+}
+
+const lu = (d: number, a: Float64Array, ipiv: Int32Array) => blas.dgetrf(d, d, a, d, ipiv);
+const cholesky = (d: number, a: Float64Array) => blas.dpotrf(U, d, a, d);
+const qr = (d: number, a: Float64Array, _: Int32Array, tau: Float64Array) =>
+  blas.dgeqrf(d, d, a, d, tau);
+
+// Kronecker products of two q x q factors and vectors x and y of q^2
+// elements; x is restored before each call
+function kron(
+  name: string,
+  call: (factors: KronFactor[], x: Float64Array, y: Float64Array) => unknown
+) {
+  return {
+    name,
+    setup: (size: number) => {
+      const q = order(size);
+      const factors = [0, 1].map(() => ({ m: q, n: q, a: symmetric(q), lda: q }));
+      const x0 = f64(q * q);
+      const [x, y] = [x0.slice(), f64(q * q)];
+      return { call: () => call(factors, x, y), reset: () => x.set(x0) };
+    },
+  };
+}
+
+// Eigensolvers on a dense symmetric d x d operator, with a start vector x,
+// eigenvalues w and eigenvectors z (two of each)
+function eigen(
+  name: string,
+  call: (op: LinearOperator, x: Float64Array, w: Float64Array, z: Float64Array) => unknown
+) {
+  return {
+    name,
+    setup: (size: number) => {
+      const d = order(size);
+      const op: LinearOperator = { kind: 'dense', n: d, a: symmetric(d), lda: d };
+      const [x, w, z] = [f64(d), new Float64Array(2), new Float64Array(2 * d)];
+      return () => call(op, x, w, z);
+    },
+  };
+}
+
+// Operands of a batch: `count` problems of 16 elements (vectors of n <= 16
+// or 4 x 4 matrices) as arrays xs and ys, and back to back in x and y
+interface Batch {
+  n: number;
+  count: number;
+  xs: Float64Array[];
+  ys: Float64Array[];
+  x: Float64Array;
+  y: Float64Array;
+  r: Float64Array;
+}
+
+function batched(name: string, call: (o: Batch) => unknown) {
+  return {
+    name,
+    setup: (size: number) => {
+      const count = Math.max(1, Math.floor(size / 16));
+      const o: Batch = {
+        n: Math.min(16, size),
+        count,
+        xs: list(count, () => f64(16)),
+        ys: list(count, () => f64(16)),
+        x: f64(16 * count),
+        y: f64(16 * count),
+        r: new Float64Array(count),
+      };
+      return () => call(o);
+    },
+  };
+}
+
+// bfloat16 and fp16 products of d x d matrices
+function gemm16(name: string, gemm: typeof blas.sbgemm) {
+  return {
+    name,
+    setup: (size: number) => {
+      const d = order(size);
+      const [a, b, c] = [u16(d * d), u16(d * d), new Float32Array(d * d)];
+      return () => gemm(N, N, d, d, d, 1, a, d, b, d, 0, c, d);
+    },
+  };
+}
+
+function gemv16(name: string, gemv: typeof blas.sbgemv) {
+  return {
+    name,
+    setup: (size: number) => {
+      const d = order(size);
+      const [a, x, y] = [u16(d * d), u16(d), new Float32Array(d)];
+      return () => gemv(N, d, d, 1, a, d, x, 1, 0, y, 1);
+    },
+  };
+}
+
+// 16-bit conversions between `size` elements
+function convert<X, Y>(
+  name: string,
+  from: (n: number) => X,
+  to: (n: number) => Y,
+  call: (n: number, x: X, y: Y) => unknown
+) {
+  return {
+    name,
+    setup: (n: number) => {
+      const x = from(n);
+      const y = to(n);
+      return () => call(n, x, y);
+    },
+  };
+}
+
+const BENCHES: Bench[] = [
+  // Level 1
+  vector('daxpy', (n, x, y) => blas.daxpy(n, 1e-9, x, 1, y, 1)),
+  vector('daxpby', (n, x, y) => blas.daxpby(n, 1e-9, x, 1, 1 - 1e-9, y, 1)),
+  vector('dcopy', (n, x, y) => blas.dcopy(n, x, 1, y, 1)),
+  vector('ddot', (n, x, y) => blas.ddot(n, x, 1, y, 1)),
+  vector('dscal', (n, x) => blas.dscal(n, 1 - 1e-9, x, 1)),
+  vector('dasum', (n, x) => blas.dasum(n, x, 1)),
+  vector('dnrm2', (n, x) => blas.dnrm2(n, x, 1)),
+  vector('dswap', (n, x, y) => blas.dswap(n, x, 1, y, 1)),
+  vector('drot', (n, x, y) => blas.drot(n, x, 1, y, 1, 0.6, 0.8)),
+  vector('drotm', (n, x, y) => blas.drotm(n, x, 1, y, 1, ROTM_PARAM)),
+  { name: 'drotg', setup: () => () => blas.drotg(3, 4) },
+  { name: 'drotmg', setup: () => () => blas.drotmg(1, 1, 3, 4) },
+  // Level 2
+  matrix('dgemv', (d, a, x, y) => blas.dgemv(N, d, d, 1, a, d, x, 1, 0, y, 1)),
+  matrix('dger', (d, a, x, y) => blas.dger(d, d, 1e-9, x, 1, y, 1, a, d)),
+  matrix('dsymv', (d, a, x, y) => blas.dsymv(U, d, 1, a, d, x, 1, 0, y, 1)),
+  matrix('dsyr', (d, a, x) => blas.dsyr(U, d, 1e-9, x, 1, a, d)),
+  matrix('dsyr2', (d, a, x, y) => blas.dsyr2(U, d, 1e-9, x, 1, y, 1, a, d)),
+  matrix('dtrmv', (d, a, x) => blas.dtrmv(U, N, Diagonal.NonUnit, d, a, d, x, 1)),
+  matrix('dtrsv', (d, a, x) => blas.dtrsv(U, N, Diagonal.NonUnit, d, a, d, x, 1)),
+  band('dgbmv', (n, a, x, y) => blas.dgbmv(N, n, n, 2, 2, 1, a, 5, x, 1, 0, y, 1)),
+  band('dsbmv', (n, a, x, y) => blas.dsbmv(U, n, 2, 1, a, 5, x, 1, 0, y, 1)),
+  band('dtbmv', (n, a, x) => blas.dtbmv(U, N, Diagonal.NonUnit, n, 2, a, 5, x, 1)),
+  band('dtbsv', (n, a, x) => blas.dtbsv(U, N, Diagonal.NonUnit, n, 2, a, 5, x, 1)),
+  packed('dspmv', (n, ap, x, y) => blas.dspmv(U, n, 1, ap, x, 1, 0, y, 1)),
+  packed('dspr', (n, ap, x) => blas.dspr(U, n, 1e-9, x, 1, ap)),
+  packed('dspr2', (n, ap, x, y) => blas.dspr2(U, n, 1e-9, x, 1, y, 1, ap)),
+  packed('dtpmv', (n, ap, x) => blas.dtpmv(U, N, Diagonal.NonUnit, n, ap, x, 1)),
+  packed('dtpsv', (n, ap, x) => blas.dtpsv(U, N, Diagonal.NonUnit, n, ap, x, 1)),
+  // Batched Level 1
+  batched('ddot_batch', (o) => blas.ddot_batch(o.n, o.xs, 1, o.ys, 1, o.r)),
+  batched('ddot_batch_strided', (o) =>
+    blas.ddot_batch_strided(o.n, o.x, 1, 16, o.y, 1, 16, o.r, o.count)
+  ),
+  batched('dnrm2_batch', (o) => blas.dnrm2_batch(o.n, o.xs, 1, o.r)),
+  batched('dnrm2_batch_strided', (o) => blas.dnrm2_batch_strided(o.n, o.x, 1, 16, o.r, o.count)),
+  batched('dasum_batch', (o) => blas.dasum_batch(o.n, o.xs, 1, o.r)),
+  batched('dasum_batch_strided', (o) => blas.dasum_batch_strided(o.n, o.x, 1, 16, o.r, o.count)),
+  batched('daxpy_batch', (o) => blas.daxpy_batch(o.n, 1e-9, o.xs, 1, o.ys, 1)),
+  batched('daxpy_batch_strided', (o) =>
+    blas.daxpy_batch_strided(o.n, 1e-9, o.x, 1, 16, o.y, 1, 16, o.count)
+  ),
+  batched('dscal_batch', (o) => blas.dscal_batch(o.n, 1 - 1e-9, o.xs, 1)),
+  batched('dscal_batch_strided', (o) =>
+    blas.dscal_batch_strided(o.n, 1 - 1e-9, o.x, 1, 16, o.count)
+  ),
+  // Batched Level 2 on 4 x 4 matrices
+  batched('dgemv_batch', (o) => blas.dgemv_batch(N, 4, 4, 1, o.xs, 4, o.ys, 1, 0, o.ys, 1)),
+  batched('dgemv_batch_strided', (o) =>
+    blas.dgemv_batch_strided(N, 4, 4, 1, o.x, 4, 16, o.y, 1, 16, 0, o.y, 1, 16, o.count)
+  ),
+  batched('dsymv_batch', (o) => blas.dsymv_batch(U, 4, 1, o.xs, 4, o.ys, 1, 0, o.ys, 1)),
+  batched('dsymv_batch_strided', (o) =>
+    blas.dsymv_batch_strided(U, 4, 1, o.x, 4, 16, o.y, 1, 16, 0, o.y, 1, 16, o.count)
+  ),
+  batched('dtrmv_batch', (o) => blas.dtrmv_batch(U, N, Diagonal.Unit, 4, o.xs, 4, o.ys, 1)),
+  batched('dtrmv_batch_strided', (o) =>
+    blas.dtrmv_batch_strided(U, N, Diagonal.Unit, 4, o.x, 4, 16, o.y, 1, 16, o.count)
+  ),
+  batched('dtrsv_batch', (o) => blas.dtrsv_batch(U, N, Diagonal.Unit, 4, o.xs, 4, o.ys, 1)),
+  batched('dtrsv_batch_strided', (o) =>
+    blas.dtrsv_batch_strided(U, N, Diagonal.Unit, 4, o.x, 4, 16, o.y, 1, 16, o.count)
+  ),
+  batched('dger_batch', (o) => blas.dger_batch(4, 4, 1e-9, o.ys, 1, o.ys, 1, o.xs, 4)),
+  batched('dger_batch_strided', (o) =>
+    blas.dger_batch_strided(4, 4, 1e-9, o.y, 1, 16, o.y, 1, 16, o.x, 4, 16, o.count)
+  ),
+  // Level 3
+  matrix('dgemm', (d, a, _, __, b, c) => blas.dgemm(N, N, d, d, d, 1, a, d, b, d, 0, c, d)),
+  matrix('dgemmtr', (d, a, _, __, b, c) => blas.dgemmtr(U, N, N, d, d, 1, a, d, b, d, 0, c, d)),
+  matrix('dsymm', (d, a, _, __, b, c) => blas.dsymm(Side.Left, U, d, d, 1, a, d, b, d, 0, c, d)),
+  matrix('dsyrk', (d, a, _, __, ___, c) => blas.dsyrk(U, N, d, d, 1, a, d, 0, c, d)),
+  matrix('dsyr2k', (d, a, _, __, b, c) => blas.dsyr2k(U, N, d, d, 1, a, d, b, d, 0, c, d)),
+  matrix('dtrmm', (d, a, _, __, b) =>
+    blas.dtrmm(Side.Left, U, N, Diagonal.NonUnit, d, d, 1, a, d, b, d)
+  ),
+  matrix('dtrsm', (d, a, _, __, b) =>
+    blas.dtrsm(Side.Left, U, N, Diagonal.NonUnit, d, d, 1, a, d, b, d)
+  ),
+  {
+    name: 'dgemm_batch',
+    setup: (size: number) => {
+      const count = Math.max(1, Math.floor(size / 16));
+      const a = list(count, () => f64(16));
+      const c = list(count, () => f64(16));
+      const group = { transa: N, transb: N, m: 4, n: 4, k: 4, alpha: 1, beta: 0 };
+      const groups = [{ ...group, a, lda: 4, b: a, ldb: 4, c, ldc: 4 }];
+      return () => blas.dgemm_batch(groups);
+    },
+  },
+  // LAPACK auxiliary
+  matrix('dlacpy', (d, a, _, __, b) => blas.dlacpy(MatrixType.General, d, d, a, d, b, d)),
+  matrix('dlaset', (d, _, __, ___, b) => blas.dlaset(MatrixType.General, d, d, 0, 1, b, d)),
+  matrix('dlascl', (d, _, __, ___, b) => blas.dlascl(MatrixType.General, 1, 1 - 1e-9, d, d, b, d)),
+  matrix('dlange', (d, a) => blas.dlange(Norm.One, d, d, a, d)),
+  matrix('dlansy', (d, a) => blas.dlansy(Norm.One, U, d, a, d)),
+  matrix('dlantr', (d, a) => blas.dlantr(Norm.One, U, Diagonal.NonUnit, d, d, a, d)),
+  matrix('dreduce', (d, a, x) => blas.dreduce(Reduction.Sum, Axis.Columns, d, d, a, d, x)),
+  // LAPACK
+  lapack('dgetrf', (d, a, _, ipiv) => blas.dgetrf(d, d, a, d, ipiv)),
+  lapack('dgetrs', (d, a, b, ipiv) => blas.dgetrs(N, d, d, a, d, ipiv, b, d), lu),
+  lapack('dgetri', (d, a, _, ipiv) => blas.dgetri(d, a, d, ipiv), lu),
+  lapack('dtrtri', (d, a) => blas.dtrtri(U, Diagonal.NonUnit, d, a, d)),
+  lapack('dpotrf', (d, a) => blas.dpotrf(U, d, a, d)),
+  lapack('dpotri', (d, a) => blas.dpotri(U, d, a, d), cholesky),
+  lapack('dgeqrf', (d, a, _, __, tau) => blas.dgeqrf(d, d, a, d, tau)),
+  lapack('dormqr', (d, a, b, _, tau) => blas.dormqr(Side.Left, N, d, d, d, a, d, tau, b, d), qr),
+  lapack('dgels', (d, a, b) => blas.dgels(N, d, d, d, a, d, b, d)),
+  lapack('dgels_normal', (d, a, b) => blas.dgels_normal(d, d, d, a, d, b, d)),
+  // Structured operators, for a fixed number of iterations (tol = 0)
+  kron('dkronmv', (factors, x, y) => blas.dkronmv(N, factors, 1, x, 0, y)),
+  kron('dkronsv', (factors, x) => blas.dkronsv(N, factors, x)),
+  eigen('dpower', (op, x) => blas.dpower(op, x, 10, 0)),
+  eigen('dlanczos', (op, _, w, z) =>
+    blas.dlanczos(op, Which.Largest, Math.min(2, op.n - 1), w, z, op.n, undefined, 1, 0)
+  ),
+  // Quantized and 16-bit storage
+  {
+    name: 'gemm_u8s8s32',
+    setup: (size: number) => {
+      const d = order(size);
+      const [a, b, c] = [u8(d * d), i8(d * d), new Int32Array(d * d)];
+      return () => blas.gemm_u8s8s32(N, N, d, d, d, a, d, 128, b, d, 0, c, d);
+    },
+  },
+  {
+    name: 'gemm_u8s8u8',
+    setup: (size: number) => {
+      const d = order(size);
+      const [a, b, c] = [u8(d * d), i8(d * d), new Uint8Array(d * d)];
+      const scale = new Float32Array([1e-4]);
+      return () => blas.gemm_u8s8u8(N, N, d, d, d, a, d, 128, b, d, 0, null, scale, 128, c, d);
+    },
+  },
+  gemm16('sbgemm', blas.sbgemm),
+  gemm16('shgemm', blas.shgemm),
+  gemv16('sbgemv', blas.sbgemv),
+  gemv16('shgemv', blas.shgemv),
+  convert('sbstobf16', f32, u16, (n, x, y) => blas.sbstobf16(n, x, 1, y, 1)),
+  convert('sbdtobf16', f64, u16, (n, x, y) => blas.sbdtobf16(n, x, 1, y, 1)),
+  convert('sbf16tos', u16, f32, (n, x, y) => blas.sbf16tos(n, x, 1, y, 1)),
+  convert('dbf16tod', u16, f64, (n, x, y) => blas.dbf16tod(n, x, 1, y, 1)),
+  convert('shstof16', f32, u16, (n, x, y) => blas.shstof16(n, x, 1, y, 1)),
+  convert('shdtof16', f64, u16, (n, x, y) => blas.shdtof16(n, x, 1, y, 1)),
+  convert('shf16tos', u16, f32, (n, x, y) => blas.shf16tos(n, x, 1, y, 1)),
+  convert('df16tod', u16, f64, (n, x, y) => blas.df16tod(n, x, 1, y, 1)),
+];
+
+// Exports of src/index that are not BLAS functions: the module, memory, raw
+// and trace APIs
+const NOT_BENCHED = new Set([wasmModule, memory, raw, trace].flatMap((m) => Object.keys(m)));
+
+// BLAS functions exported by src/index without an entry in BENCHES
+function unbenched(): string[] {
+  const benched = new Set(BENCHES.map((bench) => bench.name));
+  return Object.entries(blas)
+    .filter(([name, value]) => typeof value === 'function' && !NOT_BENCHED.has(name))
+    .map(([name]) => name)
+    .filter((name) => !benched.has(name));
+}
+
+// Timestamps recorded by the instrumented exports: kind (0 malloc, 1 free,
+// 2 kernel), start and end of each call
+const MAX_EVENTS = 1 << 16;
+const eventKind = new Uint8Array(MAX_EVENTS);
+const eventStart = new Float64Array(MAX_EVENTS);
+const eventEnd = new Float64Array(MAX_EVENTS);
+let eventCount = 0;
+
+/**
+ * Wrap every export of the module to record its calls; returns the function
+ * that restores the originals
+ */
+function instrument(module: BlasModule): () => void {
+  const exports = module as unknown as Record<string, unknown>;
+  const originals = new Map<string, unknown>();
+  for (const key of Object.keys(exports)) {
+    const original = exports[key];
+    if (!key.startsWith('_') || typeof original !== 'function') {
+      continue;
+    }
+    const fn = original as (...args: unknown[]) => unknown;
+    const kind = key.startsWith('_malloc') ? 0 : key === '_free' ? 1 : 2;
+    originals.set(key, original);
+    exports[key] = (...args: unknown[]) => {
+      const start = performance.now();
+      const result = fn(...args);
+      const end = performance.now();
+      if (eventCount < MAX_EVENTS) {
+        eventKind[eventCount] = kind;
+        eventStart[eventCount] = start;
+        eventEnd[eventCount++] = end;
+      }
+      return result;
+    };
+  }
+  return () => originals.forEach((original, key) => (exports[key] = original));
+}
+
+// Cost of one timestamp in milliseconds
+function timestampCost(): number {
+  const count = 100000;
+  const t0 = performance.now();
+  let t = t0;
+  for (let i = 0; i < count; i++) t = performance.now();
+  return (t - t0) / count;
+}
+
+// Split the call from t0 to t1 into phases, by the recorded events (ms)
+function split(t0: number, t1: number, tick: number): Phases {
+  const p = Object.fromEntries(PHASES.map((phase) => [phase, 0])) as Phases;
+  let prev = t0;
+  let state: Phase = 'validate';
+  const gap = (end: number) => {
+    p[state] += Math.max(0, end - prev - tick);
+  };
+  for (let i = 0; i < eventCount; i++) {
+    gap(eventStart[i]);
+    const d = Math.max(0, eventEnd[i] - eventStart[i] - tick);
+    const kind = eventKind[i];
+    if (kind === 0) {
+      p.malloc += d;
+      if (state === 'validate') state = 'copy_in';
+    } else if (kind === 1) {
+      p.free += d;
+      state = 'other';
+    } else {
+      p.kernel += d;
+      if (state !== 'other') state = 'copy_out';
+    }
+    prev = eventEnd[i];
+  }
+  gap(t1);
+  return p;
+}
+
+// Phases of one function at one size, in microseconds
+function measure(prepared: Call, tick: number): Phases {
+  const { call, reset } =
+    typeof prepared === 'function' ? { call: prepared, reset: () => {} } : prepared;
+
+  // Warm up the JIT on the wrapper and its kernel
+  const warm = performance.now();
+  for (let i = 0; i < 1000 && performance.now() - warm < WARMUP_SECONDS * 1e3; i++) {
+    reset();
+    call();
+  }
+
+  const samples: { total: number; phases: Phases }[] = [];
+  const begin = performance.now();
+  while (
+    samples.length < MIN_CALLS ||
+    (samples.length < MAX_CALLS && performance.now() - begin < MIN_SECONDS * 1e3)
+  ) {
+    reset();
+    eventCount = 0;
+    const t0 = performance.now();
+    call();
+    const t1 = performance.now();
+    samples.push({ total: t1 - t0, phases: split(t0, t1, tick) });
+  }
+
+  // Mean over the faster half
+  samples.sort((a, b) => a.total - b.total);
+  const fast = samples.slice(0, Math.ceil(samples.length / 2));
+  const mean = {} as Phases;
+  for (const phase of PHASES) {
+    mean[phase] = (fast.reduce((sum, s) => sum + s.phases[phase], 0) / fast.length) * 1e3;
+  }
+  return mean;
+}
+
+async function main() {
+  const args = process.argv.slice(2);
+  const option = (name: string) => {
+    const i = args.indexOf(name);
+    return i >= 0 ? args.splice(i, 2)[1] : undefined;
+  };
+  const jsonPath = option('--json');
+  const baselinePath = option('--baseline');
+  const filter = args[0] ?? '';
+
+  const missing = unbenched();
+  if (missing.length > 0) {
+    throw new Error(`no benchmark in BENCHES for ${missing.join(', ')}`);
+  }
+
+  const module = await blas.initWasm();
+  const tick = timestampCost();
+  const restore = instrument(module);
+
+  const summary: Record<string, Summary> = {};
+  const columns = ['size', 'total', ...PHASES].map((c) => c.padStart(9)).join(' ');
+  console.log(`times in microseconds; timestamp cost ${(tick * 1e6).toFixed(0)} ns subtracted\n`);
+  console.log(`${'function'.padEnd(20)} ${columns}`);
+  try {
+    for (const bench of BENCHES.filter((b) => b.name.includes(filter))) {
+      let overhead = Infinity;
+      let crossover: number | null = null;
+      for (const size of SIZES) {
+        const phases = measure(bench.setup(size), tick);
+        const total = PHASES.reduce((sum, phase) => sum + phases[phase], 0);
+        const rest = total - phases.kernel;
+        if (size <= FIXED_SIZE) overhead = Math.min(overhead, rest);
+        if (crossover === null && phases.kernel >= rest) crossover = size;
+        const values = [total, ...PHASES.map((phase) => phases[phase])];
+        const row = [String(size), ...values.map((v) => v.toFixed(2))];
+        console.log(`${bench.name.padEnd(20)} ${row.map((c) => c.padStart(9)).join(' ')}`);
+      }
+      summary[bench.name] = { overhead, crossover };
+    }
+  } finally {
+    restore();
+  }
+
+  // Summary and comparison with the baseline
+  const baseline: Record<string, Summary> = baselinePath
+    ? JSON.parse(readFileSync(baselinePath, 'utf8'))
+    : {};
+  let regressions = 0;
+  console.log(`\n${'function'.padEnd(20)} ${'overhead'.padStart(9)} ${'crossover'.padStart(9)}`);
+  for (const [name, { overhead, crossover }] of Object.entries(summary)) {
+    const base = baseline[name];
+    const regressed =
+      base !== undefined &&
+      overhead > base.overhead * REGRESSION_RATIO &&
+      overhead > base.overhead + REGRESSION_US;
+    if (regressed) regressions++;
+    const cross = crossover === null ? `>${SIZES[SIZES.length - 1]}` : String(crossover);
+    const note = regressed ? `  REGRESSION (baseline ${base.overhead.toFixed(2)})` : '';
+    const row = `${name.padEnd(20)} ${overhead.toFixed(2).padStart(9)} ${cross.padStart(9)}`;
+    console.log(row + note);
+  }
+
+  if (jsonPath) {
+    writeFileSync(jsonPath, JSON.stringify(summary, null, 2) + '\n');
+  }
+  if (regressions > 0) {
+    console.log(`\n${regressions} function(s) regressed`);
+    process.exit(1);
+  }
+}
+
+main().catch((error) => {
+  console.error(error);
+  process.exit(1);
+});
@@ -0,0 +1,397 @@
+/**
+ * Trace replayer
+ *
+ * Re-executes a call trace recorded with startTrace()/stopTrace() (see
+ * src/trace.ts for the format) through the C API in blas.h, with random data
+ * of the recorded shapes and the recorded integer arrays ('N'), and prints
+ * the time per routine:
+ *
+ *   routine  calls  recorded_ms  replay_ms  mean_us
+ *
+ * recorded_ms is the time the calls took in the application, replay_ms the
+ * time here. Built natively (blas-replay) and as a WASI command
+ * (blas-replay-wasi.wasm; pass --dir so the runtime can open the trace).
+ *
+ * Usage: blas-replay trace.bin [repeat]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../src/cpp/blas.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// One decoded argument; arrays own their (random or recorded) data
+struct Value {
+    int32_t i = 0;
+    double d = 0.0;
+    std::vector<unsigned char> bytes;
+    bool null = false;
+};
+
+// Signature character of each C parameter type, as written by src/trace.ts
+template <typename T> struct Code;
+template <> struct Code<int> { static constexpr char value = 'i'; };
+template <> struct Code<char> { static constexpr char value = 'i'; };
+template <> struct Code<double> { static constexpr char value = 'd'; };
+template <> struct Code<float> { static constexpr char value = 'd'; };
+template <> struct Code<double*> { static constexpr char value = 'D'; };
+template <> struct Code<float*> { static constexpr char value = 'S'; };
+template <> struct Code<int32_t*> { static constexpr char value = 'I'; };
+template <> struct Code<uint16_t*> { static constexpr char value = 'H'; };
+template <> struct Code<int8_t*> { static constexpr char value = 'b'; };
+template <> struct Code<uint8_t*> { static constexpr char value = 'B'; };
+template <typename T> struct Code<const T*> : Code<T*> {};
+
+template <typename T>
+T get(Value& v) {
+    if constexpr (std::is_pointer_v<T>) {
+        return v.null ? nullptr : reinterpret_cast<T>(v.bytes.data());
+    } else if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(v.i);
+    } else {
+        return static_cast<T>(v.d);
+    }
+}
+
+struct Routine {
+    std::string signature;
+    void (*invoke)(std::vector<Value>& args);
+};
+
+template <typename R, typename... A, size_t... I>
+void invoke(R (*fn)(A...), std::vector<Value>& args, std::index_sequence<I...>) {
+    if constexpr (std::is_void_v<R>) {
+        fn(get<A>(args[I])...);
+    } else {
+        volatile R r = fn(get<A>(args[I])...);
+        (void)r;
+    }
+}
+
+template <typename R, typename... A>
+Routine make_routine(R (*)(A...), void (*call)(std::vector<Value>&)) {
+    return {std::string{Code<A>::value...}, call};
+}
+
+// Routine whose signature records some int32 arrays by value: sig is the
+// signature from the C types with those 'I' replaced by 'N'
+Routine by_value(Routine routine, const char* sig) {
+    std::string s = sig;
+    bool same = s.size() == routine.signature.size();
+    for (size_t i = 0; same && i < s.size(); i++) {
+        same = s[i] == routine.signature[i] || (s[i] == 'N' && routine.signature[i] == 'I');
+    }
+    if (!same) throw std::logic_error("signature " + s + " does not match " + routine.signature);
+    routine.signature = s;
+    return routine;
+}
+
+template <typename R, typename... A>
+void dispatch(R (*fn)(A...), std::vector<Value>& args) {
+    invoke(fn, args, std::index_sequence_for<A...>{});
+}
+
+#define BLAS_ROUTINE(name) \
+    { #name, make_routine(name, [](std::vector<Value>& a) { dispatch(name, a); }) }
+
+#define BLAS_ROUTINE_BY_VALUE(name, sig) \
+    { #name, by_value(make_routine(name, [](std::vector<Value>& a) { dispatch(name, a); }), sig) }
+
+const std::map<std::string, Routine>& routines() {
+    static const std::map<std::string, Routine> table = {
+        // Level 1 BLAS
+        BLAS_ROUTINE(daxpy),
+        BLAS_ROUTINE(daxpby),
+        BLAS_ROUTINE(dcopy),
+        BLAS_ROUTINE(ddot),
+        BLAS_ROUTINE(dscal),
+        BLAS_ROUTINE(dasum),
+        BLAS_ROUTINE(dnrm2),
+        BLAS_ROUTINE(dswap),
+        BLAS_ROUTINE(drot),
+        BLAS_ROUTINE(drotg),
+        BLAS_ROUTINE(drotm),
+        BLAS_ROUTINE(drotmg),
+        // Level 2 BLAS
+        BLAS_ROUTINE(dgemv),
+        BLAS_ROUTINE(dgbmv),
+        BLAS_ROUTINE(dger),
+        BLAS_ROUTINE(dsymv),
+        BLAS_ROUTINE(dsbmv),
+        BLAS_ROUTINE(dspmv),
+        BLAS_ROUTINE(dsyr),
+        BLAS_ROUTINE(dsyr2),
+        BLAS_ROUTINE(dspr),
+        BLAS_ROUTINE(dspr2),
+        BLAS_ROUTINE(dtrmv),
+        BLAS_ROUTINE(dtrsv),
+        BLAS_ROUTINE(dtbmv),
+        BLAS_ROUTINE(dtbsv),
+        BLAS_ROUTINE(dtpmv),
+        BLAS_ROUTINE(dtpsv),
+        // Batched Level 1 BLAS
+        BLAS_ROUTINE(ddot_batch_strided),
+        BLAS_ROUTINE(dnrm2_batch_strided),
+        BLAS_ROUTINE(dasum_batch_strided),
+        BLAS_ROUTINE(daxpy_batch_strided),
+        BLAS_ROUTINE(dscal_batch_strided),
+        // Batched Level 2 BLAS
+        BLAS_ROUTINE(dgemv_batch_strided),
+        BLAS_ROUTINE(dsymv_batch_strided),
+        BLAS_ROUTINE(dtrmv_batch_strided),
+        BLAS_ROUTINE(dtrsv_batch_strided),
+        BLAS_ROUTINE(dger_batch_strided),
+        // Level 3 BLAS
+        BLAS_ROUTINE(dgemm),
+        BLAS_ROUTINE(dgemmtr),
+        BLAS_ROUTINE_BY_VALUE(dgemm_batch, "iNNNNNNDDNNDNNDDNN"),
+        BLAS_ROUTINE(dsymm),
+        BLAS_ROUTINE(dsyrk),
+        BLAS_ROUTINE(dsyr2k),
+        BLAS_ROUTINE(dtrmm),
+        BLAS_ROUTINE(dtrsm),
+        // Low precision extensions
+        BLAS_ROUTINE(gemm_u8s8s32),
+        BLAS_ROUTINE(gemm_u8s8u8),
+        BLAS_ROUTINE(sbstobf16),
+        BLAS_ROUTINE(sbdtobf16),
+        BLAS_ROUTINE(sbf16tos),
+        BLAS_ROUTINE(dbf16tod),
+        BLAS_ROUTINE(shstof16),
+        BLAS_ROUTINE(shdtof16),
+        BLAS_ROUTINE(shf16tos),
+        BLAS_ROUTINE(df16tod),
+        BLAS_ROUTINE(sbgemm),
+        BLAS_ROUTINE(shgemm),
+        BLAS_ROUTINE(sbgemv),
+        BLAS_ROUTINE(shgemv),
+        // LAPACK auxiliary routines
+        BLAS_ROUTINE(dlacpy),
+        BLAS_ROUTINE(dlaset),
+        BLAS_ROUTINE(dlascl),
+        BLAS_ROUTINE(dlange),
+        BLAS_ROUTINE(dlansy),
+        BLAS_ROUTINE(dlantr),
+        BLAS_ROUTINE(dreduce),
+        BLAS_ROUTINE(dgetrf),
+        BLAS_ROUTINE_BY_VALUE(dgetrs, "iiiDiNDi"),
+        BLAS_ROUTINE_BY_VALUE(dgetri, "iDiN"),
+        BLAS_ROUTINE(dtrtri),
+        BLAS_ROUTINE(dpotrf),
+        BLAS_ROUTINE(dpotri),
+        BLAS_ROUTINE(dgeqrf),
+        BLAS_ROUTINE(dormqr),
+        BLAS_ROUTINE(dgels),
+        BLAS_ROUTINE(dgels_normal),
+        BLAS_ROUTINE_BY_VALUE(dkronmv, "iiNNdDNNDdD"),
+        BLAS_ROUTINE_BY_VALUE(dkronsv, "iiNDNND"),
+        BLAS_ROUTINE_BY_VALUE(dpower, "iiiiDiNNidDD"),
+        BLAS_ROUTINE_BY_VALUE(dlanczos, "iiiiDiNNiiiidDDi"),
+    };
+    return table;
+}
+
+size_t element_size(char type) {
+    switch (type) {
+        case 'D': return 8;
+        case 'S': case 'I': case 'N': return 4;
+        case 'H': return 2;
+        case 'b': case 'B': return 1;
+        default: throw std::runtime_error(std::string("unknown argument type ") + type);
+    }
+}
+
+std::mt19937 rng(42);
+
+void fill_random(char type, std::vector<unsigned char>& bytes) {
+    size_t n = bytes.size() / element_size(type);
+    std::uniform_real_distribution<double> real(-1.0, 1.0);
+    std::uniform_int_distribution<int> byte(0, 255);
+    if (type == 'D') {
+        auto* p = reinterpret_cast<double*>(bytes.data());
+        for (size_t i = 0; i < n; i++) p[i] = real(rng);
+    } else if (type == 'S') {
+        auto* p = reinterpret_cast<float*>(bytes.data());
+        for (size_t i = 0; i < n; i++) p[i] = static_cast<float>(real(rng));
+    } else if (type == 'H') {
+        // Normal numbers in both bfloat16 and fp16
+        std::uniform_int_distribution<int> half(0x3000, 0x3bff);
+        auto* p = reinterpret_cast<uint16_t*>(bytes.data());
+        for (size_t i = 0; i < n; i++) p[i] = static_cast<uint16_t>(half(rng));
+    } else {
+        // int32 arrays (bias) stay small, int8/uint8 cover their full range
+        for (size_t i = 0; i < bytes.size(); i++) {
+            bytes[i] = static_cast<unsigned char>(type == 'I' && i % 4 ? 0 : byte(rng));
+        }
+    }
+}
+
+// Little endian reader over the whole trace
+struct Reader {
+    const std::vector<unsigned char>& data;
+    size_t pos = 0;
+
+    template <typename T>
+    T read() {
+        if (pos + sizeof(T) > data.size()) throw std::runtime_error("truncated trace");
+        T v;
+        std::memcpy(&v, data.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return v;
+    }
+
+    std::string ascii() {
+        size_t len = read<uint8_t>();
+        if (pos + len > data.size()) throw std::runtime_error("truncated trace");
+        std::string s(reinterpret_cast<const char*>(data.data() + pos), len);
+        pos += len;
+        return s;
+    }
+
+    bool done() const { return pos >= data.size(); }
+};
+
+struct Stats {
+    long calls = 0;
+    double recorded_us = 0.0;
+    double replay_us = 0.0;
+};
+
+std::vector<unsigned char> read_file(const char* path) {
+    FILE* f = std::fopen(path, "rb");
+    if (!f) throw std::runtime_error(std::string("cannot open ") + path);
+    std::vector<unsigned char> data;
+    unsigned char buf[1 << 16];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+    std::fclose(f);
+    return data;
+}
+
+std::map<std::string, Stats> replay(const std::vector<unsigned char>& data, int repeat) {
+    Reader in{data};
+    if (data.size() < 12 || std::memcmp(data.data(), "BLTR", 4) != 0) {
+        throw std::runtime_error("not a BLAS trace");
+    }
+    in.pos = 4;
+    if (in.read<uint16_t>() != 1) throw std::runtime_error("unsupported trace version");
+    bool hashed = in.read<uint8_t>() & 1;
+    in.read<uint8_t>();
+    uint32_t sample = in.read<uint32_t>();
+
+    struct Defined {
+        std::string name;
+        std::string signature;
+        const Routine* routine = nullptr;
+    };
+    std::vector<Defined> defined(256);
+    std::map<std::string, Stats> stats;
+    std::vector<Value> args;
+
+    while (!in.done()) {
+        uint8_t tag = in.read<uint8_t>();
+        uint8_t id = in.read<uint8_t>();
+        if (tag == 1) {
+            Defined& d = defined[id];
+            d.name = in.ascii();
+            d.signature = in.ascii();
+            auto it = routines().find(d.name);
+            if (it == routines().end()) throw std::runtime_error("unknown routine " + d.name);
+            if (it->second.signature != d.signature) {
+                throw std::runtime_error("signature mismatch for " + d.name + ": trace has " +
+                                         d.signature + ", expected " + it->second.signature);
+            }
+            d.routine = &it->second;
+            continue;
+        }
+        const Defined& d = defined[id];
+        if (tag != 2 || d.routine == nullptr) throw std::runtime_error("corrupt trace");
+
+        double recorded = in.read<float>();
+        args.assign(d.signature.size(), Value{});
+        for (size_t i = 0; i < d.signature.size(); i++) {
+            char type = d.signature[i];
+            Value& v = args[i];
+            if (type == 'i') {
+                v.i = in.read<int32_t>();
+            } else if (type == 'd') {
+                v.d = in.read<double>();
+            } else {
+                uint32_t length = in.read<uint32_t>();
+                if (length == 0xffffffffu) {
+                    v.null = true;
+                    continue;
+                }
+                if (hashed) in.read<uint32_t>();
+                size_t size = element_size(type);
+                v.bytes.resize(std::max<size_t>(length * size, 1));
+                if (type == 'N') {
+                    // Recorded in full: dimensions, offsets and indices are replayed as they are
+                    if (in.pos + length * size > data.size()) {
+                        throw std::runtime_error("truncated trace");
+                    }
+                    std::memcpy(v.bytes.data(), data.data() + in.pos, length * size);
+                    in.pos += length * size;
+                } else {
+                    in.pos += std::min<size_t>(sample, length) * size;
+                    fill_random(type, v.bytes);
+                }
+            }
+        }
+
+        auto t0 = Clock::now();
+        for (int r = 0; r < repeat; r++) d.routine->invoke(args);
+        double t = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+
+        Stats& s = stats[d.name];
+        s.calls += repeat;
+        s.recorded_us += recorded * repeat;
+        s.replay_us += t;
+    }
+    return stats;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s trace.bin [repeat]\n", argv[0]);
+        return 2;
+    }
+    int repeat = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1;
+
+    std::map<std::string, Stats> stats;
+    try {
+        stats = replay(read_file(argv[1]), repeat);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s: %s\n", argv[1], e.what());
+        return 1;
+    }
+
+    std::vector<std::pair<std::string, Stats>> rows(stats.begin(), stats.end());
+    std::sort(rows.begin(), rows.end(),
+              [](const auto& a, const auto& b) { return a.second.replay_us > b.second.replay_us; });
+
+    std::printf("%-14s %10s %14s %14s %12s\n", "routine", "calls", "recorded_ms", "replay_ms",
+                "mean_us");
+    for (const auto& [name, s] : rows) {
+        std::printf("%-14s %10ld %14.3f %14.3f %12.3f\n", name.c_str(), s.calls,
+                    s.recorded_us * 1e-3, s.replay_us * 1e-3, s.replay_us / s.calls);
+    }
+    return 0;
+}
@@ -0,0 +1,41 @@
+/**
+ * Minimal WASI host for blas-wasi.wasm
+ *
+ * Shows how a runtime without the Emscripten JS glue drives the C API from
+ * src/cpp/blas.h: instantiate with WASI imports, initialize the reactor,
+ * allocate with the exported malloc and pass byte offsets as pointers.
+ *
+ * Usage: node examples/wasi/host.mjs [build/blas-wasi.wasm]
+ */
+
+import { readFile } from 'node:fs/promises';
+import { WASI } from 'node:wasi';
+
+const file = process.argv[2] ?? 'build/blas-wasi.wasm';
+const wasi = new WASI({ version: 'preview1' });
+const { instance } = await WebAssembly.instantiate(await readFile(file), wasi.getImportObject());
+wasi.initialize(instance);
+
+const { memory, malloc, free, ddot, dgemm } = instance.exports;
+const n = 4;
+
+const a = malloc(n * n * 8);
+const b = malloc(n * n * 8);
+const c = malloc(n * n * 8);
+try {
+  // Views must be created after malloc, which may grow (and detach) the memory
+  const heap = new Float64Array(memory.buffer);
+  for (let i = 0; i < n * n; i++) {
+    heap[a / 8 + i] = i + 1;
+    heap[b / 8 + i] = i % (n + 1) === 0 ? 1 : 0; // identity
+  }
+
+  console.log('ddot(a, a) =', ddot(n * n, a, 1, a, 1));
+
+  dgemm('N'.charCodeAt(0), 'N'.charCodeAt(0), n, n, n, 1.0, a, n, b, n, 0.0, c, n);
+  console.log('a * I =', Array.from(new Float64Array(memory.buffer, c, n * n)));
+} finally {
+  free(a);
+  free(b);
+  free(c);
+}
@@ -0,0 +1,18 @@
+#!/bin/sh
+# Run the kernel benchmark suite under wasmtime, AOT-compiled for this CPU
+#
+# Usage: examples/wasi/run-bench.sh [--roofline] [filter] [min_seconds]
+#
+# Expects build/blas-bench-wasi.wasm (npm run build:wasm) and wasmtime on PATH.
+# Compare with the native numbers from build-native/blas-bench.
+set -e
+
+BUILD_DIR=${BUILD_DIR:-build}
+MODULE="$BUILD_DIR/blas-bench-wasi.wasm"
+COMPILED="$BUILD_DIR/blas-bench-wasi.cwasm"
+
+if [ ! -f "$COMPILED" ] || [ "$MODULE" -nt "$COMPILED" ]; then
+    wasmtime compile "$MODULE" -o "$COMPILED"
+fi
+
+exec wasmtime run --allow-precompiled "$COMPILED" "$@"
@@ -0,0 +1,160 @@
+/**
+ * Helpers shared by the batched wrappers
+ *
+ * The operands of a batched function are given either as one array per
+ * problem (the `_batch` functions, where a single array is shared by all
+ * problems) or as one array holding problem b at offset b * stride (the
+ * `_batch_strided` functions, where a stride of 0 shares the operand). The
+ * kernels take the strided form: separate arrays are packed back to back,
+ * into the WASM heap or, for the native backend, into a scratch array.
+ */
+
+import { gatherAt, packedLength, packMatrixAt, scatterAt, unpackMatrixAt } from './utils';
+
+/**
+ * A batched operand: one array per problem, or one array and the stride
+ * between problems
+ * @internal
+ */
+export type BatchOperand = Float64Array[] | { array: Float64Array; stride: number };
+
+/**
+ * Whether an operand is given as one array with a stride
+ * @internal
+ */
+export function isStrided(op: BatchOperand): op is { array: Float64Array; stride: number } {
+  return !Array.isArray(op);
+}
+
+/**
+ * Number of distinct members of an operand: 1 if it is shared, batch otherwise
+ * @internal
+ */
+export function batchMembers(op: BatchOperand, batch: number): number {
+  const shared = Array.isArray(op) ? op.length === 1 : op.stride === 0;
+  return shared ? 1 : batch;
+}
+
+// Member b of an operand, as an array starting at its first element
+function member(op: BatchOperand, b: number): Float64Array {
+  if (Array.isArray(op)) {
+    return op[op.length === 1 ? 0 : b];
+  }
+  return op.stride === 0 ? op.array : op.array.subarray(b * op.stride);
+}
+
+/**
+ * Check that an operand holds batch members of at least `length` elements;
+ * an output may not be shared, and its members may not overlap
+ * @internal
+ */
+export function checkBatchOperand(
+  name: string,
+  op: BatchOperand,
+  batch: number,
+  length: number,
+  output: boolean
+): void {
+  if (Array.isArray(op)) {
+    if (op.length !== batch && (output || op.length !== 1)) {
+      const expected = output ? `${batch}` : `1 or ${batch}`;
+      throw new Error(`${name} must hold ${expected} arrays, got ${op.length}`);
+    }
+    op.forEach((array, b) => {
+      if (array.length < length) {
+        throw new Error(
+          `${name}[${b}] array too small: expected at least ${length}, got ${array.length}`
+        );
+      }
+    });
+    return;
+  }
+
+  const { array, stride } = op;
+  if (!Number.isInteger(stride) || stride < 0) {
+    throw new Error(`stride of ${name} must be a non-negative integer, got ${stride}`);
+  }
+  if (output && batch > 1 && stride < length) {
+    throw new Error(`stride of ${name} must be at least ${length}, got ${stride}`);
+  }
+  const needed = batch === 0 ? 0 : (batch - 1) * stride + length;
+  if (array.length < needed) {
+    throw new Error(`${name} array too small: expected at least ${needed}, got ${array.length}`);
+  }
+}
+
+/**
+ * Copy the first `members` rows x cols matrices of an operand into dst from
+ * index k, each with leading dimension ld and rows * ld elements apart
+ * @internal
+ */
+export function packMatrices(
+  dst: Float64Array,
+  k: number,
+  op: BatchOperand,
+  members: number,
+  lda: number,
+  rows: number,
+  cols: number,
+  ld: number
+): void {
+  for (let b = 0; b < members; b++) {
+    packMatrixAt(dst, k + b * ld * cols, member(op, b), lda, rows, cols, ld);
+  }
+}
+
+/**
+ * Copy matrices packed by packMatrices() back to the operand
+ * @internal
+ */
+export function unpackMatrices(
+  src: Float64Array,
+  k: number,
+  op: BatchOperand,
+  members: number,
+  lda: number,
+  rows: number,
+  cols: number,
+  ld: number
+): void {
+  for (let b = 0; b < members; b++) {
+    unpackMatrixAt(src, k + b * ld * cols, ld, member(op, b), lda, rows, cols);
+  }
+}
+
+/**
+ * Copy the first `members` n-vectors of an operand contiguously into dst
+ * from index k, packedLength(n, inc) elements apart
+ * @internal
+ */
+export function packVectors(
+  dst: Float64Array,
+  k: number,
+  op: BatchOperand,
+  members: number,
+  n: number,
+  inc: number
+): void {
+  const size = packedLength(n, inc);
+  for (let b = 0; b < members; b++) {
+    gatherAt(dst, k + b * size, member(op, b), n, inc);
+  }
+}
+
+/**
+ * Copy vectors packed by packVectors() back to the operand
+ * @internal
+ */
+export function unpackVectors(
+  src: Float64Array,
+  k: number,
+  op: BatchOperand,
+  members: number,
+  n: number,
+  inc: number
+): void {
+  const size = packedLength(n, inc);
+  for (let b = 0; b < members; b++) {
+    scatterAt(src, k + b * size, member(op, b), n, inc);
+  }
+}
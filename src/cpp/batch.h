@@ -0,0 +1,128 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+/**
+ * Helpers for the batched kernels
+ *
+ * A strided batch applies one routine to `batch` independent problems whose
+ * operands lie at fixed element strides from each other; a stride of 0 on an
+ * input shares it between all problems. The batch is split into chunks that
+ * run on the thread pool (parallel.h) when the total work is large enough.
+ * Batches of problems of different sizes are scheduled by cost instead
+ * (for_each_weighted).
+ *
+ * Problems whose matrices have at most TINY rows and columns, or whose
+ * vectors have at most SHORT elements, are too small for SIMD within one
+ * problem. With WebAssembly SIMD, pairs of them are computed together
+ * instead, one problem per f64x2 lane, mirroring the unit-stride loops of the
+ * single-problem kernel so that each lane rounds exactly like a separate call.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "parallel.h"
+#include "simd.h"
+
+namespace batch {
+
+// Largest matrix dimension computed two problems at a time
+constexpr int TINY = 8;
+
+// Longest vector computed two at a time by the batched Level 1 kernels
+constexpr int SHORT = 16;
+
+// Flops per chunk below which waking the pool does not pay off
+constexpr double MIN_TASK_WORK = 32768.0;
+
+// Element offset of problem b in an operand with the given stride
+inline size_t offset(int b, int stride) { return static_cast<size_t>(b) * stride; }
+
+// Call f(first, last) on consecutive chunks of [0, count) that together hold
+// `work` flops per problem, in parallel if there is enough work. Chunks start
+// at even indices, so pairs of problems stay in one chunk.
+template <typename F>
+void for_each_chunk(int count, double work, F f) {
+    int nthreads = parallel::num_threads();
+    int tasks = static_cast<int>(std::min<double>(4.0 * nthreads, count * work / MIN_TASK_WORK));
+    if (nthreads == 1 || tasks <= 1) {
+        f(0, count);
+        return;
+    }
+    int chunk = ((count + tasks - 1) / tasks + 1) & ~1;
+    tasks = (count + chunk - 1) / chunk;
+    parallel::run(tasks, [&](int t) {
+        int first = t * chunk;
+        f(first, std::min(count, first + chunk));
+    });
+}
+
+// Call f(i) for every item i in [0, count), where item i costs cost(i) flops,
+// balancing uneven costs across the pool. Items costing at least one
+// thread's share of the total run first, one at a time on the calling thread,
+// so that f can use the pool itself. The rest are handed out largest first
+// (longest processing time order), the small ones in runs of about `grain`
+// flops; the pool gives the next task to whichever thread is free, so no
+// thread is left with a large item at the end.
+template <typename Cost, typename F>
+void for_each_weighted(int count, Cost cost, F f) {
+    int nthreads = parallel::num_threads();
+    std::vector<double> costs(count);
+    double total = 0.0;
+    for (int i = 0; i < count; i++) {
+        costs[i] = cost(i);
+        total += costs[i];
+    }
+    if (nthreads == 1 || total < 2.0 * MIN_TASK_WORK) {
+        for (int i = 0; i < count; i++) f(i);
+        return;
+    }
+
+    std::vector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int i, int j) { return costs[i] > costs[j]; });
+
+    double share = total / nthreads;
+    int first = 0;
+    for (; first < count && costs[order[first]] >= share; first++) f(order[first]);
+
+    double grain = std::max(MIN_TASK_WORK, total / (16.0 * nthreads));
+    std::vector<int> starts;
+    double run = grain;
+    for (int p = first; p < count; p++) {
+        if (run >= grain) {
+            starts.push_back(p);
+            run = 0.0;
+        }
+        run += costs[order[p]];
+    }
+    starts.push_back(count);
+
+    parallel::run(static_cast<int>(starts.size()) - 1, [&](int t) {
+        for (int p = starts[t]; p < starts[t + 1]; p++) f(order[p]);
+    });
+}
+
+#ifdef __wasm_simd128__
+
+// Element k of two problems' operands, one per lane
+inline v128_t load2(const double* p0, const double* p1, size_t k) {
+    return wasm_f64x2_make(p0[k], p1[k]);
+}
+
+inline void store2(double* p0, double* p1, size_t k, v128_t v) {
+    p0[k] = wasm_f64x2_extract_lane(v, 0);
+    p1[k] = wasm_f64x2_extract_lane(v, 1);
+}
+
+// Lanes of v where mask is set, zero elsewhere
+inline v128_t where(v128_t mask, v128_t v) { return wasm_v128_and(mask, v); }
+
+#endif // __wasm_simd128__
+
+} // namespace batch
+
+#endif // BATCH_H
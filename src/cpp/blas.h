@@ -1,7 +1,25 @@
 #ifndef BLAS_H
 #define BLAS_H
 
+/**
+ * Public C API of the kernels
+ *
+ * This header is valid C and C++ and describes the functions exported by
+ * every build: the Emscripten module, the standalone WASI module and the
+ * native libraries. Matrices are column-major, array arguments are plain
+ * pointers into the caller's (or the wasm instance's) memory, and flags are
+ * passed as characters ('N', 'T', 'U', 'L', ...) or, where noted in the
+ * kernel sources, as small integers.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
 extern "C" {
+#endif
+
+// Level 1 BLAS
 
 /**
  * DAXPY - Double precision A*X Plus Y
@@ -9,6 +27,498 @@ extern "C" {
  */
 void daxpy(int n, double alpha, const double* x, int incx, double* y, int incy);
 
+/**
+ * DAXPBY - Double precision extended AXPY
+ * Computes: y = alpha * x + beta * y
+ */
+void daxpby(int n, double alpha, const double* x, int incx, double beta, double* y, int incy);
+
+/**
+ * DCOPY - Double precision vector copy
+ * Computes: y = x
+ */
+void dcopy(int n, const double* x, int incx, double* y, int incy);
+
+/**
+ * DDOT - Double precision dot product
+ * Computes: x^T * y
+ */
+double ddot(int n, const double* x, int incx, const double* y, int incy);
+
+/**
+ * DSCAL - Double precision vector scaling
+ * Computes: x = alpha * x
+ */
+void dscal(int n, double alpha, double* x, int incx);
+
+/**
+ * DASUM - Double precision sum of absolute values
+ * Computes: sum(|x_i|)
+ */
+double dasum(int n, const double* x, int incx);
+
+/**
+ * DNRM2 - Double precision Euclidean norm
+ * Computes: sqrt(x^T * x) without overflow or underflow
+ */
+double dnrm2(int n, const double* x, int incx);
+
+/**
+ * DSWAP - Double precision vector swap
+ * Computes: x <-> y
+ */
+void dswap(int n, double* x, int incx, double* y, int incy);
+
+/**
+ * DROT - Double precision plane rotation
+ * Computes: [x, y] = [c*x + s*y, c*y - s*x]
+ */
+void drot(int n, double* x, int incx, double* y, int incy, double c, double s);
+
+/**
+ * DROTG - Double precision Givens rotation generation
+ */
+void drotg(double* a, double* b, double* c, double* s);
+
+/**
+ * DROTM - Double precision modified Givens rotation
+ */
+void drotm(int n, double* x, int incx, double* y, int incy, const double* param);
+
+/**
+ * DROTMG - Double precision modified Givens rotation generation
+ */
+void drotmg(double* dd1, double* dd2, double* dx1, double dy1, double* param);
+
+// Level 2 BLAS
+
+/**
+ * DGEMV - Double precision general matrix-vector multiplication
+ * Computes: y = alpha * op(A) * x + beta * y
+ */
+void dgemv(int trans, int m, int n, double alpha, const double* a, int lda, const double* x,
+           int incx, double beta, double* y, int incy);
+
+/**
+ * DGBMV - Double precision general band matrix-vector multiplication
+ * Computes: y = alpha * op(A) * x + beta * y
+ */
+void dgbmv(int trans, int m, int n, int kl, int ku, double alpha, const double* a, int lda,
+           const double* x, int incx, double beta, double* y, int incy);
+
+/**
+ * DGER - Double precision general rank-1 update
+ * Computes: A = alpha * x * y^T + A
+ */
+void dger(int m, int n, double alpha, const double* x, int incx, const double* y, int incy,
+          double* a, int lda);
+
+/**
+ * DSYMV - Double precision symmetric matrix-vector multiplication
+ * Computes: y = alpha * A * x + beta * y
+ */
+void dsymv(char uplo, int n, double alpha, const double* a, int lda, const double* x, int incx,
+           double beta, double* y, int incy);
+
+/**
+ * DSBMV - Double precision symmetric band matrix-vector multiplication
+ * Computes: y = alpha * A * x + beta * y
+ */
+void dsbmv(int uplo, int n, int k, double alpha, const double* a, int lda, const double* x,
+           int incx, double beta, double* y, int incy);
+
+/**
+ * DSPMV - Double precision symmetric packed matrix-vector multiplication
+ * Computes: y = alpha * A * x + beta * y
+ */
+void dspmv(int uplo, int n, double alpha, const double* ap, const double* x, int incx,
+           double beta, double* y, int incy);
+
+/**
+ * DSYR - Double precision symmetric rank-1 update
+ * Computes: A = alpha * x * x^T + A
+ */
+void dsyr(char uplo, int n, double alpha, const double* x, int incx, double* a, int lda);
+
+/**
+ * DSYR2 - Double precision symmetric rank-2 update
+ * Computes: A = alpha * x * y^T + alpha * y * x^T + A
+ */
+void dsyr2(char uplo, int n, double alpha, const double* x, int incx, const double* y, int incy,
+           double* a, int lda);
+
+/**
+ * DSPR - Double precision symmetric packed rank-1 update
+ * Computes: A = alpha * x * x^T + A
+ */
+void dspr(int uplo, int n, double alpha, const double* x, int incx, double* ap);
+
+/**
+ * DSPR2 - Double precision symmetric packed rank-2 update
+ * Computes: A = alpha * x * y^T + alpha * y * x^T + A
+ */
+void dspr2(int uplo, int n, double alpha, const double* x, int incx, const double* y, int incy,
+           double* ap);
+
+/**
+ * DTRMV - Double precision triangular matrix-vector multiplication
+ * Computes: x = op(A) * x
+ */
+void dtrmv(char uplo, char trans, char diag, int n, const double* a, int lda, double* x,
+           int incx);
+
+/**
+ * DTRSV - Double precision triangular solve
+ * Solves: op(A) * x = b
+ */
+void dtrsv(char uplo, char trans, char diag, int n, const double* a, int lda, double* x,
+           int incx);
+
+/**
+ * DTBMV - Double precision triangular band matrix-vector multiplication
+ * Computes: x = op(A) * x
+ */
+void dtbmv(int uplo, int trans, int diag, int n, int k, const double* a, int lda, double* x,
+           int incx);
+
+/**
+ * DTBSV - Double precision triangular band solve
+ * Solves: op(A) * x = b
+ */
+void dtbsv(int uplo, int trans, int diag, int n, int k, const double* a, int lda, double* x,
+           int incx);
+
+/**
+ * DTPMV - Double precision triangular packed matrix-vector multiplication
+ * Computes: x = op(A) * x
+ */
+void dtpmv(int uplo, int trans, int diag, int n, const double* ap, double* x, int incx);
+
+/**
+ * DTPSV - Double precision triangular packed solve
+ * Solves: op(A) * x = b
+ */
+void dtpsv(int uplo, int trans, int diag, int n, const double* ap, double* x, int incx);
+
+// Batched Level 1 BLAS: problem b uses x + b * stridex, y + b * stridey; a
+// stride of 0 shares an input vector between all problems
+
+/**
+ * DDOT_BATCH_STRIDED - result[b] = ddot of problem b
+ */
+void ddot_batch_strided(int n, const double* x, int incx, int stridex, const double* y, int incy,
+                        int stridey, double* result, int batch);
+
+/**
+ * DNRM2_BATCH_STRIDED - result[b] = dnrm2 of problem b
+ */
+void dnrm2_batch_strided(int n, const double* x, int incx, int stridex, double* result, int batch);
+
+/**
+ * DASUM_BATCH_STRIDED - result[b] = dasum of problem b
+ */
+void dasum_batch_strided(int n, const double* x, int incx, int stridex, double* result, int batch);
+
+/**
+ * DAXPY_BATCH_STRIDED - daxpy on each of `batch` problems
+ */
+void daxpy_batch_strided(int n, double alpha, const double* x, int incx, int stridex, double* y,
+                         int incy, int stridey, int batch);
+
+/**
+ * DSCAL_BATCH_STRIDED - dscal on each of `batch` problems
+ */
+void dscal_batch_strided(int n, double alpha, double* x, int incx, int stridex, int batch);
+
+// Batched Level 2 BLAS: problem b uses a + b * stridea, x + b * stridex, ...;
+// a stride of 0 shares an input between all problems
+
+/**
+ * DGEMV_BATCH_STRIDED - dgemv on each of `batch` problems
+ */
+void dgemv_batch_strided(int trans, int m, int n, double alpha, const double* a, int lda,
+                         int stridea, const double* x, int incx, int stridex, double beta,
+                         double* y, int incy, int stridey, int batch);
+
+/**
+ * DSYMV_BATCH_STRIDED - dsymv on each of `batch` problems
+ */
+void dsymv_batch_strided(char uplo, int n, double alpha, const double* a, int lda, int stridea,
+                         const double* x, int incx, int stridex, double beta, double* y,
+                         int incy, int stridey, int batch);
+
+/**
+ * DTRMV_BATCH_STRIDED - dtrmv on each of `batch` problems
+ */
+void dtrmv_batch_strided(char uplo, char trans, char diag, int n, const double* a, int lda,
+                         int stridea, double* x, int incx, int stridex, int batch);
+
+/**
+ * DTRSV_BATCH_STRIDED - dtrsv on each of `batch` problems
+ */
+void dtrsv_batch_strided(char uplo, char trans, char diag, int n, const double* a, int lda,
+                         int stridea, double* x, int incx, int stridex, int batch);
+
+/**
+ * DGER_BATCH_STRIDED - dger on each of `batch` problems
+ */
+void dger_batch_strided(int m, int n, double alpha, const double* x, int incx, int stridex,
+                        const double* y, int incy, int stridey, double* a, int lda, int stridea,
+                        int batch);
+
+// Level 3 BLAS
+
+/**
+ * DGEMM - Double precision general matrix-matrix multiplication
+ * Computes: C = alpha * op(A) * op(B) + beta * C
+ */
+void dgemm(char transa, char transb, int m, int n, int k, double alpha, const double* a, int lda,
+           const double* b, int ldb, double beta, double* c, int ldc);
+
+/**
+ * DGEMMTR - Double precision GEMM updating one triangle of C
+ * Computes: C = alpha * op(A) * op(B) + beta * C (upper or lower part only)
+ */
+void dgemmtr(int uplo, int transa, int transb, int n, int k, double alpha, const double* a,
+             int lda, const double* b, int ldb, double beta, double* c, int ldc);
+
+/**
+ * DGEMM_BATCH - dgemm on groups of problems, each group with its own flags,
+ * sizes and scalars; problem p uses a + offa[p], b + offb[p], c + offc[p]
+ */
+void dgemm_batch(int group_count, const int* group_size, const int* transa, const int* transb,
+                 const int* m, const int* n, const int* k, const double* alpha, const double* a,
+                 const int* lda, const int* offa, const double* b, const int* ldb,
+                 const int* offb, const double* beta, double* c, const int* ldc,
+                 const int* offc);
+
+/**
+ * DSYMM - Double precision symmetric matrix-matrix multiplication
+ * Computes: C = alpha * A * B + beta * C  or  C = alpha * B * A + beta * C
+ */
+void dsymm(char side, char uplo, int m, int n, double alpha, const double* a, int lda,
+           const double* b, int ldb, double beta, double* c, int ldc);
+
+/**
+ * DSYRK - Double precision symmetric rank-k update
+ * Computes: C = alpha * op(A) * op(A)^T + beta * C
+ */
+void dsyrk(char uplo, char trans, int n, int k, double alpha, const double* a, int lda,
+           double beta, double* c, int ldc);
+
+/**
+ * DSYR2K - Double precision symmetric rank-2k update
+ * Computes: C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C
+ */
+void dsyr2k(char uplo, char trans, int n, int k, double alpha, const double* a, int lda,
+            const double* b, int ldb, double beta, double* c, int ldc);
+
+/**
+ * DTRMM - Double precision triangular matrix-matrix multiplication
+ * Computes: B = alpha * op(A) * B  or  B = alpha * B * op(A)
+ */
+void dtrmm(char side, char uplo, char transa, char diag, int m, int n, double alpha,
+           const double* a, int lda, double* b, int ldb);
+
+/**
+ * DTRSM - Double precision triangular solve with multiple right-hand sides
+ * Solves: op(A) * X = alpha * B  or  X * op(A) = alpha * B
+ */
+void dtrsm(char side, char uplo, char transa, char diag, int m, int n, double alpha,
+           const double* a, int lda, double* b, int ldb);
+
+// Low precision extensions
+
+/**
+ * GEMM_U8S8S32 - Quantized uint8 x int8 matrix-matrix multiplication
+ * Computes: C = (op(A) - a_zero) * (op(B) - b_zero) with int32 accumulation
+ */
+void gemm_u8s8s32(char transa, char transb, int m, int n, int k, const uint8_t* a, int lda,
+                  int a_zero, const int8_t* b, int ldb, int b_zero, int32_t* c, int ldc);
+
+/**
+ * GEMM_U8S8U8 - Quantized GEMM with fused requantization to uint8
+ */
+void gemm_u8s8u8(char transa, char transb, int m, int n, int k, const uint8_t* a, int lda,
+                 int a_zero, const int8_t* b, int ldb, int b_zero, const int32_t* bias,
+                 const float* scale, int per_channel, int c_zero, uint8_t* c, int ldc);
+
+/**
+ * Conversions between bfloat16 / fp16 storage and float / double
+ */
+void sbstobf16(int n, const float* in, int incin, uint16_t* out, int incout);
+void sbdtobf16(int n, const double* in, int incin, uint16_t* out, int incout);
+void sbf16tos(int n, const uint16_t* in, int incin, float* out, int incout);
+void dbf16tod(int n, const uint16_t* in, int incin, double* out, int incout);
+void shstof16(int n, const float* in, int incin, uint16_t* out, int incout);
+void shdtof16(int n, const double* in, int incin, uint16_t* out, int incout);
+void shf16tos(int n, const uint16_t* in, int incin, float* out, int incout);
+void df16tod(int n, const uint16_t* in, int incin, double* out, int incout);
+
+/**
+ * SBGEMM / SHGEMM - Matrix-matrix multiplication with bfloat16 / fp16 storage
+ * Computes: C = alpha * op(A) * op(B) + beta * C in single precision
+ */
+void sbgemm(char transa, char transb, int m, int n, int k, float alpha, const uint16_t* a,
+            int lda, const uint16_t* b, int ldb, float beta, float* c, int ldc);
+void shgemm(char transa, char transb, int m, int n, int k, float alpha, const uint16_t* a,
+            int lda, const uint16_t* b, int ldb, float beta, float* c, int ldc);
+
+/**
+ * SBGEMV / SHGEMV - Matrix-vector multiplication with bfloat16 / fp16 storage
+ * Computes: y = alpha * op(A) * x + beta * y in single precision
+ */
+void sbgemv(char trans, int m, int n, float alpha, const uint16_t* a, int lda, const uint16_t* x,
+            int incx, float beta, float* y, int incy);
+void shgemv(char trans, int m, int n, float alpha, const uint16_t* a, int lda, const uint16_t* x,
+            int incx, float beta, float* y, int incy);
+
+// LAPACK auxiliary routines
+
+/**
+ * DLACPY - Copy all of A, or its upper ('U') or lower ('L') triangle, to B
+ */
+void dlacpy(char uplo, int m, int n, const double* a, int lda, double* b, int ldb);
+
+/**
+ * DLASET - Set the off-diagonal elements of A (all, or the strictly upper 'U' or
+ * lower 'L' triangle) to alpha and the diagonal to beta
+ */
+void dlaset(char uplo, int m, int n, double alpha, double beta, double* a, int lda);
+
+/**
+ * DLASCL - Multiply A ('G'), or its upper ('U') or lower ('L') triangle, by cto/cfrom
+ * without intermediate overflow or underflow
+ */
+void dlascl(char type, double cfrom, double cto, int m, int n, double* a, int lda);
+
+/**
+ * DLANGE - Max abs ('M'), 1-norm ('1'), infinity-norm ('I') or Frobenius norm ('F') of A
+ */
+double dlange(char norm, int m, int n, const double* a, int lda);
+
+/**
+ * DLANSY - Norm of a symmetric matrix stored in its upper ('U') or lower ('L') triangle
+ */
+double dlansy(char norm, char uplo, int n, const double* a, int lda);
+
+/**
+ * DLANTR - Norm of an upper ('U') or lower ('L') trapezoidal matrix, with a unit
+ * diagonal if diag is 'U'
+ */
+double dlantr(char norm, char uplo, char diag, int m, int n, const double* a, int lda);
+
+/**
+ * DREDUCE - Sum ('S'), sum of absolute values ('A'), sum of squares ('Q'), Euclidean
+ * norm ('N') or max abs ('M') of each column ('C') or each row ('R') of A
+ */
+void dreduce(char op, char axis, int m, int n, const double* a, int lda, double* r);
+
+// LAPACK routines
+
+/**
+ * DGETRF - LU factorization with partial pivoting: A = P * L * U; ipiv is 1-based.
+ * Returns 0, or i > 0 if U(i, i) is exactly zero
+ */
+int dgetrf(int m, int n, double* a, int lda, int* ipiv);
+
+/**
+ * DGETRS - Solve op(A) * X = B with the LU factorization from DGETRF
+ */
+void dgetrs(char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b,
+            int ldb);
+
+/**
+ * DGETRI - Inverse of A from the LU factorization from DGETRF, in place.
+ * Returns 0, or i > 0 if U(i, i) is exactly zero
+ */
+int dgetri(int n, double* a, int lda, const int* ipiv);
+
+/**
+ * DTRTRI - Inverse of an upper ('U') or lower ('L') triangular matrix, in place.
+ * Returns 0, or i > 0 if A(i, i) is exactly zero
+ */
+int dtrtri(char uplo, char diag, int n, double* a, int lda);
+
+/**
+ * DPOTRF - Cholesky factorization A = U^T * U ('U') or A = L * L^T ('L').
+ * Returns 0, or i > 0 if the leading minor of order i is not positive definite
+ */
+int dpotrf(char uplo, int n, double* a, int lda);
+
+/**
+ * DPOTRI - Inverse of A from the Cholesky factorization from DPOTRF, in place.
+ * Returns 0, or i > 0 if the factor has a zero at (i, i)
+ */
+int dpotri(char uplo, int n, double* a, int lda);
+
+/**
+ * DGEQRF - QR factorization A = Q * R with Householder reflectors
+ */
+void dgeqrf(int m, int n, double* a, int lda, double* tau);
+
+/**
+ * DORMQR - Multiply C by Q or Q^T from DGEQRF, from the left ('L') or the right ('R')
+ */
+void dormqr(char side, char trans, int m, int n, int k, const double* a, int lda,
+            const double* tau, double* c, int ldc);
+
+/**
+ * DGELS - Least squares or minimum norm solution of op(A) * X = B by QR (m >= n) or
+ * LQ (m < n). Returns 0, or i > 0 if A does not have full rank
+ */
+int dgels(char trans, int m, int n, int nrhs, double* a, int lda, double* b, int ldb);
+
+/**
+ * DGELS_NORMAL - Least squares solution by the normal equations (DSYRK and Cholesky),
+ * falling back to DGELS if A is ill-conditioned
+ */
+int dgels_normal(int m, int n, int nrhs, double* a, int lda, double* b, int ldb);
+
+// Kronecker products
+
+/**
+ * DKRONMV - Kronecker product matrix-vector multiplication
+ * Computes: y = alpha * op(A_0 (x) ... (x) A_{d-1}) * x + beta * y, one DGEMM per factor
+ */
+void dkronmv(char trans, int d, const int* m, const int* n, double alpha, const double* a,
+             const int* lda, const int* offa, const double* x, double beta, double* y);
+
+/**
+ * DKRONSV - Kronecker product solve
+ * Solves: op(A_0 (x) ... (x) A_{d-1}) * x = b with the LU factorization of each factor.
+ * Returns 0, or k > 0 if factor k - 1 is exactly singular
+ */
+int dkronsv(char trans, int d, const int* n, const double* a, const int* lda, const int* offa,
+            double* b);
+
+// Eigensolvers
+
+/**
+ * DPOWER - Power iteration for the eigenvalue of largest magnitude of a dense ('D'),
+ * symmetric band ('B'), symmetric packed ('P') or sparse CSR ('S') matrix.
+ * Returns 0 on convergence, 1 otherwise
+ */
+int dpower(char kind, char uplo, int n, int k, const double* a, int lda, const int* ia,
+           const int* ja, int maxit, double tol, double* x, double* lambda);
+
+/**
+ * DLANCZOS - Thick-restart Lanczos for nev eigenpairs of a symmetric matrix in the storage
+ * of DPOWER. Returns 0 on convergence, or the number of eigenpairs that did not converge
+ */
+int dlanczos(char kind, char uplo, int n, int k, const double* a, int lda, const int* ia,
+             const int* ja, char which, int nev, int ncv, int maxit, double tol, double* w,
+             double* z, int ldz);
+
+// Memory
+
+/**
+ * 64-byte (cache line) aligned allocation; release with free()
+ */
+void* malloc_aligned(size_t bytes);
+
+#ifdef __cplusplus
 } // extern "C"
+#endif
 
 #endif // BLAS_H
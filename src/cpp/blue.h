@@ -0,0 +1,139 @@
+#ifndef BLUE_H
+#define BLUE_H
+
+/**
+ * Blue's algorithm for sums of squares without overflow or underflow
+ *
+ * Elements are classified against the thresholds tsml and tbig: tiny ones
+ * are accumulated scaled up by ssml, huge ones scaled down by sbig and the
+ * rest unscaled, and the three sums are combined at the end. This is the
+ * scheme of the reference DNRM2 / DLASSQ (LAPACK 3.10), shared by dnrm2 and
+ * the matrix norm and reduction kernels.
+ */
+
+#include <cmath>
+
+#include "simd.h"
+
+namespace blue {
+
+// Thresholds and scaling factors for IEEE double precision
+constexpr double tsml = 0x1p-511;
+constexpr double tbig = 0x1p+486;
+constexpr double ssml = 0x1p+537;
+constexpr double sbig = 0x1p-538;
+
+struct Accumulator {
+    // abig -- sums of squares scaled down to avoid overflow
+    // asml -- sums of squares scaled up to avoid underflow
+    // amed -- sums of squares that do not require scaling
+    double asml = 0.0;
+    double amed = 0.0;
+    double abig = 0.0;
+    bool notbig = true;
+
+    void add(double x) {
+        double ax = std::abs(x);
+        if (ax > tbig) {
+            abig = abig + (ax * sbig) * (ax * sbig);
+            notbig = false;
+        } else if (ax < tsml) {
+            if (notbig) asml = asml + (ax * ssml) * (ax * ssml);
+        } else {
+            amed = amed + ax * ax;
+        }
+    }
+
+    // Add x[0], ..., x[n - 1]
+    void add(const double* x, int n) {
+        int i = 0;
+#ifdef __wasm_simd128__
+        // Vector pass: accumulate amed while every element is zero or
+        // mid-range. If any element needs scaling, start over with the
+        // scalar loop below.
+        const v128_t vsml = wasm_f64x2_splat(tsml);
+        const v128_t vbig = wasm_f64x2_splat(tbig);
+        const v128_t vzero = wasm_f64x2_splat(0.0);
+        v128_t s0 = vzero;
+        v128_t s1 = vzero;
+        v128_t out = wasm_i64x2_splat(0);
+        for (; i + 4 <= n; i += 4) {
+            v128_t a0 = wasm_f64x2_abs(wasm_v128_load(x + i));
+            v128_t a1 = wasm_f64x2_abs(wasm_v128_load(x + i + 2));
+            out = wasm_v128_or(out, wasm_f64x2_gt(a0, vbig));
+            out = wasm_v128_or(out, wasm_f64x2_gt(a1, vbig));
+            out = wasm_v128_or(out, wasm_v128_and(wasm_f64x2_lt(a0, vsml), wasm_f64x2_gt(a0, vzero)));
+            out = wasm_v128_or(out, wasm_v128_and(wasm_f64x2_lt(a1, vsml), wasm_f64x2_gt(a1, vzero)));
+            s0 = simd::madd_f64x2(a0, a0, s0);
+            s1 = simd::madd_f64x2(a1, a1, s1);
+        }
+        if (wasm_v128_any_true(out)) {
+            i = 0;
+        } else {
+            amed = amed + simd::hsum_f64x2(wasm_f64x2_add(s0, s1));
+        }
+#endif
+        for (; i < n; i++) add(x[i]);
+    }
+
+    // Add the sums of another accumulator
+    void merge(const Accumulator& other) {
+        asml = asml + other.asml;
+        amed = amed + other.amed;
+        abig = abig + other.abig;
+        notbig = notbig && other.notbig;
+    }
+
+    // Multiply the sum of squares by a small power of two (e.g. 2 for the
+    // mirrored half of a symmetric matrix)
+    void scale(double s) {
+        asml = asml * s;
+        amed = amed * s;
+        abig = abig * s;
+    }
+
+    // Square root of the sum of squares
+    double norm() const {
+        double scl;
+        double sumsq;
+        // Combine abig and amed or amed and asml if more than one
+        // accumulator was used.
+        if (abig > 0.0) {
+            // Combine abig and amed if abig > 0.
+            double big = abig;
+            if (amed > 0.0 || amed != amed) { // Check for NaN
+                big = big + (amed * sbig) * sbig;
+            }
+            scl = 1.0 / sbig;
+            sumsq = big;
+        } else if (asml > 0.0) {
+            // Combine amed and asml if asml > 0.
+            if (amed > 0.0 || amed != amed) { // Check for NaN
+                double med = std::sqrt(amed);
+                double sml = std::sqrt(asml) / ssml;
+                double ymin, ymax;
+                if (sml > med) {
+                    ymin = med;
+                    ymax = sml;
+                } else {
+                    ymin = sml;
+                    ymax = med;
+                }
+                scl = 1.0;
+                sumsq = ymax * ymax * (1.0 + (ymin / ymax) * (ymin / ymax));
+            } else {
+                scl = 1.0 / ssml;
+                sumsq = asml;
+            }
+        } else {
+            // Otherwise all values are mid-range
+            scl = 1.0;
+            sumsq = amed;
+        }
+        return scl * std::sqrt(sumsq);
+    }
+};
+
+} // namespace blue
+
+#endif // BLUE_H
@@ -0,0 +1,82 @@
+#ifndef BLAS_CHECK_H
+#define BLAS_CHECK_H
+
+/**
+ * Argument checks for the debug build
+ *
+ * Compiled with BLAS_DEBUG, the Level 2 and Level 3 kernels validate their
+ * flags, dimensions, leading dimensions and increments the way the reference
+ * BLAS does with XERBLA: the first illegal argument is reported by its 1-based
+ * position and the call is aborted. In WebAssembly the report is thrown to
+ * the JavaScript caller. Without BLAS_DEBUG the checks compile to nothing.
+ */
+
+#ifdef BLAS_DEBUG
+
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#endif
+
+namespace check {
+
+[[noreturn]] inline void xerbla(const char* routine, int pos) {
+    char msg[96];
+    std::snprintf(msg, sizeof(msg), "On entry to %s parameter number %d had an illegal value",
+                  routine, pos);
+#ifdef __EMSCRIPTEN__
+    emscripten_throw_string(msg);
+#else
+    std::fprintf(stderr, " ** %s\n", msg);
+#endif
+    std::abort();
+}
+
+// Character flags
+inline bool trans(char c) {
+    return c == 'N' || c == 'n' || c == 'T' || c == 't' || c == 'C' || c == 'c';
+}
+inline bool uplo(char c) { return c == 'U' || c == 'u' || c == 'L' || c == 'l'; }
+inline bool diag(char c) { return c == 'U' || c == 'u' || c == 'N' || c == 'n'; }
+inline bool side(char c) { return c == 'L' || c == 'l' || c == 'R' || c == 'r'; }
+inline bool notrans(char c) { return c == 'N' || c == 'n'; }
+inline bool left(char c) { return c == 'L' || c == 'l'; }
+inline bool op(char c) {
+    return c == 'D' || c == 'd' || c == 'B' || c == 'b' || c == 'P' || c == 'p' || c == 'S' ||
+           c == 's';
+}
+inline bool which(char c) {
+    return c == 'L' || c == 'l' || c == 'S' || c == 's' || c == 'M' || c == 'm';
+}
+inline bool norm(char c) {
+    return c == 'M' || c == 'm' || c == '1' || c == 'O' || c == 'o' || c == 'I' || c == 'i' ||
+           c == 'F' || c == 'f' || c == 'E' || c == 'e';
+}
+inline bool reduction(char c) {
+    return c == 'S' || c == 's' || c == 'A' || c == 'a' || c == 'Q' || c == 'q' || c == 'N' ||
+           c == 'n' || c == 'M' || c == 'm';
+}
+inline bool axis(char c) { return c == 'C' || c == 'c' || c == 'R' || c == 'r'; }
+
+// Integer flags: trans 0 ('N'), 1 ('T') or 2 ('C'); uplo and diag 0 or 1
+inline bool trans(int t) { return t >= 0 && t <= 2; }
+inline bool flag(int f) { return f == 0 || f == 1; }
+
+inline int max1(int n) { return n > 1 ? n : 1; }
+
+} // namespace check
+
+#define BLAS_CHECK(routine, cond, pos)              \
+    do {                                            \
+        if (!(cond)) check::xerbla(routine, pos);   \
+    } while (0)
+
+#else
+
+#define BLAS_CHECK(routine, cond, pos) ((void)0)
+
+#endif // BLAS_DEBUG
+
+#endif // BLAS_CHECK_H
@@ -6,6 +6,9 @@
  * This is a C++ implementation of the BLAS Level 1 DASUM routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, long vectors are split into one range per thread
+ * (parallel::Split) and the partial sums added in order.
+ * 
  * @param n      Number of elements in input vector
  * @param x      Input vector x
  * @param incx   Storage spacing between elements of x
@@ -13,10 +16,14 @@
  */
 
 #include <cmath>
+#include <cstddef>
+#include <vector>
 
-extern "C" {
+#include "parallel.h"
 
-double dasum(int n, const double* x, int incx) {
+namespace {
+
+double dasum_serial(int n, const double* x, int incx) {
     double dtemp = 0.0;
     
     // Quick return if possible
@@ -50,4 +57,26 @@ double dasum(int n, const double* x, int incx) {
     return dtemp;
 }
 
+} // namespace
+
+extern "C" {
+
+double dasum(int n, const double* x, int incx) {
+    // Quick return if possible
+    if (n <= 0 || incx <= 0) return 0.0;
+
+    // Long vectors: one partial sum per thread, added in order
+    parallel::Split split(n, 1.0, 8);
+    if (split.parts() == 1) return dasum_serial(n, x, incx);
+    std::vector<double> partial(split.parts());
+    parallel::run(split.parts(), [&](int t) {
+        int first = split.first(t);
+        partial[t] = dasum_serial(split.last(t) - first, x + static_cast<size_t>(first) * incx,
+                                  incx);
+    });
+    double dtemp = 0.0;
+    for (double p : partial) dtemp += p;
+    return dtemp;
+}
+
 } // extern "C"
@@ -0,0 +1,67 @@
+/**
+ * DASUM_BATCH_STRIDED - Batched double precision sum of absolute values
+ *
+ * Computes, for b = 0, ..., batch - 1: result[b] = sum(|x_b[i]|)
+ * where x_b = x + b * stridex
+ *
+ * Each sum is computed as by DASUM. The batch runs on the thread pool when it
+ * is large enough; short vectors are computed two at a time in the lanes of a
+ * vector (see batch.h).
+ *
+ * @param n        Number of elements in each vector
+ * @param x        Input vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b (0: one shared vector)
+ * @param result   Output array of batch sums
+ * @param batch    Number of problems
+ */
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increment; DASUM adds the elements in order
+v128_t asum_pair(int n, const double* x0, const double* x1) {
+    v128_t dtemp = wasm_f64x2_splat(0.0);
+    for (int i = 0; i < n; i++) {
+        dtemp = wasm_f64x2_add(dtemp, wasm_f64x2_abs(batch::load2(x0, x1, i)));
+    }
+    return dtemp;
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dasum_batch_strided(int n, const double* x, int incx, int stridex, double* result,
+                         int batch) {
+    BLAS_CHECK("DASUM_BATCH_STRIDED", n >= 0, 1);
+    BLAS_CHECK("DASUM_BATCH_STRIDED", stridex >= 0, 4);
+    BLAS_CHECK("DASUM_BATCH_STRIDED", batch >= 0, 6);
+
+    // Quick return if possible
+    if (batch <= 0) return;
+
+    batch::for_each_chunk(batch, 1.0 * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (n <= batch::SHORT && incx == 1) {
+            for (; b + 2 <= last; b += 2) {
+                wasm_v128_store(result + b, asum_pair(n, x + batch::offset(b, stridex),
+                                                      x + batch::offset(b + 1, stridex)));
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            result[b] = dasum(n, x + batch::offset(b, stridex), incx);
+        }
+    });
+}
+
+} // extern "C"
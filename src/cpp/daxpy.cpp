@@ -6,6 +6,9 @@
  * This is a C++ implementation of the BLAS Level 1 DAXPY routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, long vectors are split into one range per thread
+ * (parallel::Split).
+ * 
  * @param n      Number of elements in input vectors
  * @param alpha  Scalar multiplier for x
  * @param x      Input vector x
@@ -14,15 +17,30 @@
  * @param incy   Storage spacing between elements of y
  */
 
-extern "C" {
+#include "parallel.h"
+#include "simd.h"
 
-void daxpy(int n, double alpha, const double* x, int incx, double* y, int incy) {
+namespace {
+
+void daxpy_serial(int n, double alpha, const double* x, int incx, double* y, int incy) {
     // Quick return if possible
     if (n <= 0) return;
     if (alpha == 0.0) return;
     
     // Code for both increments equal to 1
     if (incx == 1 && incy == 1) {
+#ifdef __wasm_simd128__
+        v128_t va = wasm_f64x2_splat(alpha);
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            wasm_v128_store(y + i, simd::madd_f64x2(va, wasm_v128_load(x + i), wasm_v128_load(y + i)));
+            wasm_v128_store(y + i + 2,
+                            simd::madd_f64x2(va, wasm_v128_load(x + i + 2), wasm_v128_load(y + i + 2)));
+        }
+        for (; i < n; i++) {
+            y[i] = y[i] + alpha * x[i];
+        }
+#else
         // Clean-up loop - handle remainder when n is not divisible by 4
         int m = n % 4;
         if (m != 0) {
@@ -40,6 +58,7 @@ void daxpy(int n, double alpha, const double* x, int incx, double* y, int incy)
             y[i + 2] = y[i + 2] + alpha * x[i + 2];
             y[i + 3] = y[i + 3] + alpha * x[i + 3];
         }
+#endif
     } else {
         // Code for unequal increments or equal increments not equal to 1
         int ix = 0;
@@ -56,4 +75,27 @@ void daxpy(int n, double alpha, const double* x, int incx, double* y, int incy)
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void daxpy(int n, double alpha, const double* x, int incx, double* y, int incy) {
+    // Quick return if possible
+    if (n <= 0) return;
+    if (alpha == 0.0) return;
+
+    // Long vectors: one range per thread
+    parallel::Split split(n, 3.0, 8);
+    if (split.parts() == 1) {
+        daxpy_serial(n, alpha, x, incx, y, incy);
+        return;
+    }
+    parallel::run(split.parts(), [&](int t) {
+        int first = split.first(t);
+        int last = split.last(t);
+        daxpy_serial(last - first, alpha, parallel::slice(x, incx, n, first, last), incx,
+                     parallel::slice(y, incy, n, first, last), incy);
+    });
+}
+
 } // extern "C"
@@ -0,0 +1,94 @@
+/**
+ * DAXPY_BATCH_STRIDED - Batched double precision A*X Plus Y
+ *
+ * Computes, for b = 0, ..., batch - 1: y_b = alpha * x_b + y_b
+ * where x_b = x + b * stridex and y_b = y + b * stridey
+ *
+ * Each update is computed as by DAXPY. The batch runs on the thread pool
+ * when it is large enough. Vectors that lie back to back (unit increments
+ * and strides of n) are updated as one long vector; otherwise short vectors
+ * are computed two at a time in the lanes of a vector (see batch.h).
+ *
+ * @param n        Number of elements in each vector
+ * @param alpha    Scalar multiplier for x_b
+ * @param x        Input vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b (0: one shared vector)
+ * @param y        Input/output vectors y_b
+ * @param incy     Storage spacing between elements of each y_b
+ * @param stridey  Elements between successive y_b
+ * @param batch    Number of problems
+ */
+
+#include <climits>
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increments, as the SIMD loop of DAXPY
+void axpy_pair(int n, v128_t va, const double* x0, const double* x1, double* y0, double* y1) {
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (int l = 0; l < 4; l++) {
+            batch::store2(y0, y1, i + l,
+                          simd::madd_f64x2(va, batch::load2(x0, x1, i + l),
+                                           batch::load2(y0, y1, i + l)));
+        }
+    }
+    for (; i < n; i++) {
+        batch::store2(y0, y1, i,
+                      wasm_f64x2_add(batch::load2(y0, y1, i),
+                                     wasm_f64x2_mul(va, batch::load2(x0, x1, i))));
+    }
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void daxpy_batch_strided(int n, double alpha, const double* x, int incx, int stridex, double* y,
+                         int incy, int stridey, int batch) {
+    BLAS_CHECK("DAXPY_BATCH_STRIDED", n >= 0, 1);
+    BLAS_CHECK("DAXPY_BATCH_STRIDED", stridex >= 0, 5);
+    BLAS_CHECK("DAXPY_BATCH_STRIDED", stridey > 0 || batch <= 1, 8);
+    BLAS_CHECK("DAXPY_BATCH_STRIDED", batch >= 0, 9);
+
+    // Quick return if possible
+    if (batch <= 0 || n == 0 || alpha == 0.0) return;
+
+    bool contiguous = incx == 1 && incy == 1 && stridex == n && stridey == n;
+
+    batch::for_each_chunk(batch, 2.0 * n, [&](int first, int last) {
+        int b = first;
+        // Back-to-back vectors form one vector of n * (last - first) elements.
+        // In the relaxed-SIMD build, elements of its SIMD loop and tail may
+        // round differently from separate calls (see simd.h).
+        if (contiguous && static_cast<long long>(n) * (last - first) <= INT_MAX) {
+            daxpy(n * (last - first), alpha, x + batch::offset(b, n), 1, y + batch::offset(b, n),
+                  1);
+            return;
+        }
+#ifdef __wasm_simd128__
+        if (n <= batch::SHORT && incx == 1 && incy == 1) {
+            v128_t va = wasm_f64x2_splat(alpha);
+            for (; b + 2 <= last; b += 2) {
+                axpy_pair(n, va, x + batch::offset(b, stridex), x + batch::offset(b + 1, stridex),
+                          y + batch::offset(b, stridey), y + batch::offset(b + 1, stridey));
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            daxpy(n, alpha, x + batch::offset(b, stridex), incx, y + batch::offset(b, stridey),
+                  incy);
+        }
+    });
+}
+
+} // extern "C"
@@ -13,33 +13,18 @@
  * @param incy   Storage spacing between elements of y
  */
 
+#include <algorithm>
+
 extern "C" {
 
 void dcopy(int n, const double* x, int incx, double* y, int incy) {
     // Quick return if possible
     if (n <= 0) return;
     
-    // Code for both increments equal to 1
+    // Code for both increments equal to 1: a single memory.copy when
+    // built with bulk memory
     if (incx == 1 && incy == 1) {
-        // Clean-up loop - handle remainder when n is not divisible by 7
-        int m = n % 7;
-        if (m != 0) {
-            for (int i = 0; i < m; i++) {
-                y[i] = x[i];
-            }
-            if (n < 7) return;
-        }
-        
-        // Unrolled loop for better performance
-        for (int i = m; i < n; i += 7) {
-            y[i] = x[i];
-            y[i + 1] = x[i + 1];
-            y[i + 2] = x[i + 2];
-            y[i + 3] = x[i + 3];
-            y[i + 4] = x[i + 4];
-            y[i + 5] = x[i + 5];
-            y[i + 6] = x[i + 6];
-        }
+        std::copy(x, x + n, y);
     } else {
         // Code for unequal increments or equal increments not equal to 1
         int ix = 0;
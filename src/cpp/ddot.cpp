@@ -6,6 +6,10 @@
  * This is a C++ implementation of the BLAS Level 1 DDOT routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, long vectors are split into one range per thread
+ * (parallel::Split) and the partial sums added in order; the result then
+ * depends on the number of threads but not on their timing.
+ * 
  * @param n      Number of elements in input vectors
  * @param x      Input vector x
  * @param incx   Storage spacing between elements of x
@@ -14,9 +18,14 @@
  * @return       Dot product of x and y
  */
 
-extern "C" {
+#include <vector>
 
-double ddot(int n, const double* x, int incx, const double* y, int incy) {
+#include "parallel.h"
+#include "simd.h"
+
+namespace {
+
+double ddot_serial(int n, const double* x, int incx, const double* y, int incy) {
     double dtemp = 0.0;
     
     // Quick return if possible
@@ -24,6 +33,24 @@ double ddot(int n, const double* x, int incx, const double* y, int incy) {
     
     // Code for both increments equal to 1
     if (incx == 1 && incy == 1) {
+#ifdef __wasm_simd128__
+        // Four independent f64x2 accumulators hide the multiply-add latency
+        v128_t s0 = wasm_f64x2_splat(0.0);
+        v128_t s1 = wasm_f64x2_splat(0.0);
+        v128_t s2 = wasm_f64x2_splat(0.0);
+        v128_t s3 = wasm_f64x2_splat(0.0);
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            s0 = simd::madd_f64x2(wasm_v128_load(x + i), wasm_v128_load(y + i), s0);
+            s1 = simd::madd_f64x2(wasm_v128_load(x + i + 2), wasm_v128_load(y + i + 2), s1);
+            s2 = simd::madd_f64x2(wasm_v128_load(x + i + 4), wasm_v128_load(y + i + 4), s2);
+            s3 = simd::madd_f64x2(wasm_v128_load(x + i + 6), wasm_v128_load(y + i + 6), s3);
+        }
+        dtemp = simd::hsum_f64x2(wasm_f64x2_add(wasm_f64x2_add(s0, s1), wasm_f64x2_add(s2, s3)));
+        for (; i < n; i++) {
+            dtemp = dtemp + x[i] * y[i];
+        }
+#else
         // Clean-up loop - handle remainder when n is not divisible by 5
         int m = n % 5;
         if (m != 0) {
@@ -38,6 +65,7 @@ double ddot(int n, const double* x, int incx, const double* y, int incy) {
             dtemp = dtemp + x[i] * y[i] + x[i + 1] * y[i + 1] +
                     x[i + 2] * y[i + 2] + x[i + 3] * y[i + 3] + x[i + 4] * y[i + 4];
         }
+#endif
     } else {
         // Code for unequal increments or equal increments not equal to 1
         int ix = 0;
@@ -56,4 +84,27 @@ double ddot(int n, const double* x, int incx, const double* y, int incy) {
     return dtemp;
 }
 
+} // namespace
+
+extern "C" {
+
+double ddot(int n, const double* x, int incx, const double* y, int incy) {
+    // Quick return if possible
+    if (n <= 0) return 0.0;
+
+    // Long vectors: one partial sum per thread, added in order
+    parallel::Split split(n, 2.0, 8);
+    if (split.parts() == 1) return ddot_serial(n, x, incx, y, incy);
+    std::vector<double> partial(split.parts());
+    parallel::run(split.parts(), [&](int t) {
+        int first = split.first(t);
+        int last = split.last(t);
+        partial[t] = ddot_serial(last - first, parallel::slice(x, incx, n, first, last), incx,
+                                 parallel::slice(y, incy, n, first, last), incy);
+    });
+    double dtemp = 0.0;
+    for (double p : partial) dtemp += p;
+    return dtemp;
+}
+
 } // extern "C"
@@ -0,0 +1,89 @@
+/**
+ * DDOT_BATCH_STRIDED - Batched double precision dot product
+ *
+ * Computes, for b = 0, ..., batch - 1: result[b] = x_b^T * y_b
+ * where x_b = x + b * stridex and y_b = y + b * stridey
+ *
+ * Each dot product is computed as by DDOT. The batch runs on the thread pool
+ * when it is large enough; short vectors are computed two at a time in the
+ * lanes of a vector (see batch.h).
+ *
+ * @param n        Number of elements in each vector
+ * @param x        Input vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b (0: one shared vector)
+ * @param y        Input vectors y_b
+ * @param incy     Storage spacing between elements of each y_b
+ * @param stridey  Elements between successive y_b (0: one shared vector)
+ * @param result   Output array of batch dot products
+ * @param batch    Number of problems
+ */
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increments, as the SIMD loop of DDOT: s[l]
+// holds, for both problems, the accumulator lane of DDOT that sums elements
+// i with i % 8 == l
+v128_t dot_pair(int n, const double* x0, const double* x1, const double* y0, const double* y1) {
+    v128_t s[8];
+    for (int l = 0; l < 8; l++) s[l] = wasm_f64x2_splat(0.0);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        for (int l = 0; l < 8; l++) {
+            s[l] = simd::madd_f64x2(batch::load2(x0, x1, i + l), batch::load2(y0, y1, i + l), s[l]);
+        }
+    }
+    // hsum((s0 + s1) + (s2 + s3)) of DDOT
+    v128_t even = wasm_f64x2_add(wasm_f64x2_add(s[0], s[2]), wasm_f64x2_add(s[4], s[6]));
+    v128_t odd = wasm_f64x2_add(wasm_f64x2_add(s[1], s[3]), wasm_f64x2_add(s[5], s[7]));
+    v128_t dtemp = wasm_f64x2_add(even, odd);
+    for (; i < n; i++) {
+        dtemp = wasm_f64x2_add(dtemp,
+                               wasm_f64x2_mul(batch::load2(x0, x1, i), batch::load2(y0, y1, i)));
+    }
+    return dtemp;
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void ddot_batch_strided(int n, const double* x, int incx, int stridex, const double* y, int incy,
+                        int stridey, double* result, int batch) {
+    BLAS_CHECK("DDOT_BATCH_STRIDED", n >= 0, 1);
+    BLAS_CHECK("DDOT_BATCH_STRIDED", stridex >= 0, 4);
+    BLAS_CHECK("DDOT_BATCH_STRIDED", stridey >= 0, 7);
+    BLAS_CHECK("DDOT_BATCH_STRIDED", batch >= 0, 9);
+
+    // Quick return if possible
+    if (batch <= 0) return;
+
+    batch::for_each_chunk(batch, 2.0 * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (n <= batch::SHORT && incx == 1 && incy == 1) {
+            for (; b + 2 <= last; b += 2) {
+                v128_t r = dot_pair(n, x + batch::offset(b, stridex),
+                                    x + batch::offset(b + 1, stridex),
+                                    y + batch::offset(b, stridey),
+                                    y + batch::offset(b + 1, stridey));
+                wasm_v128_store(result + b, r);
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            result[b] = ddot(n, x + batch::offset(b, stridex), incx, y + batch::offset(b, stridey),
+                             incy);
+        }
+    });
+}
+
+} // extern "C"
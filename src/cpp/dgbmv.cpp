@@ -1,11 +1,22 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dgbmv(int trans, int m, int n, int kl, int ku, double alpha, 
            const double* a, int lda, const double* x, int incx, 
            double beta, double* y, int incy) {
+    BLAS_CHECK("DGBMV", check::trans(trans), 1);
+    BLAS_CHECK("DGBMV", m >= 0, 2);
+    BLAS_CHECK("DGBMV", n >= 0, 3);
+    BLAS_CHECK("DGBMV", kl >= 0, 4);
+    BLAS_CHECK("DGBMV", ku >= 0, 5);
+    BLAS_CHECK("DGBMV", lda >= kl + ku + 1, 8);
+    BLAS_CHECK("DGBMV", incx != 0, 10);
+    BLAS_CHECK("DGBMV", incy != 0, 13);
+
     // Quick return if possible
     if (m == 0 || n == 0 || (alpha == 0.0 && beta == 1.0)) return;
 
@@ -36,9 +47,7 @@ void dgbmv(int trans, int m, int n, int kl, int ku, double alpha,
     if (beta != 1.0) {
         if (incy == 1) {
             if (beta == 0.0) {
-                for (int i = 0; i < leny; i++) {
-                    y[i] = 0.0;
-                }
+                std::fill(y, y + leny, 0.0);
             } else {
                 for (int i = 0; i < leny; i++) {
                     y[i] = beta * y[i];
@@ -0,0 +1,114 @@
+/**
+ * DGELS - Double precision least squares or minimum norm solution
+ *
+ * Solves, for each column of B, one of:
+ *   trans = 'N', m >= n: the least squares problem min ||B - A * X||
+ *   trans = 'N', m <  n: the minimum norm solution of A * X = B
+ *   trans = 'T', m >= n: the minimum norm solution of A^T * X = B
+ *   trans = 'T', m <  n: the least squares problem min ||B - A^T * X||
+ * where A has full rank; X overwrites B
+ *
+ * This is a C++ implementation of the LAPACK driver DGELS, based on the
+ * reference LAPACK implementation from netlib.org, using the QR
+ * factorization of A (DGEQRF, DORMQR) if m >= n and its LQ factorization
+ * if m < n. The LQ factorization is computed as the QR factorization of a
+ * transposed copy of A and transposed back, so A holds the factors in the
+ * same layout as DGELQF: L on and below the diagonal, the reflectors in the
+ * rows above it. Unlike the reference driver, A and B are not scaled when
+ * their elements are close to overflow or underflow.
+ *
+ * @param trans  'N': solve with A, 'T'/'C': solve with A^T
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param nrhs   Number of columns of B and X
+ * @param a      Input matrix (m x n), output its QR or LQ factorization
+ * @param lda    Leading dimension of A
+ * @param b      Input right-hand sides (m x nrhs for 'N', n x nrhs for 'T'),
+ *               output the solution X (n x nrhs for 'N', m x nrhs for 'T');
+ *               for least squares, rows n:m-1 (or m:n-1) hold the residual
+ *               in the basis of Q
+ * @param ldb    Leading dimension of B, at least max(1, m, n)
+ * @return       0 on success, i > 0 if the i-th diagonal element of R or L
+ *               is exactly zero, so A does not have full rank
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// dst (n x m, leading dimension ldd) = src^T (m x n, leading dimension lds)
+void transpose(int m, int n, const double* src, int lds, double* dst, int ldd) {
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+            dst[j + static_cast<size_t>(i) * ldd] = src[i + static_cast<size_t>(j) * lds];
+        }
+    }
+}
+
+// DGELS for m >= n on the QR factorization of a and tau
+int solve_qr(bool notrans, int m, int n, int nrhs, const double* a, int lda,
+             const double* tau, double* b, int ldb) {
+    // Test R for singularity
+    for (int i = 0; i < n; i++) {
+        if (a[i + static_cast<size_t>(i) * lda] == 0.0) return i + 1;
+    }
+
+    if (notrans) {
+        // Least squares: B(0:n-1, :) = inv(R) * (Q^T * B)(0:n-1, :)
+        dormqr('L', 'T', m, nrhs, n, a, lda, tau, b, ldb);
+        dtrsm('L', 'U', 'N', 'N', n, nrhs, 1.0, a, lda, b, ldb);
+    } else {
+        // Minimum norm: B = Q * [inv(R^T) * B(0:n-1, :); 0]
+        dtrsm('L', 'U', 'T', 'N', n, nrhs, 1.0, a, lda, b, ldb);
+        for (int j = 0; j < nrhs; j++) {
+            double* col = b + static_cast<size_t>(j) * ldb;
+            std::fill(col + n, col + m, 0.0);
+        }
+        dormqr('L', 'N', m, nrhs, n, a, lda, tau, b, ldb);
+    }
+    return 0;
+}
+
+} // namespace
+
+extern "C" {
+
+int dgels(char trans, int m, int n, int nrhs, double* a, int lda, double* b, int ldb) {
+    BLAS_CHECK("DGELS", check::trans(trans), 1);
+    BLAS_CHECK("DGELS", m >= 0, 2);
+    BLAS_CHECK("DGELS", n >= 0, 3);
+    BLAS_CHECK("DGELS", nrhs >= 0, 4);
+    BLAS_CHECK("DGELS", lda >= check::max1(m), 6);
+    BLAS_CHECK("DGELS", ldb >= check::max1(std::max(m, n)), 8);
+
+    const bool notrans = trans == 'N' || trans == 'n';
+
+    // Quick return if possible
+    if (std::min(m, n) == 0) {
+        dlaset('A', std::max(m, n), nrhs, 0.0, 0.0, b, ldb);
+        return 0;
+    }
+    if (nrhs == 0) return 0;
+
+    std::vector<double> tau(std::min(m, n));
+    if (m >= n) {
+        // QR factorization of A
+        dgeqrf(m, n, a, lda, tau.data());
+        return solve_qr(notrans, m, n, nrhs, a, lda, tau.data(), b, ldb);
+    }
+
+    // LQ factorization of A: with A^T = Q * R, A = R^T * Q^T = L * Q^T, so
+    // the problem is solved with the copy A^T and the opposite trans
+    std::vector<double> at(static_cast<size_t>(n) * m);
+    transpose(m, n, a, lda, at.data(), n);
+    dgeqrf(n, m, at.data(), n, tau.data());
+    transpose(n, m, at.data(), n, a, lda);
+    return solve_qr(!notrans, n, m, nrhs, at.data(), n, tau.data(), b, ldb);
+}
+
+} // extern "C"
@@ -0,0 +1,81 @@
+/**
+ * DGELS_NORMAL - Double precision least squares by the normal equations
+ *
+ * Solves: min ||B - A * X|| for each column of B
+ * where A is m x n with m >= n and full rank; X overwrites B(0:n-1, :)
+ *
+ * The normal equations A^T * A * X = A^T * B are formed with DSYRK and DGEMM
+ * and solved with the Cholesky factorization (DPOTRF, DTRSM). This reads A
+ * once and costs about m * n^2 flops, half of a QR factorization, but its
+ * error grows with cond(A)^2 instead of cond(A). The Cholesky factor gives a
+ * cheap lower bound on cond(A), the ratio of its largest to smallest
+ * diagonal element; if that exceeds COND_LIMIT, or A^T * A is not
+ * numerically positive definite, the problem is solved by DGELS (QR)
+ * instead. A is only modified in that case. The normal equations use a
+ * workspace of n * (n + nrhs) elements that the kernel allocates itself.
+ *
+ * @param m      Number of rows of A, at least n
+ * @param n      Number of columns of A
+ * @param nrhs   Number of columns of B and X
+ * @param a      Input matrix (m x n); overwritten by its QR factorization
+ *               only if the driver falls back to DGELS
+ * @param lda    Leading dimension of A
+ * @param b      Input right-hand sides (m x nrhs), output the solution X in
+ *               rows 0:n-1
+ * @param ldb    Leading dimension of B
+ * @return       0 on success, or the result of DGELS after a fallback
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// Largest lower bound on cond(A) for which the normal equations are used:
+// cond(A)^2 * eps then stays below about 1e-8
+constexpr double COND_LIMIT = 1e4;
+
+} // namespace
+
+extern "C" {
+
+int dgels_normal(int m, int n, int nrhs, double* a, int lda, double* b, int ldb) {
+    BLAS_CHECK("DGELS_NORMAL", m >= 0, 1);
+    BLAS_CHECK("DGELS_NORMAL", n >= 0 && n <= m, 2);
+    BLAS_CHECK("DGELS_NORMAL", nrhs >= 0, 3);
+    BLAS_CHECK("DGELS_NORMAL", lda >= check::max1(m), 5);
+    BLAS_CHECK("DGELS_NORMAL", ldb >= check::max1(m), 7);
+
+    // Quick return if possible
+    if (n == 0 || nrhs == 0) return dgels('N', m, n, nrhs, a, lda, b, ldb);
+
+    // C = A^T * A (upper triangle) and Y = A^T * B
+    std::vector<double> work(static_cast<size_t>(n) * (n + nrhs));
+    double* c = work.data();
+    double* y = c + static_cast<size_t>(n) * n;
+    dsyrk('U', 'T', n, m, 1.0, a, lda, 0.0, c, n);
+    dgemm('T', 'N', n, nrhs, m, 1.0, a, lda, b, ldb, 0.0, y, n);
+
+    // C = U^T * U; fall back to QR if A is too ill-conditioned
+    if (dpotrf('U', n, c, n) > 0) return dgels('N', m, n, nrhs, a, lda, b, ldb);
+    double dmin = c[0];
+    double dmax = c[0];
+    for (int i = 1; i < n; i++) {
+        dmin = std::min(dmin, c[i + static_cast<size_t>(i) * n]);
+        dmax = std::max(dmax, c[i + static_cast<size_t>(i) * n]);
+    }
+    if (!(dmax <= COND_LIMIT * dmin)) return dgels('N', m, n, nrhs, a, lda, b, ldb);
+
+    // X = inv(U) * inv(U^T) * Y
+    dtrsm('L', 'U', 'T', 'N', n, nrhs, 1.0, c, n, y, n);
+    dtrsm('L', 'U', 'N', 'N', n, nrhs, 1.0, c, n, y, n);
+    dlacpy('A', n, nrhs, y, n, b, ldb);
+    return 0;
+}
+
+} // extern "C"
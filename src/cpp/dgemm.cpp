@@ -6,6 +6,17 @@
  * 
  * This is a C++ implementation of the BLAS Level 3 DGEMM routine,
  * based on the reference BLAS implementation from netlib.org
+ *
+ * op(A) and op(B) are packed into cache blocks (alpha is folded into the
+ * packed B), so every transpose combination runs the same MR x NR register
+ * microkernel with unit-stride loads. Large products are split into column
+ * (or row) slices of C that run in parallel when threads are enabled.
+ *
+ * Two shapes take their own paths: tall, skinny products (n and k at most
+ * 16, e.g. 10^6 x 8 x 8) stream op(A) once without packing it, and with
+ * threads, a small C with a long depth (e.g. a 64 x 64 Gram matrix over
+ * 10^6 samples) splits k between the threads and adds their partial
+ * products, so that the result then depends on the number of threads.
  * 
  * @param transa  'N': op(A) = A, 'T'/'C': op(A) = A^T
  * @param transb  'N': op(B) = B, 'T'/'C': op(B) = B^T
@@ -22,11 +33,251 @@
  * @param ldc     Leading dimension of C
  */
 
+#include <algorithm>
+#include <vector>
+
+#include "check.h"
+#include "parallel.h"
+#include "simd.h"
+
+namespace {
+
+const int MR = 4;     // rows of the register tile
+const int NR = 4;     // columns of the register tile
+const int MC = 128;   // rows of A packed per block
+const int KC = 256;   // depth of a packed block
+const int NC = 1024;  // columns of B packed per block
+
+const int TS_MAX = 16;   // largest n and k of a tall, skinny product
+const int TS_ROWS = 64;  // granularity of the row split of a tall, skinny product
+
+// Split-k products: depth at least SPLIT_K_RATIO * max(m, n), C of at most
+// SPLIT_K_MAX_C elements (one private copy per thread)
+const int SPLIT_K_RATIO = 8;
+const double SPLIT_K_MAX_C = 256.0 * 256.0;
+
+// Pack rows [i0, i0 + mc) and columns [l0, l0 + kc) of op(A)
+void pack_a(bool nota, const double* a, int lda, int i0, int mc, int l0, int kc, double* pa) {
+    for (int ir = 0; ir < mc; ir += MR) {
+        int mr = std::min(MR, mc - ir);
+        for (int p = 0; p < kc; p++) {
+            int l = l0 + p;
+            for (int r = 0; r < MR; r++) {
+                int i = i0 + ir + r;
+                if (r >= mr) {
+                    pa[r] = 0.0;
+                } else if (nota) {
+                    pa[r] = a[i + static_cast<size_t>(l) * lda];
+                } else {
+                    pa[r] = a[l + static_cast<size_t>(i) * lda];
+                }
+            }
+            pa += MR;
+        }
+    }
+}
+
+// Pack rows [l0, l0 + kc) and columns [j0, j0 + nc) of alpha * op(B)
+void pack_b(bool notb, const double* b, int ldb, double alpha,
+            int l0, int kc, int j0, int nc, double* pb) {
+    for (int jr = 0; jr < nc; jr += NR) {
+        for (int p = 0; p < kc; p++) {
+            int l = l0 + p;
+            for (int c = 0; c < NR; c++) {
+                int j = j0 + jr + c;
+                if (jr + c >= nc) {
+                    pb[c] = 0.0;
+                } else if (notb) {
+                    pb[c] = alpha * b[l + static_cast<size_t>(j) * ldb];
+                } else {
+                    pb[c] = alpha * b[j + static_cast<size_t>(l) * ldb];
+                }
+            }
+            pb += NR;
+        }
+    }
+}
+
+// C[0:mr, 0:nr] += A panel * packed B panel, where the MR rows of the panel
+// for depth p start at pa + p * as (as = MR for a packed panel)
+void kernel_4x4(int kc, const double* pa, int as, const double* pb, double* c, int ldc, int mr,
+                int nr) {
+    double tile[MR * NR];
+#ifdef __wasm_simd128__
+    v128_t c00 = wasm_f64x2_splat(0.0), c01 = wasm_f64x2_splat(0.0);
+    v128_t c10 = wasm_f64x2_splat(0.0), c11 = wasm_f64x2_splat(0.0);
+    v128_t c20 = wasm_f64x2_splat(0.0), c21 = wasm_f64x2_splat(0.0);
+    v128_t c30 = wasm_f64x2_splat(0.0), c31 = wasm_f64x2_splat(0.0);
+    for (int p = 0; p < kc; p++) {
+        v128_t a0 = wasm_v128_load(pa);
+        v128_t a1 = wasm_v128_load(pa + 2);
+        v128_t b0 = wasm_f64x2_splat(pb[0]);
+        v128_t b1 = wasm_f64x2_splat(pb[1]);
+        v128_t b2 = wasm_f64x2_splat(pb[2]);
+        v128_t b3 = wasm_f64x2_splat(pb[3]);
+        c00 = simd::madd_f64x2(a0, b0, c00);
+        c01 = simd::madd_f64x2(a1, b0, c01);
+        c10 = simd::madd_f64x2(a0, b1, c10);
+        c11 = simd::madd_f64x2(a1, b1, c11);
+        c20 = simd::madd_f64x2(a0, b2, c20);
+        c21 = simd::madd_f64x2(a1, b2, c21);
+        c30 = simd::madd_f64x2(a0, b3, c30);
+        c31 = simd::madd_f64x2(a1, b3, c31);
+        pa += as;
+        pb += NR;
+    }
+    if (mr == MR && nr == NR) {
+        double* c0 = c;
+        double* c1 = c + ldc;
+        double* c2 = c + 2 * static_cast<size_t>(ldc);
+        double* c3 = c + 3 * static_cast<size_t>(ldc);
+        wasm_v128_store(c0, wasm_f64x2_add(wasm_v128_load(c0), c00));
+        wasm_v128_store(c0 + 2, wasm_f64x2_add(wasm_v128_load(c0 + 2), c01));
+        wasm_v128_store(c1, wasm_f64x2_add(wasm_v128_load(c1), c10));
+        wasm_v128_store(c1 + 2, wasm_f64x2_add(wasm_v128_load(c1 + 2), c11));
+        wasm_v128_store(c2, wasm_f64x2_add(wasm_v128_load(c2), c20));
+        wasm_v128_store(c2 + 2, wasm_f64x2_add(wasm_v128_load(c2 + 2), c21));
+        wasm_v128_store(c3, wasm_f64x2_add(wasm_v128_load(c3), c30));
+        wasm_v128_store(c3 + 2, wasm_f64x2_add(wasm_v128_load(c3 + 2), c31));
+        return;
+    }
+    wasm_v128_store(tile, c00);
+    wasm_v128_store(tile + 2, c01);
+    wasm_v128_store(tile + 4, c10);
+    wasm_v128_store(tile + 6, c11);
+    wasm_v128_store(tile + 8, c20);
+    wasm_v128_store(tile + 10, c21);
+    wasm_v128_store(tile + 12, c30);
+    wasm_v128_store(tile + 14, c31);
+#else
+    std::fill(tile, tile + MR * NR, 0.0);
+    for (int p = 0; p < kc; p++) {
+        for (int j = 0; j < NR; j++) {
+            double bj = pb[j];
+            for (int i = 0; i < MR; i++) {
+                tile[i + j * MR] += pa[i] * bj;
+            }
+        }
+        pa += as;
+        pb += NR;
+    }
+#endif
+    for (int j = 0; j < nr; j++) {
+        for (int i = 0; i < mr; i++) {
+            c[i + static_cast<size_t>(j) * ldc] += tile[i + j * MR];
+        }
+    }
+}
+
+// C[0:m, 0:n] += alpha * op(A) * op(B), one packed block at a time
+void gemm_blocked(bool nota, bool notb, int m, int n, int k, double alpha,
+                  const double* a, int lda, const double* b, int ldb, double* c, int ldc) {
+    // Packing buffers, sized for the blocks actually used
+    int kcmax = std::min(KC, k);
+    std::vector<double> pa(static_cast<size_t>((std::min(MC, m) + MR - 1) / MR * MR) * kcmax);
+    std::vector<double> pb(static_cast<size_t>((std::min(NC, n) + NR - 1) / NR * NR) * kcmax);
+
+    for (int j0 = 0; j0 < n; j0 += NC) {
+        int nc = std::min(NC, n - j0);
+        for (int l0 = 0; l0 < k; l0 += KC) {
+            int kc = std::min(KC, k - l0);
+            pack_b(notb, b, ldb, alpha, l0, kc, j0, nc, pb.data());
+
+            for (int i0 = 0; i0 < m; i0 += MC) {
+                int mc = std::min(MC, m - i0);
+                pack_a(nota, a, lda, i0, mc, l0, kc, pa.data());
+
+                for (int jr = 0; jr < nc; jr += NR) {
+                    int nr = std::min(NR, nc - jr);
+                    for (int ir = 0; ir < mc; ir += MR) {
+                        int mr = std::min(MR, mc - ir);
+                        kernel_4x4(kc, pa.data() + ir * kc, MR, pb.data() + jr * kc,
+                                   c + (i0 + ir) + static_cast<size_t>(j0 + jr) * ldc, ldc, mr, nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// C[0:m, 0:n] += alpha * op(A) * op(B) for tall, skinny products, where
+// op(B) has at most TS_MAX rows and columns. alpha * op(B) is packed once,
+// and each MR-row tile of A is read in place (only transposed tiles and the
+// last, partial tile are packed) and used for all n columns while it is in
+// cache, so op(A) is streamed from memory once. The tiles go through
+// kernel_4x4 with the same depth as gemm_blocked, so the result is the same.
+// Rows are split between threads like a Level 2 kernel.
+void gemm_tall(bool nota, bool notb, int m, int n, int k, double alpha,
+               const double* a, int lda, const double* b, int ldb, double* c, int ldc) {
+    alignas(16) double pb[TS_MAX * TS_MAX];
+    pack_b(notb, b, ldb, alpha, 0, k, 0, n, pb);
+
+    parallel::Split split(m, k + 2.0 * n, TS_ROWS);
+    parallel::run(split.parts(), [&](int t) {
+        alignas(16) double pa[MR * TS_MAX];
+        int last = split.last(t);
+        for (int i = split.first(t); i < last; i += MR) {
+            int mr = std::min(MR, last - i);
+            const double* ai = a + i;
+            int as = lda;
+            if (!nota || mr < MR) {
+                pack_a(nota, a, lda, i, mr, 0, k, pa);
+                ai = pa;
+                as = MR;
+            }
+            for (int jr = 0; jr < n; jr += NR) {
+                kernel_4x4(k, ai, as, pb + jr * k, c + i + static_cast<size_t>(jr) * ldc, ldc, mr,
+                           std::min(NR, n - jr));
+            }
+        }
+    });
+}
+
+// C[0:m, 0:n] += alpha * op(A) * op(B) with the depth split into `parts`
+// ranges of whole KC blocks: each thread multiplies its range into a private
+// m x n block, and the blocks are added to C in order. A and B are read once
+// in total, however small C is.
+void gemm_split_k(int parts, bool nota, bool notb, int m, int n, int k, double alpha,
+                  const double* a, int lda, const double* b, int ldb, double* c, int ldc) {
+    int kt = ((k + parts - 1) / parts + KC - 1) / KC * KC;
+    parts = (k + kt - 1) / kt;
+    size_t size = static_cast<size_t>(m) * n;
+    std::vector<double> partial(size * parts, 0.0);
+
+    parallel::run(parts, [&](int t) {
+        int l0 = t * kt;
+        const double* at = nota ? a + static_cast<size_t>(l0) * lda : a + l0;
+        const double* bt = notb ? b + l0 : b + static_cast<size_t>(l0) * ldb;
+        gemm_blocked(nota, notb, m, n, std::min(kt, k - l0), alpha, at, lda, bt, ldb,
+                     partial.data() + t * size, m);
+    });
+
+    for (int t = 0; t < parts; t++) {
+        const double* pt = partial.data() + t * size;
+        for (int j = 0; j < n; j++) {
+            double* cj = c + static_cast<size_t>(j) * ldc;
+            for (int i = 0; i < m; i++) {
+                cj[i] += pt[i + static_cast<size_t>(j) * m];
+            }
+        }
+    }
+}
+
+} // namespace
+
 extern "C" {
 
 void dgemm(char transa, char transb, int m, int n, int k, double alpha,
            const double* a, int lda, const double* b, int ldb, 
            double beta, double* c, int ldc) {
+    BLAS_CHECK("DGEMM", check::trans(transa), 1);
+    BLAS_CHECK("DGEMM", check::trans(transb), 2);
+    BLAS_CHECK("DGEMM", m >= 0, 3);
+    BLAS_CHECK("DGEMM", n >= 0, 4);
+    BLAS_CHECK("DGEMM", k >= 0, 5);
+    BLAS_CHECK("DGEMM", lda >= check::max1(check::notrans(transa) ? m : k), 8);
+    BLAS_CHECK("DGEMM", ldb >= check::max1(check::notrans(transb) ? k : n), 10);
+    BLAS_CHECK("DGEMM", ldc >= check::max1(m), 13);
     
     const double zero = 0.0;
     const double one = 1.0;
@@ -40,100 +291,61 @@ void dgemm(char transa, char transb, int m, int n, int k, double alpha,
         return;
     }
     
-    // Handle beta scaling of C
-    if (alpha == zero) {
-        if (beta == zero) {
-            for (int j = 0; j < n; j++) {
+    // First form C := beta*C
+    if (beta != one) {
+        for (int j = 0; j < n; j++) {
+            double* cj = c + static_cast<size_t>(j) * ldc;
+            if (beta == zero) {
+                std::fill(cj, cj + m, zero);
+            } else {
                 for (int i = 0; i < m; i++) {
-                    c[i + j * ldc] = zero;
-                }
-            }
-        } else {
-            for (int j = 0; j < n; j++) {
-                for (int i = 0; i < m; i++) {
-                    c[i + j * ldc] = beta * c[i + j * ldc];
+                    cj[i] = beta * cj[i];
                 }
             }
         }
+    }
+    if (alpha == zero || k == 0) {
         return;
     }
     
-    // Start the operations
-    if (notb) {
-        if (nota) {
-            // Form C := alpha*A*B + beta*C
-            for (int j = 0; j < n; j++) {
-                if (beta == zero) {
-                    for (int i = 0; i < m; i++) {
-                        c[i + j * ldc] = zero;
-                    }
-                } else if (beta != one) {
-                    for (int i = 0; i < m; i++) {
-                        c[i + j * ldc] = beta * c[i + j * ldc];
-                    }
-                }
-                
-                for (int l = 0; l < k; l++) {
-                    double temp = alpha * b[l + j * ldb];
-                    for (int i = 0; i < m; i++) {
-                        c[i + j * ldc] += temp * a[i + l * lda];
-                    }
-                }
-            }
-        } else {
-            // Form C := alpha*A^T*B + beta*C
-            for (int j = 0; j < n; j++) {
-                for (int i = 0; i < m; i++) {
-                    double temp = zero;
-                    for (int l = 0; l < k; l++) {
-                        temp += a[l + i * lda] * b[l + j * ldb];
-                    }
-                    if (beta == zero) {
-                        c[i + j * ldc] = alpha * temp;
-                    } else {
-                        c[i + j * ldc] = alpha * temp + beta * c[i + j * ldc];
-                    }
-                }
-            }
-        }
-    } else {
-        if (nota) {
-            // Form C := alpha*A*B^T + beta*C
-            for (int j = 0; j < n; j++) {
-                if (beta == zero) {
-                    for (int i = 0; i < m; i++) {
-                        c[i + j * ldc] = zero;
-                    }
-                } else if (beta != one) {
-                    for (int i = 0; i < m; i++) {
-                        c[i + j * ldc] = beta * c[i + j * ldc];
-                    }
-                }
-                
-                for (int l = 0; l < k; l++) {
-                    double temp = alpha * b[j + l * ldb];
-                    for (int i = 0; i < m; i++) {
-                        c[i + j * ldc] += temp * a[i + l * lda];
-                    }
-                }
-            }
-        } else {
-            // Form C := alpha*A^T*B^T + beta*C
-            for (int j = 0; j < n; j++) {
-                for (int i = 0; i < m; i++) {
-                    double temp = zero;
-                    for (int l = 0; l < k; l++) {
-                        temp += a[l + i * lda] * b[j + l * ldb];
-                    }
-                    if (beta == zero) {
-                        c[i + j * ldc] = alpha * temp;
-                    } else {
-                        c[i + j * ldc] = alpha * temp + beta * c[i + j * ldc];
-                    }
-                }
-            }
-        }
+    // Tall, skinny products: op(A) is streamed once past a small op(B)
+    if (n <= TS_MAX && k <= TS_MAX) {
+        gemm_tall(nota, notb, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+        return;
+    }
+
+    // Products too small to amortize waking the pool run on this thread
+    int nthreads = parallel::num_threads();
+    if (nthreads == 1 || static_cast<double>(m) * n * k < parallel::MIN_PARALLEL_MADDS) {
+        gemm_blocked(nota, notb, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+        return;
     }
+
+    // A small C with a long depth has too few tiles to share, and every
+    // slice of C would read all of A or B: split k instead
+    int kparts = std::min(nthreads, k / KC);
+    if (kparts > 1 && k >= SPLIT_K_RATIO * std::max(m, n) &&
+        static_cast<double>(m) * n <= SPLIT_K_MAX_C) {
+        gemm_split_k(kparts, nota, notb, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+        return;
+    }
+
+    // Split C into tm x tn slices, preferring whole columns so each thread
+    // packs a disjoint part of B
+    int tn = std::min(nthreads, (n + NR - 1) / NR);
+    int tm = std::min(std::max(1, nthreads / tn), (m + MR - 1) / MR);
+    int ms = ((m + tm - 1) / tm + MR - 1) / MR * MR;
+    int ns = ((n + tn - 1) / tn + NR - 1) / NR * NR;
+
+    parallel::run(tm * tn, [&](int t) {
+        int i0 = (t % tm) * ms;
+        int j0 = (t / tm) * ns;
+        if (i0 >= m || j0 >= n) return;
+        const double* ai = nota ? a + i0 : a + static_cast<size_t>(i0) * lda;
+        const double* bj = notb ? b + static_cast<size_t>(j0) * ldb : b + j0;
+        gemm_blocked(nota, notb, std::min(ms, m - i0), std::min(ns, n - j0), k, alpha,
+                     ai, lda, bj, ldb, c + i0 + static_cast<size_t>(j0) * ldc, ldc);
+    });
 }
 
 } // extern "C"
@@ -0,0 +1,96 @@
+/**
+ * DGEMM_BATCH - Grouped batch of double precision matrix-matrix multiplications
+ *
+ * Computes, for every problem p of every group g:
+ *   C_p = alpha[g] * op(A_p) * op(B_p) + beta[g] * C_p
+ * where op(X) = X or X^T, A_p = a + offa[p], B_p = b + offb[p] and
+ * C_p = c + offc[p]
+ *
+ * Problems are numbered group by group: group 0 holds problems
+ * 0, ..., group_size[0] - 1, group 1 the next group_size[1], and so on. All
+ * problems of a group share its flags, dimensions, scalars and leading
+ * dimensions. This is the grouped API of MKL's dgemm_batch with element
+ * offsets into three arrays instead of arrays of pointers.
+ *
+ * Each problem is computed as by DGEMM. With threads, problems are scheduled
+ * by their flop count (see batch::for_each_weighted): the largest use the
+ * whole pool one at a time, the others run concurrently, largest first. The
+ * C_p must not overlap.
+ *
+ * @param group_count  Number of groups
+ * @param group_size   Number of problems in each group
+ * @param transa       Per group: 'N': op(A) = A, 'T'/'C': op(A) = A^T (character codes)
+ * @param transb       Per group: 'N': op(B) = B, 'T'/'C': op(B) = B^T (character codes)
+ * @param m            Per group: rows of op(A) and C
+ * @param n            Per group: columns of op(B) and C
+ * @param k            Per group: columns of op(A) and rows of op(B)
+ * @param alpha        Per group: scalar multiplier for op(A)*op(B)
+ * @param a            Matrices A_p
+ * @param lda          Per group: leading dimension of the A_p
+ * @param offa         Per problem: element offset of A_p in a
+ * @param b            Matrices B_p
+ * @param ldb          Per group: leading dimension of the B_p
+ * @param offb         Per problem: element offset of B_p in b
+ * @param beta         Per group: scalar multiplier for C
+ * @param c            Input/output matrices C_p
+ * @param ldc          Per group: leading dimension of the C_p
+ * @param offc         Per problem: element offset of C_p in c
+ */
+
+#include <vector>
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+extern "C" {
+
+void dgemm_batch(int group_count, const int* group_size, const int* transa, const int* transb,
+                 const int* m, const int* n, const int* k, const double* alpha, const double* a,
+                 const int* lda, const int* offa, const double* b, const int* ldb,
+                 const int* offb, const double* beta, double* c, const int* ldc,
+                 const int* offc) {
+    BLAS_CHECK("DGEMM_BATCH", group_count >= 0, 1);
+
+    int count = 0;
+    for (int g = 0; g < group_count; g++) {
+#ifdef BLAS_DEBUG
+        char ta = static_cast<char>(transa[g]);
+        char tb = static_cast<char>(transb[g]);
+#endif
+        BLAS_CHECK("DGEMM_BATCH", group_size[g] >= 0, 2);
+        BLAS_CHECK("DGEMM_BATCH", check::trans(ta), 3);
+        BLAS_CHECK("DGEMM_BATCH", check::trans(tb), 4);
+        BLAS_CHECK("DGEMM_BATCH", m[g] >= 0, 5);
+        BLAS_CHECK("DGEMM_BATCH", n[g] >= 0, 6);
+        BLAS_CHECK("DGEMM_BATCH", k[g] >= 0, 7);
+        BLAS_CHECK("DGEMM_BATCH", lda[g] >= check::max1(check::notrans(ta) ? m[g] : k[g]), 10);
+        BLAS_CHECK("DGEMM_BATCH", ldb[g] >= check::max1(check::notrans(tb) ? k[g] : n[g]), 13);
+        BLAS_CHECK("DGEMM_BATCH", ldc[g] >= check::max1(m[g]), 17);
+        count += group_size[g];
+    }
+
+    // Quick return if possible
+    if (count == 0) return;
+
+    // Group of each problem
+    std::vector<int> group(count);
+    for (int g = 0, p = 0; g < group_count; g++) {
+        for (int i = 0; i < group_size[g]; i++) group[p++] = g;
+    }
+
+    batch::for_each_weighted(
+        count,
+        [&](int p) {
+            int g = group[p];
+            return (2.0 * k[g] + 1.0) * m[g] * n[g];
+        },
+        [&](int p) {
+            int g = group[p];
+            dgemm(static_cast<char>(transa[g]), static_cast<char>(transb[g]), m[g], n[g], k[g],
+                  alpha[g], a + offa[p], lda[g], b + offb[p], ldb[g], beta[g], c + offc[p],
+                  ldc[g]);
+        });
+}
+
+} // extern "C"
@@ -1,57 +1,25 @@
 #include <algorithm>
 #include <cmath>
 
-extern "C" {
+#include "check.h"
+#include "parallel.h"
 
-void dgemmtr(int uplo, int transa, int transb, int n, int k, double alpha,
-             const double* a, int lda, const double* b, int ldb, 
-             double beta, double* c, int ldc) {
-    // Quick return if possible
-    if (n == 0) return;
-
-    // Set NOTA and NOTB as true if A and B respectively are not
-    // transposed and set NROWA and NROWB as the number of rows of A
-    // and B respectively.
-    bool nota = (transa == 0);  // 'N'
-    bool notb = (transb == 0);  // 'N'
-    bool upper = (uplo == 0);   // 'U'
-    
-    // And if alpha == 0
-    if (alpha == 0.0) {
-        if (beta == 0.0) {
-            for (int j = 0; j < n; j++) {
-                int istart = upper ? 0 : j;
-                int istop = upper ? j : n - 1;
-                
-                for (int i = istart; i <= istop; i++) {
-                    c[i + j * ldc] = 0.0;
-                }
-            }
-        } else {
-            for (int j = 0; j < n; j++) {
-                int istart = upper ? 0 : j;
-                int istop = upper ? j : n - 1;
-                
-                for (int i = istart; i <= istop; i++) {
-                    c[i + j * ldc] = beta * c[i + j * ldc];
-                }
-            }
-        }
-        return;
-    }
+namespace {
 
+// The operations of DGEMMTR on the columns [j0, j1) of C
+void dgemmtr_columns(bool upper, bool nota, bool notb, int n, int k, double alpha,
+                     const double* a, int lda, const double* b, int ldb, double beta, double* c,
+                     int ldc, int j0, int j1) {
     // Start the operations.
     if (notb) {
         if (nota) {
             // Form C := alpha*A*B + beta*C
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 int istart = upper ? 0 : j;
                 int istop = upper ? j : n - 1;
                 
                 if (beta == 0.0) {
-                    for (int i = istart; i <= istop; i++) {
-                        c[i + j * ldc] = 0.0;
-                    }
+                    std::fill(c + istart + j * ldc, c + istop + 1 + j * ldc, 0.0);
                 } else if (beta != 1.0) {
                     for (int i = istart; i <= istop; i++) {
                         c[i + j * ldc] = beta * c[i + j * ldc];
@@ -67,7 +35,7 @@ void dgemmtr(int uplo, int transa, int transb, int n, int k, double alpha,
             }
         } else {
             // Form C := alpha*A**T*B + beta*C
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 int istart = upper ? 0 : j;
                 int istop = upper ? j : n - 1;
                 
@@ -87,14 +55,12 @@ void dgemmtr(int uplo, int transa, int transb, int n, int k, double alpha,
     } else {
         if (nota) {
             // Form C := alpha*A*B**T + beta*C
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 int istart = upper ? 0 : j;
                 int istop = upper ? j : n - 1;
                 
                 if (beta == 0.0) {
-                    for (int i = istart; i <= istop; i++) {
-                        c[i + j * ldc] = 0.0;
-                    }
+                    std::fill(c + istart + j * ldc, c + istop + 1 + j * ldc, 0.0);
                 } else if (beta != 1.0) {
                     for (int i = istart; i <= istop; i++) {
                         c[i + j * ldc] = beta * c[i + j * ldc];
@@ -110,7 +76,7 @@ void dgemmtr(int uplo, int transa, int transb, int n, int k, double alpha,
             }
         } else {
             // Form C := alpha*A**T*B**T + beta*C
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 int istart = upper ? 0 : j;
                 int istop = upper ? j : n - 1;
                 
@@ -130,4 +96,63 @@ void dgemmtr(int uplo, int transa, int transb, int n, int k, double alpha,
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void dgemmtr(int uplo, int transa, int transb, int n, int k, double alpha,
+             const double* a, int lda, const double* b, int ldb, 
+             double beta, double* c, int ldc) {
+    BLAS_CHECK("DGEMMTR", check::flag(uplo), 1);
+    BLAS_CHECK("DGEMMTR", check::trans(transa), 2);
+    BLAS_CHECK("DGEMMTR", check::trans(transb), 3);
+    BLAS_CHECK("DGEMMTR", n >= 0, 4);
+    BLAS_CHECK("DGEMMTR", k >= 0, 5);
+    BLAS_CHECK("DGEMMTR", lda >= check::max1(transa == 0 ? n : k), 8);
+    BLAS_CHECK("DGEMMTR", ldb >= check::max1(transb == 0 ? k : n), 10);
+    BLAS_CHECK("DGEMMTR", ldc >= check::max1(n), 13);
+
+    // Quick return if possible
+    if (n == 0) return;
+
+    // Set NOTA and NOTB as true if A and B respectively are not
+    // transposed and set NROWA and NROWB as the number of rows of A
+    // and B respectively.
+    bool nota = (transa == 0);  // 'N'
+    bool notb = (transb == 0);  // 'N'
+    bool upper = (uplo == 0);   // 'U'
+    
+    // And if alpha == 0
+    if (alpha == 0.0) {
+        if (beta == 0.0) {
+            for (int j = 0; j < n; j++) {
+                int istart = upper ? 0 : j;
+                int istop = upper ? j : n - 1;
+                
+                std::fill(c + istart + j * ldc, c + istop + 1 + j * ldc, 0.0);
+            }
+        } else {
+            for (int j = 0; j < n; j++) {
+                int istart = upper ? 0 : j;
+                int istop = upper ? j : n - 1;
+                
+                for (int i = istart; i <= istop; i++) {
+                    c[i + j * ldc] = beta * c[i + j * ldc];
+                }
+            }
+        }
+        return;
+    }
+
+    // Start the operations, on ranges of columns of C balanced by flops
+    // between the threads
+    parallel::for_balanced(
+        n,
+        1,
+        [&](int j) { return (upper ? j + 1.0 : n - j) * k; },
+        [&](int j0, int j1) {
+            dgemmtr_columns(upper, nota, notb, n, k, alpha, a, lda, b, ldb, beta, c, ldc, j0, j1);
+        });
+}
+
 } // extern "C"
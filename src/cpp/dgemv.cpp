@@ -6,6 +6,9 @@
  * This is a C++ implementation of the BLAS Level 2 DGEMV routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, large matrices are split into one panel of y per thread
+ * (parallel::Split); every element of y is computed as without threads.
+ * 
  * @param trans  0: y = alpha*A*x + beta*y, 1/2: y = alpha*A^T*x + beta*y
  * @param m      Number of rows of matrix A
  * @param n      Number of columns of matrix A
@@ -19,11 +22,15 @@
  * @param incy   Storage spacing between elements of y
  */
 
-extern "C" {
+#include <algorithm>
 
-void dgemv(int trans, int m, int n, double alpha, const double* a, int lda,
-           const double* x, int incx, double beta, double* y, int incy) {
-    
+#include "check.h"
+#include "parallel.h"
+
+namespace {
+
+void dgemv_serial(int trans, int m, int n, double alpha, const double* a, int lda,
+                  const double* x, int incx, double beta, double* y, int incy) {
     const double zero = 0.0;
     const double one = 1.0;
     
@@ -55,9 +62,7 @@ void dgemv(int trans, int m, int n, double alpha, const double* a, int lda,
     if (beta != one) {
         if (incy == 1) {
             if (beta == zero) {
-                for (int i = 0; i < leny; i++) {
-                    y[i] = zero;
-                }
+                std::fill(y, y + leny, zero);
             } else {
                 for (int i = 0; i < leny; i++) {
                     y[i] = beta * y[i];
@@ -130,4 +135,39 @@ void dgemv(int trans, int m, int n, double alpha, const double* a, int lda,
     }
 }
 
-} // extern "C"
\ No newline at end of file
+} // namespace
+
+extern "C" {
+
+void dgemv(int trans, int m, int n, double alpha, const double* a, int lda,
+           const double* x, int incx, double beta, double* y, int incy) {
+    BLAS_CHECK("DGEMV", check::trans(trans), 1);
+    BLAS_CHECK("DGEMV", m >= 0, 2);
+    BLAS_CHECK("DGEMV", n >= 0, 3);
+    BLAS_CHECK("DGEMV", lda >= check::max1(m), 6);
+    BLAS_CHECK("DGEMV", incx != 0, 8);
+    BLAS_CHECK("DGEMV", incy != 0, 11);
+
+    // Large matrices: each thread computes a panel of y, from a panel of rows
+    // of A for y = A*x or of columns for y = A^T*x
+    bool notran = (trans == 0);
+    int leny = notran ? m : n;
+    parallel::Split split(leny, notran ? n : m, 8);
+    if (split.parts() == 1) {
+        dgemv_serial(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        return;
+    }
+    parallel::run(split.parts(), [&](int t) {
+        int first = split.first(t);
+        int last = split.last(t);
+        double* yt = parallel::slice(y, incy, leny, first, last);
+        if (notran) {
+            dgemv_serial(trans, last - first, n, alpha, a + first, lda, x, incx, beta, yt, incy);
+        } else {
+            dgemv_serial(trans, m, last - first, alpha, a + static_cast<size_t>(first) * lda, lda,
+                         x, incx, beta, yt, incy);
+        }
+    });
+}
+
+} // extern "C"
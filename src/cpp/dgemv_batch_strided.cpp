@@ -0,0 +1,123 @@
+/**
+ * DGEMV_BATCH_STRIDED - Batched double precision matrix-vector multiplication
+ *
+ * Computes, for b = 0, ..., batch - 1:
+ *   y_b = alpha * A_b * x_b + beta * y_b  or  y_b = alpha * A_b^T * x_b + beta * y_b
+ * where A_b = a + b * stridea, x_b = x + b * stridex and y_b = y + b * stridey
+ *
+ * Each problem is computed as by DGEMV. The batch runs on the thread pool
+ * when it is large enough; tiny problems are computed two at a time in the
+ * lanes of a vector (see batch.h).
+ *
+ * @param trans    0: y = alpha*A*x + beta*y, 1/2: y = alpha*A^T*x + beta*y
+ * @param m        Number of rows of each A_b
+ * @param n        Number of columns of each A_b
+ * @param alpha    Scalar multiplier for A*x or A^T*x
+ * @param a        Matrices A_b stored in column-major order
+ * @param lda      Leading dimension of each A_b (>= max(1,m))
+ * @param stridea  Elements between successive A_b (0: one shared matrix)
+ * @param x        Input vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b (0: one shared vector)
+ * @param beta     Scalar multiplier for y
+ * @param y        Input/output vectors y_b
+ * @param incy     Storage spacing between elements of each y_b
+ * @param stridey  Elements between successive y_b
+ * @param batch    Number of problems
+ */
+
+#include <algorithm>
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increments, as the incx == incy == 1
+// loops of DGEMV
+void gemv_pair(bool notran, int m, int n, double alpha, const double* a0, const double* a1,
+               int lda, const double* x0, const double* x1, double beta, double* y0, double* y1) {
+    int leny = notran ? m : n;
+    const v128_t valpha = wasm_f64x2_splat(alpha);
+    const v128_t vbeta = wasm_f64x2_splat(beta);
+    const v128_t vzero = wasm_f64x2_splat(0.0);
+
+    if (beta != 1.0) {
+        for (int i = 0; i < leny; i++) {
+            v128_t yi = beta == 0.0 ? vzero : wasm_f64x2_mul(vbeta, batch::load2(y0, y1, i));
+            batch::store2(y0, y1, i, yi);
+        }
+    }
+    if (alpha == 0.0) return;
+
+    if (notran) {
+        for (int j = 0; j < n; j++) {
+            v128_t temp = wasm_f64x2_mul(valpha, batch::load2(x0, x1, j));
+            for (int i = 0; i < m; i++) {
+                size_t k = i + static_cast<size_t>(j) * lda;
+                v128_t yi = wasm_f64x2_add(batch::load2(y0, y1, i),
+                                           wasm_f64x2_mul(temp, batch::load2(a0, a1, k)));
+                batch::store2(y0, y1, i, yi);
+            }
+        }
+    } else {
+        for (int j = 0; j < n; j++) {
+            v128_t temp = vzero;
+            for (int i = 0; i < m; i++) {
+                size_t k = i + static_cast<size_t>(j) * lda;
+                temp = wasm_f64x2_add(temp, wasm_f64x2_mul(batch::load2(a0, a1, k),
+                                                           batch::load2(x0, x1, i)));
+            }
+            v128_t yj = wasm_f64x2_add(batch::load2(y0, y1, j), wasm_f64x2_mul(valpha, temp));
+            batch::store2(y0, y1, j, yj);
+        }
+    }
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dgemv_batch_strided(int trans, int m, int n, double alpha, const double* a, int lda,
+                         int stridea, const double* x, int incx, int stridex, double beta,
+                         double* y, int incy, int stridey, int batch) {
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", check::trans(trans), 1);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", m >= 0, 2);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", n >= 0, 3);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", lda >= check::max1(m), 6);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", stridea >= 0, 7);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", incx != 0, 9);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", stridex >= 0, 10);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", incy != 0, 13);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", stridey > 0 || batch <= 1, 14);
+    BLAS_CHECK("DGEMV_BATCH_STRIDED", batch >= 0, 15);
+
+    // Quick return if possible
+    if (batch <= 0 || m == 0 || n == 0 || (alpha == 0.0 && beta == 1.0)) return;
+
+    batch::for_each_chunk(batch, 2.0 * m * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (std::max(m, n) <= batch::TINY && incx == 1 && incy == 1) {
+            bool notran = (trans == 0);
+            for (; b + 2 <= last; b += 2) {
+                gemv_pair(notran, m, n, alpha, a + batch::offset(b, stridea),
+                          a + batch::offset(b + 1, stridea), lda, x + batch::offset(b, stridex),
+                          x + batch::offset(b + 1, stridex), beta, y + batch::offset(b, stridey),
+                          y + batch::offset(b + 1, stridey));
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            dgemv(trans, m, n, alpha, a + batch::offset(b, stridea), lda,
+                  x + batch::offset(b, stridex), incx, beta, y + batch::offset(b, stridey), incy);
+        }
+    });
+}
+
+} // extern "C"
@@ -0,0 +1,91 @@
+/**
+ * DGEQRF - Double precision QR factorization of a general matrix
+ *
+ * Computes: A = Q * R
+ * where Q is orthogonal, the product of min(m, n) Householder reflectors
+ * H(i) = I - tau(i) * v(i) * v(i)^T, and R is upper triangular (upper
+ * trapezoidal if m < n)
+ *
+ * This is a C++ implementation of the LAPACK routine DGEQRF, based on the
+ * reference LAPACK implementation from netlib.org. Panels of NB columns are
+ * factored as by DGEQR2 with DGEMV and DGER; the panel's reflectors are then
+ * applied to the rest of the matrix at once as a block reflector with DTRMM
+ * and DGEMM (householder.h). The workspace of one panel is allocated by the
+ * kernel itself, so there is no work argument.
+ *
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param a      Input matrix (m x n); output R on and above the diagonal and
+ *               the vectors v(i) below it (v(i)(i) = 1 is not stored)
+ * @param lda    Leading dimension of A
+ * @param tau    Output scalar factors of the reflectors (min(m, n))
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+#include "householder.h"
+
+namespace {
+
+// Columns per panel
+constexpr int NB = 32;
+
+// The unblocked factorization DGEQR2 of the m x n panel a; work holds n
+// elements
+void dgeqr2(int m, int n, double* a, int lda, double* tau, double* work) {
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+
+    for (int i = 0; i < std::min(m, n); i++) {
+        // Generate H(i) to annihilate A(i+1:m-1, i)
+        householder::larfg(m - i, *at(i, i), at(std::min(i + 1, m - 1), i), 1, tau[i]);
+
+        // Apply H(i) to A(i:m-1, i+1:n-1) from the left
+        if (i + 1 < n && tau[i] != 0.0) {
+            double aii = *at(i, i);
+            *at(i, i) = 1.0;
+            dgemv(1, m - i, n - i - 1, 1.0, at(i, i + 1), lda, at(i, i), 1, 0.0, work, 1);
+            dger(m - i, n - i - 1, -tau[i], at(i, i), 1, work, 1, at(i, i + 1), lda);
+            *at(i, i) = aii;
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void dgeqrf(int m, int n, double* a, int lda, double* tau) {
+    BLAS_CHECK("DGEQRF", m >= 0, 1);
+    BLAS_CHECK("DGEQRF", n >= 0, 2);
+    BLAS_CHECK("DGEQRF", lda >= check::max1(m), 4);
+
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    const int k = std::min(m, n);
+    if (k == 0) return;
+
+    // T of one panel, then W of its block update
+    const int nb = std::min(k, NB);
+    std::vector<double> work(static_cast<size_t>(nb) * nb + static_cast<size_t>(n) * nb);
+    double* t = work.data();
+    double* w = t + nb * nb;
+
+    for (int i = 0; i < k; i += nb) {
+        const int ib = std::min(k - i, nb);
+
+        // Factor the panel A(i:m-1, i:i+ib-1)
+        dgeqr2(m - i, ib, at(i, i), lda, tau + i, w);
+
+        // Apply H(i+ib-1)^T * ... * H(i)^T to A(i:m-1, i+ib:n-1)
+        if (i + ib < n) {
+            householder::larft(m - i, ib, at(i, i), lda, tau + i, t, nb);
+            householder::larfb('L', 'T', m - i, n - i - ib, ib, at(i, i), lda, t, nb,
+                               at(i, i + ib), lda, w);
+        }
+    }
+}
+
+} // extern "C"
@@ -17,10 +17,17 @@
  * @param lda    Leading dimension of A
  */
 
+#include "check.h"
+
 extern "C" {
 
 void dger(int m, int n, double alpha, const double* x, int incx,
           const double* y, int incy, double* a, int lda) {
+    BLAS_CHECK("DGER", m >= 0, 1);
+    BLAS_CHECK("DGER", n >= 0, 2);
+    BLAS_CHECK("DGER", incx != 0, 5);
+    BLAS_CHECK("DGER", incy != 0, 7);
+    BLAS_CHECK("DGER", lda >= check::max1(m), 9);
     
     const double zero = 0.0;
     
@@ -0,0 +1,95 @@
+/**
+ * DGER_BATCH_STRIDED - Batched double precision rank-1 update
+ *
+ * Computes, for b = 0, ..., batch - 1: A_b = alpha * x_b * y_b^T + A_b
+ * where x_b = x + b * stridex, y_b = y + b * stridey and A_b = a + b * stridea
+ *
+ * Each problem is computed as by DGER. The batch runs on the thread pool
+ * when it is large enough; tiny problems are computed two at a time in the
+ * lanes of a vector (see batch.h).
+ *
+ * @param m        Number of rows of each A_b
+ * @param n        Number of columns of each A_b
+ * @param alpha    Scalar multiplier for x*y^T
+ * @param x        Input vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b (0: one shared vector)
+ * @param y        Input vectors y_b
+ * @param incy     Storage spacing between elements of each y_b
+ * @param stridey  Elements between successive y_b (0: one shared vector)
+ * @param a        Input/output matrices A_b stored in column-major order
+ * @param lda      Leading dimension of each A_b (>= max(1,m))
+ * @param stridea  Elements between successive A_b
+ * @param batch    Number of problems
+ */
+
+#include <algorithm>
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increments, as the incx == incy == 1 loop
+// of DGER; lanes whose y[j] is zero are skipped
+void ger_pair(int m, int n, double alpha, const double* x0, const double* x1, const double* y0,
+              const double* y1, double* a0, double* a1, int lda) {
+    const v128_t valpha = wasm_f64x2_splat(alpha);
+    const v128_t vzero = wasm_f64x2_splat(0.0);
+    for (int j = 0; j < n; j++) {
+        v128_t yj = batch::load2(y0, y1, j);
+        v128_t nonzero = wasm_f64x2_ne(yj, vzero);
+        v128_t temp = wasm_f64x2_mul(valpha, yj);
+        for (int i = 0; i < m; i++) {
+            size_t k = i + static_cast<size_t>(j) * lda;
+            v128_t update = batch::where(nonzero, wasm_f64x2_mul(temp, batch::load2(x0, x1, i)));
+            batch::store2(a0, a1, k, wasm_f64x2_add(batch::load2(a0, a1, k), update));
+        }
+    }
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dger_batch_strided(int m, int n, double alpha, const double* x, int incx, int stridex,
+                        const double* y, int incy, int stridey, double* a, int lda, int stridea,
+                        int batch) {
+    BLAS_CHECK("DGER_BATCH_STRIDED", m >= 0, 1);
+    BLAS_CHECK("DGER_BATCH_STRIDED", n >= 0, 2);
+    BLAS_CHECK("DGER_BATCH_STRIDED", incx != 0, 5);
+    BLAS_CHECK("DGER_BATCH_STRIDED", stridex >= 0, 6);
+    BLAS_CHECK("DGER_BATCH_STRIDED", incy != 0, 8);
+    BLAS_CHECK("DGER_BATCH_STRIDED", stridey >= 0, 9);
+    BLAS_CHECK("DGER_BATCH_STRIDED", lda >= check::max1(m), 11);
+    BLAS_CHECK("DGER_BATCH_STRIDED", stridea > 0 || batch <= 1, 12);
+    BLAS_CHECK("DGER_BATCH_STRIDED", batch >= 0, 13);
+
+    // Quick return if possible
+    if (batch <= 0 || m == 0 || n == 0 || alpha == 0.0) return;
+
+    batch::for_each_chunk(batch, 2.0 * m * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (std::max(m, n) <= batch::TINY && incx == 1 && incy == 1) {
+            for (; b + 2 <= last; b += 2) {
+                ger_pair(m, n, alpha, x + batch::offset(b, stridex),
+                         x + batch::offset(b + 1, stridex), y + batch::offset(b, stridey),
+                         y + batch::offset(b + 1, stridey), a + batch::offset(b, stridea),
+                         a + batch::offset(b + 1, stridea), lda);
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            dger(m, n, alpha, x + batch::offset(b, stridex), incx, y + batch::offset(b, stridey),
+                 incy, a + batch::offset(b, stridea), lda);
+        }
+    });
+}
+
+} // extern "C"
@@ -0,0 +1,136 @@
+/**
+ * DGETRF - Double precision LU factorization of a general matrix
+ *
+ * Computes: A = P * L * U
+ * where P is a permutation matrix, L is lower triangular with a unit
+ * diagonal (lower trapezoidal if m > n) and U is upper triangular (upper
+ * trapezoidal if m < n), using partial pivoting with row interchanges
+ *
+ * This is a C++ implementation of the LAPACK routine DGETRF, based on the
+ * reference LAPACK implementation from netlib.org. Panels of NB columns are
+ * factored as by DGETF2, with the rank-1 updates done by DGER; the rest of
+ * the matrix is then updated with DTRSM and DGEMM, so most of the work (and
+ * the threading) is in the Level 3 kernels.
+ *
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param a      Input/output matrix (m x n): on exit the factors L and U; the
+ *               unit diagonal of L is not stored
+ * @param lda    Leading dimension of A
+ * @param ipiv   Output pivot indices (min(m, n)), 1-based: row i was
+ *               interchanged with row ipiv[i]
+ * @return       0 on success, i > 0 if U(i, i) is exactly zero; the
+ *               factorization is completed, but U is singular
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// Columns per panel
+constexpr int NB = 64;
+
+// The unblocked factorization DGETF2 of the m x n panel a, with pivots
+// relative to the panel; returns its info
+int dgetf2(int m, int n, double* a, int lda, int* ipiv) {
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    int info = 0;
+
+    for (int j = 0; j < std::min(m, n); j++) {
+        // Find the pivot and test for singularity
+        const double* col = at(0, j);
+        int p = j;
+        double pmax = std::abs(col[j]);
+        for (int i = j + 1; i < m; i++) {
+            if (std::abs(col[i]) > pmax) {
+                pmax = std::abs(col[i]);
+                p = i;
+            }
+        }
+        ipiv[j] = p + 1;
+
+        if (*at(p, j) != 0.0) {
+            // Apply the interchange to the columns of the panel
+            if (p != j) {
+                for (int k = 0; k < n; k++) std::swap(*at(j, k), *at(p, k));
+            }
+
+            // Compute the elements j+1:m of the j-th column
+            double pivot = *at(j, j);
+            double* l = at(j + 1, j);
+            if (std::abs(pivot) >= DBL_MIN) {
+                double r = 1.0 / pivot;
+                for (int i = 0; i < m - j - 1; i++) l[i] *= r;
+            } else {
+                for (int i = 0; i < m - j - 1; i++) l[i] /= pivot;
+            }
+        } else if (info == 0) {
+            info = j + 1;
+        }
+
+        // Update the trailing columns of the panel
+        if (j + 1 < n && j + 1 < m) {
+            dger(m - j - 1, n - j - 1, -1.0, at(j + 1, j), 1, at(j, j + 1), lda, at(j + 1, j + 1),
+                 lda);
+        }
+    }
+    return info;
+}
+
+// The row interchanges ipiv[k1..k2) of DLASWP applied to n columns of a
+void laswp(int n, double* a, int lda, int k1, int k2, const int* ipiv) {
+    for (int j = 0; j < n; j++) {
+        double* col = a + static_cast<size_t>(j) * lda;
+        for (int i = k1; i < k2; i++) {
+            int p = ipiv[i] - 1;
+            if (p != i) std::swap(col[i], col[p]);
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int dgetrf(int m, int n, double* a, int lda, int* ipiv) {
+    BLAS_CHECK("DGETRF", m >= 0, 1);
+    BLAS_CHECK("DGETRF", n >= 0, 2);
+    BLAS_CHECK("DGETRF", lda >= check::max1(m), 4);
+
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    const int mn = std::min(m, n);
+    int info = 0;
+
+    for (int j = 0; j < mn; j += NB) {
+        const int jb = std::min(mn - j, NB);
+
+        // Factor the diagonal and subdiagonal blocks and test for singularity
+        int panel = dgetf2(m - j, jb, at(j, j), lda, ipiv + j);
+        if (info == 0 && panel > 0) info = panel + j;
+
+        // Adjust the pivot indices and apply the interchanges to the
+        // columns left and right of the panel
+        for (int i = j; i < j + jb; i++) ipiv[i] += j;
+        laswp(j, a, lda, j, j + jb, ipiv);
+
+        if (j + jb < n) {
+            laswp(n - j - jb, at(0, j + jb), lda, j, j + jb, ipiv);
+
+            // Compute the block row of U and update the trailing submatrix
+            dtrsm('L', 'L', 'N', 'U', jb, n - j - jb, 1.0, at(j, j), lda, at(j, j + jb), lda);
+            if (j + jb < m) {
+                dgemm('N', 'N', m - j - jb, n - j - jb, jb, -1.0, at(j + jb, j), lda,
+                      at(j, j + jb), lda, 1.0, at(j + jb, j + jb), lda);
+            }
+        }
+    }
+    return info;
+}
+
+} // extern "C"
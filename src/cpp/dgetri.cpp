@@ -0,0 +1,83 @@
+/**
+ * DGETRI - Double precision inverse of a general matrix
+ *
+ * Computes: A := inv(A)
+ * from the LU factorization A = P * L * U computed by DGETRF, in place
+ *
+ * This is a C++ implementation of the LAPACK routine DGETRI, based on the
+ * reference LAPACK implementation from netlib.org: inv(U) is formed by
+ * DTRTRI, then inv(A) * L = inv(U) is solved for inv(A) a block of NB
+ * columns at a time, last block first, with DGEMM and DTRSM, and the column
+ * interchanges are undone. The only workspace is one block column of L
+ * (n x NB), which the kernel allocates itself.
+ *
+ * @param n      Order of A
+ * @param a      Input factors L and U from DGETRF, output inv(A) (n x n)
+ * @param lda    Leading dimension of A
+ * @param ipiv   Pivot indices from DGETRF (n), 1-based
+ * @return       0 on success, i > 0 if U(i, i) is exactly zero and A is
+ *               singular; A is then unchanged
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// Columns per block
+constexpr int NB = 64;
+
+} // namespace
+
+extern "C" {
+
+int dgetri(int n, double* a, int lda, const int* ipiv) {
+    BLAS_CHECK("DGETRI", n >= 0, 1);
+    BLAS_CHECK("DGETRI", lda >= check::max1(n), 3);
+
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+
+    // Quick return if possible
+    if (n == 0) return 0;
+
+    // Form inv(U); if it is singular, there is no inverse
+    int info = dtrtri('U', 'N', n, a, lda);
+    if (info > 0) return info;
+
+    // Solve inv(A) * L = inv(U) for inv(A), one block column at a time
+    const int nb = std::min(n, NB);
+    std::vector<double> work(static_cast<size_t>(n) * nb);
+    auto w = [&](int i, int j) { return work.data() + i + static_cast<size_t>(j) * n; };
+    for (int j = (n - 1) / nb * nb; j >= 0; j -= nb) {
+        const int jb = std::min(n - j, nb);
+
+        // Copy the current block column of L to work and replace it with zeros
+        for (int jj = 0; jj < jb; jj++) {
+            for (int i = j + jj + 1; i < n; i++) {
+                *w(i, jj) = *at(i, j + jj);
+                *at(i, j + jj) = 0.0;
+            }
+        }
+
+        // Compute the current block column of inv(A)
+        if (j + jb < n) {
+            dgemm('N', 'N', n, jb, n - j - jb, -1.0, at(0, j + jb), lda, w(j + jb, 0), n, 1.0,
+                  at(0, j), lda);
+        }
+        dtrsm('R', 'L', 'N', 'U', n, jb, 1.0, w(j, 0), n, at(0, j), lda);
+    }
+
+    // Apply the column interchanges
+    for (int j = n - 2; j >= 0; j--) {
+        const int jp = ipiv[j] - 1;
+        if (jp != j) std::swap_ranges(at(0, j), at(0, j) + n, at(0, jp));
+    }
+    return 0;
+}
+
+} // extern "C"
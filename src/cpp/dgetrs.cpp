@@ -0,0 +1,66 @@
+/**
+ * DGETRS - Double precision solve with an LU factorization
+ *
+ * Solves: op(A) * X = B
+ * where op(A) = A or A^T and A = P * L * U has been factored by DGETRF; X
+ * overwrites B
+ *
+ * This is a C++ implementation of the LAPACK routine DGETRS, based on the
+ * reference LAPACK implementation from netlib.org: the row interchanges and
+ * two triangular solves with DTRSM.
+ *
+ * @param trans  'N': A * X = B, 'T'/'C': A^T * X = B
+ * @param n      Order of A
+ * @param nrhs   Number of columns of B
+ * @param a      The factors L and U from DGETRF (n x n)
+ * @param lda    Leading dimension of A
+ * @param ipiv   Pivot indices from DGETRF (n), 1-based
+ * @param b      Input right-hand sides, output solution X (n x nrhs)
+ * @param ldb    Leading dimension of B
+ */
+
+#include <cstddef>
+#include <utility>
+
+#include "blas.h"
+#include "check.h"
+
+extern "C" {
+
+void dgetrs(char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b,
+            int ldb) {
+    BLAS_CHECK("DGETRS", check::trans(trans), 1);
+    BLAS_CHECK("DGETRS", n >= 0, 2);
+    BLAS_CHECK("DGETRS", nrhs >= 0, 3);
+    BLAS_CHECK("DGETRS", lda >= check::max1(n), 5);
+    BLAS_CHECK("DGETRS", ldb >= check::max1(n), 8);
+
+    // Quick return if possible
+    if (n == 0 || nrhs == 0) return;
+
+    if (trans == 'N' || trans == 'n') {
+        // Solve A * X = B: apply the row interchanges, then solve L * X = B
+        // and U * X = B
+        for (int j = 0; j < nrhs; j++) {
+            double* col = b + static_cast<size_t>(j) * ldb;
+            for (int i = 0; i < n; i++) {
+                if (ipiv[i] - 1 != i) std::swap(col[i], col[ipiv[i] - 1]);
+            }
+        }
+        dtrsm('L', 'L', 'N', 'U', n, nrhs, 1.0, a, lda, b, ldb);
+        dtrsm('L', 'U', 'N', 'N', n, nrhs, 1.0, a, lda, b, ldb);
+    } else {
+        // Solve A^T * X = B: solve U^T * X = B and L^T * X = B, then apply
+        // the row interchanges in reverse order
+        dtrsm('L', 'U', 'T', 'N', n, nrhs, 1.0, a, lda, b, ldb);
+        dtrsm('L', 'L', 'T', 'U', n, nrhs, 1.0, a, lda, b, ldb);
+        for (int j = 0; j < nrhs; j++) {
+            double* col = b + static_cast<size_t>(j) * ldb;
+            for (int i = n - 1; i >= 0; i--) {
+                if (ipiv[i] - 1 != i) std::swap(col[i], col[ipiv[i] - 1]);
+            }
+        }
+    }
+}
+
+} // extern "C"
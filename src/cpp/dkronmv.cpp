@@ -0,0 +1,99 @@
+/**
+ * DKRONMV - Double precision Kronecker product matrix-vector multiplication
+ *
+ * Computes: y = alpha * op(A_0 (x) A_1 (x) ... (x) A_{d-1}) * x + beta * y
+ * where (x) is the Kronecker product, op(X) = X or X^T and the factor A_k is
+ * the m[k] x n[k] matrix at a + offa[k] with leading dimension lda[k]
+ *
+ * The Kronecker product is never formed. x is viewed as a tensor whose first
+ * (fastest) mode belongs to the last factor, and each factor is applied in
+ * turn as a mode product: one DGEMM of the q x rest unfolding of the tensor
+ * with op(A_k), written transposed so that the next mode becomes the
+ * fastest. After d products the modes are back in their original order.
+ * The cost is sum_k p_k * q_k * (length of the tensor at step k) flops
+ * instead of prod(p_k * q_k) for the explicit product.
+ *
+ * The intermediate tensors alternate between the two halves of one
+ * workspace that the kernel allocates itself; the last product writes to y
+ * directly, with alpha and beta.
+ *
+ * @param trans  'N': y = alpha*(A_0 (x) ... (x) A_{d-1})*x + beta*y,
+ *               'T'/'C': y = alpha*(A_0 (x) ... (x) A_{d-1})^T*x + beta*y
+ * @param d      Number of factors, at least 1
+ * @param m      Rows of each factor (d)
+ * @param n      Columns of each factor (d)
+ * @param alpha  Scalar multiplier for the product
+ * @param a      The factors
+ * @param lda    Leading dimension of each factor (d)
+ * @param offa   Element offset of each factor in a (d)
+ * @param x      Input vector: prod(n) elements ('N') or prod(m) ('T')
+ * @param beta   Scalar multiplier for y
+ * @param y      Input/output vector: prod(m) elements ('N') or prod(n) ('T')
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+
+extern "C" {
+
+void dkronmv(char trans, int d, const int* m, const int* n, double alpha, const double* a,
+             const int* lda, const int* offa, const double* x, double beta, double* y) {
+    BLAS_CHECK("DKRONMV", check::trans(trans), 1);
+    BLAS_CHECK("DKRONMV", d >= 1, 2);
+    for (int k = 0; k < d; k++) {
+        BLAS_CHECK("DKRONMV", m[k] >= 0, 3);
+        BLAS_CHECK("DKRONMV", n[k] >= 0, 4);
+        BLAS_CHECK("DKRONMV", lda[k] >= check::max1(m[k]), 7);
+    }
+
+    const bool notrans = trans == 'N' || trans == 'n';
+
+    // Rows (p) and columns (q) of op(A_k); the lengths of x and y
+    std::vector<int> p(d), q(d);
+    size_t xlen = 1;
+    size_t ylen = 1;
+    for (int k = 0; k < d; k++) {
+        p[k] = notrans ? m[k] : n[k];
+        q[k] = notrans ? n[k] : m[k];
+        xlen *= q[k];
+        ylen *= p[k];
+    }
+
+    // Quick return if possible
+    if (ylen == 0) return;
+    if (xlen == 0 || alpha == 0.0) {
+        if (beta == 0.0) {
+            std::fill(y, y + ylen, 0.0);
+        } else if (beta != 1.0) {
+            for (size_t i = 0; i < ylen; i++) y[i] *= beta;
+        }
+        return;
+    }
+
+    // Length of the tensor after each product but the last, which is y
+    size_t len = xlen;
+    size_t most = 0;
+    for (int k = d - 1; k > 0; k--) {
+        len = len / q[k] * p[k];
+        most = std::max(most, len);
+    }
+    std::vector<double> work(2 * most);
+
+    const double* src = x;
+    len = xlen;
+    for (int k = d - 1; k >= 0; k--) {
+        // dst (rest x p_k) = src^T (rest x q_k) * op(A_k)^T
+        int rest = static_cast<int>(len / q[k]);
+        double* dst = k == 0 ? y : work.data() + (src == work.data() ? most : 0);
+        dgemm('T', notrans ? 'T' : 'N', rest, p[k], q[k], k == 0 ? alpha : 1.0, src, q[k],
+              a + offa[k], lda[k], k == 0 ? beta : 0.0, dst, rest);
+        src = dst;
+        len = static_cast<size_t>(rest) * p[k];
+    }
+}
+
+} // extern "C"
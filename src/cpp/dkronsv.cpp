@@ -0,0 +1,112 @@
+/**
+ * DKRONSV - Double precision Kronecker product solve
+ *
+ * Solves: op(A_0 (x) A_1 (x) ... (x) A_{d-1}) * x = b
+ * where (x) is the Kronecker product, op(X) = X or X^T and the factor A_k is
+ * the n[k] x n[k] matrix at a + offa[k] with leading dimension lda[k]; x
+ * overwrites b
+ *
+ * The inverse of a Kronecker product is the Kronecker product of the
+ * inverses, so the solve is the mode product sequence of DKRONMV with each
+ * factor applied through its LU factorization: the factors are copied and
+ * factored by DGETRF, then for each mode the n[k] x rest unfolding is solved
+ * in place by DGETRS and transposed so that the next mode becomes the
+ * fastest. The Kronecker product is never formed. The factor copies and the
+ * transpose target share one workspace that the kernel allocates itself;
+ * b is left unchanged if a factor is singular.
+ *
+ * @param trans  'N': solve (A_0 (x) ... (x) A_{d-1})*x = b,
+ *               'T'/'C': solve (A_0 (x) ... (x) A_{d-1})^T*x = b
+ * @param d      Number of factors, at least 1
+ * @param n      Order of each factor (d)
+ * @param a      The factors
+ * @param lda    Leading dimension of each factor (d)
+ * @param offa   Element offset of each factor in a (d)
+ * @param b      Input right-hand side, output solution x (prod(n) elements)
+ * @return       0 on success, k > 0 if factor k - 1 is exactly singular
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// Tile of the out-of-place transpose
+constexpr int TILE = 32;
+
+// dst (cols x rows, leading dimension cols) = src^T (src rows x cols,
+// leading dimension rows)
+void transpose(int rows, int cols, const double* src, double* dst) {
+    for (int j0 = 0; j0 < cols; j0 += TILE) {
+        int j1 = std::min(cols, j0 + TILE);
+        for (int i0 = 0; i0 < rows; i0 += TILE) {
+            int i1 = std::min(rows, i0 + TILE);
+            for (int j = j0; j < j1; j++) {
+                const double* s = src + static_cast<size_t>(j) * rows;
+                for (int i = i0; i < i1; i++) {
+                    dst[j + static_cast<size_t>(i) * cols] = s[i];
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int dkronsv(char trans, int d, const int* n, const double* a, const int* lda, const int* offa,
+            double* b) {
+    BLAS_CHECK("DKRONSV", check::trans(trans), 1);
+    BLAS_CHECK("DKRONSV", d >= 1, 2);
+    for (int k = 0; k < d; k++) {
+        BLAS_CHECK("DKRONSV", n[k] >= 0, 3);
+        BLAS_CHECK("DKRONSV", lda[k] >= check::max1(n[k]), 5);
+    }
+
+    // Offsets of the factor copies in the workspace and length of b
+    std::vector<size_t> offlu(d + 1, 0);
+    size_t len = 1;
+    int pivots = 0;
+    for (int k = 0; k < d; k++) {
+        offlu[k + 1] = offlu[k] + static_cast<size_t>(n[k]) * n[k];
+        len *= n[k];
+        pivots += n[k];
+    }
+
+    // Quick return if possible
+    if (len == 0) return 0;
+
+    // Factor copies, then the transpose target
+    std::vector<double> work(offlu[d] + len);
+    std::vector<int> ipiv(pivots);
+
+    // Factor each A_k
+    int* piv = ipiv.data();
+    for (int k = 0; k < d; k++) {
+        dlacpy('A', n[k], n[k], a + offa[k], lda[k], work.data() + offlu[k], n[k]);
+        if (dgetrf(n[k], n[k], work.data() + offlu[k], n[k], piv) > 0) return k + 1;
+        piv += n[k];
+    }
+
+    // Apply the inverse of each factor, last first
+    double* buf = work.data() + offlu[d];
+    double* src = b;
+    for (int k = d - 1; k >= 0; k--) {
+        piv -= n[k];
+        int rest = static_cast<int>(len / n[k]);
+        dgetrs(trans, n[k], rest, work.data() + offlu[k], n[k], piv, src, n[k]);
+
+        double* dst = src == b ? buf : b;
+        transpose(n[k], rest, src, dst);
+        src = dst;
+    }
+    if (src != b) std::copy(src, src + len, b);
+    return 0;
+}
+
+} // extern "C"
@@ -0,0 +1,55 @@
+/**
+ * DLACPY - Double precision matrix copy
+ *
+ * Computes: B := A for the upper triangle, the lower triangle or all of A
+ *
+ * This is a C++ implementation of the LAPACK auxiliary routine DLACPY,
+ * based on the reference LAPACK implementation from netlib.org. Each column
+ * is copied with a single memory.copy when built with bulk memory.
+ *
+ * @param uplo  'U': upper triangle and diagonal, 'L': lower triangle and
+ *              diagonal, otherwise the whole matrix
+ * @param m     Number of rows of A and B
+ * @param n     Number of columns of A and B
+ * @param a     Matrix A (m x n)
+ * @param lda   Leading dimension of A
+ * @param b     Output matrix B (m x n)
+ * @param ldb   Leading dimension of B
+ */
+
+#include <algorithm>
+#include <cstddef>
+
+#include "check.h"
+
+extern "C" {
+
+void dlacpy(char uplo, int m, int n, const double* a, int lda, double* b, int ldb) {
+    BLAS_CHECK("DLACPY", m >= 0, 2);
+    BLAS_CHECK("DLACPY", n >= 0, 3);
+    BLAS_CHECK("DLACPY", lda >= check::max1(m), 5);
+    BLAS_CHECK("DLACPY", ldb >= check::max1(m), 7);
+
+    bool upper = (uplo == 'U' || uplo == 'u');
+    bool lower = (uplo == 'L' || uplo == 'l');
+
+    if (m <= 0 || n <= 0) return;
+
+    // Whole matrices without gaps between the columns: one copy
+    if (!upper && !lower && lda == m && ldb == m) {
+        std::copy(a, a + static_cast<size_t>(m) * n, b);
+        return;
+    }
+
+    for (int j = 0; j < n; j++) {
+        const double* aj = a + static_cast<size_t>(j) * lda;
+        double* bj = b + static_cast<size_t>(j) * ldb;
+        int first = lower ? j : 0;
+        int last = upper ? std::min(j + 1, m) : m;
+        if (first < last) {
+            std::copy(aj + first, aj + last, bj + first);
+        }
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,240 @@
+/**
+ * DLANCZOS - Double precision thick-restart Lanczos eigensolver
+ *
+ * Computes nev eigenvalues of the symmetric n x n matrix A, the largest
+ * ('L'), the smallest ('S') or those of largest magnitude ('M'), and their
+ * orthonormal eigenvectors, by the thick-restart Lanczos method of Wu and
+ * Simon (SIAM J. Matrix Anal. Appl. 22, 2000).
+ *
+ * The Lanczos recurrence builds an orthonormal basis V of ncv vectors of a
+ * Krylov subspace, with A * V = V * T + beta * v * e^T for a small symmetric
+ * T. Each step is one product with A, the three-term recurrence in two fused
+ * passes (subtract the previous vector while taking the dot product with the
+ * current one, then subtract the current vector while taking the norm) and a
+ * full reorthogonalization against the basis (krylov::reorthogonalize). The
+ * eigenpairs of T (Ritz pairs) approximate those of A, with the residual
+ * norm |beta * y(ncv - 1)| for an eigenvector y of T. When the basis is
+ * full and the wanted pairs have not converged, the basis is restarted with
+ * the nev + (ncv - nev) / 2 best Ritz vectors plus v, which keeps T
+ * tridiagonal apart from one arrow row, and the recurrence continues from
+ * there. A Ritz pair has converged when its residual norm is at most
+ * tol * max |theta|, with max |theta| as an estimate of ||A||.
+ *
+ * A is given by its storage (see krylov.h) and applied inside the kernel:
+ * the whole solve runs in one call, with the basis, T and its eigenvectors
+ * in a workspace of about n * (2 * ncv + 1) + 3 * ncv^2 elements that the
+ * kernel allocates itself. The eigenpairs of T are computed by cyclic Jacobi
+ * rotations. The starting vector is pseudo-random and fixed, so the result
+ * is reproducible.
+ *
+ * @param kind   'D': dense (a, lda), 'B': symmetric band (uplo, k, a, lda),
+ *               'P': symmetric packed (uplo, a), 'S': sparse CSR (a, ia, ja)
+ * @param uplo   'U' or 'L': the triangle stored for 'B' and 'P'
+ * @param n      Order of A
+ * @param k      Number of super- or subdiagonals for 'B'
+ * @param a      The matrix, band, packed triangle or nonzero values
+ * @param lda    Leading dimension of a for 'D' and 'B'
+ * @param ia     Row pointers (n + 1) for 'S', zero-based
+ * @param ja     Column indices of the nonzeros for 'S', zero-based
+ * @param which  'L': largest, 'S': smallest, 'M': largest magnitude
+ * @param nev    Number of eigenpairs, 0 <= nev < ncv
+ * @param ncv    Number of basis vectors, nev < ncv <= n
+ * @param maxit  Maximum number of restarts
+ * @param tol    Relative residual tolerance
+ * @param w      Output the nev eigenvalues, in the order of which
+ * @param z      Output the eigenvectors (n x nev)
+ * @param ldz    Leading dimension of z
+ * @return       0 on convergence, or the number of eigenpairs that did not
+ *               converge in maxit restarts (w and z then hold the current
+ *               approximations)
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+#include "krylov.h"
+
+namespace {
+
+// Eigenvalues d and orthonormal eigenvectors q (m x m) of the symmetric m x m
+// matrix s, which is destroyed: cyclic Jacobi sweeps until the off-diagonal
+// part is negligible
+void jacobi(int m, double* s, double* d, double* q) {
+    auto st = [&](int i, int j) { return s + i + static_cast<size_t>(j) * m; };
+    auto qt = [&](int i, int j) { return q + i + static_cast<size_t>(j) * m; };
+
+    dlaset('A', m, m, 0.0, 1.0, q, m);
+    double thresh = DBL_EPSILON * dlange('F', m, m, s, m);
+    for (int sweep = 0; sweep < 64; sweep++) {
+        double off = 0.0;
+        for (int j = 1; j < m; j++) {
+            for (int i = 0; i < j; i++) off += *st(i, j) * *st(i, j);
+        }
+        if (std::sqrt(off) <= thresh) break;
+
+        for (int p = 0; p < m - 1; p++) {
+            for (int r = p + 1; r < m; r++) {
+                double apr = *st(p, r);
+                if (apr == 0.0) continue;
+
+                // Rotation J with J^T * S * J zero at (p, r)
+                double theta = (*st(r, r) - *st(p, p)) / (2.0 * apr);
+                double t = std::copysign(1.0, theta) / (std::abs(theta) + std::hypot(theta, 1.0));
+                double c = 1.0 / std::hypot(t, 1.0);
+                double sn = t * c;
+                drot(m, st(0, p), 1, st(0, r), 1, c, -sn);
+                drot(m, st(p, 0), m, st(r, 0), m, c, -sn);
+                drot(m, qt(0, p), 1, qt(0, r), 1, c, -sn);
+            }
+        }
+    }
+    for (int i = 0; i < m; i++) d[i] = *st(i, i);
+}
+
+// Deterministic pseudo-random vector with elements in (-0.5, 0.5)
+void random_vector(int n, double* v, unsigned& seed) {
+    for (int i = 0; i < n; i++) {
+        seed = static_cast<unsigned>((static_cast<unsigned long long>(seed) * 16807) % 2147483647);
+        v[i] = seed / 2147483647.0 - 0.5;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int dlanczos(char kind, char uplo, int n, int k, const double* a, int lda, const int* ia,
+             const int* ja, char which, int nev, int ncv, int maxit, double tol, double* w,
+             double* z, int ldz) {
+    BLAS_CHECK("DLANCZOS", check::op(kind), 1);
+    BLAS_CHECK("DLANCZOS", check::uplo(uplo), 2);
+    BLAS_CHECK("DLANCZOS", n >= 0, 3);
+    BLAS_CHECK("DLANCZOS", k >= 0, 4);
+    BLAS_CHECK("DLANCZOS", lda >= krylov::min_lda(kind, n, k), 6);
+    BLAS_CHECK("DLANCZOS", check::which(which), 9);
+    BLAS_CHECK("DLANCZOS", nev >= 0, 10);
+    BLAS_CHECK("DLANCZOS", ncv > nev && ncv <= n, 11);
+    BLAS_CHECK("DLANCZOS", maxit >= 0, 12);
+    BLAS_CHECK("DLANCZOS", ldz >= check::max1(n), 16);
+
+    // Quick return if possible
+    if (nev == 0) return 0;
+
+    const krylov::Operator op{kind, uplo == 'U' || uplo == 'u', n, k, a, lda, ia, ja};
+    const char sel = which >= 'a' ? static_cast<char>(which - 'a' + 'A') : which;
+
+    // Basis V (n x (ncv + 1)), T and its eigenvectors Y (ncv x ncv), the
+    // Ritz values, a workspace for the restart and the reorthogonalization
+    std::vector<double> v(static_cast<size_t>(n) * (ncv + 1));
+    std::vector<double> t(static_cast<size_t>(ncv) * ncv, 0.0);
+    std::vector<double> s(static_cast<size_t>(ncv) * ncv);
+    std::vector<double> y(static_cast<size_t>(ncv) * ncv);
+    std::vector<double> theta(ncv);
+    std::vector<double> work(static_cast<size_t>(n) * ncv);
+    std::vector<double> h(ncv + 1);
+    std::vector<int> order(ncv);
+
+    auto vt = [&](int j) { return v.data() + static_cast<size_t>(j) * n; };
+    auto tt = [&](int i, int j) -> double& { return t[i + static_cast<size_t>(j) * ncv]; };
+    auto yt = [&](int i, int j) { return y.data() + i + static_cast<size_t>(j) * ncv; };
+
+    unsigned seed = 1;
+    random_vector(n, vt(0), seed);
+    dscal(n, 1.0 / dnrm2(n, vt(0), 1), vt(0), 1);
+
+    int kept = 0;
+    double beta = 0.0;
+    double anorm = 0.0;
+    for (int restart = 0;; restart++) {
+        // Extend the basis from kept to ncv vectors
+        for (int j = kept; j < ncv; j++) {
+            double* vj = vt(j);
+            double* wj = vt(j + 1);
+            krylov::apply(op, vj, wj);
+
+            double alpha;
+            if (j == kept) {
+                // After a restart v_j is coupled to every kept Ritz vector
+                if (kept > 0) dgemv(0, n, kept, -1.0, v.data(), n, &tt(0, j), 1, 1.0, wj, 1);
+                alpha = ddot(n, wj, 1, vj, 1);
+            } else {
+                alpha = krylov::axpy_dot(n, -tt(j - 1, j), vt(j - 1), wj, vj);
+            }
+            double wnorm = krylov::axpby_nrm2(n, -alpha, vj, 1.0, wj);
+            tt(j, j) = alpha;
+
+            double bnorm = krylov::reorthogonalize(n, j + 1, v.data(), n, wj, h.data(), wnorm);
+            anorm = std::max(anorm, std::abs(alpha) + bnorm);
+            if (bnorm <= DBL_EPSILON * anorm) {
+                // Invariant subspace: continue with a random vector orthogonal to V
+                bnorm = 0.0;
+                std::fill(wj, wj + n, 0.0);
+                if (j + 1 < n) {
+                    random_vector(n, wj, seed);
+                    double rnorm = krylov::reorthogonalize(n, j + 1, v.data(), n, wj, h.data(),
+                                                           dnrm2(n, wj, 1));
+                    dscal(n, 1.0 / rnorm, wj, 1);
+                }
+            } else {
+                dscal(n, 1.0 / bnorm, wj, 1);
+            }
+            if (j + 1 < ncv) {
+                tt(j, j + 1) = bnorm;
+                tt(j + 1, j) = bnorm;
+            } else {
+                beta = bnorm;
+            }
+        }
+
+        // Ritz pairs, the wanted ones first
+        s = t;
+        jacobi(ncv, s.data(), theta.data(), y.data());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int p, int q) {
+            if (sel == 'L') return theta[p] > theta[q];
+            if (sel == 'S') return theta[p] < theta[q];
+            return std::abs(theta[p]) > std::abs(theta[q]);
+        });
+
+        double tnorm = 0.0;
+        for (int i = 0; i < ncv; i++) tnorm = std::max(tnorm, std::abs(theta[i]));
+        int nconv = 0;
+        for (int i = 0; i < nev; i++) {
+            if (std::abs(beta * *yt(ncv - 1, order[i])) <= tol * tnorm) nconv++;
+        }
+
+        // The kept Ritz vectors (in s) and their couplings to v
+        bool done = nconv == nev || restart == maxit;
+        int next = done ? nev : std::min(ncv - 1, nev + (ncv - nev) / 2);
+        for (int i = 0; i < next; i++) {
+            double* si = s.data() + static_cast<size_t>(i) * ncv;
+            std::copy(yt(0, order[i]), yt(0, order[i]) + ncv, si);
+        }
+        dgemm('N', 'N', n, next, ncv, 1.0, v.data(), n, s.data(), ncv, 0.0, work.data(), n);
+
+        if (done) {
+            for (int i = 0; i < nev; i++) w[i] = theta[order[i]];
+            dlacpy('A', n, nev, work.data(), n, z, ldz);
+            return nev - nconv;
+        }
+
+        // Thick restart: V = [V * Y_kept, v], T = [diag(theta_kept), beta * y_last; ...]
+        dlacpy('A', n, next, work.data(), n, v.data(), n);
+        std::copy(vt(ncv), vt(ncv) + n, vt(next));
+        std::fill(t.begin(), t.end(), 0.0);
+        for (int i = 0; i < next; i++) {
+            tt(i, i) = theta[order[i]];
+            tt(i, next) = beta * s[(ncv - 1) + static_cast<size_t>(i) * ncv];
+            tt(next, i) = tt(i, next);
+        }
+        kept = next;
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,70 @@
+/**
+ * DLANGE - Double precision norm of a general matrix
+ *
+ * Computes: max(abs(A(i,j))), the 1-norm (maximum column sum), the
+ * infinity-norm (maximum row sum) or the Frobenius norm of A
+ *
+ * This is a C++ implementation of the LAPACK auxiliary routine DLANGE,
+ * based on the reference LAPACK implementation from netlib.org. The
+ * Frobenius norm uses Blue's scaling (blue.h), as DLASSQ does, and the row
+ * sums of the infinity-norm are accumulated a column at a time in a scratch
+ * vector that the kernel allocates itself, so there is no work argument.
+ *
+ * @param norm   'M': max abs, '1' or 'O': 1-norm, 'I': infinity-norm,
+ *               'F' or 'E': Frobenius norm
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param a      Input matrix A (m x n)
+ * @param lda    Leading dimension of A
+ * @return       The selected norm of A, 0 if m or n is 0
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "blue.h"
+#include "check.h"
+#include "reduce.h"
+
+extern "C" {
+
+double dlange(char norm, int m, int n, const double* a, int lda) {
+    BLAS_CHECK("DLANGE", check::norm(norm), 1);
+    BLAS_CHECK("DLANGE", m >= 0, 2);
+    BLAS_CHECK("DLANGE", n >= 0, 3);
+    BLAS_CHECK("DLANGE", lda >= check::max1(m), 5);
+
+    if (m <= 0 || n <= 0) return 0.0;
+
+    double value = 0.0;
+    if (norm == 'M' || norm == 'm') {
+        // Find max(abs(A(i,j)))
+        for (int j = 0; j < n; j++) {
+            value = reduce::nanmax(value, reduce::amax(a + static_cast<size_t>(j) * lda, m));
+        }
+    } else if (norm == 'O' || norm == 'o' || norm == '1') {
+        // Find norm1(A)
+        for (int j = 0; j < n; j++) {
+            value = reduce::nanmax(value, reduce::asum(a + static_cast<size_t>(j) * lda, m));
+        }
+    } else if (norm == 'I' || norm == 'i') {
+        // Find normI(A)
+        std::vector<double> work(m, 0.0);
+        for (int j = 0; j < n; j++) {
+            reduce::add_abs(a + static_cast<size_t>(j) * lda, m, work.data());
+        }
+        for (int i = 0; i < m; i++) {
+            value = reduce::nanmax(value, work[i]);
+        }
+    } else if (norm == 'F' || norm == 'f' || norm == 'E' || norm == 'e') {
+        // Find normF(A)
+        blue::Accumulator acc;
+        for (int j = 0; j < n; j++) {
+            acc.add(a + static_cast<size_t>(j) * lda, m);
+        }
+        value = acc.norm();
+    }
+    return value;
+}
+
+} // extern "C"
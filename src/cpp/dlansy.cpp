@@ -0,0 +1,91 @@
+/**
+ * DLANSY - Double precision norm of a symmetric matrix
+ *
+ * Computes: max(abs(A(i,j))), the 1-norm, the infinity-norm (equal for a
+ * symmetric matrix) or the Frobenius norm of A, of which only the upper or
+ * the lower triangle is referenced
+ *
+ * This is a C++ implementation of the LAPACK auxiliary routine DLANSY,
+ * based on the reference LAPACK implementation from netlib.org, with Blue's
+ * scaling (blue.h) for the Frobenius norm and a scratch vector allocated by
+ * the kernel in place of the work argument.
+ *
+ * @param norm   'M': max abs, '1', 'O' or 'I': 1-norm, 'F' or 'E': Frobenius norm
+ * @param uplo   'U': the upper triangle of A is stored, 'L': the lower
+ * @param n      Order of A
+ * @param a      Input symmetric matrix A (n x n)
+ * @param lda    Leading dimension of A
+ * @return       The selected norm of A, 0 if n is 0
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "blue.h"
+#include "check.h"
+#include "reduce.h"
+
+extern "C" {
+
+double dlansy(char norm, char uplo, int n, const double* a, int lda) {
+    BLAS_CHECK("DLANSY", check::norm(norm), 1);
+    BLAS_CHECK("DLANSY", check::uplo(uplo), 2);
+    BLAS_CHECK("DLANSY", n >= 0, 3);
+    BLAS_CHECK("DLANSY", lda >= check::max1(n), 5);
+
+    if (n <= 0) return 0.0;
+
+    bool upper = (uplo == 'U' || uplo == 'u');
+
+    double value = 0.0;
+    if (norm == 'M' || norm == 'm') {
+        // Find max(abs(A(i,j)))
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            double colmax = upper ? reduce::amax(aj, j + 1) : reduce::amax(aj + j, n - j);
+            value = reduce::nanmax(value, colmax);
+        }
+    } else if (norm == 'I' || norm == 'i' || norm == 'O' || norm == 'o' || norm == '1') {
+        // Find normI(A) ( = norm1(A), since A is symmetric)
+        std::vector<double> work(n, 0.0);
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            if (upper) {
+                // Column j holds row j above the diagonal
+                work[j] += reduce::asum(aj, j) + std::abs(aj[j]);
+                reduce::add_abs(aj, j, work.data());
+            } else {
+                double sum = work[j] + std::abs(aj[j]) + reduce::asum(aj + j + 1, n - j - 1);
+                reduce::add_abs(aj + j + 1, n - j - 1, work.data() + j + 1);
+                value = reduce::nanmax(value, sum);
+            }
+        }
+        if (upper) {
+            for (int i = 0; i < n; i++) {
+                value = reduce::nanmax(value, work[i]);
+            }
+        }
+    } else if (norm == 'F' || norm == 'f' || norm == 'E' || norm == 'e') {
+        // Find normF(A): the off-diagonal elements count twice
+        blue::Accumulator acc;
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            if (upper) {
+                acc.add(aj, j);
+            } else {
+                acc.add(aj + j + 1, n - j - 1);
+            }
+        }
+        acc.scale(2.0);
+        blue::Accumulator diag;
+        for (int j = 0; j < n; j++) {
+            diag.add(a[j + static_cast<size_t>(j) * lda]);
+        }
+        acc.merge(diag);
+        value = acc.norm();
+    }
+    return value;
+}
+
+} // extern "C"
@@ -0,0 +1,95 @@
+/**
+ * DLANTR - Double precision norm of a triangular matrix
+ *
+ * Computes: max(abs(A(i,j))), the 1-norm, the infinity-norm or the Frobenius
+ * norm of the upper or lower trapezoidal (triangular if m == n) matrix A,
+ * with a unit diagonal if diag is 'U'
+ *
+ * This is a C++ implementation of the LAPACK auxiliary routine DLANTR,
+ * based on the reference LAPACK implementation from netlib.org, with Blue's
+ * scaling (blue.h) for the Frobenius norm and a scratch vector allocated by
+ * the kernel in place of the work argument.
+ *
+ * @param norm   'M': max abs, '1' or 'O': 1-norm, 'I': infinity-norm,
+ *               'F' or 'E': Frobenius norm
+ * @param uplo   'U': A is upper trapezoidal, 'L': lower trapezoidal
+ * @param diag   'U': unit diagonal (not referenced), 'N': non-unit
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param a      Input matrix A (m x n)
+ * @param lda    Leading dimension of A
+ * @return       The selected norm of A, 0 if m or n is 0
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "blue.h"
+#include "check.h"
+#include "reduce.h"
+
+extern "C" {
+
+double dlantr(char norm, char uplo, char diag, int m, int n, const double* a, int lda) {
+    BLAS_CHECK("DLANTR", check::norm(norm), 1);
+    BLAS_CHECK("DLANTR", check::uplo(uplo), 2);
+    BLAS_CHECK("DLANTR", check::diag(diag), 3);
+    BLAS_CHECK("DLANTR", m >= 0, 4);
+    BLAS_CHECK("DLANTR", n >= 0, 5);
+    BLAS_CHECK("DLANTR", lda >= check::max1(m), 7);
+
+    if (m <= 0 || n <= 0) return 0.0;
+
+    bool upper = (uplo == 'U' || uplo == 'u');
+    bool unit = (diag == 'U' || diag == 'u');
+    int k = std::min(m, n);
+
+    // Rows [first, last) of column j referenced: the triangle, without the
+    // diagonal if it is a unit diagonal
+    auto first = [&](int j) { return upper ? 0 : std::min(unit ? j + 1 : j, m); };
+    auto last = [&](int j) { return upper ? std::min(unit ? j : j + 1, m) : m; };
+
+    double value = 0.0;
+    if (norm == 'M' || norm == 'm') {
+        // Find max(abs(A(i,j)))
+        if (unit) value = 1.0;
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            value = reduce::nanmax(value, reduce::amax(aj + first(j), last(j) - first(j)));
+        }
+    } else if (norm == 'O' || norm == 'o' || norm == '1') {
+        // Find norm1(A)
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            double sum = (unit && j < m) ? 1.0 : 0.0;
+            sum += reduce::asum(aj + first(j), last(j) - first(j));
+            value = reduce::nanmax(value, sum);
+        }
+    } else if (norm == 'I' || norm == 'i') {
+        // Find normI(A)
+        std::vector<double> work(m, 0.0);
+        if (unit) std::fill(work.begin(), work.begin() + k, 1.0);
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            reduce::add_abs(aj + first(j), last(j) - first(j), work.data() + first(j));
+        }
+        for (int i = 0; i < m; i++) {
+            value = reduce::nanmax(value, work[i]);
+        }
+    } else if (norm == 'F' || norm == 'f' || norm == 'E' || norm == 'e') {
+        // Find normF(A)
+        blue::Accumulator acc;
+        if (unit) {
+            for (int i = 0; i < k; i++) acc.add(1.0);
+        }
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            acc.add(aj + first(j), last(j) - first(j));
+        }
+        value = acc.norm();
+    }
+    return value;
+}
+
+} // extern "C"
@@ -0,0 +1,88 @@
+/**
+ * DLASCL - Double precision matrix scaling by cto/cfrom
+ *
+ * Computes: A := (cto / cfrom) * A for all of A, its upper or its lower
+ * triangle, without overflow or underflow in the ratio: the scaling is done
+ * in steps of at most 1/DBL_MIN while cto/cfrom is out of range
+ *
+ * This is a C++ implementation of the LAPACK auxiliary routine DLASCL,
+ * based on the reference LAPACK implementation from netlib.org, for the
+ * full and triangular storage types ('G', 'U', 'L'). The band types, and
+ * with them the kl and ku arguments, are not supported.
+ *
+ * @param type   'G': full matrix, 'U': upper triangle, 'L': lower triangle
+ * @param cfrom  Denominator of the scale factor, nonzero
+ * @param cto    Numerator of the scale factor
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param a      Input/output matrix A (m x n)
+ * @param lda    Leading dimension of A
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+#include "check.h"
+
+extern "C" {
+
+void dlascl(char type, double cfrom, double cto, int m, int n, double* a, int lda) {
+    BLAS_CHECK("DLASCL", type == 'G' || type == 'g' || check::uplo(type), 1);
+    BLAS_CHECK("DLASCL", cfrom != 0.0 && !std::isnan(cfrom), 2);
+    BLAS_CHECK("DLASCL", !std::isnan(cto), 3);
+    BLAS_CHECK("DLASCL", m >= 0, 4);
+    BLAS_CHECK("DLASCL", n >= 0, 5);
+    BLAS_CHECK("DLASCL", lda >= check::max1(m), 7);
+
+    bool upper = (type == 'U' || type == 'u');
+    bool lower = (type == 'L' || type == 'l');
+
+    if (m <= 0 || n <= 0) return;
+
+    const double smlnum = DBL_MIN;
+    const double bignum = 1.0 / smlnum;
+
+    double cfromc = cfrom;
+    double ctoc = cto;
+    bool done = false;
+    while (!done) {
+        double mul;
+        double cfrom1 = cfromc * smlnum;
+        if (cfrom1 == cfromc) {
+            // cfromc is an infinity: the result is a signed zero or NaN
+            mul = ctoc / cfromc;
+            done = true;
+        } else {
+            double cto1 = ctoc / bignum;
+            if (cto1 == ctoc) {
+                // ctoc is zero or an infinity
+                mul = ctoc;
+                done = true;
+                cfromc = 1.0;
+            } else if (std::fabs(cfrom1) > std::fabs(ctoc) && ctoc != 0.0) {
+                mul = smlnum;
+                cfromc = cfrom1;
+            } else if (std::fabs(cto1) > std::fabs(cfromc)) {
+                mul = bignum;
+                ctoc = cto1;
+            } else {
+                mul = ctoc / cfromc;
+                done = true;
+                if (mul == 1.0) return;
+            }
+        }
+
+        for (int j = 0; j < n; j++) {
+            double* aj = a + static_cast<size_t>(j) * lda;
+            int first = lower ? std::min(j, m) : 0;
+            int last = upper ? std::min(j + 1, m) : m;
+            for (int i = first; i < last; i++) {
+                aj[i] *= mul;
+            }
+        }
+    }
+}
+
+} // extern "C"
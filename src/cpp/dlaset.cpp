@@ -0,0 +1,59 @@
+/**
+ * DLASET - Double precision matrix initialization
+ *
+ * Computes: A := alpha off the diagonal and beta on the diagonal, for the
+ * strictly upper triangle, the strictly lower triangle or all of A
+ *
+ * This is a C++ implementation of the LAPACK auxiliary routine DLASET,
+ * based on the reference LAPACK implementation from netlib.org. Columns are
+ * filled with memory.fill when built with bulk memory and alpha is zero.
+ *
+ * @param uplo   'U': strictly upper triangle, 'L': strictly lower triangle,
+ *               otherwise the whole matrix; the diagonal is always set
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param alpha  Value of the off-diagonal elements
+ * @param beta   Value of the diagonal elements
+ * @param a      Input/output matrix A (m x n)
+ * @param lda    Leading dimension of A
+ */
+
+#include <algorithm>
+#include <cstddef>
+
+#include "check.h"
+
+extern "C" {
+
+void dlaset(char uplo, int m, int n, double alpha, double beta, double* a, int lda) {
+    BLAS_CHECK("DLASET", m >= 0, 2);
+    BLAS_CHECK("DLASET", n >= 0, 3);
+    BLAS_CHECK("DLASET", lda >= check::max1(m), 7);
+
+    bool upper = (uplo == 'U' || uplo == 'u');
+    bool lower = (uplo == 'L' || uplo == 'l');
+
+    if (m <= 0 || n <= 0) return;
+
+    if (!upper && !lower && lda == m) {
+        std::fill(a, a + static_cast<size_t>(m) * n, alpha);
+    } else {
+        for (int j = 0; j < n; j++) {
+            double* aj = a + static_cast<size_t>(j) * lda;
+            if (upper) {
+                std::fill(aj, aj + std::min(j, m), alpha);
+            } else if (lower) {
+                if (j + 1 < m) std::fill(aj + j + 1, aj + m, alpha);
+            } else {
+                std::fill(aj, aj + m, alpha);
+            }
+        }
+    }
+
+    int k = std::min(m, n);
+    for (int i = 0; i < k; i++) {
+        a[i + static_cast<size_t>(i) * lda] = beta;
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,99 @@
+/**
+ * DNRM2_BATCH_STRIDED - Batched double precision Euclidean norm
+ *
+ * Computes, for b = 0, ..., batch - 1: result[b] = sqrt(x_b^T * x_b)
+ * where x_b = x + b * stridex
+ *
+ * Each norm is computed as by DNRM2, with Blue's scaling. The batch runs on
+ * the thread pool when it is large enough; short vectors are computed two at
+ * a time in the lanes of a vector (see batch.h).
+ *
+ * @param n        Number of elements in each vector
+ * @param x        Input vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b (0: one shared vector)
+ * @param result   Output array of batch norms
+ * @param batch    Number of problems
+ */
+
+#include "batch.h"
+#include "blas.h"
+#include "blue.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increment, when every element of both is
+// zero or mid-range: the vector pass of blue::Accumulator::add followed by
+// its scalar tail, after which DNRM2 returns sqrt(amed). Returns false,
+// without storing, if an element needs scaling.
+bool nrm2_pair(int n, const double* x0, const double* x1, double* r) {
+    const v128_t vsml = wasm_f64x2_splat(blue::tsml);
+    const v128_t vbig = wasm_f64x2_splat(blue::tbig);
+    const v128_t vzero = wasm_f64x2_splat(0.0);
+    v128_t s[4] = {vzero, vzero, vzero, vzero};
+    v128_t out = wasm_i64x2_splat(0);
+    auto abs_checked = [&](int i) {
+        v128_t a = wasm_f64x2_abs(batch::load2(x0, x1, i));
+        out = wasm_v128_or(out, wasm_f64x2_gt(a, vbig));
+        out = wasm_v128_or(out, wasm_v128_and(wasm_f64x2_lt(a, vsml), wasm_f64x2_gt(a, vzero)));
+        return a;
+    };
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (int l = 0; l < 4; l++) {
+            v128_t a = abs_checked(i + l);
+            s[l] = simd::madd_f64x2(a, a, s[l]);
+        }
+    }
+    // hsum(s0 + s1) of the vector pass
+    v128_t amed = wasm_f64x2_add(wasm_f64x2_add(s[0], s[2]), wasm_f64x2_add(s[1], s[3]));
+    for (; i < n; i++) {
+        v128_t a = abs_checked(i);
+        amed = wasm_f64x2_add(amed, wasm_f64x2_mul(a, a));
+    }
+    if (wasm_v128_any_true(out)) return false;
+
+    wasm_v128_store(r, wasm_f64x2_sqrt(amed));
+    return true;
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dnrm2_batch_strided(int n, const double* x, int incx, int stridex, double* result,
+                         int batch) {
+    BLAS_CHECK("DNRM2_BATCH_STRIDED", n >= 0, 1);
+    BLAS_CHECK("DNRM2_BATCH_STRIDED", stridex >= 0, 4);
+    BLAS_CHECK("DNRM2_BATCH_STRIDED", batch >= 0, 6);
+
+    // Quick return if possible
+    if (batch <= 0) return;
+
+    batch::for_each_chunk(batch, 2.0 * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (n <= batch::SHORT && incx == 1) {
+            for (; b + 2 <= last; b += 2) {
+                const double* x0 = x + batch::offset(b, stridex);
+                const double* x1 = x + batch::offset(b + 1, stridex);
+                if (!nrm2_pair(n, x0, x1, result + b)) {
+                    result[b] = dnrm2(n, x0, incx);
+                    result[b + 1] = dnrm2(n, x1, incx);
+                }
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            result[b] = dnrm2(n, x + batch::offset(b, stridex), incx);
+        }
+    });
+}
+
+} // extern "C"
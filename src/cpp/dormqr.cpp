@@ -0,0 +1,90 @@
+/**
+ * DORMQR - Double precision multiplication by Q from a QR factorization
+ *
+ * Computes: C = op(Q) * C  or  C = C * op(Q)
+ * where op(Q) = Q or Q^T and Q = H(0) * H(1) * ... * H(k-1) is the product
+ * of the Householder reflectors returned by DGEQRF
+ *
+ * This is a C++ implementation of the LAPACK routine DORMQR, based on the
+ * reference LAPACK implementation from netlib.org. The reflectors are
+ * applied NB at a time as block reflectors with DTRMM and DGEMM
+ * (householder.h); the workspace for one block is allocated by the kernel.
+ *
+ * @param side   'L': op(Q) * C, 'R': C * op(Q)
+ * @param trans  'N': op(Q) = Q, 'T'/'C': op(Q) = Q^T
+ * @param m      Number of rows of C
+ * @param n      Number of columns of C
+ * @param k      Number of reflectors, at most m ('L') or n ('R')
+ * @param a      The vectors v(i) in the columns below the diagonal, as
+ *               returned by DGEQRF (m x k for 'L', n x k for 'R')
+ * @param lda    Leading dimension of A
+ * @param tau    Scalar factors of the reflectors (k)
+ * @param c      Input/output matrix C (m x n)
+ * @param ldc    Leading dimension of C
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+#include "householder.h"
+
+namespace {
+
+// Reflectors per block
+constexpr int NB = 32;
+
+} // namespace
+
+extern "C" {
+
+void dormqr(char side, char trans, int m, int n, int k, const double* a, int lda,
+            const double* tau, double* c, int ldc) {
+    const bool left = side == 'L' || side == 'l';
+    const bool notrans = trans == 'N' || trans == 'n';
+    const int nq = left ? m : n;
+    BLAS_CHECK("DORMQR", check::side(side), 1);
+    BLAS_CHECK("DORMQR", check::trans(trans), 2);
+    BLAS_CHECK("DORMQR", m >= 0, 3);
+    BLAS_CHECK("DORMQR", n >= 0, 4);
+    BLAS_CHECK("DORMQR", k >= 0 && k <= nq, 5);
+    BLAS_CHECK("DORMQR", lda >= check::max1(nq), 7);
+    BLAS_CHECK("DORMQR", ldc >= check::max1(m), 10);
+
+    // Quick return if possible
+    if (m == 0 || n == 0 || k == 0) return;
+
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    auto ct = [&](int i, int j) { return c + i + static_cast<size_t>(j) * ldc; };
+
+    // T of one block, then W of its update
+    const int nb = std::min(k, NB);
+    std::vector<double> work(static_cast<size_t>(nb) * nb +
+                             static_cast<size_t>(left ? n : m) * nb);
+    double* t = work.data();
+    double* w = t + nb * nb;
+
+    // Q^T * C and C * Q apply the blocks first to last, Q * C and C * Q^T
+    // last to first
+    const bool forward = left != notrans;
+    const int first = forward ? 0 : (k - 1) / nb * nb;
+    const int step = forward ? nb : -nb;
+    const char op = notrans ? 'N' : 'T';
+    for (int i = first; i >= 0 && i < k; i += step) {
+        const int ib = std::min(k - i, nb);
+
+        // Form the triangular factor of the block reflector H(i) * ... * H(i+ib-1)
+        householder::larft(nq - i, ib, at(i, i), lda, tau + i, t, nb);
+
+        // Apply H or H^T to C(i:m-1, 0:n-1) or C(0:m-1, i:n-1)
+        if (left) {
+            householder::larfb('L', op, m - i, n, ib, at(i, i), lda, t, nb, ct(i, 0), ldc, w);
+        } else {
+            householder::larfb('R', op, m, n - i, ib, at(i, i), lda, t, nb, ct(0, i), ldc, w);
+        }
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,121 @@
+/**
+ * DPOTRF - Double precision Cholesky factorization
+ *
+ * Computes: A = U^T * U  or  A = L * L^T
+ * where A is symmetric positive definite, in place
+ *
+ * This is a C++ implementation of the LAPACK routine DPOTRF, based on the
+ * reference LAPACK implementation from netlib.org. Diagonal blocks of NB
+ * columns are factored as by DPOTF2 with DDOT and DGEMV after a DSYRK update;
+ * the off-diagonal blocks are updated with DGEMM and DTRSM.
+ *
+ * @param uplo   'U': the upper triangle of A is stored and U is computed,
+ *               'L': the lower triangle is stored and L is computed
+ * @param n      Order of A
+ * @param a      Input symmetric matrix, output its Cholesky factor (n x n);
+ *               the other triangle is not referenced
+ * @param lda    Leading dimension of A
+ * @return       0 on success, i > 0 if the leading minor of order i is not
+ *               positive definite; the factorization stops there
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// Columns per block
+constexpr int NB = 64;
+
+// The unblocked factorization DPOTF2 of the n x n matrix a; returns its info
+int dpotf2(bool upper, int n, double* a, int lda) {
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+
+    for (int j = 0; j < n; j++) {
+        if (upper) {
+            // Compute U(j,j) and test for non-positive-definiteness
+            double ajj = *at(j, j) - ddot(j, at(0, j), 1, at(0, j), 1);
+            if (ajj <= 0.0 || std::isnan(ajj)) {
+                *at(j, j) = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt(ajj);
+            *at(j, j) = ajj;
+
+            // Compute elements j+1:n-1 of row j
+            if (j < n - 1) {
+                dgemv(1, j, n - j - 1, -1.0, at(0, j + 1), lda, at(0, j), 1, 1.0, at(j, j + 1),
+                      lda);
+                dscal(n - j - 1, 1.0 / ajj, at(j, j + 1), lda);
+            }
+        } else {
+            // Compute L(j,j) and test for non-positive-definiteness
+            double ajj = *at(j, j) - ddot(j, at(j, 0), lda, at(j, 0), lda);
+            if (ajj <= 0.0 || std::isnan(ajj)) {
+                *at(j, j) = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt(ajj);
+            *at(j, j) = ajj;
+
+            // Compute elements j+1:n-1 of column j
+            if (j < n - 1) {
+                dgemv(0, n - j - 1, j, -1.0, at(j + 1, 0), lda, at(j, 0), lda, 1.0, at(j + 1, j),
+                      1);
+                dscal(n - j - 1, 1.0 / ajj, at(j + 1, j), 1);
+            }
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+extern "C" {
+
+int dpotrf(char uplo, int n, double* a, int lda) {
+    BLAS_CHECK("DPOTRF", check::uplo(uplo), 1);
+    BLAS_CHECK("DPOTRF", n >= 0, 2);
+    BLAS_CHECK("DPOTRF", lda >= check::max1(n), 4);
+
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    const bool upper = uplo == 'U' || uplo == 'u';
+
+    for (int j = 0; j < n; j += NB) {
+        const int jb = std::min(n - j, NB);
+        const int rest = n - j - jb;
+
+        if (upper) {
+            // Update and factor the diagonal block
+            dsyrk('U', 'T', jb, j, -1.0, at(0, j), lda, 1.0, at(j, j), lda);
+            int info = dpotf2(true, jb, at(j, j), lda);
+            if (info > 0) return info + j;
+
+            // Compute the current block row
+            if (rest > 0) {
+                dgemm('T', 'N', jb, rest, j, -1.0, at(0, j), lda, at(0, j + jb), lda, 1.0,
+                      at(j, j + jb), lda);
+                dtrsm('L', 'U', 'T', 'N', jb, rest, 1.0, at(j, j), lda, at(j, j + jb), lda);
+            }
+        } else {
+            // Update and factor the diagonal block
+            dsyrk('L', 'N', jb, j, -1.0, at(j, 0), lda, 1.0, at(j, j), lda);
+            int info = dpotf2(false, jb, at(j, j), lda);
+            if (info > 0) return info + j;
+
+            // Compute the current block column
+            if (rest > 0) {
+                dgemm('N', 'T', rest, jb, j, -1.0, at(j + jb, 0), lda, at(j, 0), lda, 1.0,
+                      at(j + jb, j), lda);
+                dtrsm('R', 'L', 'T', 'N', rest, jb, 1.0, at(j, j), lda, at(j + jb, j), lda);
+            }
+        }
+    }
+    return 0;
+}
+
+} // extern "C"
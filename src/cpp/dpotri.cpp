@@ -0,0 +1,108 @@
+/**
+ * DPOTRI - Double precision inverse of a symmetric positive definite matrix
+ *
+ * Computes: A := inv(A) = inv(U) * inv(U)^T  or  inv(L)^T * inv(L)
+ * from the Cholesky factorization computed by DPOTRF, in place
+ *
+ * This is a C++ implementation of the LAPACK routine DPOTRI, based on the
+ * reference LAPACK implementation from netlib.org: the factor is inverted by
+ * DTRTRI and multiplied by its transpose as by DLAUUM, a block of NB columns
+ * at a time with DTRMM, DGEMM and DSYRK (DLAUU2 with DDOT and DGEMV on the
+ * diagonal blocks). No workspace is needed.
+ *
+ * @param uplo   'U': A holds the factor U, 'L': A holds the factor L
+ * @param n      Order of A
+ * @param a      Input Cholesky factor, output the upper or lower triangle of
+ *               inv(A) (n x n); the other triangle is not referenced
+ * @param lda    Leading dimension of A
+ * @return       0 on success, i > 0 if the factor has a zero at (i, i) and A
+ *               is singular; A is then unchanged
+ */
+
+#include <algorithm>
+#include <cstddef>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// Columns per block
+constexpr int NB = 64;
+
+// The unblocked product DLAUU2: U * U^T or L^T * L of the n x n triangle a
+void dlauu2(bool upper, int n, double* a, int lda) {
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+
+    for (int i = 0; i < n; i++) {
+        const double aii = *at(i, i);
+        if (upper) {
+            if (i < n - 1) {
+                *at(i, i) = ddot(n - i, at(i, i), lda, at(i, i), lda);
+                dgemv(0, i, n - i - 1, 1.0, at(0, i + 1), lda, at(i, i + 1), lda, aii, at(0, i),
+                      1);
+            } else {
+                dscal(i + 1, aii, at(0, i), 1);
+            }
+        } else {
+            if (i < n - 1) {
+                *at(i, i) = ddot(n - i, at(i, i), 1, at(i, i), 1);
+                dgemv(1, n - i - 1, i, 1.0, at(i + 1, 0), lda, at(i + 1, i), 1, aii, at(i, 0),
+                      lda);
+            } else {
+                dscal(i + 1, aii, at(i, 0), lda);
+            }
+        }
+    }
+}
+
+// The blocked product DLAUUM
+void dlauum(bool upper, int n, double* a, int lda) {
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+
+    for (int i = 0; i < n; i += NB) {
+        const int ib = std::min(n - i, NB);
+        const int rest = n - i - ib;
+
+        if (upper) {
+            // Compute the product U * U^T
+            dtrmm('R', 'U', 'T', 'N', i, ib, 1.0, at(i, i), lda, at(0, i), lda);
+            dlauu2(true, ib, at(i, i), lda);
+            if (rest > 0) {
+                dgemm('N', 'T', i, ib, rest, 1.0, at(0, i + ib), lda, at(i, i + ib), lda, 1.0,
+                      at(0, i), lda);
+                dsyrk('U', 'N', ib, rest, 1.0, at(i, i + ib), lda, 1.0, at(i, i), lda);
+            }
+        } else {
+            // Compute the product L^T * L
+            dtrmm('L', 'L', 'T', 'N', ib, i, 1.0, at(i, i), lda, at(i, 0), lda);
+            dlauu2(false, ib, at(i, i), lda);
+            if (rest > 0) {
+                dgemm('T', 'N', ib, i, rest, 1.0, at(i + ib, i), lda, at(i + ib, 0), lda, 1.0,
+                      at(i, 0), lda);
+                dsyrk('L', 'T', ib, rest, 1.0, at(i + ib, i), lda, 1.0, at(i, i), lda);
+            }
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int dpotri(char uplo, int n, double* a, int lda) {
+    BLAS_CHECK("DPOTRI", check::uplo(uplo), 1);
+    BLAS_CHECK("DPOTRI", n >= 0, 2);
+    BLAS_CHECK("DPOTRI", lda >= check::max1(n), 4);
+
+    // Invert the triangular Cholesky factor U or L
+    const bool upper = uplo == 'U' || uplo == 'u';
+    int info = dtrtri(upper ? 'U' : 'L', 'N', n, a, lda);
+    if (info > 0) return info;
+
+    // Form inv(U) * inv(U)^T or inv(L)^T * inv(L)
+    dlauum(upper, n, a, lda);
+    return 0;
+}
+
+} // extern "C"
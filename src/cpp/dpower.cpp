@@ -0,0 +1,84 @@
+/**
+ * DPOWER - Double precision power iteration
+ *
+ * Computes the eigenvalue of largest magnitude of the n x n matrix A and its
+ * eigenvector by power iteration: x = A * x / ||A * x|| from the starting
+ * vector x, with the Rayleigh quotient lambda = x^T * A * x as the
+ * eigenvalue estimate. The iteration stops when the residual satisfies
+ * ||A * x - lambda * x|| <= tol * ||A * x||. A need not be symmetric (e.g.
+ * the column-stochastic matrix of PageRank); the convergence rate is the
+ * ratio of the two largest eigenvalue magnitudes.
+ *
+ * A is given by its storage (see krylov.h) and applied inside the kernel,
+ * so the whole iteration runs in one call. Each step is one product with A
+ * and three fused passes over the vectors: the Rayleigh quotient with
+ * ||A * x||, the residual with its norm and the normalization.
+ *
+ * @param kind   'D': dense (a, lda), 'B': symmetric band (uplo, k, a, lda),
+ *               'P': symmetric packed (uplo, a), 'S': sparse CSR (a, ia, ja)
+ * @param uplo   'U' or 'L': the triangle stored for 'B' and 'P'
+ * @param n      Order of A
+ * @param k      Number of super- or subdiagonals for 'B'
+ * @param a      The matrix, band, packed triangle or nonzero values
+ * @param lda    Leading dimension of a for 'D' and 'B'
+ * @param ia     Row pointers (n + 1) for 'S', zero-based
+ * @param ja     Column indices of the nonzeros for 'S', zero-based
+ * @param maxit  Maximum number of iterations
+ * @param tol    Relative residual tolerance
+ * @param x      Input starting vector (all ones if zero), output the unit
+ *               eigenvector
+ * @param lambda Output the eigenvalue
+ * @return       0 on convergence, 1 if maxit iterations did not converge
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "blas.h"
+#include "check.h"
+#include "krylov.h"
+
+extern "C" {
+
+int dpower(char kind, char uplo, int n, int k, const double* a, int lda, const int* ia,
+           const int* ja, int maxit, double tol, double* x, double* lambda) {
+    BLAS_CHECK("DPOWER", check::op(kind), 1);
+    BLAS_CHECK("DPOWER", check::uplo(uplo), 2);
+    BLAS_CHECK("DPOWER", n >= 0, 3);
+    BLAS_CHECK("DPOWER", k >= 0, 4);
+    BLAS_CHECK("DPOWER", lda >= krylov::min_lda(kind, n, k), 6);
+    BLAS_CHECK("DPOWER", maxit >= 0, 9);
+
+    *lambda = 0.0;
+
+    // Quick return if possible
+    if (n == 0) return 0;
+
+    const krylov::Operator op{kind, uplo == 'U' || uplo == 'u', n, k, a, lda, ia, ja};
+    std::vector<double> y(n);
+
+    double xnorm = dnrm2(n, x, 1);
+    if (xnorm == 0.0) {
+        std::fill(x, x + n, 1.0);
+        xnorm = std::sqrt(static_cast<double>(n));
+    }
+    dscal(n, 1.0 / xnorm, x, 1);
+
+    for (int it = 0; it < maxit; it++) {
+        krylov::apply(op, x, y.data());
+
+        // lambda = x^T * y with ||y||; x is in the null space of A if y = 0
+        double ynorm;
+        *lambda = krylov::dot_nrm2(n, x, y.data(), ynorm);
+        if (ynorm == 0.0) return 0;
+
+        // x = y - lambda * x is the residual, then the next iterate
+        double rnorm = krylov::axpby_nrm2(n, 1.0, y.data(), -*lambda, x);
+        daxpby(n, 1.0 / ynorm, y.data(), 1, 0.0, x, 1);
+        if (rnorm <= tol * ynorm) return 0;
+    }
+    return 1;
+}
+
+} // extern "C"
@@ -0,0 +1,103 @@
+/**
+ * DREDUCE - Double precision reduction of a matrix along its rows or columns
+ *
+ * Computes, for each column (axis 'C', n results) or each row (axis 'R',
+ * m results) of A, one of:
+ *   'S': sum(A(i,j))           'A': sum(abs(A(i,j)))
+ *   'Q': sum(A(i,j)^2)         'N': sqrt(sum(A(i,j)^2))
+ *   'M': max(abs(A(i,j)))
+ *
+ * Columns are reduced with SIMD, rows by folding the columns into r in one
+ * pass over A. The Euclidean norms use Blue's scaling (blue.h) as in DNRM2;
+ * along rows they are first accumulated unscaled and recomputed with scaled
+ * accumulators only if some element is tiny or huge. Maxima propagate NaN.
+ *
+ * @param op     Reduction: 'S', 'A', 'Q', 'N' or 'M' (either case)
+ * @param axis   'C': one result per column, 'R': one result per row (either case)
+ * @param m      Number of rows of A
+ * @param n      Number of columns of A
+ * @param a      Input matrix A (m x n)
+ * @param lda    Leading dimension of A
+ * @param r      Output vector: n elements for axis 'C', m for axis 'R'
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "blue.h"
+#include "check.h"
+#include "reduce.h"
+
+extern "C" {
+
+void dreduce(char op, char axis, int m, int n, const double* a, int lda, double* r) {
+    BLAS_CHECK("DREDUCE", check::reduction(op), 1);
+    BLAS_CHECK("DREDUCE", check::axis(axis), 2);
+    BLAS_CHECK("DREDUCE", m >= 0, 3);
+    BLAS_CHECK("DREDUCE", n >= 0, 4);
+    BLAS_CHECK("DREDUCE", lda >= check::max1(m), 6);
+
+    if (axis == 'C' || axis == 'c') {
+        for (int j = 0; j < n; j++) {
+            const double* aj = a + static_cast<size_t>(j) * lda;
+            switch (op) {
+            case 'S':
+            case 's': r[j] = reduce::sum(aj, m); break;
+            case 'A':
+            case 'a': r[j] = reduce::asum(aj, m); break;
+            case 'Q':
+            case 'q': r[j] = reduce::sumsq(aj, m); break;
+            case 'M':
+            case 'm': r[j] = reduce::amax(aj, m); break;
+            case 'N':
+            case 'n': {
+                blue::Accumulator acc;
+                acc.add(aj, m);
+                r[j] = acc.norm();
+                break;
+            }
+            }
+        }
+        return;
+    }
+
+    if (m <= 0) return;
+    std::fill(r, r + m, 0.0);
+
+    if (op == 'N' || op == 'n') {
+        bool unscaled = true;
+        for (int j = 0; j < n && unscaled; j++) {
+            unscaled = reduce::add_sq_unscaled(a + static_cast<size_t>(j) * lda, m, r);
+        }
+        if (unscaled) {
+            for (int i = 0; i < m; i++) r[i] = std::sqrt(r[i]);
+        } else {
+            // Some element needs scaling: start over with one accumulator per row
+            std::vector<blue::Accumulator> acc(m);
+            for (int j = 0; j < n; j++) {
+                const double* aj = a + static_cast<size_t>(j) * lda;
+                for (int i = 0; i < m; i++) acc[i].add(aj[i]);
+            }
+            for (int i = 0; i < m; i++) r[i] = acc[i].norm();
+        }
+        return;
+    }
+
+    for (int j = 0; j < n; j++) {
+        const double* aj = a + static_cast<size_t>(j) * lda;
+        switch (op) {
+        case 'S':
+        case 's': reduce::add(aj, m, r); break;
+        case 'A':
+        case 'a': reduce::add_abs(aj, m, r); break;
+        case 'Q':
+        case 'q': reduce::add_sq(aj, m, r); break;
+        case 'M':
+        case 'm': reduce::max_abs(aj, m, r); break;
+        }
+    }
+}
+
+} // extern "C"
@@ -1,11 +1,20 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dsbmv(int uplo, int n, int k, double alpha, 
            const double* a, int lda, const double* x, int incx, 
            double beta, double* y, int incy) {
+    BLAS_CHECK("DSBMV", check::flag(uplo), 1);
+    BLAS_CHECK("DSBMV", n >= 0, 2);
+    BLAS_CHECK("DSBMV", k >= 0, 3);
+    BLAS_CHECK("DSBMV", lda >= k + 1, 6);
+    BLAS_CHECK("DSBMV", incx != 0, 8);
+    BLAS_CHECK("DSBMV", incy != 0, 11);
+
     // Quick return if possible
     if (n == 0 || (alpha == 0.0 && beta == 1.0)) return;
 
@@ -26,9 +35,7 @@ void dsbmv(int uplo, int n, int k, double alpha,
     if (beta != 1.0) {
         if (incy == 1) {
             if (beta == 0.0) {
-                for (int i = 0; i < n; i++) {
-                    y[i] = 0.0;
-                }
+                std::fill(y, y + n, 0.0);
             } else {
                 for (int i = 0; i < n; i++) {
                     y[i] = beta * y[i];
@@ -109,7 +116,7 @@ void dsbmv(int uplo, int n, int k, double alpha,
                 y[j] += temp1 * a[0 + j * lda];
                 
                 // Process the strict lower triangular part
-                int l = 1 - j;
+                int l = -j;
                 int i_end = std::min(n - 1, j + k);
                 for (int i = j + 1; i <= i_end; i++) {
                     y[i] += temp1 * a[(l + i) + j * lda];
@@ -129,7 +136,7 @@ void dsbmv(int uplo, int n, int k, double alpha,
                 y[jy] += temp1 * a[0 + j * lda];
                 
                 // Process the strict lower triangular part
-                int l = 1 - j;
+                int l = -j;
                 int ix = jx;
                 int iy = jy;
                 int i_end = std::min(n - 1, j + k);
@@ -6,15 +6,22 @@
  * This is a C++ implementation of the BLAS Level 1 DSCAL routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, long vectors are split into one range per thread
+ * (parallel::Split).
+ * 
  * @param n      Number of elements in input vector
  * @param alpha  Scalar multiplier
  * @param x      Input/output vector x (result stored here)
  * @param incx   Storage spacing between elements of x
  */
 
-extern "C" {
+#include <cstddef>
 
-void dscal(int n, double alpha, double* x, int incx) {
+#include "parallel.h"
+
+namespace {
+
+void dscal_serial(int n, double alpha, double* x, int incx) {
     // Quick return if possible
     if (n <= 0 || incx <= 0 || alpha == 1.0) return;
     
@@ -46,4 +53,24 @@ void dscal(int n, double alpha, double* x, int incx) {
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void dscal(int n, double alpha, double* x, int incx) {
+    // Quick return if possible
+    if (n <= 0 || incx <= 0 || alpha == 1.0) return;
+
+    // Long vectors: one range per thread
+    parallel::Split split(n, 2.0, 8);
+    if (split.parts() == 1) {
+        dscal_serial(n, alpha, x, incx);
+        return;
+    }
+    parallel::run(split.parts(), [&](int t) {
+        int first = split.first(t);
+        dscal_serial(split.last(t) - first, alpha, x + static_cast<size_t>(first) * incx, incx);
+    });
+}
+
 } // extern "C"
@@ -0,0 +1,74 @@
+/**
+ * DSCAL_BATCH_STRIDED - Batched double precision vector scaling
+ *
+ * Computes, for b = 0, ..., batch - 1: x_b = alpha * x_b
+ * where x_b = x + b * stridex
+ *
+ * Each vector is scaled as by DSCAL. The batch runs on the thread pool when
+ * it is large enough. Vectors that lie back to back (unit increment and a
+ * stride of n) are scaled as one long vector; otherwise short vectors are
+ * computed two at a time in the lanes of a vector (see batch.h).
+ *
+ * @param n        Number of elements in each vector
+ * @param alpha    Scalar multiplier
+ * @param x        Input/output vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b
+ * @param batch    Number of problems
+ */
+
+#include <climits>
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increment
+void scal_pair(int n, v128_t va, double* x0, double* x1) {
+    for (int i = 0; i < n; i++) {
+        batch::store2(x0, x1, i, wasm_f64x2_mul(va, batch::load2(x0, x1, i)));
+    }
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dscal_batch_strided(int n, double alpha, double* x, int incx, int stridex, int batch) {
+    BLAS_CHECK("DSCAL_BATCH_STRIDED", n >= 0, 1);
+    BLAS_CHECK("DSCAL_BATCH_STRIDED", stridex > 0 || batch <= 1, 5);
+    BLAS_CHECK("DSCAL_BATCH_STRIDED", batch >= 0, 6);
+
+    // Quick return if possible
+    if (batch <= 0 || n == 0 || incx <= 0 || alpha == 1.0) return;
+
+    bool contiguous = incx == 1 && stridex == n;
+
+    batch::for_each_chunk(batch, 1.0 * n, [&](int first, int last) {
+        int b = first;
+        // Back-to-back vectors form one vector of n * (last - first) elements
+        if (contiguous && static_cast<long long>(n) * (last - first) <= INT_MAX) {
+            dscal(n * (last - first), alpha, x + batch::offset(b, n), 1);
+            return;
+        }
+#ifdef __wasm_simd128__
+        if (n <= batch::SHORT && incx == 1) {
+            v128_t va = wasm_f64x2_splat(alpha);
+            for (; b + 2 <= last; b += 2) {
+                scal_pair(n, va, x + batch::offset(b, stridex), x + batch::offset(b + 1, stridex));
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            dscal(n, alpha, x + batch::offset(b, stridex), incx);
+        }
+    });
+}
+
+} // extern "C"
@@ -1,11 +1,18 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dspmv(int uplo, int n, double alpha, 
            const double* ap, const double* x, int incx, 
            double beta, double* y, int incy) {
+    BLAS_CHECK("DSPMV", check::flag(uplo), 1);
+    BLAS_CHECK("DSPMV", n >= 0, 2);
+    BLAS_CHECK("DSPMV", incx != 0, 6);
+    BLAS_CHECK("DSPMV", incy != 0, 9);
+
     // Quick return if possible
     if (n == 0 || (alpha == 0.0 && beta == 1.0)) return;
 
@@ -26,9 +33,7 @@ void dspmv(int uplo, int n, double alpha,
     if (beta != 1.0) {
         if (incy == 1) {
             if (beta == 0.0) {
-                for (int i = 0; i < n; i++) {
-                    y[i] = 0.0;
-                }
+                std::fill(y, y + n, 0.0);
             } else {
                 for (int i = 0; i < n; i++) {
                     y[i] = beta * y[i];
@@ -1,10 +1,16 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dspr(int uplo, int n, double alpha, 
           const double* x, int incx, double* ap) {
+    BLAS_CHECK("DSPR", check::flag(uplo), 1);
+    BLAS_CHECK("DSPR", n >= 0, 2);
+    BLAS_CHECK("DSPR", incx != 0, 5);
+
     // Quick return if possible
     if (n == 0 || alpha == 0.0) return;
 
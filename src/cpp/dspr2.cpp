@@ -1,10 +1,17 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dspr2(int uplo, int n, double alpha, 
            const double* x, int incx, const double* y, int incy, double* ap) {
+    BLAS_CHECK("DSPR2", check::flag(uplo), 1);
+    BLAS_CHECK("DSPR2", n >= 0, 2);
+    BLAS_CHECK("DSPR2", incx != 0, 5);
+    BLAS_CHECK("DSPR2", incy != 0, 7);
+
     // Quick return if possible
     if (n == 0 || alpha == 0.0) return;
 
@@ -7,6 +7,8 @@
  * This is a C++ implementation of the BLAS Level 3 DSYMM routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, the columns of C are split into one range per thread.
+ * 
  * @param side   'L': C := alpha*A*B + beta*C, 'R': C := alpha*B*A + beta*C
  * @param uplo   'U': use upper triangular part, 'L': use lower triangular part
  * @param m      Number of rows of matrix C
@@ -21,47 +23,24 @@
  * @param ldc    Leading dimension of C
  */
 
-extern "C" {
+#include <algorithm>
 
-void dsymm(char side, char uplo, int m, int n, double alpha,
-           const double* a, int lda, const double* b, int ldb,
-           double beta, double* c, int ldc) {
-    
+#include "check.h"
+#include "parallel.h"
+
+namespace {
+
+// The operations of DSYMM on the columns [j0, j1) of C
+void dsymm_columns(bool left, bool upper, int m, int n, double alpha, const double* a, int lda,
+                   const double* b, int ldb, double beta, double* c, int ldc, int j0, int j1) {
     const double zero = 0.0;
-    const double one = 1.0;
-    
-    bool left = (side == 'L' || side == 'l');
-    bool upper = (uplo == 'U' || uplo == 'u');
-    
-    // Quick return if possible
-    if (m == 0 || n == 0 || ((alpha == zero || (left ? m : n) == 0) && beta == one)) {
-        return;
-    }
-    
-    // Handle beta
-    if (alpha == zero) {
-        if (beta == zero) {
-            for (int j = 0; j < n; j++) {
-                for (int i = 0; i < m; i++) {
-                    c[i + j * ldc] = zero;
-                }
-            }
-        } else {
-            for (int j = 0; j < n; j++) {
-                for (int i = 0; i < m; i++) {
-                    c[i + j * ldc] = beta * c[i + j * ldc];
-                }
-            }
-        }
-        return;
-    }
     
     // Start the operations
     if (left) {
         // Form C := alpha*A*B + beta*C
         if (upper) {
             // Form C when A is upper triangular
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 for (int i = 0; i < m; i++) {
                     double temp1 = alpha * b[i + j * ldb];
                     double temp2 = zero;
@@ -78,7 +57,7 @@ void dsymm(char side, char uplo, int m, int n, double alpha,
             }
         } else {
             // Form C when A is lower triangular
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 for (int i = m - 1; i >= 0; i--) {
                     double temp1 = alpha * b[i + j * ldb];
                     double temp2 = zero;
@@ -96,7 +75,7 @@ void dsymm(char side, char uplo, int m, int n, double alpha,
         }
     } else {
         // Form C := alpha*B*A + beta*C
-        for (int j = 0; j < n; j++) {
+        for (int j = j0; j < j1; j++) {
             double temp1 = alpha * a[j + j * lda];
             if (beta == zero) {
                 for (int i = 0; i < m; i++) {
@@ -131,4 +110,57 @@ void dsymm(char side, char uplo, int m, int n, double alpha,
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void dsymm(char side, char uplo, int m, int n, double alpha,
+           const double* a, int lda, const double* b, int ldb,
+           double beta, double* c, int ldc) {
+    BLAS_CHECK("DSYMM", check::side(side), 1);
+    BLAS_CHECK("DSYMM", check::uplo(uplo), 2);
+    BLAS_CHECK("DSYMM", m >= 0, 3);
+    BLAS_CHECK("DSYMM", n >= 0, 4);
+    BLAS_CHECK("DSYMM", lda >= check::max1(check::left(side) ? m : n), 7);
+    BLAS_CHECK("DSYMM", ldb >= check::max1(m), 9);
+    BLAS_CHECK("DSYMM", ldc >= check::max1(m), 12);
+    
+    const double zero = 0.0;
+    const double one = 1.0;
+    
+    bool left = (side == 'L' || side == 'l');
+    bool upper = (uplo == 'U' || uplo == 'u');
+    
+    // Quick return if possible
+    if (m == 0 || n == 0 || ((alpha == zero || (left ? m : n) == 0) && beta == one)) {
+        return;
+    }
+    
+    // Handle beta
+    if (alpha == zero) {
+        if (beta == zero) {
+            for (int j = 0; j < n; j++) {
+                std::fill(c + j * ldc, c + m + j * ldc, zero);
+            }
+        } else {
+            for (int j = 0; j < n; j++) {
+                for (int i = 0; i < m; i++) {
+                    c[i + j * ldc] = beta * c[i + j * ldc];
+                }
+            }
+        }
+        return;
+    }
+    
+    // Start the operations; every column of C costs the same, so with
+    // threads C is split into equal ranges of columns, one per thread
+    parallel::for_balanced(
+        n,
+        1,
+        [&](int) { return static_cast<double>(m) * (left ? m : n); },
+        [&](int j0, int j1) {
+            dsymm_columns(left, upper, m, n, alpha, a, lda, b, ldb, beta, c, ldc, j0, j1);
+        });
+}
+
 } // extern "C"
@@ -7,6 +7,10 @@
  * This is a C++ implementation of the BLAS Level 2 DSYMV routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, large matrices are split into one panel of rows of y per
+ * thread (parallel::Split), each computed with DSYMV on its diagonal block
+ * and DGEMV on the rest of its rows.
+ * 
  * @param uplo   'U': use upper triangular part, 'L': use lower triangular part
  * @param n      Order of the matrix A
  * @param alpha  Scalar multiplier for A*x
@@ -19,11 +23,16 @@
  * @param incy   Storage spacing between elements of y
  */
 
-extern "C" {
+#include <algorithm>
 
-void dsymv(char uplo, int n, double alpha, const double* a, int lda,
-           const double* x, int incx, double beta, double* y, int incy) {
-    
+#include "blas.h"
+#include "check.h"
+#include "parallel.h"
+
+namespace {
+
+void dsymv_serial(char uplo, int n, double alpha, const double* a, int lda,
+                  const double* x, int incx, double beta, double* y, int incy) {
     const double zero = 0.0;
     const double one = 1.0;
     
@@ -41,9 +50,7 @@ void dsymv(char uplo, int n, double alpha, const double* a, int lda,
     if (beta != one) {
         if (incy == 1) {
             if (beta == zero) {
-                for (int i = 0; i < n; i++) {
-                    y[i] = zero;
-                }
+                std::fill(y, y + n, zero);
             } else {
                 for (int i = 0; i < n; i++) {
                     y[i] = beta * y[i];
@@ -141,4 +148,54 @@ void dsymv(char uplo, int n, double alpha, const double* a, int lda,
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void dsymv(char uplo, int n, double alpha, const double* a, int lda,
+           const double* x, int incx, double beta, double* y, int incy) {
+    BLAS_CHECK("DSYMV", check::uplo(uplo), 1);
+    BLAS_CHECK("DSYMV", n >= 0, 2);
+    BLAS_CHECK("DSYMV", lda >= check::max1(n), 5);
+    BLAS_CHECK("DSYMV", incx != 0, 7);
+    BLAS_CHECK("DSYMV", incy != 0, 10);
+
+    parallel::Split split(n, n, 8);
+    if (split.parts() == 1) {
+        dsymv_serial(uplo, n, alpha, a, lda, x, incx, beta, y, incy);
+        return;
+    }
+
+    // Large matrices: each thread computes the rows [first, last) of y, from
+    // the diagonal block of its panel and the two off-diagonal blocks of the
+    // stored triangle that hold the rest of those rows (one of them read
+    // transposed), so that the threads read disjoint parts of A
+    bool upper = (uplo == 'U' || uplo == 'u');
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    parallel::run(split.parts(), [&](int t) {
+        int first = split.first(t);
+        int last = split.last(t);
+        int len = last - first;
+        double* yt = parallel::slice(y, incy, n, first, last);
+        dsymv_serial(uplo, len, alpha, at(first, first), lda,
+                     parallel::slice(x, incx, n, first, last), incx, beta, yt, incy);
+        if (first > 0) {
+            const double* xl = parallel::slice(x, incx, n, 0, first);
+            if (upper) {
+                dgemv(1, first, len, alpha, at(0, first), lda, xl, incx, 1.0, yt, incy);
+            } else {
+                dgemv(0, len, first, alpha, at(first, 0), lda, xl, incx, 1.0, yt, incy);
+            }
+        }
+        if (last < n) {
+            const double* xr = parallel::slice(x, incx, n, last, n);
+            if (upper) {
+                dgemv(0, len, n - last, alpha, at(first, last), lda, xr, incx, 1.0, yt, incy);
+            } else {
+                dgemv(1, n - last, len, alpha, at(last, first), lda, xr, incx, 1.0, yt, incy);
+            }
+        }
+    });
+}
+
 } // extern "C"
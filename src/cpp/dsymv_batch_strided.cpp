@@ -0,0 +1,119 @@
+/**
+ * DSYMV_BATCH_STRIDED - Batched double precision symmetric matrix-vector multiplication
+ *
+ * Computes, for b = 0, ..., batch - 1: y_b = alpha * A_b * x_b + beta * y_b
+ * where A_b = a + b * stridea, x_b = x + b * stridex and y_b = y + b * stridey,
+ * each A_b symmetric and stored in its upper or lower triangle
+ *
+ * Each problem is computed as by DSYMV. The batch runs on the thread pool
+ * when it is large enough; tiny problems are computed two at a time in the
+ * lanes of a vector (see batch.h).
+ *
+ * @param uplo     'U': upper triangles of A_b are stored, 'L': lower triangles
+ * @param n        Order of each A_b
+ * @param alpha    Scalar multiplier for A*x
+ * @param a        Symmetric matrices A_b stored in column-major order
+ * @param lda      Leading dimension of each A_b (>= max(1,n))
+ * @param stridea  Elements between successive A_b (0: one shared matrix)
+ * @param x        Input vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b (0: one shared vector)
+ * @param beta     Scalar multiplier for y
+ * @param y        Input/output vectors y_b
+ * @param incy     Storage spacing between elements of each y_b
+ * @param stridey  Elements between successive y_b
+ * @param batch    Number of problems
+ */
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increments, as the incx == incy == 1
+// loops of DSYMV
+void symv_pair(bool upper, int n, double alpha, const double* a0, const double* a1, int lda,
+               const double* x0, const double* x1, double beta, double* y0, double* y1) {
+    const v128_t valpha = wasm_f64x2_splat(alpha);
+    const v128_t vbeta = wasm_f64x2_splat(beta);
+    const v128_t vzero = wasm_f64x2_splat(0.0);
+
+    if (beta != 1.0) {
+        for (int i = 0; i < n; i++) {
+            v128_t yi = beta == 0.0 ? vzero : wasm_f64x2_mul(vbeta, batch::load2(y0, y1, i));
+            batch::store2(y0, y1, i, yi);
+        }
+    }
+    if (alpha == 0.0) return;
+
+    for (int j = 0; j < n; j++) {
+        v128_t temp1 = wasm_f64x2_mul(valpha, batch::load2(x0, x1, j));
+        v128_t temp2 = vzero;
+        size_t jj = j + static_cast<size_t>(j) * lda;
+        int first = upper ? 0 : j + 1;
+        int last = upper ? j : n;
+        if (!upper) {
+            v128_t yj = wasm_f64x2_add(batch::load2(y0, y1, j),
+                                       wasm_f64x2_mul(temp1, batch::load2(a0, a1, jj)));
+            batch::store2(y0, y1, j, yj);
+        }
+        for (int i = first; i < last; i++) {
+            v128_t aij = batch::load2(a0, a1, i + static_cast<size_t>(j) * lda);
+            batch::store2(y0, y1, i,
+                          wasm_f64x2_add(batch::load2(y0, y1, i), wasm_f64x2_mul(temp1, aij)));
+            temp2 = wasm_f64x2_add(temp2, wasm_f64x2_mul(aij, batch::load2(x0, x1, i)));
+        }
+        v128_t update = wasm_f64x2_mul(valpha, temp2);
+        if (upper) {
+            update = wasm_f64x2_add(wasm_f64x2_mul(temp1, batch::load2(a0, a1, jj)), update);
+        }
+        batch::store2(y0, y1, j, wasm_f64x2_add(batch::load2(y0, y1, j), update));
+    }
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dsymv_batch_strided(char uplo, int n, double alpha, const double* a, int lda, int stridea,
+                         const double* x, int incx, int stridex, double beta, double* y,
+                         int incy, int stridey, int batch) {
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", check::uplo(uplo), 1);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", n >= 0, 2);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", lda >= check::max1(n), 5);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", stridea >= 0, 6);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", incx != 0, 8);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", stridex >= 0, 9);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", incy != 0, 12);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", stridey > 0 || batch <= 1, 13);
+    BLAS_CHECK("DSYMV_BATCH_STRIDED", batch >= 0, 14);
+
+    // Quick return if possible
+    if (batch <= 0 || n == 0 || (alpha == 0.0 && beta == 1.0)) return;
+
+    batch::for_each_chunk(batch, 2.0 * n * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (n <= batch::TINY && incx == 1 && incy == 1) {
+            bool upper = (uplo == 'U' || uplo == 'u');
+            for (; b + 2 <= last; b += 2) {
+                symv_pair(upper, n, alpha, a + batch::offset(b, stridea),
+                          a + batch::offset(b + 1, stridea), lda, x + batch::offset(b, stridex),
+                          x + batch::offset(b + 1, stridex), beta, y + batch::offset(b, stridey),
+                          y + batch::offset(b + 1, stridey));
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            dsymv(uplo, n, alpha, a + batch::offset(b, stridea), lda,
+                  x + batch::offset(b, stridex), incx, beta, y + batch::offset(b, stridey), incy);
+        }
+    });
+}
+
+} // extern "C"
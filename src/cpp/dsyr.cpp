@@ -16,10 +16,16 @@
  * @param lda    Leading dimension of A
  */
 
+#include "check.h"
+
 extern "C" {
 
 void dsyr(char uplo, int n, double alpha, const double* x, int incx,
           double* a, int lda) {
+    BLAS_CHECK("DSYR", check::uplo(uplo), 1);
+    BLAS_CHECK("DSYR", n >= 0, 2);
+    BLAS_CHECK("DSYR", incx != 0, 5);
+    BLAS_CHECK("DSYR", lda >= check::max1(n), 7);
     
     const double zero = 0.0;
     
@@ -18,10 +18,17 @@
  * @param lda    Leading dimension of A
  */
 
+#include "check.h"
+
 extern "C" {
 
 void dsyr2(char uplo, int n, double alpha, const double* x, int incx,
            const double* y, int incy, double* a, int lda) {
+    BLAS_CHECK("DSYR2", check::uplo(uplo), 1);
+    BLAS_CHECK("DSYR2", n >= 0, 2);
+    BLAS_CHECK("DSYR2", incx != 0, 5);
+    BLAS_CHECK("DSYR2", incy != 0, 7);
+    BLAS_CHECK("DSYR2", lda >= check::max1(n), 9);
     
     const double zero = 0.0;
     
@@ -8,6 +8,9 @@
  * This is a C++ implementation of the BLAS Level 3 DSYR2K routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, the columns of C are split into one range per thread,
+ * balanced by the flops in each column of the triangle.
+ * 
  * @param uplo   'U': use upper triangular part, 'L': use lower triangular part  
  * @param trans  'N': C := alpha*A*B^T + alpha*B*A^T + beta*C, 'T'/'C': C := alpha*A^T*B + alpha*B^T*A + beta*C
  * @param n      Order of matrix C
@@ -22,66 +25,27 @@
  * @param ldc    Leading dimension of C
  */
 
-extern "C" {
+#include <algorithm>
 
-void dsyr2k(char uplo, char trans, int n, int k, double alpha,
-            const double* a, int lda, const double* b, int ldb,
-            double beta, double* c, int ldc) {
-    
+#include "check.h"
+#include "parallel.h"
+
+namespace {
+
+// The operations of DSYR2K on the columns [j0, j1) of C
+void dsyr2k_columns(bool upper, bool notrans, int n, int k, double alpha, const double* a,
+                    int lda, const double* b, int ldb, double beta, double* c, int ldc, int j0,
+                    int j1) {
     const double zero = 0.0;
     const double one = 1.0;
     
-    bool upper = (uplo == 'U' || uplo == 'u');
-    bool notrans = (trans == 'N' || trans == 'n');
-    
-    // Quick return if possible
-    if (n == 0 || ((alpha == zero || k == 0) && beta == one)) {
-        return;
-    }
-    
-    // Handle beta
-    if (alpha == zero) {
-        if (upper) {
-            if (beta == zero) {
-                for (int j = 0; j < n; j++) {
-                    for (int i = 0; i <= j; i++) {
-                        c[i + j * ldc] = zero;
-                    }
-                }
-            } else {
-                for (int j = 0; j < n; j++) {
-                    for (int i = 0; i <= j; i++) {
-                        c[i + j * ldc] = beta * c[i + j * ldc];
-                    }
-                }
-            }
-        } else {
-            if (beta == zero) {
-                for (int j = 0; j < n; j++) {
-                    for (int i = j; i < n; i++) {
-                        c[i + j * ldc] = zero;
-                    }
-                }
-            } else {
-                for (int j = 0; j < n; j++) {
-                    for (int i = j; i < n; i++) {
-                        c[i + j * ldc] = beta * c[i + j * ldc];
-                    }
-                }
-            }
-        }
-        return;
-    }
-    
     // Start the operations
     if (notrans) {
         // Form C := alpha*A*B^T + alpha*B*A^T + beta*C
         if (upper) {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 if (beta == zero) {
-                    for (int i = 0; i <= j; i++) {
-                        c[i + j * ldc] = zero;
-                    }
+                    std::fill(c + j * ldc, c + j + 1 + j * ldc, zero);
                 } else if (beta != one) {
                     for (int i = 0; i <= j; i++) {
                         c[i + j * ldc] = beta * c[i + j * ldc];
@@ -98,11 +62,9 @@ void dsyr2k(char uplo, char trans, int n, int k, double alpha,
                 }
             }
         } else {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 if (beta == zero) {
-                    for (int i = j; i < n; i++) {
-                        c[i + j * ldc] = zero;
-                    }
+                    std::fill(c + j + j * ldc, c + n + j * ldc, zero);
                 } else if (beta != one) {
                     for (int i = j; i < n; i++) {
                         c[i + j * ldc] = beta * c[i + j * ldc];
@@ -122,7 +84,7 @@ void dsyr2k(char uplo, char trans, int n, int k, double alpha,
     } else {
         // Form C := alpha*A^T*B + alpha*B^T*A + beta*C
         if (upper) {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 for (int i = 0; i <= j; i++) {
                     double temp1 = zero;
                     double temp2 = zero;
@@ -138,7 +100,7 @@ void dsyr2k(char uplo, char trans, int n, int k, double alpha,
                 }
             }
         } else {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 for (int i = j; i < n; i++) {
                     double temp1 = zero;
                     double temp2 = zero;
@@ -157,4 +119,71 @@ void dsyr2k(char uplo, char trans, int n, int k, double alpha,
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void dsyr2k(char uplo, char trans, int n, int k, double alpha,
+            const double* a, int lda, const double* b, int ldb,
+            double beta, double* c, int ldc) {
+    BLAS_CHECK("DSYR2K", check::uplo(uplo), 1);
+    BLAS_CHECK("DSYR2K", check::trans(trans), 2);
+    BLAS_CHECK("DSYR2K", n >= 0, 3);
+    BLAS_CHECK("DSYR2K", k >= 0, 4);
+    BLAS_CHECK("DSYR2K", lda >= check::max1(check::notrans(trans) ? n : k), 7);
+    BLAS_CHECK("DSYR2K", ldb >= check::max1(check::notrans(trans) ? n : k), 9);
+    BLAS_CHECK("DSYR2K", ldc >= check::max1(n), 12);
+    
+    const double zero = 0.0;
+    const double one = 1.0;
+    
+    bool upper = (uplo == 'U' || uplo == 'u');
+    bool notrans = (trans == 'N' || trans == 'n');
+    
+    // Quick return if possible
+    if (n == 0 || ((alpha == zero || k == 0) && beta == one)) {
+        return;
+    }
+    
+    // Handle beta
+    if (alpha == zero) {
+        if (upper) {
+            if (beta == zero) {
+                for (int j = 0; j < n; j++) {
+                    std::fill(c + j * ldc, c + j + 1 + j * ldc, zero);
+                }
+            } else {
+                for (int j = 0; j < n; j++) {
+                    for (int i = 0; i <= j; i++) {
+                        c[i + j * ldc] = beta * c[i + j * ldc];
+                    }
+                }
+            }
+        } else {
+            if (beta == zero) {
+                for (int j = 0; j < n; j++) {
+                    std::fill(c + j + j * ldc, c + n + j * ldc, zero);
+                }
+            } else {
+                for (int j = 0; j < n; j++) {
+                    for (int i = j; i < n; i++) {
+                        c[i + j * ldc] = beta * c[i + j * ldc];
+                    }
+                }
+            }
+        }
+        return;
+    }
+    
+    // Start the operations, on ranges of columns of C balanced by flops
+    // between the threads
+    parallel::for_balanced(
+        n,
+        1,
+        [&](int j) { return (upper ? j + 1.0 : n - j) * 2.0 * k; },
+        [&](int j0, int j1) {
+            dsyr2k_columns(upper, notrans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, j0, j1);
+        });
+}
+
 } // extern "C"
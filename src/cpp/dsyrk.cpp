@@ -7,6 +7,9 @@
  * This is a C++ implementation of the BLAS Level 3 DSYRK routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, the columns of C are split into one range per thread,
+ * balanced by the flops in each column of the triangle.
+ * 
  * @param uplo   'U': use upper triangular part, 'L': use lower triangular part  
  * @param trans  'N': C := alpha*A*A^T + beta*C, 'T'/'C': C := alpha*A^T*A + beta*C
  * @param n      Order of matrix C
@@ -19,65 +22,26 @@
  * @param ldc    Leading dimension of C
  */
 
-extern "C" {
+#include <algorithm>
 
-void dsyrk(char uplo, char trans, int n, int k, double alpha,
-           const double* a, int lda, double beta, double* c, int ldc) {
-    
+#include "check.h"
+#include "parallel.h"
+
+namespace {
+
+// The operations of DSYRK on the columns [j0, j1) of C
+void dsyrk_columns(bool upper, bool notrans, int n, int k, double alpha, const double* a, int lda,
+                   double beta, double* c, int ldc, int j0, int j1) {
     const double zero = 0.0;
     const double one = 1.0;
     
-    bool upper = (uplo == 'U' || uplo == 'u');
-    bool notrans = (trans == 'N' || trans == 'n');
-    
-    // Quick return if possible
-    if (n == 0 || ((alpha == zero || k == 0) && beta == one)) {
-        return;
-    }
-    
-    // Handle beta
-    if (alpha == zero) {
-        if (upper) {
-            if (beta == zero) {
-                for (int j = 0; j < n; j++) {
-                    for (int i = 0; i <= j; i++) {
-                        c[i + j * ldc] = zero;
-                    }
-                }
-            } else {
-                for (int j = 0; j < n; j++) {
-                    for (int i = 0; i <= j; i++) {
-                        c[i + j * ldc] = beta * c[i + j * ldc];
-                    }
-                }
-            }
-        } else {
-            if (beta == zero) {
-                for (int j = 0; j < n; j++) {
-                    for (int i = j; i < n; i++) {
-                        c[i + j * ldc] = zero;
-                    }
-                }
-            } else {
-                for (int j = 0; j < n; j++) {
-                    for (int i = j; i < n; i++) {
-                        c[i + j * ldc] = beta * c[i + j * ldc];
-                    }
-                }
-            }
-        }
-        return;
-    }
-    
     // Start the operations
     if (notrans) {
         // Form C := alpha*A*A^T + beta*C
         if (upper) {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 if (beta == zero) {
-                    for (int i = 0; i <= j; i++) {
-                        c[i + j * ldc] = zero;
-                    }
+                    std::fill(c + j * ldc, c + j + 1 + j * ldc, zero);
                 } else if (beta != one) {
                     for (int i = 0; i <= j; i++) {
                         c[i + j * ldc] = beta * c[i + j * ldc];
@@ -93,11 +57,9 @@ void dsyrk(char uplo, char trans, int n, int k, double alpha,
                 }
             }
         } else {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 if (beta == zero) {
-                    for (int i = j; i < n; i++) {
-                        c[i + j * ldc] = zero;
-                    }
+                    std::fill(c + j + j * ldc, c + n + j * ldc, zero);
                 } else if (beta != one) {
                     for (int i = j; i < n; i++) {
                         c[i + j * ldc] = beta * c[i + j * ldc];
@@ -116,7 +78,7 @@ void dsyrk(char uplo, char trans, int n, int k, double alpha,
     } else {
         // Form C := alpha*A^T*A + beta*C
         if (upper) {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 for (int i = 0; i <= j; i++) {
                     double temp = zero;
                     for (int l = 0; l < k; l++) {
@@ -130,7 +92,7 @@ void dsyrk(char uplo, char trans, int n, int k, double alpha,
                 }
             }
         } else {
-            for (int j = 0; j < n; j++) {
+            for (int j = j0; j < j1; j++) {
                 for (int i = j; i < n; i++) {
                     double temp = zero;
                     for (int l = 0; l < k; l++) {
@@ -147,4 +109,69 @@ void dsyrk(char uplo, char trans, int n, int k, double alpha,
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void dsyrk(char uplo, char trans, int n, int k, double alpha,
+           const double* a, int lda, double beta, double* c, int ldc) {
+    BLAS_CHECK("DSYRK", check::uplo(uplo), 1);
+    BLAS_CHECK("DSYRK", check::trans(trans), 2);
+    BLAS_CHECK("DSYRK", n >= 0, 3);
+    BLAS_CHECK("DSYRK", k >= 0, 4);
+    BLAS_CHECK("DSYRK", lda >= check::max1(check::notrans(trans) ? n : k), 7);
+    BLAS_CHECK("DSYRK", ldc >= check::max1(n), 10);
+    
+    const double zero = 0.0;
+    const double one = 1.0;
+    
+    bool upper = (uplo == 'U' || uplo == 'u');
+    bool notrans = (trans == 'N' || trans == 'n');
+    
+    // Quick return if possible
+    if (n == 0 || ((alpha == zero || k == 0) && beta == one)) {
+        return;
+    }
+    
+    // Handle beta
+    if (alpha == zero) {
+        if (upper) {
+            if (beta == zero) {
+                for (int j = 0; j < n; j++) {
+                    std::fill(c + j * ldc, c + j + 1 + j * ldc, zero);
+                }
+            } else {
+                for (int j = 0; j < n; j++) {
+                    for (int i = 0; i <= j; i++) {
+                        c[i + j * ldc] = beta * c[i + j * ldc];
+                    }
+                }
+            }
+        } else {
+            if (beta == zero) {
+                for (int j = 0; j < n; j++) {
+                    std::fill(c + j + j * ldc, c + n + j * ldc, zero);
+                }
+            } else {
+                for (int j = 0; j < n; j++) {
+                    for (int i = j; i < n; i++) {
+                        c[i + j * ldc] = beta * c[i + j * ldc];
+                    }
+                }
+            }
+        }
+        return;
+    }
+    
+    // Start the operations, on ranges of columns of C balanced by flops
+    // between the threads
+    parallel::for_balanced(
+        n,
+        1,
+        [&](int j) { return (upper ? j + 1.0 : n - j) * k; },
+        [&](int j0, int j1) {
+            dsyrk_columns(upper, notrans, n, k, alpha, a, lda, beta, c, ldc, j0, j1);
+        });
+}
+
 } // extern "C"
@@ -1,10 +1,20 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dtbmv(int uplo, int trans, int diag, int n, int k,
            const double* a, int lda, double* x, int incx) {
+    BLAS_CHECK("DTBMV", check::flag(uplo), 1);
+    BLAS_CHECK("DTBMV", check::trans(trans), 2);
+    BLAS_CHECK("DTBMV", check::flag(diag), 3);
+    BLAS_CHECK("DTBMV", n >= 0, 4);
+    BLAS_CHECK("DTBMV", k >= 0, 5);
+    BLAS_CHECK("DTBMV", lda >= k + 1, 7);
+    BLAS_CHECK("DTBMV", incx != 0, 9);
+
     // Quick return if possible
     if (n == 0) return;
 
@@ -59,7 +69,7 @@ void dtbmv(int uplo, int trans, int diag, int n, int k,
                 for (int j = n - 1; j >= 0; j--) {
                     if (x[j] != 0.0) {
                         double temp = x[j];
-                        int l = 1 - j;
+                        int l = -j;
                         int i_end = std::min(n - 1, j + k);
                         for (int i = i_end; i > j; i--) {
                             x[i] += temp * a[(l + i) + j * lda];
@@ -74,7 +84,7 @@ void dtbmv(int uplo, int trans, int diag, int n, int k,
                     if (x[jx] != 0.0) {
                         double temp = x[jx];
                         int ix = kx;
-                        int l = 1 - j;
+                        int l = -j;
                         int i_end = std::min(n - 1, j + k);
                         for (int i = i_end; i > j; i--) {
                             x[ix] += temp * a[(l + i) + j * lda];
@@ -123,7 +133,7 @@ void dtbmv(int uplo, int trans, int diag, int n, int k,
             if (incx == 1) {
                 for (int j = 0; j < n; j++) {
                     double temp = x[j];
-                    int l = 1 - j;
+                    int l = -j;
                     if (nounit) temp *= a[0 + j * lda];
                     int i_end = std::min(n - 1, j + k);
                     for (int i = j + 1; i <= i_end; i++) {
@@ -137,7 +147,7 @@ void dtbmv(int uplo, int trans, int diag, int n, int k,
                     double temp = x[jx];
                     kx += incx;
                     int ix = kx;
-                    int l = 1 - j;
+                    int l = -j;
                     if (nounit) temp *= a[0 + j * lda];
                     int i_end = std::min(n - 1, j + k);
                     for (int i = j + 1; i <= i_end; i++) {
@@ -1,10 +1,20 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dtbsv(int uplo, int trans, int diag, int n, int k,
            const double* a, int lda, double* x, int incx) {
+    BLAS_CHECK("DTBSV", check::flag(uplo), 1);
+    BLAS_CHECK("DTBSV", check::trans(trans), 2);
+    BLAS_CHECK("DTBSV", check::flag(diag), 3);
+    BLAS_CHECK("DTBSV", n >= 0, 4);
+    BLAS_CHECK("DTBSV", k >= 0, 5);
+    BLAS_CHECK("DTBSV", lda >= k + 1, 7);
+    BLAS_CHECK("DTBSV", incx != 0, 9);
+
     // Quick return if possible
     if (n == 0) return;
 
@@ -59,7 +69,7 @@ void dtbsv(int uplo, int trans, int diag, int n, int k,
             if (incx == 1) {
                 for (int j = 0; j < n; j++) {
                     if (x[j] != 0.0) {
-                        int l = 1 - j;
+                        int l = -j;
                         if (nounit) x[j] /= a[0 + j * lda];
                         double temp = x[j];
                         int i_end = std::min(n - 1, j + k);
@@ -74,7 +84,7 @@ void dtbsv(int uplo, int trans, int diag, int n, int k,
                     kx += incx;
                     if (x[jx] != 0.0) {
                         int ix = kx;
-                        int l = 1 - j;
+                        int l = -j;
                         if (nounit) x[jx] /= a[0 + j * lda];
                         double temp = x[jx];
                         int i_end = std::min(n - 1, j + k);
@@ -122,7 +132,7 @@ void dtbsv(int uplo, int trans, int diag, int n, int k,
             if (incx == 1) {
                 for (int j = n - 1; j >= 0; j--) {
                     double temp = x[j];
-                    int l = 1 - j;
+                    int l = -j;
                     int i_end = std::min(n - 1, j + k);
                     for (int i = i_end; i > j; i--) {
                         temp -= a[(l + i) + j * lda] * x[i];
@@ -136,7 +146,7 @@ void dtbsv(int uplo, int trans, int diag, int n, int k,
                 for (int j = n - 1; j >= 0; j--) {
                     double temp = x[jx];
                     int ix = kx;
-                    int l = 1 - j;
+                    int l = -j;
                     int i_end = std::min(n - 1, j + k);
                     for (int i = i_end; i > j; i--) {
                         temp -= a[(l + i) + j * lda] * x[ix];
@@ -1,10 +1,18 @@
 #include <algorithm>
 #include <cmath>
 
+#include "check.h"
+
 extern "C" {
 
 void dtpsv(int uplo, int trans, int diag, int n, 
            const double* ap, double* x, int incx) {
+    BLAS_CHECK("DTPSV", check::flag(uplo), 1);
+    BLAS_CHECK("DTPSV", check::trans(trans), 2);
+    BLAS_CHECK("DTPSV", check::flag(diag), 3);
+    BLAS_CHECK("DTPSV", n >= 0, 4);
+    BLAS_CHECK("DTPSV", incx != 0, 7);
+
     // Quick return if possible
     if (n == 0) return;
 
@@ -17,10 +17,18 @@
  * @param incx   Storage spacing between elements of x
  */
 
+#include "check.h"
+
 extern "C" {
 
 void dtrmv(char uplo, char trans, char diag, int n, const double* a, int lda,
            double* x, int incx) {
+    BLAS_CHECK("DTRMV", check::uplo(uplo), 1);
+    BLAS_CHECK("DTRMV", check::trans(trans), 2);
+    BLAS_CHECK("DTRMV", check::diag(diag), 3);
+    BLAS_CHECK("DTRMV", n >= 0, 4);
+    BLAS_CHECK("DTRMV", lda >= check::max1(n), 6);
+    BLAS_CHECK("DTRMV", incx != 0, 8);
     
     const double zero = 0.0;
     
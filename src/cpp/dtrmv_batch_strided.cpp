@@ -0,0 +1,125 @@
+/**
+ * DTRMV_BATCH_STRIDED - Batched double precision triangular matrix-vector multiplication
+ *
+ * Computes, for b = 0, ..., batch - 1: x_b = A_b * x_b  or  x_b = A_b^T * x_b
+ * where A_b = a + b * stridea is triangular and x_b = x + b * stridex
+ *
+ * Each problem is computed as by DTRMV. The batch runs on the thread pool
+ * when it is large enough; tiny problems are computed two at a time in the
+ * lanes of a vector (see batch.h).
+ *
+ * @param uplo     'U': upper triangular, 'L': lower triangular
+ * @param trans    'N': x = A*x, 'T'/'C': x = A^T*x
+ * @param diag     'U': unit triangular, 'N': non-unit triangular
+ * @param n        Order of each A_b
+ * @param a        Triangular matrices A_b stored in column-major order
+ * @param lda      Leading dimension of each A_b (>= max(1,n))
+ * @param stridea  Elements between successive A_b (0: one shared matrix)
+ * @param x        Input/output vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b
+ * @param batch    Number of problems
+ */
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increment, as the incx == 1 loops of DTRMV
+void trmv_pair(bool upper, bool notrans, bool nounit, int n, const double* a0, const double* a1,
+               int lda, double* x0, double* x1) {
+    const v128_t vzero = wasm_f64x2_splat(0.0);
+    auto at = [&](int i, int j) {
+        return batch::load2(a0, a1, i + static_cast<size_t>(j) * lda);
+    };
+    auto add = [&](int i, v128_t v) {
+        batch::store2(x0, x1, i, wasm_f64x2_add(batch::load2(x0, x1, i), v));
+    };
+
+    if (notrans) {
+        // Form x := A*x; lanes whose x[j] is zero are skipped
+        for (int jj = 0; jj < n; jj++) {
+            int j = upper ? jj : n - 1 - jj;
+            v128_t temp = batch::load2(x0, x1, j);
+            v128_t nonzero = wasm_f64x2_ne(temp, vzero);
+            if (upper) {
+                for (int i = 0; i < j; i++) {
+                    add(i, batch::where(nonzero, wasm_f64x2_mul(temp, at(i, j))));
+                }
+            } else {
+                for (int i = n - 1; i > j; i--) {
+                    add(i, batch::where(nonzero, wasm_f64x2_mul(temp, at(i, j))));
+                }
+            }
+            if (nounit) {
+                batch::store2(x0, x1, j,
+                              wasm_v128_bitselect(wasm_f64x2_mul(temp, at(j, j)), temp, nonzero));
+            }
+        }
+    } else {
+        // Form x := A^T*x
+        for (int jj = 0; jj < n; jj++) {
+            int j = upper ? n - 1 - jj : jj;
+            v128_t temp = batch::load2(x0, x1, j);
+            if (nounit) temp = wasm_f64x2_mul(temp, at(j, j));
+            if (upper) {
+                for (int i = j - 1; i >= 0; i--) {
+                    temp = wasm_f64x2_add(temp, wasm_f64x2_mul(at(i, j), batch::load2(x0, x1, i)));
+                }
+            } else {
+                for (int i = j + 1; i < n; i++) {
+                    temp = wasm_f64x2_add(temp, wasm_f64x2_mul(at(i, j), batch::load2(x0, x1, i)));
+                }
+            }
+            batch::store2(x0, x1, j, temp);
+        }
+    }
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dtrmv_batch_strided(char uplo, char trans, char diag, int n, const double* a, int lda,
+                         int stridea, double* x, int incx, int stridex, int batch) {
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", check::uplo(uplo), 1);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", check::trans(trans), 2);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", check::diag(diag), 3);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", n >= 0, 4);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", lda >= check::max1(n), 6);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", stridea >= 0, 7);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", incx != 0, 9);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", stridex > 0 || batch <= 1, 10);
+    BLAS_CHECK("DTRMV_BATCH_STRIDED", batch >= 0, 11);
+
+    // Quick return if possible
+    if (batch <= 0 || n == 0) return;
+
+    batch::for_each_chunk(batch, static_cast<double>(n) * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (n <= batch::TINY && incx == 1) {
+            bool upper = (uplo == 'U' || uplo == 'u');
+            bool notrans = (trans == 'N' || trans == 'n');
+            bool nounit = (diag == 'N' || diag == 'n');
+            for (; b + 2 <= last; b += 2) {
+                trmv_pair(upper, notrans, nounit, n, a + batch::offset(b, stridea),
+                          a + batch::offset(b + 1, stridea), lda, x + batch::offset(b, stridex),
+                          x + batch::offset(b + 1, stridex));
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            dtrmv(uplo, trans, diag, n, a + batch::offset(b, stridea), lda,
+                  x + batch::offset(b, stridex), incx);
+        }
+    });
+}
+
+} // extern "C"
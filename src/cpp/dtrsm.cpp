@@ -7,6 +7,9 @@
  * This is a C++ implementation of the BLAS Level 3 DTRSM routine,
  * based on the reference BLAS implementation from netlib.org
  * 
+ * With threads, the right-hand sides (columns of B for side 'L', rows for
+ * side 'R') are split into one range per thread.
+ * 
  * @param side   'L': op(A)*X = alpha*B, 'R': X*op(A) = alpha*B
  * @param uplo   'U': upper triangular, 'L': lower triangular
  * @param transa 'N': op(A) = A, 'T'/'C': op(A) = A^T
@@ -20,10 +23,15 @@
  * @param ldb    Leading dimension of B
  */
 
-extern "C" {
+#include <algorithm>
 
-void dtrsm(char side, char uplo, char transa, char diag, int m, int n, double alpha,
-           const double* a, int lda, double* b, int ldb) {
+#include "check.h"
+#include "parallel.h"
+
+namespace {
+
+void dtrsm_serial(char side, char uplo, char transa, char diag, int m, int n, double alpha,
+                  const double* a, int lda, double* b, int ldb) {
     
     const double zero = 0.0;
     const double one = 1.0;
@@ -39,9 +47,7 @@ void dtrsm(char side, char uplo, char transa, char diag, int m, int n, double al
     // Handle alpha
     if (alpha == zero) {
         for (int j = 0; j < n; j++) {
-            for (int i = 0; i < m; i++) {
-                b[i + j * ldb] = zero;
-            }
+            std::fill(b + j * ldb, b + m + j * ldb, zero);
         }
         return;
     }
@@ -206,4 +212,38 @@ void dtrsm(char side, char uplo, char transa, char diag, int m, int n, double al
     }
 }
 
+} // namespace
+
+extern "C" {
+
+void dtrsm(char side, char uplo, char transa, char diag, int m, int n, double alpha,
+           const double* a, int lda, double* b, int ldb) {
+    BLAS_CHECK("DTRSM", check::side(side), 1);
+    BLAS_CHECK("DTRSM", check::uplo(uplo), 2);
+    BLAS_CHECK("DTRSM", check::trans(transa), 3);
+    BLAS_CHECK("DTRSM", check::diag(diag), 4);
+    BLAS_CHECK("DTRSM", m >= 0, 5);
+    BLAS_CHECK("DTRSM", n >= 0, 6);
+    BLAS_CHECK("DTRSM", lda >= check::max1(check::left(side) ? m : n), 9);
+    BLAS_CHECK("DTRSM", ldb >= check::max1(m), 11);
+
+    // The right-hand sides are independent: with threads, B is split into
+    // ranges of columns (side 'L') or rows (side 'R'), one per thread
+    bool left = (side == 'L' || side == 'l');
+    int order = left ? m : n;
+    parallel::for_balanced(
+        left ? n : m,
+        left ? 1 : 8,
+        [&](int) { return 0.5 * order * order; },
+        [&](int first, int last) {
+            if (left) {
+                dtrsm_serial(side, uplo, transa, diag, m, last - first, alpha, a, lda,
+                             b + static_cast<size_t>(first) * ldb, ldb);
+            } else {
+                dtrsm_serial(side, uplo, transa, diag, last - first, n, alpha, a, lda, b + first,
+                             ldb);
+            }
+        });
+}
+
 } // extern "C"
@@ -17,10 +17,18 @@
  * @param incx   Storage spacing between elements of x
  */
 
+#include "check.h"
+
 extern "C" {
 
 void dtrsv(char uplo, char trans, char diag, int n, const double* a, int lda,
            double* x, int incx) {
+    BLAS_CHECK("DTRSV", check::uplo(uplo), 1);
+    BLAS_CHECK("DTRSV", check::trans(trans), 2);
+    BLAS_CHECK("DTRSV", check::diag(diag), 3);
+    BLAS_CHECK("DTRSV", n >= 0, 4);
+    BLAS_CHECK("DTRSV", lda >= check::max1(n), 6);
+    BLAS_CHECK("DTRSV", incx != 0, 8);
     
     const double zero = 0.0;
     
@@ -133,7 +141,7 @@ void dtrsv(char uplo, char trans, char diag, int n, const double* a, int lda,
                 for (int j = n - 1; j >= 0; j--) {
                     double temp = x[jx];
                     int ix = kx;
-                    for (int i = j + 1; i < n; i++) {
+                    for (int i = n - 1; i > j; i--) {
                         temp -= a[i + j * lda] * x[ix];
                         ix -= incx;
                     }
@@ -0,0 +1,122 @@
+/**
+ * DTRSV_BATCH_STRIDED - Batched double precision triangular solve
+ *
+ * Solves, for b = 0, ..., batch - 1: A_b * x_b = c_b  or  A_b^T * x_b = c_b
+ * where A_b = a + b * stridea is triangular and x_b = x + b * stridex holds
+ * c_b on entry and the solution on exit
+ *
+ * Each problem is solved as by DTRSV. The batch runs on the thread pool
+ * when it is large enough; tiny problems are solved two at a time in the
+ * lanes of a vector (see batch.h).
+ *
+ * @param uplo     'U': upper triangular, 'L': lower triangular
+ * @param trans    'N': solve A*x = c, 'T'/'C': solve A^T*x = c
+ * @param diag     'U': unit triangular, 'N': non-unit triangular
+ * @param n        Order of each A_b
+ * @param a        Triangular matrices A_b stored in column-major order
+ * @param lda      Leading dimension of each A_b (>= max(1,n))
+ * @param stridea  Elements between successive A_b (0: one shared matrix)
+ * @param x        Input/output vectors x_b
+ * @param incx     Storage spacing between elements of each x_b
+ * @param stridex  Elements between successive x_b
+ * @param batch    Number of problems
+ */
+
+#include "batch.h"
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+#ifdef __wasm_simd128__
+
+// Problems b and b + 1 with unit increment, as the incx == 1 loops of DTRSV
+void trsv_pair(bool upper, bool notrans, bool nounit, int n, const double* a0, const double* a1,
+               int lda, double* x0, double* x1) {
+    const v128_t vzero = wasm_f64x2_splat(0.0);
+    auto at = [&](int i, int j) {
+        return batch::load2(a0, a1, i + static_cast<size_t>(j) * lda);
+    };
+    auto sub = [&](int i, v128_t v) {
+        batch::store2(x0, x1, i, wasm_f64x2_sub(batch::load2(x0, x1, i), v));
+    };
+
+    if (notrans) {
+        // Form x := inv(A)*x; lanes whose x[j] is zero are skipped
+        for (int jj = 0; jj < n; jj++) {
+            int j = upper ? n - 1 - jj : jj;
+            v128_t temp = batch::load2(x0, x1, j);
+            v128_t nonzero = wasm_f64x2_ne(temp, vzero);
+            if (nounit) {
+                temp = wasm_v128_bitselect(wasm_f64x2_div(temp, at(j, j)), temp, nonzero);
+                batch::store2(x0, x1, j, temp);
+            }
+            if (upper) {
+                for (int i = j - 1; i >= 0; i--) {
+                    sub(i, batch::where(nonzero, wasm_f64x2_mul(temp, at(i, j))));
+                }
+            } else {
+                for (int i = j + 1; i < n; i++) {
+                    sub(i, batch::where(nonzero, wasm_f64x2_mul(temp, at(i, j))));
+                }
+            }
+        }
+    } else {
+        // Form x := inv(A^T)*x
+        for (int jj = 0; jj < n; jj++) {
+            int j = upper ? jj : n - 1 - jj;
+            v128_t temp = batch::load2(x0, x1, j);
+            int first = upper ? 0 : j + 1;
+            int last = upper ? j : n;
+            for (int i = first; i < last; i++) {
+                temp = wasm_f64x2_sub(temp, wasm_f64x2_mul(at(i, j), batch::load2(x0, x1, i)));
+            }
+            if (nounit) temp = wasm_f64x2_div(temp, at(j, j));
+            batch::store2(x0, x1, j, temp);
+        }
+    }
+}
+
+#endif // __wasm_simd128__
+
+} // namespace
+
+extern "C" {
+
+void dtrsv_batch_strided(char uplo, char trans, char diag, int n, const double* a, int lda,
+                         int stridea, double* x, int incx, int stridex, int batch) {
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", check::uplo(uplo), 1);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", check::trans(trans), 2);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", check::diag(diag), 3);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", n >= 0, 4);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", lda >= check::max1(n), 6);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", stridea >= 0, 7);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", incx != 0, 9);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", stridex > 0 || batch <= 1, 10);
+    BLAS_CHECK("DTRSV_BATCH_STRIDED", batch >= 0, 11);
+
+    // Quick return if possible
+    if (batch <= 0 || n == 0) return;
+
+    batch::for_each_chunk(batch, static_cast<double>(n) * n, [&](int first, int last) {
+        int b = first;
+#ifdef __wasm_simd128__
+        if (n <= batch::TINY && incx == 1) {
+            bool upper = (uplo == 'U' || uplo == 'u');
+            bool notrans = (trans == 'N' || trans == 'n');
+            bool nounit = (diag == 'N' || diag == 'n');
+            for (; b + 2 <= last; b += 2) {
+                trsv_pair(upper, notrans, nounit, n, a + batch::offset(b, stridea),
+                          a + batch::offset(b + 1, stridea), lda, x + batch::offset(b, stridex),
+                          x + batch::offset(b + 1, stridex));
+            }
+        }
+#endif
+        for (; b < last; b++) {
+            dtrsv(uplo, trans, diag, n, a + batch::offset(b, stridea), lda,
+                  x + batch::offset(b, stridex), incx);
+        }
+    });
+}
+
+} // extern "C"
@@ -0,0 +1,119 @@
+/**
+ * DTRTRI - Double precision inverse of a triangular matrix
+ *
+ * Computes: A := inv(A)
+ * where A is upper or lower triangular, in place
+ *
+ * This is a C++ implementation of the LAPACK routine DTRTRI, based on the
+ * reference LAPACK implementation from netlib.org. Diagonal blocks of NB
+ * columns are inverted as by DTRTI2 with DTRMV; the off-diagonal blocks are
+ * computed with DTRMM and DTRSM, so no workspace is needed.
+ *
+ * @param uplo   'U': A is upper triangular, 'L': A is lower triangular
+ * @param diag   'U': A has a unit diagonal (not referenced), 'N': non-unit
+ * @param n      Order of A
+ * @param a      Input triangular matrix, output its inverse (n x n); the
+ *               other triangle is not referenced
+ * @param lda    Leading dimension of A
+ * @return       0 on success, i > 0 if A(i, i) is exactly zero and A is
+ *               singular; A is then unchanged
+ */
+
+#include <algorithm>
+#include <cstddef>
+
+#include "blas.h"
+#include "check.h"
+
+namespace {
+
+// Columns per block
+constexpr int NB = 64;
+
+// The unblocked inverse DTRTI2 of the n x n triangle a
+void dtrti2(bool upper, char diag, int n, double* a, int lda) {
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    const bool nounit = diag == 'N' || diag == 'n';
+
+    if (upper) {
+        for (int j = 0; j < n; j++) {
+            double ajj = -1.0;
+            if (nounit) {
+                *at(j, j) = 1.0 / *at(j, j);
+                ajj = -*at(j, j);
+            }
+
+            // Compute elements 0:j-1 of the j-th column
+            dtrmv('U', 'N', diag, j, a, lda, at(0, j), 1);
+            dscal(j, ajj, at(0, j), 1);
+        }
+    } else {
+        for (int j = n - 1; j >= 0; j--) {
+            double ajj = -1.0;
+            if (nounit) {
+                *at(j, j) = 1.0 / *at(j, j);
+                ajj = -*at(j, j);
+            }
+
+            // Compute elements j+1:n-1 of the j-th column
+            if (j < n - 1) {
+                dtrmv('L', 'N', diag, n - j - 1, at(j + 1, j + 1), lda, at(j + 1, j), 1);
+                dscal(n - j - 1, ajj, at(j + 1, j), 1);
+            }
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int dtrtri(char uplo, char diag, int n, double* a, int lda) {
+    BLAS_CHECK("DTRTRI", check::uplo(uplo), 1);
+    BLAS_CHECK("DTRTRI", check::diag(diag), 2);
+    BLAS_CHECK("DTRTRI", n >= 0, 3);
+    BLAS_CHECK("DTRTRI", lda >= check::max1(n), 5);
+
+    auto at = [&](int i, int j) { return a + i + static_cast<size_t>(j) * lda; };
+    const bool upper = uplo == 'U' || uplo == 'u';
+
+    // Check for singularity if non-unit
+    if (diag == 'N' || diag == 'n') {
+        for (int i = 0; i < n; i++) {
+            if (*at(i, i) == 0.0) return i + 1;
+        }
+    }
+
+    if (upper) {
+        // Compute the inverse of the upper triangular matrix, first block first
+        for (int j = 0; j < n; j += NB) {
+            const int jb = std::min(n - j, NB);
+
+            // Compute rows 0:j-1 of the current block column
+            dtrmm('L', 'U', 'N', diag, j, jb, 1.0, a, lda, at(0, j), lda);
+            dtrsm('R', 'U', 'N', diag, j, jb, -1.0, at(j, j), lda, at(0, j), lda);
+
+            // Compute the inverse of the current diagonal block
+            dtrti2(true, diag, jb, at(j, j), lda);
+        }
+    } else {
+        // Compute the inverse of the lower triangular matrix, last block first
+        for (int j = (n - 1) / NB * NB; j >= 0; j -= NB) {
+            const int jb = std::min(n - j, NB);
+
+            // Compute rows j+jb:n-1 of the current block column
+            if (j + jb < n) {
+                dtrmm('L', 'L', 'N', diag, n - j - jb, jb, 1.0, at(j + jb, j + jb), lda,
+                      at(j + jb, j), lda);
+                dtrsm('R', 'L', 'N', diag, n - j - jb, jb, -1.0, at(j, j), lda, at(j + jb, j),
+                      lda);
+            }
+
+            // Compute the inverse of the current diagonal block
+            dtrti2(false, diag, jb, at(j, j), lda);
+        }
+    }
+    return 0;
+}
+
+} // extern "C"
@@ -0,0 +1,263 @@
+/**
+ * GEMM_U8S8S32 - Quantized uint8 x int8 matrix-matrix multiplication
+ *
+ * Computes: C := (op(A) - a_zero) * (op(B) - b_zero)
+ * with int32 accumulation, where A is uint8, B is int8 and op(X) = X or X^T
+ *
+ * GEMM_U8S8U8 runs the same product through a fused requantization epilogue:
+ *   C(i,j) := clamp(round((acc(i,j) + bias(j)) * scale(j)) + c_zero, 0, 255)
+ * so the int32 accumulators never leave the packed tile. scale(j) is scale[0]
+ * unless per_channel is non-zero, in which case there is one scale per column
+ * of C (one per output channel when B holds the weights).
+ *
+ * Packing format: zero points are subtracted while widening to int16 and k is
+ * split into pairs, so that one i32x4.dot_i16x8_s yields the partial sums of
+ * four rows of C over two values of k.
+ *   packed A: per MR-row panel, per k pair: MR x 2 int16, row by row
+ *   packed B: per NR-column panel, per k pair: NR int32 words, each holding
+ *             the two int16 values of one column (low half first)
+ * Rows, columns and the odd trailing k value are padded with zeros.
+ *
+ * The int32 accumulators are exact as long as k * 255 * 255 < 2^31,
+ * i.e. for k up to 33025.
+ *
+ * @param transa    'N': op(A) = A, 'T'/'C': op(A) = A^T
+ * @param transb    'N': op(B) = B, 'T'/'C': op(B) = B^T
+ * @param m         Number of rows of op(A) and C
+ * @param n         Number of columns of op(B) and C
+ * @param k         Number of columns of op(A) and rows of op(B)
+ * @param a         Matrix A (uint8)
+ * @param lda       Leading dimension of A
+ * @param a_zero    Zero point of A (0..255)
+ * @param b         Matrix B (int8)
+ * @param ldb       Leading dimension of B
+ * @param b_zero    Zero point of B (-128..127)
+ * @param c         Output matrix C (int32, or uint8 for GEMM_U8S8U8)
+ * @param ldc       Leading dimension of C
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+#include "check.h"
+
+namespace {
+
+const int MR = 4;     // rows of the register tile
+const int NR = 4;     // columns of the register tile
+const int MC = 64;    // rows of A packed per block
+const int NC = 64;    // columns of B packed per block
+const int KCP = 256;  // k pairs of A packed per block
+
+struct Epilogue {
+    // GEMM_U8S8S32 output
+    int32_t* c32;
+    // GEMM_U8S8U8 output and requantization parameters
+    uint8_t* c8;
+    const int32_t* bias;
+    const float* scale;
+    int per_channel;
+    int c_zero;
+    int ldc;
+};
+
+// Pack rows [i0, i0 + mc) and k pairs [p0, p0 + kcp) of op(A) - a_zero
+void pack_a(bool nota, const uint8_t* a, int lda, int a_zero, int k,
+            int i0, int mc, int p0, int kcp, int16_t* pa) {
+    for (int ir = 0; ir < mc; ir += MR) {
+        for (int p = 0; p < kcp; p++) {
+            int l = 2 * (p0 + p);
+            for (int r = 0; r < MR; r++) {
+                int16_t v0 = 0;
+                int16_t v1 = 0;
+                if (ir + r < mc) {
+                    int i = i0 + ir + r;
+                    if (nota) {
+                        v0 = static_cast<int16_t>(a[i + l * lda] - a_zero);
+                        if (l + 1 < k) v1 = static_cast<int16_t>(a[i + (l + 1) * lda] - a_zero);
+                    } else {
+                        v0 = static_cast<int16_t>(a[l + i * lda] - a_zero);
+                        if (l + 1 < k) v1 = static_cast<int16_t>(a[l + 1 + i * lda] - a_zero);
+                    }
+                }
+                *pa++ = v0;
+                *pa++ = v1;
+            }
+        }
+    }
+}
+
+// Pack columns [j0, j0 + nc) and all k pairs of op(B) - b_zero
+void pack_b(bool notb, const int8_t* b, int ldb, int b_zero, int k, int kp,
+            int j0, int nc, int32_t* pb) {
+    for (int jr = 0; jr < nc; jr += NR) {
+        for (int p = 0; p < kp; p++) {
+            int l = 2 * p;
+            for (int c = 0; c < NR; c++) {
+                int16_t v0 = 0;
+                int16_t v1 = 0;
+                if (jr + c < nc) {
+                    int j = j0 + jr + c;
+                    if (notb) {
+                        v0 = static_cast<int16_t>(b[l + j * ldb] - b_zero);
+                        if (l + 1 < k) v1 = static_cast<int16_t>(b[l + 1 + j * ldb] - b_zero);
+                    } else {
+                        v0 = static_cast<int16_t>(b[j + l * ldb] - b_zero);
+                        if (l + 1 < k) v1 = static_cast<int16_t>(b[j + (l + 1) * ldb] - b_zero);
+                    }
+                }
+                *pb++ = static_cast<int32_t>(static_cast<uint16_t>(v0) |
+                                             (static_cast<uint32_t>(static_cast<uint16_t>(v1)) << 16));
+            }
+        }
+    }
+}
+
+// ct[0:MR, 0:NR] += packed A panel * packed B panel over kcp pairs
+void kernel_4x4(int kcp, const int16_t* pa, const int32_t* pb, int32_t* ct, int ldt) {
+#ifdef __wasm_simd128__
+    v128_t c0 = wasm_i32x4_splat(0);
+    v128_t c1 = wasm_i32x4_splat(0);
+    v128_t c2 = wasm_i32x4_splat(0);
+    v128_t c3 = wasm_i32x4_splat(0);
+    for (int p = 0; p < kcp; p++) {
+        v128_t av = wasm_v128_load(pa + 8 * p);
+        v128_t bv = wasm_v128_load(pb + 4 * p);
+        c0 = wasm_i32x4_add(c0, wasm_i32x4_dot_i16x8(av, wasm_i32x4_shuffle(bv, bv, 0, 0, 0, 0)));
+        c1 = wasm_i32x4_add(c1, wasm_i32x4_dot_i16x8(av, wasm_i32x4_shuffle(bv, bv, 1, 1, 1, 1)));
+        c2 = wasm_i32x4_add(c2, wasm_i32x4_dot_i16x8(av, wasm_i32x4_shuffle(bv, bv, 2, 2, 2, 2)));
+        c3 = wasm_i32x4_add(c3, wasm_i32x4_dot_i16x8(av, wasm_i32x4_shuffle(bv, bv, 3, 3, 3, 3)));
+    }
+    wasm_v128_store(ct, wasm_i32x4_add(wasm_v128_load(ct), c0));
+    wasm_v128_store(ct + ldt, wasm_i32x4_add(wasm_v128_load(ct + ldt), c1));
+    wasm_v128_store(ct + 2 * ldt, wasm_i32x4_add(wasm_v128_load(ct + 2 * ldt), c2));
+    wasm_v128_store(ct + 3 * ldt, wasm_i32x4_add(wasm_v128_load(ct + 3 * ldt), c3));
+#else
+    int32_t acc[MR * NR] = {0};
+    for (int p = 0; p < kcp; p++) {
+        const int16_t* ap = pa + 8 * p;
+        const int32_t* bp = pb + 4 * p;
+        for (int c = 0; c < NR; c++) {
+            uint32_t w = static_cast<uint32_t>(bp[c]);
+            int32_t b0 = static_cast<int16_t>(w & 0xFFFF);
+            int32_t b1 = static_cast<int16_t>(w >> 16);
+            for (int r = 0; r < MR; r++) {
+                acc[r + c * MR] += ap[2 * r] * b0 + ap[2 * r + 1] * b1;
+            }
+        }
+    }
+    for (int c = 0; c < NR; c++) {
+        for (int r = 0; r < MR; r++) {
+            ct[r + c * ldt] += acc[r + c * MR];
+        }
+    }
+#endif
+}
+
+// Write the finished mc x nc tile at (i0, j0) of C
+void store_tile(const Epilogue& ep, const int32_t* ct, int ldt, int i0, int mc, int j0, int nc) {
+    if (ep.c32) {
+        for (int jj = 0; jj < nc; jj++) {
+            int32_t* cj = ep.c32 + i0 + (j0 + jj) * ep.ldc;
+            for (int ii = 0; ii < mc; ii++) {
+                cj[ii] = ct[ii + jj * ldt];
+            }
+        }
+        return;
+    }
+    for (int jj = 0; jj < nc; jj++) {
+        int j = j0 + jj;
+        int32_t bj = ep.bias ? ep.bias[j] : 0;
+        float sj = ep.per_channel ? ep.scale[j] : ep.scale[0];
+        uint8_t* cj = ep.c8 + i0 + j * ep.ldc;
+        for (int ii = 0; ii < mc; ii++) {
+            long q = std::lrint(static_cast<float>(ct[ii + jj * ldt] + bj) * sj) + ep.c_zero;
+            cj[ii] = static_cast<uint8_t>(std::min(255L, std::max(0L, q)));
+        }
+    }
+}
+
+void gemm_u8s8(char transa, char transb, int m, int n, int k,
+               const uint8_t* a, int lda, int a_zero,
+               const int8_t* b, int ldb, int b_zero, const Epilogue& ep) {
+    if (m <= 0 || n <= 0) return;
+
+    bool nota = (transa == 'N' || transa == 'n');
+    bool notb = (transb == 'N' || transb == 'n');
+    int kp = (std::max(k, 0) + 1) / 2;
+
+    std::vector<int16_t> pa(static_cast<size_t>(MC) * KCP * 2);
+    std::vector<int32_t> pb(static_cast<size_t>(NC) * std::max(kp, 1));
+    std::vector<int32_t> ct(static_cast<size_t>(MC) * NC);
+
+    for (int j0 = 0; j0 < n; j0 += NC) {
+        int nc = std::min(NC, n - j0);
+        pack_b(notb, b, ldb, b_zero, k, kp, j0, nc, pb.data());
+
+        for (int i0 = 0; i0 < m; i0 += MC) {
+            int mc = std::min(MC, m - i0);
+            std::fill(ct.begin(), ct.end(), 0);
+
+            for (int p0 = 0; p0 < kp; p0 += KCP) {
+                int kcp = std::min(KCP, kp - p0);
+                pack_a(nota, a, lda, a_zero, k, i0, mc, p0, kcp, pa.data());
+
+                for (int jr = 0; jr < nc; jr += NR) {
+                    const int32_t* pbj = pb.data() + static_cast<size_t>(jr) * kp + p0 * NR;
+                    for (int ir = 0; ir < mc; ir += MR) {
+                        kernel_4x4(kcp, pa.data() + ir * kcp * 2, pbj, ct.data() + ir + jr * MC, MC);
+                    }
+                }
+            }
+
+            store_tile(ep, ct.data(), MC, i0, mc, j0, nc);
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void gemm_u8s8s32(char transa, char transb, int m, int n, int k,
+                  const uint8_t* a, int lda, int a_zero,
+                  const int8_t* b, int ldb, int b_zero,
+                  int32_t* c, int ldc) {
+    BLAS_CHECK("GEMM_U8S8S32", check::trans(transa), 1);
+    BLAS_CHECK("GEMM_U8S8S32", check::trans(transb), 2);
+    BLAS_CHECK("GEMM_U8S8S32", m >= 0, 3);
+    BLAS_CHECK("GEMM_U8S8S32", n >= 0, 4);
+    BLAS_CHECK("GEMM_U8S8S32", k >= 0, 5);
+    BLAS_CHECK("GEMM_U8S8S32", lda >= check::max1(check::notrans(transa) ? m : k), 7);
+    BLAS_CHECK("GEMM_U8S8S32", ldb >= check::max1(check::notrans(transb) ? k : n), 10);
+    BLAS_CHECK("GEMM_U8S8S32", ldc >= check::max1(m), 13);
+
+    Epilogue ep = {c, nullptr, nullptr, nullptr, 0, 0, ldc};
+    gemm_u8s8(transa, transb, m, n, k, a, lda, a_zero, b, ldb, b_zero, ep);
+}
+
+void gemm_u8s8u8(char transa, char transb, int m, int n, int k,
+                 const uint8_t* a, int lda, int a_zero,
+                 const int8_t* b, int ldb, int b_zero,
+                 const int32_t* bias, const float* scale, int per_channel, int c_zero,
+                 uint8_t* c, int ldc) {
+    BLAS_CHECK("GEMM_U8S8U8", check::trans(transa), 1);
+    BLAS_CHECK("GEMM_U8S8U8", check::trans(transb), 2);
+    BLAS_CHECK("GEMM_U8S8U8", m >= 0, 3);
+    BLAS_CHECK("GEMM_U8S8U8", n >= 0, 4);
+    BLAS_CHECK("GEMM_U8S8U8", k >= 0, 5);
+    BLAS_CHECK("GEMM_U8S8U8", lda >= check::max1(check::notrans(transa) ? m : k), 7);
+    BLAS_CHECK("GEMM_U8S8U8", ldb >= check::max1(check::notrans(transb) ? k : n), 10);
+    BLAS_CHECK("GEMM_U8S8U8", ldc >= check::max1(m), 17);
+
+    Epilogue ep = {nullptr, c, bias, scale, per_channel, c_zero, ldc};
+    gemm_u8s8(transa, transb, m, n, k, a, lda, a_zero, b, ldb, b_zero, ep);
+}
+
+} // extern "C"
@@ -0,0 +1,157 @@
+#ifndef HALF_H
+#define HALF_H
+
+/**
+ * 16-bit floating point storage formats
+ *
+ * BF16 - bfloat16: the upper half of an IEEE single (8-bit exponent, 7-bit mantissa)
+ * F16  - IEEE 754 binary16 (5-bit exponent, 10-bit mantissa)
+ *
+ * Each format provides scalar conversions to and from float (round to nearest
+ * even, NaN preserved) and, with WebAssembly SIMD, conversion of four values
+ * at a time held in the low 16 bits of the u32 lanes of a vector. Kernels are
+ * templated on the format so bf16 and fp16 share one implementation.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+namespace half {
+
+inline uint32_t bits(float f) {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+inline float from_bits(uint32_t u) {
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+struct BF16 {
+    static float to_float(uint16_t h) {
+        return from_bits(static_cast<uint32_t>(h) << 16);
+    }
+
+    static uint16_t from_float(float f) {
+        uint32_t u = bits(f);
+        if ((u & 0x7FFFFFFFu) > 0x7F800000u) {
+            return static_cast<uint16_t>((u >> 16) | 0x0040u);  // quiet NaN
+        }
+        u += 0x7FFFu + ((u >> 16) & 1u);
+        return static_cast<uint16_t>(u >> 16);
+    }
+
+#ifdef __wasm_simd128__
+    static v128_t to_f32x4(v128_t h) {
+        return wasm_i32x4_shl(h, 16);
+    }
+
+    static v128_t from_f32x4(v128_t f) {
+        v128_t nan = wasm_u32x4_gt(wasm_v128_and(f, wasm_i32x4_splat(0x7FFFFFFF)),
+                                   wasm_i32x4_splat(0x7F800000));
+        v128_t lsb = wasm_v128_and(wasm_u32x4_shr(f, 16), wasm_i32x4_splat(1));
+        v128_t r = wasm_i32x4_add(f, wasm_i32x4_add(wasm_i32x4_splat(0x7FFF), lsb));
+        v128_t q = wasm_v128_or(f, wasm_i32x4_splat(0x00400000));
+        return wasm_u32x4_shr(wasm_v128_bitselect(q, r, nan), 16);
+    }
+#endif
+};
+
+struct F16 {
+    static float to_float(uint16_t h) {
+        uint32_t o = static_cast<uint32_t>(h & 0x7FFFu) << 13;
+        uint32_t exp = o & (0x7C00u << 13);
+        o += (127u - 15u) << 23;
+        if (exp == (0x7C00u << 13)) {
+            o += (128u - 16u) << 23;  // Inf/NaN
+        } else if (exp == 0) {
+            o = bits(from_bits(o + (1u << 23)) - from_bits(113u << 23));  // zero/subnormal
+        }
+        return from_bits(o | (static_cast<uint32_t>(h & 0x8000u) << 16));
+    }
+
+    static uint16_t from_float(float f) {
+        const uint32_t f32inf = 255u << 23;
+        const uint32_t f16max = (127u + 16u) << 23;
+        const uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t u = bits(f);
+        uint32_t sign = u & 0x80000000u;
+        u ^= sign;
+
+        uint32_t o;
+        if (u >= f16max) {
+            o = (u > f32inf) ? 0x7E00u : 0x7C00u;  // NaN or overflow to Inf
+        } else if (u < (113u << 23)) {
+            o = bits(from_bits(u) + from_bits(denorm_magic)) - denorm_magic;  // subnormal
+        } else {
+            uint32_t mant_odd = (u >> 13) & 1u;
+            u += ((15u - 127u) << 23) + 0xFFFu + mant_odd;
+            o = u >> 13;
+        }
+        return static_cast<uint16_t>(o | (sign >> 16));
+    }
+
+#ifdef __wasm_simd128__
+    static v128_t to_f32x4(v128_t h) {
+        const v128_t shifted_exp = wasm_i32x4_splat(0x7C00 << 13);
+        v128_t o = wasm_i32x4_shl(wasm_v128_and(h, wasm_i32x4_splat(0x7FFF)), 13);
+        v128_t exp = wasm_v128_and(o, shifted_exp);
+        o = wasm_i32x4_add(o, wasm_i32x4_splat((127 - 15) << 23));
+        v128_t inf = wasm_i32x4_eq(exp, shifted_exp);
+        o = wasm_i32x4_add(o, wasm_v128_and(inf, wasm_i32x4_splat((128 - 16) << 23)));
+        v128_t den = wasm_i32x4_eq(exp, wasm_i32x4_splat(0));
+        v128_t od = wasm_f32x4_sub(wasm_i32x4_add(o, wasm_i32x4_splat(1 << 23)),
+                                   wasm_i32x4_splat(113 << 23));
+        o = wasm_v128_bitselect(od, o, den);
+        return wasm_v128_or(o, wasm_i32x4_shl(wasm_v128_and(h, wasm_i32x4_splat(0x8000)), 16));
+    }
+
+    static v128_t from_f32x4(v128_t f) {
+        const v128_t denorm_magic = wasm_i32x4_splat(((127 - 15) + (23 - 10) + 1) << 23);
+        v128_t sign = wasm_v128_and(f, wasm_i32x4_splat(static_cast<int32_t>(0x80000000u)));
+        v128_t u = wasm_v128_xor(f, sign);
+
+        v128_t big = wasm_i32x4_ge(u, wasm_i32x4_splat((127 + 16) << 23));
+        v128_t nan = wasm_i32x4_gt(u, wasm_i32x4_splat(255 << 23));
+        v128_t o_big = wasm_v128_bitselect(wasm_i32x4_splat(0x7E00), wasm_i32x4_splat(0x7C00), nan);
+
+        v128_t small = wasm_i32x4_lt(u, wasm_i32x4_splat(113 << 23));
+        v128_t o_den = wasm_i32x4_sub(wasm_f32x4_add(u, denorm_magic), denorm_magic);
+
+        v128_t mant_odd = wasm_v128_and(wasm_u32x4_shr(u, 13), wasm_i32x4_splat(1));
+        v128_t o_nrm = wasm_i32x4_add(u, wasm_i32x4_splat(static_cast<int32_t>((15u - 127u) << 23) + 0xFFF));
+        o_nrm = wasm_u32x4_shr(wasm_i32x4_add(o_nrm, mant_odd), 13);
+
+        v128_t o = wasm_v128_bitselect(o_big, wasm_v128_bitselect(o_den, o_nrm, small), big);
+        return wasm_v128_or(o, wasm_u32x4_shr(sign, 16));
+    }
+#endif
+};
+
+#ifdef __wasm_simd128__
+// Convert 8 consecutive 16-bit values to two f32x4 vectors
+template <typename Fmt>
+inline void load8(const uint16_t* p, v128_t& lo, v128_t& hi) {
+    v128_t h = wasm_v128_load(p);
+    lo = Fmt::to_f32x4(wasm_u32x4_extend_low_u16x8(h));
+    hi = Fmt::to_f32x4(wasm_u32x4_extend_high_u16x8(h));
+}
+
+// Convert two f32x4 vectors to 8 consecutive 16-bit values
+template <typename Fmt>
+inline void store8(uint16_t* p, v128_t lo, v128_t hi) {
+    wasm_v128_store(p, wasm_u16x8_narrow_i32x4(Fmt::from_f32x4(lo), Fmt::from_f32x4(hi)));
+}
+#endif
+
+} // namespace half
+
+#endif // HALF_H
@@ -0,0 +1,187 @@
+/**
+ * Conversions between 16-bit storage formats and float/double
+ *
+ * SBSTOBF16 - float  -> bfloat16     SBF16TOS - bfloat16 -> float
+ * SBDTOBF16 - double -> bfloat16     DBF16TOD - bfloat16 -> double
+ * SHSTOF16  - float  -> fp16         SHF16TOS - fp16     -> float
+ * SHDTOF16  - double -> fp16         DF16TOD  - fp16     -> double
+ *
+ * Narrowing conversions round to nearest even, overflow to +-Inf and keep NaNs
+ * quiet. Widening conversions are exact. Conversions from double go through
+ * float (double rounding only matters for values within 2^-24 relative of a
+ * 16-bit rounding boundary).
+ *
+ * Naming and argument order follow the OpenBLAS bfloat16 extensions.
+ *
+ * @param n       Number of elements to convert
+ * @param in      Input vector
+ * @param incin   Storage spacing between elements of in
+ * @param out     Output vector
+ * @param incout  Storage spacing between elements of out
+ */
+
+#include <cstdint>
+
+#include "half.h"
+
+namespace {
+
+template <typename Fmt>
+void to_half(int n, const float* in, int incin, uint16_t* out, int incout) {
+    if (n <= 0) return;
+
+    if (incin == 1 && incout == 1) {
+        int i = 0;
+#ifdef __wasm_simd128__
+        for (; i + 8 <= n; i += 8) {
+            half::store8<Fmt>(out + i, wasm_v128_load(in + i), wasm_v128_load(in + i + 4));
+        }
+#endif
+        for (; i < n; i++) {
+            out[i] = Fmt::from_float(in[i]);
+        }
+    } else {
+        int ix = 0;
+        int iy = 0;
+        if (incin < 0) ix = (-n + 1) * incin;
+        if (incout < 0) iy = (-n + 1) * incout;
+        for (int i = 0; i < n; i++) {
+            out[iy] = Fmt::from_float(in[ix]);
+            ix += incin;
+            iy += incout;
+        }
+    }
+}
+
+template <typename Fmt>
+void to_half(int n, const double* in, int incin, uint16_t* out, int incout) {
+    if (n <= 0) return;
+
+    if (incin == 1 && incout == 1) {
+        int i = 0;
+#ifdef __wasm_simd128__
+        for (; i + 8 <= n; i += 8) {
+            v128_t lo = wasm_i32x4_shuffle(wasm_f32x4_demote_f64x2_zero(wasm_v128_load(in + i)),
+                                           wasm_f32x4_demote_f64x2_zero(wasm_v128_load(in + i + 2)),
+                                           0, 1, 4, 5);
+            v128_t hi = wasm_i32x4_shuffle(wasm_f32x4_demote_f64x2_zero(wasm_v128_load(in + i + 4)),
+                                           wasm_f32x4_demote_f64x2_zero(wasm_v128_load(in + i + 6)),
+                                           0, 1, 4, 5);
+            half::store8<Fmt>(out + i, lo, hi);
+        }
+#endif
+        for (; i < n; i++) {
+            out[i] = Fmt::from_float(static_cast<float>(in[i]));
+        }
+    } else {
+        int ix = 0;
+        int iy = 0;
+        if (incin < 0) ix = (-n + 1) * incin;
+        if (incout < 0) iy = (-n + 1) * incout;
+        for (int i = 0; i < n; i++) {
+            out[iy] = Fmt::from_float(static_cast<float>(in[ix]));
+            ix += incin;
+            iy += incout;
+        }
+    }
+}
+
+template <typename Fmt>
+void from_half(int n, const uint16_t* in, int incin, float* out, int incout) {
+    if (n <= 0) return;
+
+    if (incin == 1 && incout == 1) {
+        int i = 0;
+#ifdef __wasm_simd128__
+        for (; i + 8 <= n; i += 8) {
+            v128_t lo, hi;
+            half::load8<Fmt>(in + i, lo, hi);
+            wasm_v128_store(out + i, lo);
+            wasm_v128_store(out + i + 4, hi);
+        }
+#endif
+        for (; i < n; i++) {
+            out[i] = Fmt::to_float(in[i]);
+        }
+    } else {
+        int ix = 0;
+        int iy = 0;
+        if (incin < 0) ix = (-n + 1) * incin;
+        if (incout < 0) iy = (-n + 1) * incout;
+        for (int i = 0; i < n; i++) {
+            out[iy] = Fmt::to_float(in[ix]);
+            ix += incin;
+            iy += incout;
+        }
+    }
+}
+
+template <typename Fmt>
+void from_half(int n, const uint16_t* in, int incin, double* out, int incout) {
+    if (n <= 0) return;
+
+    if (incin == 1 && incout == 1) {
+        int i = 0;
+#ifdef __wasm_simd128__
+        for (; i + 8 <= n; i += 8) {
+            v128_t lo, hi;
+            half::load8<Fmt>(in + i, lo, hi);
+            wasm_v128_store(out + i, wasm_f64x2_promote_low_f32x4(lo));
+            wasm_v128_store(out + i + 2, wasm_f64x2_promote_low_f32x4(wasm_i32x4_shuffle(lo, lo, 2, 3, 2, 3)));
+            wasm_v128_store(out + i + 4, wasm_f64x2_promote_low_f32x4(hi));
+            wasm_v128_store(out + i + 6, wasm_f64x2_promote_low_f32x4(wasm_i32x4_shuffle(hi, hi, 2, 3, 2, 3)));
+        }
+#endif
+        for (; i < n; i++) {
+            out[i] = Fmt::to_float(in[i]);
+        }
+    } else {
+        int ix = 0;
+        int iy = 0;
+        if (incin < 0) ix = (-n + 1) * incin;
+        if (incout < 0) iy = (-n + 1) * incout;
+        for (int i = 0; i < n; i++) {
+            out[iy] = Fmt::to_float(in[ix]);
+            ix += incin;
+            iy += incout;
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void sbstobf16(int n, const float* in, int incin, uint16_t* out, int incout) {
+    to_half<half::BF16>(n, in, incin, out, incout);
+}
+
+void sbdtobf16(int n, const double* in, int incin, uint16_t* out, int incout) {
+    to_half<half::BF16>(n, in, incin, out, incout);
+}
+
+void sbf16tos(int n, const uint16_t* in, int incin, float* out, int incout) {
+    from_half<half::BF16>(n, in, incin, out, incout);
+}
+
+void dbf16tod(int n, const uint16_t* in, int incin, double* out, int incout) {
+    from_half<half::BF16>(n, in, incin, out, incout);
+}
+
+void shstof16(int n, const float* in, int incin, uint16_t* out, int incout) {
+    to_half<half::F16>(n, in, incin, out, incout);
+}
+
+void shdtof16(int n, const double* in, int incin, uint16_t* out, int incout) {
+    to_half<half::F16>(n, in, incin, out, incout);
+}
+
+void shf16tos(int n, const uint16_t* in, int incin, float* out, int incout) {
+    from_half<half::F16>(n, in, incin, out, incout);
+}
+
+void df16tod(int n, const uint16_t* in, int incin, double* out, int incout) {
+    from_half<half::F16>(n, in, incin, out, incout);
+}
+
+} // extern "C"
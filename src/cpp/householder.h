@@ -0,0 +1,137 @@
+#ifndef HOUSEHOLDER_H
+#define HOUSEHOLDER_H
+
+/**
+ * Householder reflectors shared by the QR factorization and its applications
+ *
+ * These are the LAPACK auxiliary routines DLARFG (generate a reflector),
+ * DLARFT (form the triangular factor T of a block of reflectors) and DLARFB
+ * (apply the block reflector H = I - V * T * V^T), for forward, columnwise
+ * storage only: V is unit lower trapezoidal and its unit diagonal is never
+ * read, so V can be the factored matrix itself, with R on its diagonal.
+ * The block updates are DTRMM and DGEMM calls.
+ */
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+#include "blas.h"
+
+namespace householder {
+
+// Generate H = I - tau * v * v^T with H * [alpha; x] = [beta; 0] and
+// v = [1; x / (alpha - beta)]; alpha is overwritten by beta and x by v(1:)
+inline void larfg(int n, double& alpha, double* x, int incx, double& tau) {
+    tau = 0.0;
+    if (n <= 1) return;
+
+    double xnorm = dnrm2(n - 1, x, incx);
+    if (xnorm == 0.0) return;
+
+    double beta = -std::copysign(std::hypot(alpha, xnorm), alpha);
+    const double safmin = DBL_MIN / DBL_EPSILON;
+    int knt = 0;
+    if (std::abs(beta) < safmin) {
+        // xnorm and beta may be inaccurate; scale x and recompute them
+        const double rsafmn = 1.0 / safmin;
+        do {
+            knt++;
+            dscal(n - 1, rsafmn, x, incx);
+            beta *= rsafmn;
+            alpha *= rsafmn;
+        } while (std::abs(beta) < safmin && knt < 20);
+        xnorm = dnrm2(n - 1, x, incx);
+        beta = -std::copysign(std::hypot(alpha, xnorm), alpha);
+    }
+    tau = (beta - alpha) / beta;
+    dscal(n - 1, 1.0 / (alpha - beta), x, incx);
+    for (int j = 0; j < knt; j++) beta *= safmin;
+    alpha = beta;
+}
+
+// The k x k upper triangular factor T (leading dimension ldt) of the block
+// reflector H = H(0) * ... * H(k-1) whose vectors are the columns of the
+// m x k matrix v
+inline void larft(int m, int k, const double* v, int ldv, const double* tau, double* t,
+                  int ldt) {
+    auto vt = [&](int i, int j) { return v + i + static_cast<size_t>(j) * ldv; };
+    auto tt = [&](int i, int j) { return t + i + static_cast<size_t>(j) * ldt; };
+
+    for (int i = 0; i < k; i++) {
+        if (tau[i] == 0.0) {
+            for (int j = 0; j <= i; j++) *tt(j, i) = 0.0;
+            continue;
+        }
+
+        // T(0:i-1, i) = -tau(i) * V(i:m-1, 0:i-1)^T * V(i:m-1, i), with V(i, i) = 1
+        for (int j = 0; j < i; j++) *tt(j, i) = -tau[i] * *vt(i, j);
+        dgemv(1, m - i - 1, i, -tau[i], vt(i + 1, 0), ldv, vt(i + 1, i), 1, 1.0, tt(0, i), 1);
+
+        // T(0:i-1, i) = T(0:i-1, 0:i-1) * T(0:i-1, i)
+        dtrmv('U', 'N', 'N', i, t, ldt, tt(0, i), 1);
+        *tt(i, i) = tau[i];
+    }
+}
+
+// Apply H ('N') or H^T ('T') from the left ('L') or the right ('R') to the
+// m x n matrix c, where H = I - V * T * V^T and V is the first k columns of
+// v (m rows on the left, n on the right); work holds n x k ('L') or m x k
+// ('R') elements
+inline void larfb(char side, char trans, int m, int n, int k, const double* v, int ldv,
+                  const double* t, int ldt, double* c, int ldc, double* work) {
+    if (m <= 0 || n <= 0) return;
+
+    auto vt = [&](int i, int j) { return v + i + static_cast<size_t>(j) * ldv; };
+    auto ct = [&](int i, int j) { return c + i + static_cast<size_t>(j) * ldc; };
+
+    if (side == 'L') {
+        // W = C^T * V = C1^T * V1 + C2^T * V2 (n x k, leading dimension n)
+        double* w = work;
+        for (int j = 0; j < k; j++) {
+            for (int i = 0; i < n; i++) w[i + static_cast<size_t>(j) * n] = *ct(j, i);
+        }
+        dtrmm('R', 'L', 'N', 'U', n, k, 1.0, v, ldv, w, n);
+        if (m > k) {
+            dgemm('T', 'N', n, k, m - k, 1.0, ct(k, 0), ldc, vt(k, 0), ldv, 1.0, w, n);
+        }
+
+        // W = W * T^T (for H) or W * T (for H^T)
+        dtrmm('R', 'U', trans == 'N' ? 'T' : 'N', 'N', n, k, 1.0, t, ldt, w, n);
+
+        // C = C - V * W^T
+        if (m > k) {
+            dgemm('N', 'T', m - k, n, k, -1.0, vt(k, 0), ldv, w, n, 1.0, ct(k, 0), ldc);
+        }
+        dtrmm('R', 'L', 'T', 'U', n, k, 1.0, v, ldv, w, n);
+        for (int j = 0; j < k; j++) {
+            for (int i = 0; i < n; i++) *ct(j, i) -= w[i + static_cast<size_t>(j) * n];
+        }
+    } else {
+        // W = C * V = C1 * V1 + C2 * V2 (m x k, leading dimension m)
+        double* w = work;
+        for (int j = 0; j < k; j++) {
+            for (int i = 0; i < m; i++) w[i + static_cast<size_t>(j) * m] = *ct(i, j);
+        }
+        dtrmm('R', 'L', 'N', 'U', m, k, 1.0, v, ldv, w, m);
+        if (n > k) {
+            dgemm('N', 'N', m, k, n - k, 1.0, ct(0, k), ldc, vt(k, 0), ldv, 1.0, w, m);
+        }
+
+        // W = W * T (for H) or W * T^T (for H^T)
+        dtrmm('R', 'U', trans == 'N' ? 'N' : 'T', 'N', m, k, 1.0, t, ldt, w, m);
+
+        // C = C - W * V^T
+        if (n > k) {
+            dgemm('N', 'T', m, n - k, k, -1.0, w, m, vt(k, 0), ldv, 1.0, ct(0, k), ldc);
+        }
+        dtrmm('R', 'L', 'T', 'U', m, k, 1.0, v, ldv, w, m);
+        for (int j = 0; j < k; j++) {
+            for (int i = 0; i < m; i++) *ct(i, j) -= w[i + static_cast<size_t>(j) * m];
+        }
+    }
+}
+
+} // namespace householder
+
+#endif // HOUSEHOLDER_H
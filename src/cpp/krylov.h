@@ -0,0 +1,134 @@
+#ifndef KRYLOV_H
+#define KRYLOV_H
+
+/**
+ * Operators and vector kernels shared by the eigen drivers
+ *
+ * An Operator describes the n x n matrix A of DPOWER and DLANCZOS by its
+ * storage: dense ('D', DGEMV on the full matrix), symmetric band ('B',
+ * DSBMV), symmetric packed ('P', DSPMV) or sparse ('S', compressed sparse
+ * rows with zero-based indices). The drivers only ever compute y = A * x.
+ *
+ * The fused kernels combine an update of a vector with a reduction of the
+ * result. They work through the vector in chunks small enough to stay in
+ * the L1 cache between the two passes, so each one reads and writes the
+ * vector from memory once; the passes themselves are the SIMD daxpy,
+ * daxpby, ddot and Blue's sum of squares.
+ */
+
+#include <algorithm>
+#include <cstddef>
+
+#include "blas.h"
+#include "blue.h"
+
+namespace krylov {
+
+struct Operator {
+    char kind;       // 'D', 'B', 'P' or 'S'
+    bool upper;      // Triangle stored for 'B' and 'P'
+    int n;           // Order of A
+    int k;           // Number of super- or subdiagonals for 'B'
+    const double* a; // The matrix, band, packed triangle or nonzero values
+    int lda;         // Leading dimension for 'D' and 'B'
+    const int* ia;   // Row pointers (n + 1) for 'S'
+    const int* ja;   // Column indices for 'S'
+};
+
+// Smallest legal leading dimension of the storage
+inline int min_lda(char kind, int n, int k) {
+    if (kind == 'D' || kind == 'd') return n > 1 ? n : 1;
+    if (kind == 'B' || kind == 'b') return k + 1;
+    return 1;
+}
+
+// y = A * x
+inline void apply(const Operator& op, const double* x, double* y) {
+    switch (op.kind) {
+    case 'D':
+    case 'd':
+        dgemv(0, op.n, op.n, 1.0, op.a, op.lda, x, 1, 0.0, y, 1);
+        break;
+    case 'B':
+    case 'b':
+        dsbmv(op.upper ? 0 : 1, op.n, op.k, 1.0, op.a, op.lda, x, 1, 0.0, y, 1);
+        break;
+    case 'P':
+    case 'p':
+        dspmv(op.upper ? 0 : 1, op.n, 1.0, op.a, x, 1, 0.0, y, 1);
+        break;
+    default:
+        for (int i = 0; i < op.n; i++) {
+            double sum = 0.0;
+            for (int p = op.ia[i]; p < op.ia[i + 1]; p++) sum += op.a[p] * x[op.ja[p]];
+            y[i] = sum;
+        }
+        break;
+    }
+}
+
+// Elements per chunk of the fused kernels (4 KiB)
+constexpr int CHUNK = 512;
+
+// Returns x . y and sets ynorm = ||y||
+inline double dot_nrm2(int n, const double* x, const double* y, double& ynorm) {
+    double dot = 0.0;
+    blue::Accumulator acc;
+    for (int i = 0; i < n; i += CHUNK) {
+        int len = std::min(CHUNK, n - i);
+        dot += ddot(len, x + i, 1, y + i, 1);
+        acc.add(y + i, len);
+    }
+    ynorm = acc.norm();
+    return dot;
+}
+
+// y = y + alpha * x; returns y . z
+inline double axpy_dot(int n, double alpha, const double* x, double* y, const double* z) {
+    double dot = 0.0;
+    for (int i = 0; i < n; i += CHUNK) {
+        int len = std::min(CHUNK, n - i);
+        daxpy(len, alpha, x + i, 1, y + i, 1);
+        dot += ddot(len, y + i, 1, z + i, 1);
+    }
+    return dot;
+}
+
+// y = alpha * x + beta * y; returns ||y||
+inline double axpby_nrm2(int n, double alpha, const double* x, double beta, double* y) {
+    blue::Accumulator acc;
+    for (int i = 0; i < n; i += CHUNK) {
+        int len = std::min(CHUNK, n - i);
+        daxpby(len, alpha, x + i, 1, beta, y + i, 1);
+        acc.add(y + i, len);
+    }
+    return acc.norm();
+}
+
+// Orthogonalize w against the j orthonormal columns of v (n x j, leading
+// dimension ldv) by classical Gram-Schmidt, h = V^T * w and w = w - V * h,
+// repeated once if ||w|| dropped below wnorm / sqrt(2) (the DGKS criterion);
+// h holds j elements of workspace. Returns the new ||w||
+inline double reorthogonalize(int n, int j, const double* v, int ldv, double* w, double* h,
+                              double wnorm) {
+    for (int pass = 0; pass < 2 && j > 0; pass++) {
+        dgemv(1, n, j, 1.0, v, ldv, w, 1, 0.0, h, 1);
+
+        // w = w - V * h and its norm, one row chunk at a time
+        blue::Accumulator acc;
+        for (int i = 0; i < n; i += CHUNK) {
+            int len = std::min(CHUNK, n - i);
+            dgemv(0, len, j, -1.0, v + i, ldv, h, 1, 1.0, w + i, 1);
+            acc.add(w + i, len);
+        }
+        double norm = acc.norm();
+        bool done = norm > 0.7071067811865476 * wnorm;
+        wnorm = norm;
+        if (done) break;
+    }
+    return wnorm;
+}
+
+} // namespace krylov
+
+#endif // KRYLOV_H
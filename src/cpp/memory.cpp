@@ -0,0 +1,24 @@
+/**
+ * Cache-line aligned allocation in the module's heap
+ *
+ * malloc() returns 8- or 16-byte aligned blocks. Operands placed in blocks
+ * from malloc_aligned() start on a 64-byte cache line; with a leading
+ * dimension that is a multiple of 8 doubles every column does, so no 16-byte
+ * SIMD load straddles two lines. Blocks are released with free().
+ *
+ * @param bytes  Size of the block in bytes (rounded up to a whole cache line)
+ * @return       64-byte aligned block, or null if the heap cannot grow
+ */
+
+#include <cstddef>
+#include <cstdlib>
+
+extern "C" {
+
+void* malloc_aligned(size_t bytes) {
+    // aligned_alloc() wants a size that is a multiple of the alignment
+    size_t size = (bytes + 63) & ~static_cast<size_t>(63);
+    return std::aligned_alloc(64, size > 0 ? size : 64);
+}
+
+} // extern "C"
@@ -0,0 +1,284 @@
+/**
+ * Node-API bindings for the native backend
+ *
+ * Exposes every kernel in blas.h under its C name. Scalars are passed as JS
+ * numbers and arrays as typed arrays; the kernel works directly on the
+ * typed array's backing store, so nothing is copied in either direction.
+ * The wrapper for each kernel is generated from its C signature.
+ *
+ * The addon is built once per x86-64 micro-architecture level. The loader
+ * first opens the baseline build, asks cpuLevel() which levels the CPU
+ * supports and then switches to the most specific build that is present.
+ */
+
+#include <node_api.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../blas.h"
+#include "../parallel.h"
+
+#ifndef BLAS_NATIVE_ISA
+#define BLAS_NATIVE_ISA "generic"
+#endif
+
+namespace {
+
+struct ArgError : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+void check(napi_status status, const char* what) {
+    if (status != napi_ok) throw ArgError(what);
+}
+
+// Expected typed array element type for each pointer argument
+template <typename T> struct ArrayType;
+#define BLAS_ARRAY_TYPE(T, napi_type)                          \
+    template <> struct ArrayType<T> {                          \
+        static constexpr napi_typedarray_type value = napi_type; \
+    };
+BLAS_ARRAY_TYPE(double, napi_float64_array)
+BLAS_ARRAY_TYPE(float, napi_float32_array)
+BLAS_ARRAY_TYPE(int32_t, napi_int32_array)
+BLAS_ARRAY_TYPE(uint16_t, napi_uint16_array)
+BLAS_ARRAY_TYPE(int8_t, napi_int8_array)
+BLAS_ARRAY_TYPE(uint8_t, napi_uint8_array)
+#undef BLAS_ARRAY_TYPE
+
+// Convert one JS argument to the C parameter type
+template <typename T, typename Enable = void> struct Arg;
+
+template <typename T>
+struct Arg<T, std::enable_if_t<std::is_integral_v<T>>> {
+    static T get(napi_env env, napi_value v) {
+        int32_t r;
+        check(napi_get_value_int32(env, v, &r), "expected a number");
+        return static_cast<T>(r);
+    }
+};
+
+template <typename T>
+struct Arg<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+    static T get(napi_env env, napi_value v) {
+        double r;
+        check(napi_get_value_double(env, v, &r), "expected a number");
+        return static_cast<T>(r);
+    }
+};
+
+template <typename T>
+struct Arg<T*> {
+    using Elem = std::remove_const_t<T>;
+
+    static T* get(napi_env env, napi_value v) {
+        napi_valuetype kind;
+        check(napi_typeof(env, v, &kind), "expected a typed array");
+        if (kind == napi_null || kind == napi_undefined) return nullptr;
+
+        napi_typedarray_type type;
+        size_t length;
+        void* data;
+        check(napi_get_typedarray_info(env, v, &type, &length, &data, nullptr, nullptr),
+              "expected a typed array");
+        if (type != ArrayType<Elem>::value) {
+            throw ArgError("typed array has the wrong element type");
+        }
+        return static_cast<T*>(data);
+    }
+};
+
+template <typename R, typename... A, size_t... I>
+napi_value invoke(napi_env env, napi_value* argv, R (*fn)(A...), std::index_sequence<I...>) {
+    napi_value result;
+    if constexpr (std::is_void_v<R>) {
+        fn(Arg<A>::get(env, argv[I])...);
+        napi_get_undefined(env, &result);
+    } else {
+        napi_create_double(env, static_cast<double>(fn(Arg<A>::get(env, argv[I])...)), &result);
+    }
+    return result;
+}
+
+template <typename R, typename... A>
+napi_value call(napi_env env, napi_callback_info info, R (*fn)(A...)) {
+    constexpr size_t arity = sizeof...(A);
+    size_t argc = arity;
+    napi_value argv[arity];
+    try {
+        check(napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr), "invalid call");
+        if (argc < arity) {
+            throw ArgError("expected " + std::to_string(arity) + " arguments");
+        }
+        return invoke(env, argv, fn, std::index_sequence_for<A...>{});
+    } catch (const ArgError& e) {
+        napi_throw_type_error(env, nullptr, e.what());
+        return nullptr;
+    }
+}
+
+template <auto Fn>
+napi_value kernel(napi_env env, napi_callback_info info) {
+    return call(env, info, Fn);
+}
+
+// Highest x86-64 micro-architecture level (0 = baseline, 2, 3 or 4) of this CPU
+napi_value cpu_level(napi_env env, napi_callback_info) {
+    int level = 0;
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt") &&
+        __builtin_cpu_supports("ssse3")) {
+        level = 2;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+            __builtin_cpu_supports("bmi2")) {
+            level = 3;
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl") &&
+                __builtin_cpu_supports("avx512cd")) {
+                level = 4;
+            }
+        }
+    }
+#endif
+    napi_value result;
+    napi_create_int32(env, level, &result);
+    return result;
+}
+
+napi_value get_num_threads(napi_env env, napi_callback_info) {
+    napi_value result;
+    napi_create_int32(env, parallel::num_threads(), &result);
+    return result;
+}
+
+napi_value set_num_threads(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value argv[1];
+    int32_t n = 0;
+    napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    if (argc < 1 || napi_get_value_int32(env, argv[0], &n) != napi_ok) {
+        napi_throw_type_error(env, nullptr, "expected a number");
+        return nullptr;
+    }
+    parallel::set_num_threads(n);
+    return nullptr;
+}
+
+#define BLAS_METHOD(name, fn) \
+    { name, nullptr, fn, nullptr, nullptr, nullptr, napi_enumerable, nullptr }
+#define BLAS_KERNEL(name) BLAS_METHOD(#name, kernel<name>)
+
+napi_value init(napi_env env, napi_value exports) {
+    napi_value isa;
+    napi_create_string_utf8(env, BLAS_NATIVE_ISA, NAPI_AUTO_LENGTH, &isa);
+
+    napi_property_descriptor props[] = {
+        // Level 1 BLAS
+        BLAS_KERNEL(daxpy),
+        BLAS_KERNEL(daxpby),
+        BLAS_KERNEL(dcopy),
+        BLAS_KERNEL(ddot),
+        BLAS_KERNEL(dscal),
+        BLAS_KERNEL(dasum),
+        BLAS_KERNEL(dnrm2),
+        BLAS_KERNEL(dswap),
+        BLAS_KERNEL(drot),
+        BLAS_KERNEL(drotg),
+        BLAS_KERNEL(drotm),
+        BLAS_KERNEL(drotmg),
+        // Level 2 BLAS
+        BLAS_KERNEL(dgemv),
+        BLAS_KERNEL(dgbmv),
+        BLAS_KERNEL(dger),
+        BLAS_KERNEL(dsymv),
+        BLAS_KERNEL(dsbmv),
+        BLAS_KERNEL(dspmv),
+        BLAS_KERNEL(dsyr),
+        BLAS_KERNEL(dsyr2),
+        BLAS_KERNEL(dspr),
+        BLAS_KERNEL(dspr2),
+        BLAS_KERNEL(dtrmv),
+        BLAS_KERNEL(dtrsv),
+        BLAS_KERNEL(dtbmv),
+        BLAS_KERNEL(dtbsv),
+        BLAS_KERNEL(dtpmv),
+        BLAS_KERNEL(dtpsv),
+        // Batched Level 1 BLAS
+        BLAS_KERNEL(ddot_batch_strided),
+        BLAS_KERNEL(dnrm2_batch_strided),
+        BLAS_KERNEL(dasum_batch_strided),
+        BLAS_KERNEL(daxpy_batch_strided),
+        BLAS_KERNEL(dscal_batch_strided),
+        // Batched Level 2 BLAS
+        BLAS_KERNEL(dgemv_batch_strided),
+        BLAS_KERNEL(dsymv_batch_strided),
+        BLAS_KERNEL(dtrmv_batch_strided),
+        BLAS_KERNEL(dtrsv_batch_strided),
+        BLAS_KERNEL(dger_batch_strided),
+        // Level 3 BLAS
+        BLAS_KERNEL(dgemm),
+        BLAS_KERNEL(dgemmtr),
+        BLAS_KERNEL(dgemm_batch),
+        BLAS_KERNEL(dsymm),
+        BLAS_KERNEL(dsyrk),
+        BLAS_KERNEL(dsyr2k),
+        BLAS_KERNEL(dtrmm),
+        BLAS_KERNEL(dtrsm),
+        // Low precision extensions
+        BLAS_KERNEL(gemm_u8s8s32),
+        BLAS_KERNEL(gemm_u8s8u8),
+        BLAS_KERNEL(sbstobf16),
+        BLAS_KERNEL(sbdtobf16),
+        BLAS_KERNEL(sbf16tos),
+        BLAS_KERNEL(dbf16tod),
+        BLAS_KERNEL(shstof16),
+        BLAS_KERNEL(shdtof16),
+        BLAS_KERNEL(shf16tos),
+        BLAS_KERNEL(df16tod),
+        BLAS_KERNEL(sbgemm),
+        BLAS_KERNEL(shgemm),
+        BLAS_KERNEL(sbgemv),
+        BLAS_KERNEL(shgemv),
+        // LAPACK auxiliary routines
+        BLAS_KERNEL(dlacpy),
+        BLAS_KERNEL(dlaset),
+        BLAS_KERNEL(dlascl),
+        BLAS_KERNEL(dlange),
+        BLAS_KERNEL(dlansy),
+        BLAS_KERNEL(dlantr),
+        BLAS_KERNEL(dreduce),
+        // LAPACK routines
+        BLAS_KERNEL(dgetrf),
+        BLAS_KERNEL(dgetrs),
+        BLAS_KERNEL(dgetri),
+        BLAS_KERNEL(dtrtri),
+        BLAS_KERNEL(dpotrf),
+        BLAS_KERNEL(dpotri),
+        BLAS_KERNEL(dgeqrf),
+        BLAS_KERNEL(dormqr),
+        BLAS_KERNEL(dgels),
+        BLAS_KERNEL(dgels_normal),
+        // Kronecker products
+        BLAS_KERNEL(dkronmv),
+        BLAS_KERNEL(dkronsv),
+        // Eigensolvers
+        BLAS_KERNEL(dpower),
+        BLAS_KERNEL(dlanczos),
+        // Runtime
+        BLAS_METHOD("cpuLevel", cpu_level),
+        BLAS_METHOD("getNumThreads", get_num_threads),
+        BLAS_METHOD("setNumThreads", set_num_threads),
+        {"isa", nullptr, nullptr, nullptr, nullptr, isa, napi_enumerable, nullptr},
+    };
+    napi_define_properties(env, exports, sizeof(props) / sizeof(props[0]), props);
+    return exports;
+}
+
+} // namespace
+
+NAPI_MODULE(blas_native, init)
@@ -0,0 +1,263 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+/**
+ * Fork-join helper for the threaded kernels
+ *
+ * parallel::run(ntasks, task) calls task(0) ... task(ntasks - 1) and returns
+ * when all of them have finished. With BLAS_THREADS defined (the native
+ * addon) the tasks are shared between the calling thread and a persistent
+ * pool of workers; otherwise, and for calls made from inside a task, they
+ * run in order on the calling thread.
+ *
+ * The pool size defaults to the BLAS_NUM_THREADS environment variable, or to
+ * the number of hardware threads, and can be changed with set_num_threads().
+ *
+ * Split and slice() partition the bandwidth-bound Level 1 and Level 2 kernels
+ * into one contiguous range per thread; for_balanced() partitions the
+ * columns or right-hand sides of the Level 3 kernels by flops.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef BLAS_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace parallel {
+
+#ifdef BLAS_THREADS
+
+class Pool {
+public:
+    static Pool& instance() {
+        static Pool pool;
+        return pool;
+    }
+
+    int size() const { return nthreads_; }
+
+    void resize(int nthreads) {
+        std::lock_guard<std::mutex> serial(run_mutex_);
+        stop_workers();
+        nthreads_ = nthreads < 1 ? 1 : nthreads;
+        for (int t = 1; t < nthreads_; t++) {
+            workers_.emplace_back([this] { worker(); });
+        }
+    }
+
+    void run(int ntasks, const std::function<void(int)>& task) {
+        if (nthreads_ <= 1 || ntasks <= 1 || inside_task()) {
+            for (int i = 0; i < ntasks; i++) task(i);
+            return;
+        }
+
+        std::lock_guard<std::mutex> serial(run_mutex_);
+        Job job(task, ntasks);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            generation_++;
+        }
+        wake_.notify_all();
+
+        inside_task() = true;
+        drain(job);
+        inside_task() = false;
+
+        // Workers hold a pointer to job until they leave drain()
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        job_ = nullptr;
+    }
+
+    ~Pool() { stop_workers(); }
+
+private:
+    struct Job {
+        Job(const std::function<void(int)>& t, int n) : task(t), ntasks(n) {}
+        const std::function<void(int)>& task;
+        int ntasks;
+        std::atomic<int> next{0};
+    };
+
+    Pool() {
+        int nthreads = static_cast<int>(std::thread::hardware_concurrency());
+        if (const char* env = std::getenv("BLAS_NUM_THREADS")) {
+            nthreads = std::atoi(env);
+        }
+        resize(nthreads);
+    }
+
+    static bool& inside_task() {
+        thread_local bool inside = false;
+        return inside;
+    }
+
+    static void drain(Job& job) {
+        int i;
+        while ((i = job.next.fetch_add(1)) < job.ntasks) {
+            job.task(i);
+        }
+    }
+
+    void worker() {
+        inside_task() = true;
+        unsigned long seen = 0;
+        for (;;) {
+            Job* job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+                job = job_;
+                if (!job) continue;
+                active_++;
+            }
+            drain(*job);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--active_ == 0) done_.notify_all();
+            }
+        }
+    }
+
+    void stop_workers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& w : workers_) w.join();
+        workers_.clear();
+        stop_ = false;
+    }
+
+    int nthreads_ = 1;
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;  // one job at a time
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    Job* job_ = nullptr;
+    unsigned long generation_ = 0;
+    int active_ = 0;
+    bool stop_ = false;
+};
+
+inline int num_threads() { return Pool::instance().size(); }
+
+inline void set_num_threads(int nthreads) { Pool::instance().resize(nthreads); }
+
+template <typename F>
+void run(int ntasks, F task) {
+    Pool::instance().run(ntasks, std::function<void(int)>(task));
+}
+
+#else
+
+inline int num_threads() { return 1; }
+
+inline void set_num_threads(int) {}
+
+template <typename F>
+void run(int ntasks, F task) {
+    for (int i = 0; i < ntasks; i++) task(i);
+}
+
+#endif // BLAS_THREADS
+
+// Memory accesses below which a Level 1 or Level 2 kernel stays on the
+// calling thread: one core streams this much in about the time it takes to
+// wake the pool
+constexpr double MIN_SPLIT_WORK = 65536.0;
+
+// Split of the items [0, n), each costing `work` memory accesses, into one
+// contiguous range per thread. Ranges are multiples of `align` items long
+// (except the last), so that threads do not write to the same cache line.
+// parts() is 1 without threads or when the total is below MIN_SPLIT_WORK.
+// The split depends only on n, work and the pool size, so reductions over
+// the ranges round the same way in every call.
+class Split {
+public:
+    Split(int n, double work, int align) : n_(n), parts_(1), chunk_(n) {
+        double total = static_cast<double>(n) * work;
+        int parts = static_cast<int>(std::min<double>(num_threads(), total / MIN_SPLIT_WORK));
+        if (parts > 1) {
+            chunk_ = ((n + parts - 1) / parts + align - 1) / align * align;
+            parts_ = (n + chunk_ - 1) / chunk_;
+        }
+    }
+
+    int parts() const { return parts_; }
+    int first(int t) const { return t * chunk_; }
+    int last(int t) const {
+        return static_cast<int>(std::min<long long>(n_, static_cast<long long>(t + 1) * chunk_));
+    }
+
+private:
+    int n_;
+    int parts_;
+    int chunk_;
+};
+
+// Start of the elements [first, last) of an n-element BLAS vector with
+// increment inc, as a vector of last - first elements with the same increment
+// (with a negative increment the last element comes first in memory)
+template <typename T>
+T* slice(T* x, int inc, int n, int first, int last) {
+    return inc > 0 ? x + static_cast<ptrdiff_t>(first) * inc
+                   : x - static_cast<ptrdiff_t>(n - last) * inc;
+}
+
+// Multiply-adds below which a Level 3 kernel stays on the calling thread
+constexpr double MIN_PARALLEL_MADDS = 64.0 * 64.0 * 64.0;
+
+// Call f(first, last) on contiguous ranges of the items [0, n), one per
+// thread, where item i costs cost(i) multiply-adds. The ranges hold about
+// equal shares of the total cost, so triangular work (e.g. the columns of a
+// triangle of C) is balanced by flops rather than by count; boundaries are
+// rounded to multiples of `align` items. Without threads, or below
+// MIN_PARALLEL_MADDS, this is f(0, n).
+template <typename Cost, typename F>
+void for_balanced(int n, int align, Cost cost, F f) {
+    int nthreads = num_threads();
+    if (nthreads == 1 || n <= align) {
+        f(0, n);
+        return;
+    }
+    std::vector<double> prefix(n + 1, 0.0);
+    for (int i = 0; i < n; i++) prefix[i + 1] = prefix[i] + cost(i);
+    double total = prefix[n];
+    int parts = static_cast<int>(
+        std::min<double>(std::min(nthreads, (n + align - 1) / align), total / MIN_PARALLEL_MADDS));
+    if (parts <= 1) {
+        f(0, n);
+        return;
+    }
+
+    std::vector<int> bound(parts + 1, n);
+    bound[0] = 0;
+    for (int t = 1; t < parts; t++) {
+        double share = total * t / parts;
+        int i = static_cast<int>(std::lower_bound(prefix.begin(), prefix.end(), share) -
+                                 prefix.begin());
+        i = (i + align / 2) / align * align;
+        bound[t] = std::min(n, std::max(bound[t - 1], i));
+    }
+    run(parts, [&](int t) {
+        if (bound[t] < bound[t + 1]) f(bound[t], bound[t + 1]);
+    });
+}
+
+} // namespace parallel
+
+#endif // PARALLEL_H
@@ -0,0 +1,174 @@
+#ifndef REDUCE_H
+#define REDUCE_H
+
+/**
+ * Column and row reductions shared by the matrix norm and reduction kernels
+ *
+ * The column reductions (sum, asum, sumsq, amax) reduce one contiguous column
+ * to a scalar. The row reductions (add, add_abs, add_sq, max_abs) fold a
+ * column into a vector of per-row results, so a matrix is reduced along its
+ * rows in one pass over its columns. Both run on f64x2 lanes with two
+ * independent accumulators where SIMD is available.
+ *
+ * Maxima propagate NaN, like the NaN checks of the reference DLANGE: a NaN
+ * element makes the result NaN.
+ */
+
+#include <cmath>
+
+#include "blue.h"
+#include "simd.h"
+
+namespace reduce {
+
+// Maximum of a and b that is NaN if either is
+inline double nanmax(double a, double b) { return (b > a || b != b) ? b : a; }
+
+// x[0] + ... + x[n - 1]
+inline double sum(const double* x, int n) {
+    double s = 0.0;
+    int i = 0;
+#ifdef __wasm_simd128__
+    v128_t s0 = wasm_f64x2_splat(0.0);
+    v128_t s1 = s0;
+    for (; i + 4 <= n; i += 4) {
+        s0 = wasm_f64x2_add(s0, wasm_v128_load(x + i));
+        s1 = wasm_f64x2_add(s1, wasm_v128_load(x + i + 2));
+    }
+    s = simd::hsum_f64x2(wasm_f64x2_add(s0, s1));
+#endif
+    for (; i < n; i++) s += x[i];
+    return s;
+}
+
+// |x[0]| + ... + |x[n - 1]|
+inline double asum(const double* x, int n) {
+    double s = 0.0;
+    int i = 0;
+#ifdef __wasm_simd128__
+    v128_t s0 = wasm_f64x2_splat(0.0);
+    v128_t s1 = s0;
+    for (; i + 4 <= n; i += 4) {
+        s0 = wasm_f64x2_add(s0, wasm_f64x2_abs(wasm_v128_load(x + i)));
+        s1 = wasm_f64x2_add(s1, wasm_f64x2_abs(wasm_v128_load(x + i + 2)));
+    }
+    s = simd::hsum_f64x2(wasm_f64x2_add(s0, s1));
+#endif
+    for (; i < n; i++) s += std::abs(x[i]);
+    return s;
+}
+
+// x[0]^2 + ... + x[n - 1]^2, unscaled
+inline double sumsq(const double* x, int n) {
+    double s = 0.0;
+    int i = 0;
+#ifdef __wasm_simd128__
+    v128_t s0 = wasm_f64x2_splat(0.0);
+    v128_t s1 = s0;
+    for (; i + 4 <= n; i += 4) {
+        v128_t x0 = wasm_v128_load(x + i);
+        v128_t x1 = wasm_v128_load(x + i + 2);
+        s0 = simd::madd_f64x2(x0, x0, s0);
+        s1 = simd::madd_f64x2(x1, x1, s1);
+    }
+    s = simd::hsum_f64x2(wasm_f64x2_add(s0, s1));
+#endif
+    for (; i < n; i++) s += x[i] * x[i];
+    return s;
+}
+
+// max |x[i]|, NaN if any x[i] is NaN, 0 if n == 0
+inline double amax(const double* x, int n) {
+    double s = 0.0;
+    int i = 0;
+#ifdef __wasm_simd128__
+    // f64x2.max returns NaN if either operand is NaN
+    v128_t s0 = wasm_f64x2_splat(0.0);
+    v128_t s1 = s0;
+    for (; i + 4 <= n; i += 4) {
+        s0 = wasm_f64x2_max(s0, wasm_f64x2_abs(wasm_v128_load(x + i)));
+        s1 = wasm_f64x2_max(s1, wasm_f64x2_abs(wasm_v128_load(x + i + 2)));
+    }
+    s0 = wasm_f64x2_max(s0, s1);
+    s = nanmax(wasm_f64x2_extract_lane(s0, 0), wasm_f64x2_extract_lane(s0, 1));
+#endif
+    for (; i < n; i++) s = nanmax(s, std::abs(x[i]));
+    return s;
+}
+
+// r[i] += x[i]
+inline void add(const double* x, int n, double* r) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    for (; i + 2 <= n; i += 2) {
+        wasm_v128_store(r + i, wasm_f64x2_add(wasm_v128_load(r + i), wasm_v128_load(x + i)));
+    }
+#endif
+    for (; i < n; i++) r[i] += x[i];
+}
+
+// r[i] += |x[i]|
+inline void add_abs(const double* x, int n, double* r) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    for (; i + 2 <= n; i += 2) {
+        v128_t ax = wasm_f64x2_abs(wasm_v128_load(x + i));
+        wasm_v128_store(r + i, wasm_f64x2_add(wasm_v128_load(r + i), ax));
+    }
+#endif
+    for (; i < n; i++) r[i] += std::abs(x[i]);
+}
+
+// r[i] += x[i]^2
+inline void add_sq(const double* x, int n, double* r) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    for (; i + 2 <= n; i += 2) {
+        v128_t xi = wasm_v128_load(x + i);
+        wasm_v128_store(r + i, simd::madd_f64x2(xi, xi, wasm_v128_load(r + i)));
+    }
+#endif
+    for (; i < n; i++) r[i] += x[i] * x[i];
+}
+
+// r[i] += x[i]^2 as long as no x[i] needs scaling (see blue.h); returns
+// false, with r partially updated, as soon as a column has such an element
+inline bool add_sq_unscaled(const double* x, int n, double* r) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    const v128_t vsml = wasm_f64x2_splat(blue::tsml);
+    const v128_t vbig = wasm_f64x2_splat(blue::tbig);
+    const v128_t vzero = wasm_f64x2_splat(0.0);
+    v128_t out = wasm_i64x2_splat(0);
+    for (; i + 2 <= n; i += 2) {
+        v128_t xi = wasm_v128_load(x + i);
+        v128_t ax = wasm_f64x2_abs(xi);
+        out = wasm_v128_or(out, wasm_f64x2_gt(ax, vbig));
+        out = wasm_v128_or(out, wasm_v128_and(wasm_f64x2_lt(ax, vsml), wasm_f64x2_gt(ax, vzero)));
+        wasm_v128_store(r + i, simd::madd_f64x2(xi, xi, wasm_v128_load(r + i)));
+    }
+    if (wasm_v128_any_true(out)) return false;
+#endif
+    for (; i < n; i++) {
+        double ax = std::abs(x[i]);
+        if (ax > blue::tbig || (ax < blue::tsml && ax > 0.0)) return false;
+        r[i] += ax * ax;
+    }
+    return true;
+}
+
+// r[i] = max(r[i], |x[i]|), propagating NaN
+inline void max_abs(const double* x, int n, double* r) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    for (; i + 2 <= n; i += 2) {
+        v128_t ax = wasm_f64x2_abs(wasm_v128_load(x + i));
+        wasm_v128_store(r + i, wasm_f64x2_max(wasm_v128_load(r + i), ax));
+    }
+#endif
+    for (; i < n; i++) r[i] = nanmax(r[i], std::abs(x[i]));
+}
+
+} // namespace reduce
+
+#endif // REDUCE_H
@@ -0,0 +1,232 @@
+/**
+ * SBGEMM / SHGEMM - Matrix-matrix multiplication with 16-bit storage
+ *
+ * Computes: C = alpha * op(A) * op(B) + beta * C
+ * where op(X) = X or X^T, A and B are stored as bfloat16 (SBGEMM) or
+ * IEEE fp16 (SHGEMM) and C and all arithmetic are single precision
+ *
+ * A and B are converted to float while they are packed into cache blocks, so
+ * each 16-bit element is read once per block and the microkernel runs on
+ * f32x4 vectors. Naming and argument order follow the OpenBLAS SBGEMM
+ * extension.
+ *
+ * @param transa  'N': op(A) = A, 'T'/'C': op(A) = A^T
+ * @param transb  'N': op(B) = B, 'T'/'C': op(B) = B^T
+ * @param m       Number of rows of op(A) and C
+ * @param n       Number of columns of op(B) and C
+ * @param k       Number of columns of op(A) and rows of op(B)
+ * @param alpha   Scalar multiplier for op(A)*op(B)
+ * @param a       Matrix A (16-bit)
+ * @param lda     Leading dimension of A
+ * @param b       Matrix B (16-bit)
+ * @param ldb     Leading dimension of B
+ * @param beta    Scalar multiplier for C
+ * @param c       Input/output matrix C (float)
+ * @param ldc     Leading dimension of C
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "check.h"
+#include "half.h"
+#include "simd.h"
+
+namespace {
+
+const int MR = 8;    // rows of the register tile
+const int NR = 4;    // columns of the register tile
+const int MC = 128;  // rows of A packed per block
+const int KC = 256;  // depth of a packed block
+const int NC = 512;  // columns of B packed per block
+
+// Pack rows [i0, i0 + mc) and columns [l0, l0 + kc) of op(A) as float
+template <typename Fmt>
+void pack_a(bool nota, const uint16_t* a, int lda, int i0, int mc, int l0, int kc, float* pa) {
+    for (int ir = 0; ir < mc; ir += MR) {
+        int mr = std::min(MR, mc - ir);
+        for (int p = 0; p < kc; p++) {
+            int l = l0 + p;
+            if (nota && mr == MR) {
+                const uint16_t* src = a + (i0 + ir) + static_cast<size_t>(l) * lda;
+#ifdef __wasm_simd128__
+                v128_t lo, hi;
+                half::load8<Fmt>(src, lo, hi);
+                wasm_v128_store(pa, lo);
+                wasm_v128_store(pa + 4, hi);
+#else
+                for (int r = 0; r < MR; r++) pa[r] = Fmt::to_float(src[r]);
+#endif
+            } else {
+                for (int r = 0; r < MR; r++) {
+                    int i = i0 + ir + r;
+                    if (r >= mr) {
+                        pa[r] = 0.0f;
+                    } else if (nota) {
+                        pa[r] = Fmt::to_float(a[i + static_cast<size_t>(l) * lda]);
+                    } else {
+                        pa[r] = Fmt::to_float(a[l + static_cast<size_t>(i) * lda]);
+                    }
+                }
+            }
+            pa += MR;
+        }
+    }
+}
+
+// Pack rows [l0, l0 + kc) and columns [j0, j0 + nc) of op(B) as float
+template <typename Fmt>
+void pack_b(bool notb, const uint16_t* b, int ldb, int l0, int kc, int j0, int nc, float* pb) {
+    for (int jr = 0; jr < nc; jr += NR) {
+        for (int p = 0; p < kc; p++) {
+            int l = l0 + p;
+            for (int c = 0; c < NR; c++) {
+                int j = j0 + jr + c;
+                if (jr + c >= nc) {
+                    pb[c] = 0.0f;
+                } else if (notb) {
+                    pb[c] = Fmt::to_float(b[l + static_cast<size_t>(j) * ldb]);
+                } else {
+                    pb[c] = Fmt::to_float(b[j + static_cast<size_t>(l) * ldb]);
+                }
+            }
+            pb += NR;
+        }
+    }
+}
+
+// C[0:mr, 0:nr] += alpha * packed A panel * packed B panel
+void kernel_8x4(int kc, const float* pa, const float* pb, float alpha,
+                float* c, int ldc, int mr, int nr) {
+    float tile[MR * NR];
+#ifdef __wasm_simd128__
+    v128_t acc[NR][2];
+    for (int j = 0; j < NR; j++) {
+        acc[j][0] = wasm_f32x4_splat(0.0f);
+        acc[j][1] = wasm_f32x4_splat(0.0f);
+    }
+    for (int p = 0; p < kc; p++) {
+        v128_t a0 = wasm_v128_load(pa + MR * p);
+        v128_t a1 = wasm_v128_load(pa + MR * p + 4);
+        for (int j = 0; j < NR; j++) {
+            v128_t bj = wasm_f32x4_splat(pb[NR * p + j]);
+            acc[j][0] = simd::madd_f32x4(a0, bj, acc[j][0]);
+            acc[j][1] = simd::madd_f32x4(a1, bj, acc[j][1]);
+        }
+    }
+    v128_t va = wasm_f32x4_splat(alpha);
+    if (mr == MR && nr == NR) {
+        for (int j = 0; j < NR; j++) {
+            float* cj = c + static_cast<size_t>(j) * ldc;
+            wasm_v128_store(cj, simd::madd_f32x4(va, acc[j][0], wasm_v128_load(cj)));
+            wasm_v128_store(cj + 4, simd::madd_f32x4(va, acc[j][1], wasm_v128_load(cj + 4)));
+        }
+        return;
+    }
+    for (int j = 0; j < NR; j++) {
+        wasm_v128_store(tile + j * MR, acc[j][0]);
+        wasm_v128_store(tile + j * MR + 4, acc[j][1]);
+    }
+#else
+    std::fill(tile, tile + MR * NR, 0.0f);
+    for (int p = 0; p < kc; p++) {
+        for (int j = 0; j < NR; j++) {
+            float bj = pb[NR * p + j];
+            for (int i = 0; i < MR; i++) {
+                tile[i + j * MR] += pa[MR * p + i] * bj;
+            }
+        }
+    }
+#endif
+    for (int j = 0; j < nr; j++) {
+        for (int i = 0; i < mr; i++) {
+            c[i + static_cast<size_t>(j) * ldc] += alpha * tile[i + j * MR];
+        }
+    }
+}
+
+template <typename Fmt>
+void gemm16(char transa, char transb, int m, int n, int k, float alpha,
+            const uint16_t* a, int lda, const uint16_t* b, int ldb,
+            float beta, float* c, int ldc) {
+    bool nota = (transa == 'N' || transa == 'n');
+    bool notb = (transb == 'N' || transb == 'n');
+
+    // Quick return if possible
+    if (m == 0 || n == 0 || ((alpha == 0.0f || k == 0) && beta == 1.0f)) return;
+
+    // First form C := beta*C
+    if (beta != 1.0f) {
+        for (int j = 0; j < n; j++) {
+            float* cj = c + static_cast<size_t>(j) * ldc;
+            if (beta == 0.0f) {
+                std::fill(cj, cj + m, 0.0f);
+            } else {
+                for (int i = 0; i < m; i++) cj[i] *= beta;
+            }
+        }
+    }
+    if (alpha == 0.0f || k == 0) return;
+
+    // Packing buffers, sized for the blocks actually used
+    int kcmax = std::min(KC, k);
+    std::vector<float> pa(static_cast<size_t>((std::min(MC, m) + MR - 1) / MR * MR) * kcmax);
+    std::vector<float> pb(static_cast<size_t>((std::min(NC, n) + NR - 1) / NR * NR) * kcmax);
+
+    for (int j0 = 0; j0 < n; j0 += NC) {
+        int nc = std::min(NC, n - j0);
+        for (int l0 = 0; l0 < k; l0 += KC) {
+            int kc = std::min(KC, k - l0);
+            pack_b<Fmt>(notb, b, ldb, l0, kc, j0, nc, pb.data());
+
+            for (int i0 = 0; i0 < m; i0 += MC) {
+                int mc = std::min(MC, m - i0);
+                pack_a<Fmt>(nota, a, lda, i0, mc, l0, kc, pa.data());
+
+                for (int jr = 0; jr < nc; jr += NR) {
+                    int nr = std::min(NR, nc - jr);
+                    for (int ir = 0; ir < mc; ir += MR) {
+                        int mr = std::min(MR, mc - ir);
+                        kernel_8x4(kc, pa.data() + ir * kc, pb.data() + jr * kc, alpha,
+                                   c + (i0 + ir) + static_cast<size_t>(j0 + jr) * ldc, ldc, mr, nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void sbgemm(char transa, char transb, int m, int n, int k, float alpha,
+            const uint16_t* a, int lda, const uint16_t* b, int ldb,
+            float beta, float* c, int ldc) {
+    BLAS_CHECK("SBGEMM", check::trans(transa), 1);
+    BLAS_CHECK("SBGEMM", check::trans(transb), 2);
+    BLAS_CHECK("SBGEMM", m >= 0, 3);
+    BLAS_CHECK("SBGEMM", n >= 0, 4);
+    BLAS_CHECK("SBGEMM", k >= 0, 5);
+    BLAS_CHECK("SBGEMM", lda >= check::max1(check::notrans(transa) ? m : k), 8);
+    BLAS_CHECK("SBGEMM", ldb >= check::max1(check::notrans(transb) ? k : n), 10);
+    BLAS_CHECK("SBGEMM", ldc >= check::max1(m), 13);
+    gemm16<half::BF16>(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void shgemm(char transa, char transb, int m, int n, int k, float alpha,
+            const uint16_t* a, int lda, const uint16_t* b, int ldb,
+            float beta, float* c, int ldc) {
+    BLAS_CHECK("SHGEMM", check::trans(transa), 1);
+    BLAS_CHECK("SHGEMM", check::trans(transb), 2);
+    BLAS_CHECK("SHGEMM", m >= 0, 3);
+    BLAS_CHECK("SHGEMM", n >= 0, 4);
+    BLAS_CHECK("SHGEMM", k >= 0, 5);
+    BLAS_CHECK("SHGEMM", lda >= check::max1(check::notrans(transa) ? m : k), 8);
+    BLAS_CHECK("SHGEMM", ldb >= check::max1(check::notrans(transb) ? k : n), 10);
+    BLAS_CHECK("SHGEMM", ldc >= check::max1(m), 13);
+    gemm16<half::F16>(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+} // extern "C"
@@ -0,0 +1,158 @@
+/**
+ * SBGEMV / SHGEMV - Matrix-vector multiplication with 16-bit storage
+ *
+ * Computes: y = alpha * A * x + beta * y  or  y = alpha * A^T * x + beta * y
+ * where A and x are stored as bfloat16 (SBGEMV) or IEEE fp16 (SHGEMV) and
+ * y and all arithmetic are single precision
+ *
+ * A is streamed once and converted eight elements at a time, so the kernel
+ * reads half the bytes of a single precision GEMV. Naming and argument order
+ * follow the OpenBLAS SBGEMV extension.
+ *
+ * @param trans  'N': y = alpha*A*x + beta*y, 'T'/'C': y = alpha*A^T*x + beta*y
+ * @param m      Number of rows of matrix A
+ * @param n      Number of columns of matrix A
+ * @param alpha  Scalar multiplier for A*x or A^T*x
+ * @param a      Matrix A (16-bit) stored in column-major order
+ * @param lda    Leading dimension of A (>= max(1,m))
+ * @param x      Input vector x (16-bit)
+ * @param incx   Storage spacing between elements of x
+ * @param beta   Scalar multiplier for y
+ * @param y      Input/output vector y (float)
+ * @param incy   Storage spacing between elements of y
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "check.h"
+#include "half.h"
+#include "simd.h"
+
+namespace {
+
+// t[0:m] += s * a[0:m]
+template <typename Fmt>
+void axpy16(int m, float s, const uint16_t* a, float* t) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    v128_t vs = wasm_f32x4_splat(s);
+    for (; i + 8 <= m; i += 8) {
+        v128_t lo, hi;
+        half::load8<Fmt>(a + i, lo, hi);
+        wasm_v128_store(t + i, simd::madd_f32x4(vs, lo, wasm_v128_load(t + i)));
+        wasm_v128_store(t + i + 4, simd::madd_f32x4(vs, hi, wasm_v128_load(t + i + 4)));
+    }
+#endif
+    for (; i < m; i++) {
+        t[i] += s * Fmt::to_float(a[i]);
+    }
+}
+
+// Returns a[0:m]^T * x[0:m]
+template <typename Fmt>
+float dot16(int m, const uint16_t* a, const float* x) {
+    float sum = 0.0f;
+    int i = 0;
+#ifdef __wasm_simd128__
+    v128_t s0 = wasm_f32x4_splat(0.0f);
+    v128_t s1 = wasm_f32x4_splat(0.0f);
+    for (; i + 8 <= m; i += 8) {
+        v128_t lo, hi;
+        half::load8<Fmt>(a + i, lo, hi);
+        s0 = simd::madd_f32x4(lo, wasm_v128_load(x + i), s0);
+        s1 = simd::madd_f32x4(hi, wasm_v128_load(x + i + 4), s1);
+    }
+    s0 = wasm_f32x4_add(s0, s1);
+    sum = wasm_f32x4_extract_lane(s0, 0) + wasm_f32x4_extract_lane(s0, 1) +
+          wasm_f32x4_extract_lane(s0, 2) + wasm_f32x4_extract_lane(s0, 3);
+#endif
+    for (; i < m; i++) {
+        sum += Fmt::to_float(a[i]) * x[i];
+    }
+    return sum;
+}
+
+template <typename Fmt>
+void gemv16(char trans, int m, int n, float alpha, const uint16_t* a, int lda,
+            const uint16_t* x, int incx, float beta, float* y, int incy) {
+    bool notran = (trans == 'N' || trans == 'n');
+
+    // Quick return if possible
+    if (m == 0 || n == 0 || (alpha == 0.0f && beta == 1.0f)) return;
+
+    int lenx = notran ? n : m;
+    int leny = notran ? m : n;
+    int kx = (incx < 0) ? (1 - lenx) * incx : 0;
+    int ky = (incy < 0) ? (1 - leny) * incy : 0;
+
+    // First form y := beta*y
+    if (beta != 1.0f) {
+        int iy = ky;
+        for (int i = 0; i < leny; i++) {
+            y[iy] = (beta == 0.0f) ? 0.0f : beta * y[iy];
+            iy += incy;
+        }
+    }
+    if (alpha == 0.0f) return;
+
+    // Widen x once; it is reused for every column of A
+    std::vector<float> xf(lenx);
+    int ix = kx;
+    for (int i = 0; i < lenx; i++) {
+        xf[i] = Fmt::to_float(x[ix]);
+        ix += incx;
+    }
+
+    if (notran) {
+        // Form y := alpha*A*x + y, one pass over the columns of A
+        std::vector<float> t(m, 0.0f);
+        for (int j = 0; j < n; j++) {
+            if (xf[j] != 0.0f) {
+                axpy16<Fmt>(m, alpha * xf[j], a + static_cast<size_t>(j) * lda, t.data());
+            }
+        }
+        int iy = ky;
+        for (int i = 0; i < m; i++) {
+            y[iy] += t[i];
+            iy += incy;
+        }
+    } else {
+        // Form y := alpha*A^T*x + y
+        int jy = ky;
+        for (int j = 0; j < n; j++) {
+            y[jy] += alpha * dot16<Fmt>(m, a + static_cast<size_t>(j) * lda, xf.data());
+            jy += incy;
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void sbgemv(char trans, int m, int n, float alpha, const uint16_t* a, int lda,
+            const uint16_t* x, int incx, float beta, float* y, int incy) {
+    BLAS_CHECK("SBGEMV", check::trans(trans), 1);
+    BLAS_CHECK("SBGEMV", m >= 0, 2);
+    BLAS_CHECK("SBGEMV", n >= 0, 3);
+    BLAS_CHECK("SBGEMV", lda >= check::max1(m), 6);
+    BLAS_CHECK("SBGEMV", incx != 0, 8);
+    BLAS_CHECK("SBGEMV", incy != 0, 11);
+
+    gemv16<half::BF16>(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+void shgemv(char trans, int m, int n, float alpha, const uint16_t* a, int lda,
+            const uint16_t* x, int incx, float beta, float* y, int incy) {
+    BLAS_CHECK("SHGEMV", check::trans(trans), 1);
+    BLAS_CHECK("SHGEMV", m >= 0, 2);
+    BLAS_CHECK("SHGEMV", n >= 0, 3);
+    BLAS_CHECK("SHGEMV", lda >= check::max1(m), 6);
+    BLAS_CHECK("SHGEMV", incx != 0, 8);
+    BLAS_CHECK("SHGEMV", incy != 0, 11);
+
+    gemv16<half::F16>(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+} // extern "C"
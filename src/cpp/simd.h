@@ -0,0 +1,44 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+/**
+ * WebAssembly SIMD helpers shared by the vectorized kernels
+ *
+ * madd(a, b, c) computes a*b + c. In the relaxed-SIMD build (-mrelaxed-simd)
+ * it is a single f64x2.relaxed_madd / f32x4.relaxed_madd, which the engine
+ * lowers to a fused multiply-add where the CPU has one and to a separate
+ * multiply and add elsewhere. Results of that build may therefore differ in
+ * the last bits between machines (and from the SIMD and scalar builds); the
+ * other builds always round the product and the sum separately.
+ */
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+
+namespace simd {
+
+inline v128_t madd_f64x2(v128_t a, v128_t b, v128_t c) {
+#ifdef __wasm_relaxed_simd__
+    return wasm_f64x2_relaxed_madd(a, b, c);
+#else
+    return wasm_f64x2_add(wasm_f64x2_mul(a, b), c);
+#endif
+}
+
+inline v128_t madd_f32x4(v128_t a, v128_t b, v128_t c) {
+#ifdef __wasm_relaxed_simd__
+    return wasm_f32x4_relaxed_madd(a, b, c);
+#else
+    return wasm_f32x4_add(wasm_f32x4_mul(a, b), c);
+#endif
+}
+
+inline double hsum_f64x2(v128_t a) {
+    return wasm_f64x2_extract_lane(a, 0) + wasm_f64x2_extract_lane(a, 1);
+}
+
+} // namespace simd
+
+#endif // __wasm_simd128__
+
+#endif // SIMD_H
@@ -3,7 +3,9 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { gather, packedInc, packedLength } from './utils';
 
 /**
  * Computes the sum of absolute values of vector elements: result = sum(|x[i]|)
@@ -42,15 +44,22 @@ export function dasum(n: number, x: Float64Array, incx: number = 1): number {
     throw new Error(`x array too small: expected at least ${xLen}, got ${x.length}`);
   }
 
-  // Allocate memory in WASM
-  const xPtr = module._malloc(x.length * 8); // 8 bytes per double
+  const native = getNative();
+  if (native) {
+    return native.dasum(n, x, incx);
+  }
+
+  // Allocate memory in WASM for the elements used, packed contiguously
+  const xCount = packedLength(n, incx);
+  checkBudget(xCount * 8);
+  const xPtr = module._malloc(xCount * 8); // 8 bytes per double
 
   try {
-    // Copy data to WASM memory
-    module.HEAPF64.set(x, xPtr / 8);
+    // Gather the operand into WASM memory
+    gather(module, x, n, incx, xPtr);
 
-    // Call the WASM function
-    const result = module._dasum(n, xPtr, incx);
+    // Call the WASM function on the packed operand
+    const result = module._dasum(n, xPtr, packedInc(incx));
 
     return result;
   } finally {
@@ -0,0 +1,126 @@
+/**
+ * DASUM_BATCH - Batched double precision sum of absolute values
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { packedInc, packedLength } from './utils';
+import { BatchOperand, batchMembers, checkBatchOperand, isStrided, packVectors } from './batch';
+
+/**
+ * Computes r[b] = sum(|x_b[i]|) for every vector x_b of a batch, in one call
+ *
+ * Problems run in parallel on the native backend, and short vectors (up to
+ * 16 elements) two at a time in SIMD lanes on WebAssembly, with the same
+ * results as separate dasum() calls.
+ *
+ * @param n - Number of elements in each vector
+ * @param x - Input vectors x_b, one per problem
+ * @param incx - Storage spacing between elements of each x_b
+ * @param r - Output array of at least x.length elements (Float64Array)
+ * @modifies r - r[b] is overwritten with the sum of absolute values of x_b
+ *
+ * @example
+ * ```typescript
+ * import { dasum_batch, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const xs = [new Float64Array([3, -4]), new Float64Array([-6, 8])];
+ * const r = new Float64Array(2);
+ *
+ * dasum_batch(2, xs, 1, r);
+ * // r = [7, 14]
+ * ```
+ */
+export function dasum_batch(n: number, x: Float64Array[], incx: number, r: Float64Array): void {
+  asumBatch(n, x, incx, r, x.length);
+}
+
+/**
+ * Computes r[b] = sum(|x_b[i]|) for b = 0, ..., batch - 1, where x_b starts at
+ * b * strideX in x
+ *
+ * See dasum_batch() for the execution.
+ *
+ * @param n - Number of elements in each vector
+ * @param x - Input vectors x_b (Float64Array)
+ * @param incx - Storage spacing between elements of each x_b
+ * @param strideX - Elements between successive x_b
+ * @param r - Output array of at least batch elements (Float64Array)
+ * @param batch - Number of problems
+ * @modifies r - r[b] is overwritten with the sum of absolute values of x_b
+ */
+export function dasum_batch_strided(
+  n: number,
+  x: Float64Array,
+  incx: number,
+  strideX: number,
+  r: Float64Array,
+  batch: number
+): void {
+  asumBatch(n, { array: x, stride: strideX }, incx, r, batch);
+}
+
+function asumBatch(n: number, x: BatchOperand, incx: number, r: Float64Array, batch: number): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (!Number.isInteger(batch) || batch < 0) {
+    throw new Error(`batch must be a non-negative integer, got ${batch}`);
+  }
+
+  checkBatchOperand('x', x, batch, 1 + (n - 1) * Math.abs(incx), false);
+  if (r.length < batch) {
+    throw new Error(`r array too small: expected at least ${batch}, got ${r.length}`);
+  }
+  if (batch === 0) {
+    return;
+  }
+  if (n === 0 || incx <= 0) {
+    r.fill(0, 0, batch);
+    return;
+  }
+
+  const native = getNative();
+  if (native && isStrided(x)) {
+    native.dasum_batch_strided(n, x.array, incx, x.stride, r, batch);
+    return;
+  }
+
+  // Pack the distinct vectors back to back
+  const xMembers = batchMembers(x, batch);
+  const xSize = packedLength(n, incx);
+  const xStride = xMembers > 1 ? xSize : 0;
+
+  if (native) {
+    const xData = new Float64Array(xMembers * xSize);
+    packVectors(xData, 0, x, xMembers, n, incx);
+    native.dasum_batch_strided(n, xData, packedInc(incx), xStride, r, batch);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget((xMembers * xSize + batch) * 8);
+  const xPtr = module._malloc(xMembers * xSize * 8);
+  const rPtr = module._malloc(batch * 8);
+
+  try {
+    // Copy data to WASM memory
+    packVectors(module.HEAPF64, xPtr / 8, x, xMembers, n, incx);
+
+    // Call the WASM function
+    module._dasum_batch_strided(n, xPtr, packedInc(incx), xStride, rPtr, batch);
+
+    // Copy result back to r
+    r.set(module.HEAPF64.subarray(rPtr / 8, rPtr / 8 + batch));
+  } finally {
+    // Free WASM memory
+    module._free(xPtr);
+    module._free(rPtr);
+  }
+}
@@ -3,7 +3,9 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { gather, packedInc, packedLength, scatter } from './utils';
 
 /**
  * Computes y = alpha * x + beta * y (extended AXPY operation)
@@ -62,24 +64,29 @@ export function daxpby(
     throw new Error(`y array too small: expected at least ${yLen}, got ${y.length}`);
   }
 
-  // Allocate memory in WASM
-  const xPtr = module._malloc(x.length * 8); // 8 bytes per double
-  const yPtr = module._malloc(y.length * 8);
+  const native = getNative();
+  if (native) {
+    native.daxpby(n, alpha, x, incx, beta, y, incy);
+    return;
+  }
 
-  try {
-    // Copy data to WASM memory
-    module.HEAPF64.set(x, xPtr / 8);
-    module.HEAPF64.set(y, yPtr / 8);
+  // Allocate memory in WASM for the elements used, packed contiguously
+  const xCount = packedLength(n, incx);
+  const yCount = packedLength(n, incy);
+  checkBudget((xCount + yCount) * 8);
+  const xPtr = module._malloc(xCount * 8); // 8 bytes per double
+  const yPtr = module._malloc(yCount * 8);
 
-    // Call the WASM function
-    module._daxpby(n, alpha, xPtr, incx, beta, yPtr, incy);
+  try {
+    // Gather the operands into WASM memory
+    gather(module, x, n, incx, xPtr);
+    gather(module, y, n, incy, yPtr);
 
-    // Copy result back
-    const result = new Float64Array(y.length);
-    result.set(module.HEAPF64.subarray(yPtr / 8, yPtr / 8 + y.length));
+    // Call the WASM function on the packed operands
+    module._daxpby(n, alpha, xPtr, packedInc(incx), beta, yPtr, packedInc(incy));
 
-    // Copy back to original array regardless of type
-    y.set(result);
+    // Scatter the result back to y
+    scatter(module, yPtr, y, n, incy);
   } finally {
     // Free WASM memory
     module._free(xPtr);
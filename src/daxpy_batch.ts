@@ -0,0 +1,186 @@
+/**
+ * DAXPY_BATCH - Batched double precision A*X Plus Y
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { packedInc, packedLength } from './utils';
+import {
+  BatchOperand,
+  batchMembers,
+  checkBatchOperand,
+  isStrided,
+  packVectors,
+  unpackVectors,
+} from './batch';
+
+/**
+ * Computes y_b = alpha * x_b + y_b for every problem b of a batch, in one call
+ *
+ * The problems are given as arrays of vectors, one per problem; x may
+ * instead hold a single vector that all problems share. Problems run in
+ * parallel on the native backend, and short vectors (up to 16 elements) two
+ * at a time in SIMD lanes on WebAssembly.
+ *
+ * @param n - Number of elements in each vector
+ * @param alpha - Scalar multiplier for x_b
+ * @param x - Input vectors x_b, one or y.length of them
+ * @param incx - Storage spacing between elements of each x_b
+ * @param y - Input/output vectors y_b, one per problem
+ * @param incy - Storage spacing between elements of each y_b
+ * @modifies y - Each y_b is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { daxpy_batch, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const x = new Float64Array([1, 2]); // shared
+ * const ys = [new Float64Array([1, 1]), new Float64Array([2, 2])];
+ *
+ * daxpy_batch(2, 2.0, [x], 1, ys, 1);
+ * // ys = [[3, 5], [4, 6]]
+ * ```
+ */
+export function daxpy_batch(
+  n: number,
+  alpha: number,
+  x: Float64Array[],
+  incx: number,
+  y: Float64Array[],
+  incy: number
+): void {
+  axpyBatch(n, alpha, x, incx, y, incy, y.length);
+}
+
+/**
+ * Computes y_b = alpha * x_b + y_b for b = 0, ..., batch - 1, where x_b
+ * starts at b * strideX in x and y_b at b * strideY in y
+ *
+ * A stride of 0 for x shares it between all problems. Vectors that lie back
+ * to back (unit increments and strides of n) are updated as one long vector;
+ * see daxpy_batch() for the execution otherwise.
+ *
+ * @param n - Number of elements in each vector
+ * @param alpha - Scalar multiplier for x_b
+ * @param x - Input vectors x_b (Float64Array)
+ * @param incx - Storage spacing between elements of each x_b
+ * @param strideX - Elements between successive x_b (0: shared)
+ * @param y - Input/output vectors y_b (Float64Array)
+ * @param incy - Storage spacing between elements of each y_b
+ * @param strideY - Elements between successive y_b
+ * @param batch - Number of problems
+ * @modifies y - Each y_b is modified in-place
+ */
+export function daxpy_batch_strided(
+  n: number,
+  alpha: number,
+  x: Float64Array,
+  incx: number,
+  strideX: number,
+  y: Float64Array,
+  incy: number,
+  strideY: number,
+  batch: number
+): void {
+  axpyBatch(
+    n,
+    alpha,
+    { array: x, stride: strideX },
+    incx,
+    { array: y, stride: strideY },
+    incy,
+    batch
+  );
+}
+
+function axpyBatch(
+  n: number,
+  alpha: number,
+  x: BatchOperand,
+  incx: number,
+  y: BatchOperand,
+  incy: number,
+  batch: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (!Number.isInteger(batch) || batch < 0) {
+    throw new Error(`batch must be a non-negative integer, got ${batch}`);
+  }
+
+  checkBatchOperand('x', x, batch, 1 + (n - 1) * Math.abs(incx), false);
+  checkBatchOperand('y', y, batch, 1 + (n - 1) * Math.abs(incy), true);
+  if (batch === 0 || n === 0 || alpha === 0) {
+    return;
+  }
+
+  const native = getNative();
+  if (native && isStrided(x) && isStrided(y)) {
+    native.daxpy_batch_strided(n, alpha, x.array, incx, x.stride, y.array, incy, y.stride, batch);
+    return;
+  }
+
+  // Pack the distinct vectors of each operand back to back
+  const xMembers = batchMembers(x, batch);
+  const xSize = packedLength(n, incx);
+  const ySize = packedLength(n, incy);
+  const xStride = xMembers > 1 ? xSize : 0;
+
+  if (native) {
+    const xData = new Float64Array(xMembers * xSize);
+    const yData = new Float64Array(batch * ySize);
+    packVectors(xData, 0, x, xMembers, n, incx);
+    packVectors(yData, 0, y, batch, n, incy);
+    native.daxpy_batch_strided(
+      n,
+      alpha,
+      xData,
+      packedInc(incx),
+      xStride,
+      yData,
+      packedInc(incy),
+      ySize,
+      batch
+    );
+    unpackVectors(yData, 0, y, batch, n, incy);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget((xMembers * xSize + batch * ySize) * 8);
+  const xPtr = module._malloc(xMembers * xSize * 8);
+  const yPtr = module._malloc(batch * ySize * 8);
+
+  try {
+    // Copy data to WASM memory
+    packVectors(module.HEAPF64, xPtr / 8, x, xMembers, n, incx);
+    packVectors(module.HEAPF64, yPtr / 8, y, batch, n, incy);
+
+    // Call the WASM function
+    module._daxpy_batch_strided(
+      n,
+      alpha,
+      xPtr,
+      packedInc(incx),
+      xStride,
+      yPtr,
+      packedInc(incy),
+      ySize,
+      batch
+    );
+
+    // Copy result back to y
+    unpackVectors(module.HEAPF64, yPtr / 8, y, batch, n, incy);
+  } finally {
+    // Free WASM memory
+    module._free(xPtr);
+    module._free(yPtr);
+  }
+}
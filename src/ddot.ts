@@ -3,7 +3,9 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { gather, packedInc, packedLength } from './utils';
 
 /**
  * Computes the dot product of two vectors: result = x^T * y
@@ -56,17 +58,25 @@ export function ddot(
     throw new Error(`y array too small: expected at least ${yLen}, got ${y.length}`);
   }
 
-  // Allocate memory in WASM
-  const xPtr = module._malloc(x.length * 8); // 8 bytes per double
-  const yPtr = module._malloc(y.length * 8);
+  const native = getNative();
+  if (native) {
+    return native.ddot(n, x, incx, y, incy);
+  }
+
+  // Allocate memory in WASM for the elements used, packed contiguously
+  const xCount = packedLength(n, incx);
+  const yCount = packedLength(n, incy);
+  checkBudget((xCount + yCount) * 8);
+  const xPtr = module._malloc(xCount * 8); // 8 bytes per double
+  const yPtr = module._malloc(yCount * 8);
 
   try {
-    // Copy data to WASM memory
-    module.HEAPF64.set(x, xPtr / 8);
-    module.HEAPF64.set(y, yPtr / 8);
+    // Gather the operands into WASM memory
+    gather(module, x, n, incx, xPtr);
+    gather(module, y, n, incy, yPtr);
 
-    // Call the WASM function
-    const result = module._ddot(n, xPtr, incx, yPtr, incy);
+    // Call the WASM function on the packed operands
+    const result = module._ddot(n, xPtr, packedInc(incx), yPtr, packedInc(incy));
 
     return result;
   } finally {
@@ -0,0 +1,197 @@
+/**
+ * DDOT_BATCH - Batched double precision dot product
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { packedInc, packedLength } from './utils';
+import { BatchOperand, batchMembers, checkBatchOperand, isStrided, packVectors } from './batch';
+
+/**
+ * Computes r[b] = x_b^T * y_b for every problem b of a batch, in one call
+ *
+ * The problems are given as arrays of vectors, one per problem; x or y may
+ * instead hold a single vector that all problems share, e.g. a query scored
+ * against many rows. Problems run in parallel on the native backend, and
+ * short vectors (up to 16 elements) two at a time in SIMD lanes on
+ * WebAssembly, with the same results as separate ddot() calls.
+ *
+ * @param n - Number of elements in each vector
+ * @param x - Input vectors x_b, one or as many as y
+ * @param incx - Storage spacing between elements of each x_b
+ * @param y - Input vectors y_b, one or as many as x
+ * @param incy - Storage spacing between elements of each y_b
+ * @param r - Output array of at least max(x.length, y.length) elements (Float64Array)
+ * @modifies r - r[b] is overwritten with the dot product of problem b
+ *
+ * @example
+ * ```typescript
+ * import { ddot_batch, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const q = new Float64Array([1, 2]); // shared
+ * const rows = [new Float64Array([3, 4]), new Float64Array([5, 6])];
+ * const r = new Float64Array(2);
+ *
+ * ddot_batch(2, [q], 1, rows, 1, r);
+ * // r = [11, 17]
+ * ```
+ */
+export function ddot_batch(
+  n: number,
+  x: Float64Array[],
+  incx: number,
+  y: Float64Array[],
+  incy: number,
+  r: Float64Array
+): void {
+  dotBatch(n, x, incx, y, incy, r, Math.max(x.length, y.length));
+}
+
+/**
+ * Computes r[b] = x_b^T * y_b for b = 0, ..., batch - 1, where x_b starts at
+ * b * strideX in x and y_b at b * strideY in y
+ *
+ * A stride of 0 shares that vector between all problems. See ddot_batch()
+ * for the execution.
+ *
+ * @param n - Number of elements in each vector
+ * @param x - Input vectors x_b (Float64Array)
+ * @param incx - Storage spacing between elements of each x_b
+ * @param strideX - Elements between successive x_b (0: shared)
+ * @param y - Input vectors y_b (Float64Array)
+ * @param incy - Storage spacing between elements of each y_b
+ * @param strideY - Elements between successive y_b (0: shared)
+ * @param r - Output array of at least batch elements (Float64Array)
+ * @param batch - Number of problems
+ * @modifies r - r[b] is overwritten with the dot product of problem b
+ *
+ * @example
+ * ```typescript
+ * import { ddot_batch_strided, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * // Similarity of a 16-element query with each row of a 1000 x 16 row-major table
+ * const table = new Float64Array(1000 * 16).fill(0.5);
+ * const query = new Float64Array(16).fill(2);
+ * const scores = new Float64Array(1000);
+ *
+ * ddot_batch_strided(16, table, 1, 16, query, 1, 0, scores, 1000);
+ * // scores is filled with 16
+ * ```
+ */
+export function ddot_batch_strided(
+  n: number,
+  x: Float64Array,
+  incx: number,
+  strideX: number,
+  y: Float64Array,
+  incy: number,
+  strideY: number,
+  r: Float64Array,
+  batch: number
+): void {
+  dotBatch(n, { array: x, stride: strideX }, incx, { array: y, stride: strideY }, incy, r, batch);
+}
+
+function dotBatch(
+  n: number,
+  x: BatchOperand,
+  incx: number,
+  y: BatchOperand,
+  incy: number,
+  r: Float64Array,
+  batch: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (!Number.isInteger(batch) || batch < 0) {
+    throw new Error(`batch must be a non-negative integer, got ${batch}`);
+  }
+
+  checkBatchOperand('x', x, batch, 1 + (n - 1) * Math.abs(incx), false);
+  checkBatchOperand('y', y, batch, 1 + (n - 1) * Math.abs(incy), false);
+  if (r.length < batch) {
+    throw new Error(`r array too small: expected at least ${batch}, got ${r.length}`);
+  }
+  if (batch === 0) {
+    return;
+  }
+  if (n === 0) {
+    r.fill(0, 0, batch);
+    return;
+  }
+
+  const native = getNative();
+  if (native && isStrided(x) && isStrided(y)) {
+    native.ddot_batch_strided(n, x.array, incx, x.stride, y.array, incy, y.stride, r, batch);
+    return;
+  }
+
+  // Pack the distinct vectors of each operand back to back
+  const xMembers = batchMembers(x, batch);
+  const yMembers = batchMembers(y, batch);
+  const xSize = packedLength(n, incx);
+  const ySize = packedLength(n, incy);
+  const xStride = xMembers > 1 ? xSize : 0;
+  const yStride = yMembers > 1 ? ySize : 0;
+
+  if (native) {
+    const xData = new Float64Array(xMembers * xSize);
+    const yData = new Float64Array(yMembers * ySize);
+    packVectors(xData, 0, x, xMembers, n, incx);
+    packVectors(yData, 0, y, yMembers, n, incy);
+    native.ddot_batch_strided(
+      n,
+      xData,
+      packedInc(incx),
+      xStride,
+      yData,
+      packedInc(incy),
+      yStride,
+      r,
+      batch
+    );
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget((xMembers * xSize + yMembers * ySize + batch) * 8);
+  const xPtr = module._malloc(xMembers * xSize * 8);
+  const yPtr = module._malloc(yMembers * ySize * 8);
+  const rPtr = module._malloc(batch * 8);
+
+  try {
+    // Copy data to WASM memory
+    packVectors(module.HEAPF64, xPtr / 8, x, xMembers, n, incx);
+    packVectors(module.HEAPF64, yPtr / 8, y, yMembers, n, incy);
+
+    // Call the WASM function
+    module._ddot_batch_strided(
+      n,
+      xPtr,
+      packedInc(incx),
+      xStride,
+      yPtr,
+      packedInc(incy),
+      yStride,
+      rPtr,
+      batch
+    );
+
+    // Copy result back to r
+    r.set(module.HEAPF64.subarray(rPtr / 8, rPtr / 8 + batch));
+  } finally {
+    // Free WASM memory
+    module._free(xPtr);
+    module._free(yPtr);
+    module._free(rPtr);
+  }
+}
@@ -4,7 +4,8 @@
  */
 
 import { Transpose } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs band matrix-vector multiplication: y = alpha * op(A) * x + beta * y
@@ -84,7 +85,17 @@ export function dgbmv(
     throw new Error(`y array is too small: expected at least ${minYSize}, got ${y.length}`);
   }
 
+  // Convert trans to integer
+  const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
+
+  const native = getNative();
+  if (native) {
+    native.dgbmv(transInt, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((a.length + x.length + y.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const xPtr = module._malloc(x.length * 8);
   const yPtr = module._malloc(y.length * 8);
@@ -95,9 +106,6 @@ export function dgbmv(
     module.HEAPF64.set(x, xPtr / 8);
     module.HEAPF64.set(y, yPtr / 8);
 
-    // Convert trans to integer
-    const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
-
     // Call BLAS function
     module._dgbmv(transInt, m, n, kl, ku, alpha, aPtr, lda, xPtr, incx, beta, yPtr, incy);
 
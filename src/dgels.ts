@@ -0,0 +1,234 @@
+/**
+ * DGELS / DGELS_NORMAL - Double precision least squares drivers
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Transpose } from './types';
+import { BlasModule, getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+import { dgeqrfWorkspace } from './dgeqrf';
+import { dormqrWorkspace } from './dormqr';
+
+// Elements of workspace the dgels kernel allocates: tau, the copy A^T for
+// m < n, and the larger of the dgeqrf and dormqr workspaces
+function dgelsWorkspace(m: number, n: number, nrhs: number): number {
+  const k = Math.min(m, n);
+  if (k === 0 || nrhs === 0) {
+    return 0;
+  }
+  const rows = Math.max(m, n);
+  const copy = m < n ? m * n : 0;
+  return k + copy + Math.max(dgeqrfWorkspace(rows, k), dormqrWorkspace(true, rows, nrhs, k));
+}
+
+// Validate the operands shared by both drivers
+function checkOperands(
+  m: number,
+  n: number,
+  nrhs: number,
+  a: Float64Array,
+  lda: number,
+  b: Float64Array,
+  ldb: number
+): void {
+  if (m < 0 || n < 0 || nrhs < 0) {
+    throw new Error('m, n and nrhs must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least ${Math.max(1, m)}, got ${lda}`);
+  }
+  const rows = Math.max(1, m, n);
+  if (ldb < rows) {
+    throw new Error(`ldb must be at least ${rows}, got ${ldb}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (b.length < ldb * nrhs) {
+    throw new Error(`b array too small: expected at least ${ldb * nrhs}, got ${b.length}`);
+  }
+}
+
+// Copy A and B into the heap once, run the driver and copy both back;
+// workspace is the number of elements the driver allocates itself
+function solveInHeap(
+  module: BlasModule,
+  m: number,
+  n: number,
+  nrhs: number,
+  a: Float64Array,
+  lda: number,
+  b: Float64Array,
+  ldb: number,
+  workspace: number,
+  run: (aPtr: number, ldaHeap: number, bPtr: number, ldbHeap: number) => number
+): number {
+  const rows = Math.max(m, n);
+  const ldaHeap = paddedLd(m);
+  const ldbHeap = paddedLd(rows);
+  checkBudget((ldaHeap * n + ldbHeap * nrhs + workspace) * 8);
+  const aPtr = module._malloc_aligned(ldaHeap * n * 8);
+  const bPtr = module._malloc_aligned(ldbHeap * nrhs * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, m, n, aPtr, ldaHeap);
+    packMatrix(module, b, ldb, rows, nrhs, bPtr, ldbHeap);
+
+    // Call the WASM function
+    const info = run(aPtr, ldaHeap, bPtr, ldbHeap);
+
+    // Copy the factorization and the solution back
+    unpackMatrix(module, aPtr, ldaHeap, a, lda, m, n);
+    unpackMatrix(module, bPtr, ldbHeap, b, ldb, rows, nrhs);
+    return info;
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(bPtr);
+  }
+}
+
+/**
+ * Solves overdetermined or underdetermined linear systems with a full rank
+ * m x n matrix A, for all columns of B in one call:
+ * - trans 'N', m >= n: the least squares solution of min ||B - A*X||
+ * - trans 'N', m < n: the minimum norm solution of A*X = B
+ * - trans 'T', m >= n: the minimum norm solution of A^T*X = B
+ * - trans 'T', m < n: the least squares solution of min ||B - A^T*X||
+ *
+ * A is factored by QR (dgeqrf) if m >= n and by LQ if m < n, and the whole
+ * solve runs in one kernel call: A and B are copied into WebAssembly memory
+ * once and back once.
+ *
+ * @param trans - 'N': solve with A, 'T'/'C': solve with A^T
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param nrhs - Number of columns of B and X
+ * @param a - Input matrix A in column-major order (Float64Array); output its QR or LQ
+ *            factorization
+ * @param lda - Leading dimension of A
+ * @param b - Input right-hand sides in the first m ('N') or n ('T') rows, output the
+ *            solution X in the first n ('N') or m ('T') rows, in column-major order
+ *            (Float64Array)
+ * @param ldb - Leading dimension of B, at least max(1, m, n)
+ * @returns 0 on success, i > 0 if the i-th diagonal element of the triangular factor is
+ *          exactly zero (A does not have full rank)
+ * @modifies a - The a matrix is overwritten by its factorization
+ * @modifies b - The b matrix is overwritten by the solution
+ *
+ * @example
+ * ```typescript
+ * import { dgels, initWasm, Transpose } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * // Fit y = c0 + c1 * t to (0, 1), (1, 3), (2, 5.5)
+ * const A = new Float64Array([1, 1, 1, 0, 1, 2]);
+ * const b = new Float64Array([1, 3, 5.5]);
+ *
+ * dgels(Transpose.NoTranspose, 3, 2, 1, A, 3, b, 3); // 0
+ * // b[0] = 0.916..., b[1] = 2.25
+ * ```
+ */
+export function dgels(
+  trans: Transpose,
+  m: number,
+  n: number,
+  nrhs: number,
+  a: Float64Array,
+  lda: number,
+  b: Float64Array,
+  ldb: number
+): number {
+  const module = getModule();
+
+  // Handle edge cases
+  checkOperands(m, n, nrhs, a, lda, b, ldb);
+  if (nrhs === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const transChar = trans.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    return native.dgels(transChar, m, n, nrhs, a, lda, b, ldb);
+  }
+
+  const work = dgelsWorkspace(m, n, nrhs);
+  return solveInHeap(module, m, n, nrhs, a, lda, b, ldb, work, (aPtr, ldaHeap, bPtr, ldbHeap) =>
+    module._dgels(transChar, m, n, nrhs, aPtr, ldaHeap, bPtr, ldbHeap)
+  );
+}
+
+/**
+ * Solves the least squares problem min ||B - A*X|| for a full rank m x n
+ * matrix A with m >= n by the normal equations A^T*A*X = A^T*B
+ *
+ * A^T*A is formed with dsyrk and factored by Cholesky (dpotrf): half the
+ * flops of the QR factorization in dgels and a single pass over A, which
+ * makes this the fastest way to fit tall, well-conditioned problems. The
+ * error of the normal equations grows with cond(A)^2, so when the Cholesky
+ * factor shows that cond(A) exceeds about 10^4, or A^T*A is not positive
+ * definite, the kernel solves the problem with dgels instead.
+ *
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A, at most m
+ * @param nrhs - Number of columns of B and X
+ * @param a - Input matrix A in column-major order (Float64Array); overwritten by its QR
+ *            factorization only if the solve falls back to dgels
+ * @param lda - Leading dimension of A
+ * @param b - Input right-hand sides (m x nrhs), output the solution X in the first n rows,
+ *            in column-major order (Float64Array)
+ * @param ldb - Leading dimension of B
+ * @returns 0 on success, or the result of dgels after a fallback
+ * @modifies b - The b matrix is overwritten by the solution
+ *
+ * @example
+ * ```typescript
+ * import { dgels_normal, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * // Fit y = c0 + c1 * t to (0, 1), (1, 3), (2, 5.5)
+ * const A = new Float64Array([1, 1, 1, 0, 1, 2]);
+ * const b = new Float64Array([1, 3, 5.5]);
+ *
+ * dgels_normal(3, 2, 1, A, 3, b, 3); // 0
+ * // b[0] = 0.916..., b[1] = 2.25
+ * ```
+ */
+export function dgels_normal(
+  m: number,
+  n: number,
+  nrhs: number,
+  a: Float64Array,
+  lda: number,
+  b: Float64Array,
+  ldb: number
+): number {
+  const module = getModule();
+
+  // Handle edge cases
+  checkOperands(m, n, nrhs, a, lda, b, ldb);
+  if (n > m) {
+    throw new Error(`n must be at most m = ${m}, got ${n}`);
+  }
+  if (nrhs === 0) {
+    return 0;
+  }
+
+  const native = getNative();
+  if (native) {
+    return native.dgels_normal(m, n, nrhs, a, lda, b, ldb);
+  }
+
+  // C = A^T*A and Y = A^T*B, kept while the kernel may fall back to dgels
+  const work = n * (n + nrhs) + dgelsWorkspace(m, n, nrhs);
+  return solveInHeap(module, m, n, nrhs, a, lda, b, ldb, work, (aPtr, ldaHeap, bPtr, ldbHeap) =>
+    module._dgels_normal(m, n, nrhs, aPtr, ldaHeap, bPtr, ldbHeap)
+  );
+}
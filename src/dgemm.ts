@@ -4,7 +4,9 @@
  */
 
 import { Transpose } from './types';
-import { getModule } from './wasm-module';
+import { BlasModule, getModule, getNative } from './wasm-module';
+import { availableBytes, countTiledCall, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
 
 /**
  * Performs matrix-matrix multiplication: C = alpha * op(A) * op(B) + beta * C
@@ -90,25 +92,60 @@ export function dgemm(
     throw new Error(`c array too small: expected at least ${ldc * n}, got ${c.length}`);
   }
 
+  // Convert parameters for the kernel
+  const transaChar = transa.charCodeAt(0);
+  const transbChar = transb.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dgemm(transaChar, transbChar, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
+
+  // Matrices are copied to aligned blocks with padded leading dimensions
+  const ldaHeap = paddedLd(aRows);
+  const ldbHeap = paddedLd(bRows);
+  const ldcHeap = paddedLd(m);
+  const aSize = ldaHeap * aCols;
+  const bSize = ldbHeap * bCols;
+  const cSize = ldcHeap * n;
+
+  // Operands that do not fit the memory budget are multiplied tile by tile
+  if ((aSize + bSize + cSize) * 8 > availableBytes()) {
+    dgemmTiled(module, isTransA, isTransB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
+
   // Allocate memory in WASM
-  const aPtr = module._malloc(a.length * 8);
-  const bPtr = module._malloc(b.length * 8);
-  const cPtr = module._malloc(c.length * 8);
+  const aPtr = module._malloc_aligned(aSize * 8);
+  const bPtr = module._malloc_aligned(bSize * 8);
+  const cPtr = module._malloc_aligned(cSize * 8);
 
   try {
     // Copy data to WASM memory
-    module.HEAPF64.set(a, aPtr / 8);
-    module.HEAPF64.set(b, bPtr / 8);
-    module.HEAPF64.set(c, cPtr / 8);
+    packMatrix(module, a, lda, aRows, aCols, aPtr, ldaHeap);
+    packMatrix(module, b, ldb, bRows, bCols, bPtr, ldbHeap);
+    packMatrix(module, c, ldc, m, n, cPtr, ldcHeap);
 
     // Call the WASM function
-    const transaChar = transa.charCodeAt(0);
-    const transbChar = transb.charCodeAt(0);
-    module._dgemm(transaChar, transbChar, m, n, k, alpha, aPtr, lda, bPtr, ldb, beta, cPtr, ldc);
+    module._dgemm(
+      transaChar,
+      transbChar,
+      m,
+      n,
+      k,
+      alpha,
+      aPtr,
+      ldaHeap,
+      bPtr,
+      ldbHeap,
+      beta,
+      cPtr,
+      ldcHeap
+    );
 
     // Copy result back to c
-    const result = module.HEAPF64.subarray(cPtr / 8, cPtr / 8 + c.length);
-    c.set(result);
+    unpackMatrix(module, cPtr, ldcHeap, c, ldc, m, n);
   } finally {
     // Free WASM memory
     module._free(aPtr);
@@ -116,3 +153,133 @@ export function dgemm(
     module._free(cPtr);
   }
 }
+
+/**
+ * Copy the rows x cols block of x starting at (row, col) into the heap at ptr,
+ * with leading dimension ldHeap (or back out of it, with toHeap = false)
+ */
+function copyBlock(
+  module: BlasModule,
+  x: Float64Array,
+  ldx: number,
+  row: number,
+  col: number,
+  rows: number,
+  cols: number,
+  ptr: number,
+  ldHeap: number,
+  toHeap: boolean
+): void {
+  for (let j = 0; j < cols; j++) {
+    const start = (col + j) * ldx + row;
+    const offset = ptr / 8 + j * ldHeap;
+    if (toHeap) {
+      module.HEAPF64.set(x.subarray(start, start + rows), offset);
+    } else {
+      x.set(module.HEAPF64.subarray(offset, offset + rows), start);
+    }
+  }
+}
+
+/**
+ * DGEMM with scratch buffers bounded by the memory budget: C is computed in
+ * mb x nb tiles, accumulating over kb-deep slices of op(A) and op(B). Tile
+ * sizes start at the full problem and the largest is halved until the three
+ * scratch tiles fit. The tiles are aligned blocks with padded leading
+ * dimensions, like the operands of an untiled call.
+ */
+function dgemmTiled(
+  module: BlasModule,
+  isTransA: boolean,
+  isTransB: boolean,
+  m: number,
+  n: number,
+  k: number,
+  alpha: number,
+  a: Float64Array,
+  lda: number,
+  b: Float64Array,
+  ldb: number,
+  beta: number,
+  c: Float64Array,
+  ldc: number
+): void {
+  const maxElements = Math.floor(availableBytes() / 8);
+  let mb = Math.max(m, 1);
+  let nb = Math.max(n, 1);
+  let kb = Math.max(k, 1);
+  const ldaTile = () => paddedLd(isTransA ? kb : mb);
+  const ldbTile = () => paddedLd(isTransB ? nb : kb);
+  const tileElements = () =>
+    ldaTile() * (isTransA ? mb : kb) + ldbTile() * (isTransB ? kb : nb) + paddedLd(mb) * nb;
+  while (tileElements() > maxElements) {
+    if (mb === 1 && nb === 1 && kb === 1) {
+      throw new Error(`memory budget too small for dgemm: ${availableBytes()} bytes available`);
+    }
+    if (kb >= mb && kb >= nb) {
+      kb = Math.ceil(kb / 2);
+    } else if (mb >= nb) {
+      mb = Math.ceil(mb / 2);
+    } else {
+      nb = Math.ceil(nb / 2);
+    }
+  }
+  countTiledCall();
+
+  const transa = (isTransA ? 'T' : 'N').charCodeAt(0);
+  const transb = (isTransB ? 'T' : 'N').charCodeAt(0);
+  const ldaHeap = ldaTile();
+  const ldbHeap = ldbTile();
+  const ldcHeap = paddedLd(mb);
+  const aPtr = module._malloc_aligned(ldaHeap * (isTransA ? mb : kb) * 8);
+  const bPtr = module._malloc_aligned(ldbHeap * (isTransB ? kb : nb) * 8);
+  const cPtr = module._malloc_aligned(ldcHeap * nb * 8);
+
+  try {
+    for (let jc = 0; jc < n; jc += nb) {
+      const nc = Math.min(nb, n - jc);
+      for (let ic = 0; ic < m; ic += mb) {
+        const mc = Math.min(mb, m - ic);
+        copyBlock(module, c, ldc, ic, jc, mc, nc, cPtr, ldcHeap, true);
+
+        // With k = 0 one call still applies beta to C
+        for (let pc = 0; pc < Math.max(k, 1); pc += kb) {
+          const kc = Math.min(kb, k - pc);
+          if (isTransA) {
+            copyBlock(module, a, lda, pc, ic, kc, mc, aPtr, ldaHeap, true);
+          } else {
+            copyBlock(module, a, lda, ic, pc, mc, kc, aPtr, ldaHeap, true);
+          }
+          if (isTransB) {
+            copyBlock(module, b, ldb, jc, pc, nc, kc, bPtr, ldbHeap, true);
+          } else {
+            copyBlock(module, b, ldb, pc, jc, kc, nc, bPtr, ldbHeap, true);
+          }
+
+          const betaTile = pc === 0 ? beta : 1.0;
+          module._dgemm(
+            transa,
+            transb,
+            mc,
+            nc,
+            kc,
+            alpha,
+            aPtr,
+            ldaHeap,
+            bPtr,
+            ldbHeap,
+            betaTile,
+            cPtr,
+            ldcHeap
+          );
+        }
+
+        copyBlock(module, c, ldc, ic, jc, mc, nc, cPtr, ldcHeap, false);
+      }
+    }
+  } finally {
+    module._free(aPtr);
+    module._free(bPtr);
+    module._free(cPtr);
+  }
+}
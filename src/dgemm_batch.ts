@@ -0,0 +1,280 @@
+/**
+ * DGEMM_BATCH - Grouped batch of double precision matrix-matrix multiplications
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Transpose } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { batchMembers, checkBatchOperand, packMatrices, unpackMatrices } from './batch';
+
+/**
+ * A group of dgemm problems with the same flags, sizes and scalars
+ */
+export interface GemmGroup {
+  /** 'N': op(A) = A, 'T'/'C': op(A) = A^T */
+  transa: Transpose;
+  /** 'N': op(B) = B, 'T'/'C': op(B) = B^T */
+  transb: Transpose;
+  /** Rows of op(A) and C */
+  m: number;
+  /** Columns of op(B) and C */
+  n: number;
+  /** Columns of op(A) and rows of op(B) */
+  k: number;
+  /** Scalar multiplier for op(A)*op(B) */
+  alpha: number;
+  /** Matrices A in column-major order, one per problem or one shared by the group */
+  a: Float64Array[];
+  /** Leading dimension of the A matrices */
+  lda: number;
+  /** Matrices B in column-major order, one per problem or one shared by the group */
+  b: Float64Array[];
+  /** Leading dimension of the B matrices */
+  ldb: number;
+  /** Scalar multiplier for C */
+  beta: number;
+  /** Input/output matrices C, one per problem; their number is the group size */
+  c: Float64Array[];
+  /** Leading dimension of the C matrices */
+  ldc: number;
+}
+
+/**
+ * Performs C = alpha * op(A) * op(B) + beta * C for every problem of every
+ * group, in one call
+ *
+ * Groups may have different sizes, e.g. one group per block size of a
+ * graph network. On the native backend the problems are scheduled across
+ * threads by their flop count: the largest each use all threads, one after
+ * the other, and the rest run concurrently, largest first, so that a large
+ * problem does not finish last on a single thread.
+ *
+ * @param groups - The groups of problems (see GemmGroup)
+ * @modifies groups[g].c - Each C matrix is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { dgemm_batch, initWasm, Transpose } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const I2 = new Float64Array([1, 0, 0, 1]);
+ * const small = [new Float64Array([1, 2, 3, 4]), new Float64Array([5, 6, 7, 8])];
+ * const big = new Float64Array(9).fill(1);
+ *
+ * const N = Transpose.NoTranspose;
+ * dgemm_batch([
+ *   // Two 2x2 products sharing A
+ *   { transa: N, transb: N, m: 2, n: 2, k: 2, alpha: 2, a: [I2], lda: 2, b: small, ldb: 2,
+ *     beta: 0, c: [new Float64Array(4), new Float64Array(4)], ldc: 2 },
+ *   // One 3x3 product
+ *   { transa: N, transb: N, m: 3, n: 3, k: 3, alpha: 1, a: [big], lda: 3, b: [big], ldb: 3,
+ *     beta: 0, c: [new Float64Array(9)], ldc: 3 },
+ * ]);
+ * // first group: 2 * small[b]; second group: a 3x3 matrix of 3s
+ * ```
+ */
+export function dgemm_batch(groups: GemmGroup[]): void {
+  const module = getModule();
+  const native = getNative();
+  const groupCount = groups.length;
+
+  // Handle edge cases
+  const shapes = groups.map((group, g) => {
+    const { transa, transb, m, n, k, lda, ldb, ldc } = group;
+    if (m < 0 || n < 0 || k < 0) {
+      throw new Error(`groups[${g}]: m, n, and k must be non-negative`);
+    }
+    const isTransA = transa === Transpose.Transpose || transa === Transpose.ConjugateTranspose;
+    const isTransB = transb === Transpose.Transpose || transb === Transpose.ConjugateTranspose;
+    const aRows = isTransA ? k : m;
+    const aCols = isTransA ? m : k;
+    const bRows = isTransB ? n : k;
+    const bCols = isTransB ? k : n;
+    if (lda < Math.max(1, aRows)) {
+      throw new Error(`groups[${g}]: lda must be at least ${Math.max(1, aRows)}, got ${lda}`);
+    }
+    if (ldb < Math.max(1, bRows)) {
+      throw new Error(`groups[${g}]: ldb must be at least ${Math.max(1, bRows)}, got ${ldb}`);
+    }
+    if (ldc < Math.max(1, m)) {
+      throw new Error(`groups[${g}]: ldc must be at least ${Math.max(1, m)}, got ${ldc}`);
+    }
+
+    const size = group.c.length;
+    checkBatchOperand(`groups[${g}].a`, group.a, size, lda * aCols, false);
+    checkBatchOperand(`groups[${g}].b`, group.b, size, ldb * bCols, false);
+    checkBatchOperand(`groups[${g}].c`, group.c, size, ldc * n, true);
+
+    // Leading dimensions of the packed copies; A, B and C get padded
+    // columns in the WASM heap
+    const ld = (rows: number) => (native ? Math.max(1, rows) : paddedLd(rows));
+    return {
+      size,
+      aRows,
+      aCols,
+      bRows,
+      bCols,
+      lda: ld(aRows),
+      ldb: ld(bRows),
+      ldc: ld(m),
+      aMembers: batchMembers(group.a, size),
+      bMembers: batchMembers(group.b, size),
+    };
+  });
+
+  const count = shapes.reduce((sum, s) => sum + s.size, 0);
+  if (count === 0) {
+    return;
+  }
+
+  // Pack the distinct matrices of all groups back to back; offsets give the
+  // position of each problem's operands
+  const offa = new Int32Array(count);
+  const offb = new Int32Array(count);
+  const offc = new Int32Array(count);
+  const bases = shapes.map(() => ({ a: 0, b: 0, c: 0 }));
+  let aTotal = 0;
+  let bTotal = 0;
+  let cTotal = 0;
+  let p = 0;
+  shapes.forEach((s, g) => {
+    const aSize = s.lda * s.aCols;
+    const bSize = s.ldb * s.bCols;
+    const cSize = s.ldc * groups[g].n;
+    bases[g] = { a: aTotal, b: bTotal, c: cTotal };
+    for (let i = 0; i < s.size; i++, p++) {
+      offa[p] = aTotal + (s.aMembers > 1 ? i * aSize : 0);
+      offb[p] = bTotal + (s.bMembers > 1 ? i * bSize : 0);
+      offc[p] = cTotal + i * cSize;
+    }
+    aTotal += s.aMembers * aSize;
+    bTotal += s.bMembers * bSize;
+    cTotal += s.size * cSize;
+  });
+  if (Math.max(aTotal, bTotal, cTotal) > 0x7fffffff) {
+    throw new Error('dgemm_batch operands exceed 2^31 elements');
+  }
+
+  // Per-group parameters for the kernel
+  const groupSize = Int32Array.from(shapes, (s) => s.size);
+  const transa = Int32Array.from(groups, (group) => group.transa.charCodeAt(0));
+  const transb = Int32Array.from(groups, (group) => group.transb.charCodeAt(0));
+  const m = Int32Array.from(groups, (group) => group.m);
+  const n = Int32Array.from(groups, (group) => group.n);
+  const k = Int32Array.from(groups, (group) => group.k);
+  const lda = Int32Array.from(shapes, (s) => s.lda);
+  const ldb = Int32Array.from(shapes, (s) => s.ldb);
+  const ldc = Int32Array.from(shapes, (s) => s.ldc);
+  const alpha = Float64Array.from(groups, (group) => group.alpha);
+  const beta = Float64Array.from(groups, (group) => group.beta);
+
+  // Copy the operands of every group to the packed arrays, starting at
+  // ak, bk and ck (and C back)
+  const pack = (
+    aData: Float64Array,
+    ak: number,
+    bData: Float64Array,
+    bk: number,
+    cData: Float64Array,
+    ck: number
+  ) => {
+    shapes.forEach((s, g) => {
+      const { a, b, c } = groups[g];
+      const base = bases[g];
+      packMatrices(aData, ak + base.a, a, s.aMembers, groups[g].lda, s.aRows, s.aCols, s.lda);
+      packMatrices(bData, bk + base.b, b, s.bMembers, groups[g].ldb, s.bRows, s.bCols, s.ldb);
+      packMatrices(cData, ck + base.c, c, s.size, groups[g].ldc, groups[g].m, groups[g].n, s.ldc);
+    });
+  };
+  const unpack = (cData: Float64Array, ck: number) => {
+    shapes.forEach((s, g) => {
+      const { c, ldc, m, n } = groups[g];
+      unpackMatrices(cData, ck + bases[g].c, c, s.size, ldc, m, n, s.ldc);
+    });
+  };
+
+  if (native) {
+    const aData = new Float64Array(aTotal);
+    const bData = new Float64Array(bTotal);
+    const cData = new Float64Array(cTotal);
+    pack(aData, 0, bData, 0, cData, 0);
+    native.dgemm_batch(
+      groupCount,
+      groupSize,
+      transa,
+      transb,
+      m,
+      n,
+      k,
+      alpha,
+      aData,
+      lda,
+      offa,
+      bData,
+      ldb,
+      offb,
+      beta,
+      cData,
+      ldc,
+      offc
+    );
+    unpack(cData, 0);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ints = [groupSize, transa, transb, m, n, k, lda, ldb, ldc, offa, offb, offc];
+  const intCount = 9 * groupCount + 3 * count;
+  checkBudget((aTotal + bTotal + cTotal + 2 * groupCount) * 8 + intCount * 4);
+  const aPtr = module._malloc_aligned(aTotal * 8);
+  const bPtr = module._malloc_aligned(bTotal * 8);
+  const cPtr = module._malloc_aligned(cTotal * 8);
+  const intPtrs = ints.map((values) => module._malloc(values.length * 4));
+  const alphaPtr = module._malloc(groupCount * 8);
+  const betaPtr = module._malloc(groupCount * 8);
+
+  try {
+    // Copy data to WASM memory
+    pack(module.HEAPF64, aPtr / 8, module.HEAPF64, bPtr / 8, module.HEAPF64, cPtr / 8);
+    ints.forEach((values, i) => module.HEAP32.set(values, intPtrs[i] / 4));
+    module.HEAPF64.set(alpha, alphaPtr / 8);
+    module.HEAPF64.set(beta, betaPtr / 8);
+
+    // Call the WASM function
+    const [sizePtr, transaPtr, transbPtr, mPtr, nPtr, kPtr] = intPtrs;
+    const [ldaPtr, ldbPtr, ldcPtr, offaPtr, offbPtr, offcPtr] = intPtrs.slice(6);
+    module._dgemm_batch(
+      groupCount,
+      sizePtr,
+      transaPtr,
+      transbPtr,
+      mPtr,
+      nPtr,
+      kPtr,
+      alphaPtr,
+      aPtr,
+      ldaPtr,
+      offaPtr,
+      bPtr,
+      ldbPtr,
+      offbPtr,
+      betaPtr,
+      cPtr,
+      ldcPtr,
+      offcPtr
+    );
+
+    // Copy result back to c
+    unpack(module.HEAPF64, cPtr / 8);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(bPtr);
+    module._free(cPtr);
+    intPtrs.forEach((ptr) => module._free(ptr));
+    module._free(alphaPtr);
+    module._free(betaPtr);
+  }
+}
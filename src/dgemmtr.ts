@@ -4,7 +4,8 @@
  */
 
 import { Transpose, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs general matrix-matrix multiplication storing only triangular part:
@@ -79,7 +80,19 @@ export function dgemmtr(
 
   // Input arrays are already Float64Array
 
+  // Convert parameters to integers
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+  const transaInt = transa === Transpose.NoTranspose ? 0 : transa === Transpose.Transpose ? 1 : 2;
+  const transbInt = transb === Transpose.NoTranspose ? 0 : transb === Transpose.Transpose ? 1 : 2;
+
+  const native = getNative();
+  if (native) {
+    native.dgemmtr(uploInt, transaInt, transbInt, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((a.length + b.length + c.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const bPtr = module._malloc(b.length * 8);
   const cPtr = module._malloc(c.length * 8);
@@ -90,11 +103,6 @@ export function dgemmtr(
     module.HEAPF64.set(b, bPtr / 8);
     module.HEAPF64.set(c, cPtr / 8);
 
-    // Convert parameters to integers
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-    const transaInt = transa === Transpose.NoTranspose ? 0 : transa === Transpose.Transpose ? 1 : 2;
-    const transbInt = transb === Transpose.NoTranspose ? 0 : transb === Transpose.Transpose ? 1 : 2;
-
     // Call BLAS function
     module._dgemmtr(
       uploInt,
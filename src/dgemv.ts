@@ -4,7 +4,9 @@
  */
 
 import { Transpose } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { gather, packedInc, packedLength, packMatrix, scatter } from './utils';
 
 /**
  * Performs matrix-vector multiplication: y = alpha * A * x + beta * y or y = alpha * A^T * x + beta * y
@@ -74,24 +76,48 @@ export function dgemv(
     throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
   }
 
-  // Allocate memory in WASM
-  const aPtr = module._malloc(a.length * 8);
-  const xPtr = module._malloc(x.length * 8);
-  const yPtr = module._malloc(y.length * 8);
+  // Convert parameters for the kernel
+  const transChar = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
+
+  const native = getNative();
+  if (native) {
+    native.dgemv(transChar, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    return;
+  }
+
+  // Allocate memory in WASM; A gets an aligned block with a padded leading
+  // dimension, the vectors are packed contiguously
+  const xCount = packedLength(xLen, incx);
+  const yCount = packedLength(yLen, incy);
+  const ldaHeap = paddedLd(m);
+  checkBudget((ldaHeap * n + xCount + yCount) * 8);
+  const aPtr = module._malloc_aligned(ldaHeap * n * 8);
+  const xPtr = module._malloc(xCount * 8);
+  const yPtr = module._malloc(yCount * 8);
 
   try {
     // Copy data to WASM memory
-    module.HEAPF64.set(a, aPtr / 8);
-    module.HEAPF64.set(x, xPtr / 8);
-    module.HEAPF64.set(y, yPtr / 8);
+    packMatrix(module, a, lda, m, n, aPtr, ldaHeap);
+    gather(module, x, xLen, incx, xPtr);
+    gather(module, y, yLen, incy, yPtr);
 
     // Call the WASM function
-    const transChar = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
-    module._dgemv(transChar, m, n, alpha, aPtr, lda, xPtr, incx, beta, yPtr, incy);
+    module._dgemv(
+      transChar,
+      m,
+      n,
+      alpha,
+      aPtr,
+      ldaHeap,
+      xPtr,
+      packedInc(incx),
+      beta,
+      yPtr,
+      packedInc(incy)
+    );
 
     // Copy result back to y
-    const result = module.HEAPF64.subarray(yPtr / 8, yPtr / 8 + y.length);
-    y.set(result);
+    scatter(module, yPtr, y, yLen, incy);
   } finally {
     // Free WASM memory
     module._free(aPtr);
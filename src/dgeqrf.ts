@@ -0,0 +1,110 @@
+/**
+ * DGEQRF - Double precision QR factorization of a general matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Block size of the dgeqrf and dormqr kernels (NB)
+ * @internal
+ */
+export const QR_BLOCK = 32;
+
+/**
+ * Elements of workspace the dgeqrf kernel allocates for an m x n matrix:
+ * the triangular factor of one panel and the block update of the columns
+ * @internal
+ */
+export function dgeqrfWorkspace(m: number, n: number): number {
+  const nb = Math.min(m, n, QR_BLOCK);
+  return nb * nb + n * nb;
+}
+
+/**
+ * Computes the QR factorization A = Q*R of an m x n matrix, where Q is the
+ * product of min(m, n) Householder reflectors H(i) = I - tau[i] * v(i) * v(i)^T
+ *
+ * Panels of 32 columns are factored with dgemv and dger and applied to the
+ * rest of the matrix as one block reflector with dtrmm and dgemm. Use dormqr
+ * to multiply by Q or Q^T.
+ *
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param a - Input matrix A in column-major order (Float64Array); output R on and above the
+ *            diagonal and the vectors v(i) below it (v(i)[i] = 1 is not stored)
+ * @param lda - Leading dimension of A
+ * @param tau - Output scalar factors of the reflectors (Float64Array of length min(m, n))
+ * @modifies a - The a matrix is overwritten by R and the reflectors
+ * @modifies tau - The scalar factors
+ *
+ * @example
+ * ```typescript
+ * import { dgeqrf, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([3, 4, 1, 2]); // [[3,1], [4,2]]
+ * const tau = new Float64Array(2);
+ *
+ * dgeqrf(2, 2, A, 2, tau);
+ * // R = [[-5,-2.2], [0,0.4]] on and above the diagonal of A
+ * ```
+ */
+export function dgeqrf(
+  m: number,
+  n: number,
+  a: Float64Array,
+  lda: number,
+  tau: Float64Array
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  const k = Math.min(m, n);
+  if (tau.length < k) {
+    throw new Error(`tau array too small: expected at least ${k}, got ${tau.length}`);
+  }
+  if (k === 0) {
+    return;
+  }
+
+  const native = getNative();
+  if (native) {
+    native.dgeqrf(m, n, a, lda, tau);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget((ld * n + k + dgeqrfWorkspace(m, n)) * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+  const tauPtr = module._malloc(k * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, m, n, aPtr, ld);
+
+    // Call the WASM function
+    module._dgeqrf(m, n, aPtr, ld, tauPtr);
+
+    // Copy the factorization back
+    unpackMatrix(module, aPtr, ld, a, lda, m, n);
+    tau.set(module.HEAPF64.subarray(tauPtr / 8, tauPtr / 8 + k));
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(tauPtr);
+  }
+}
@@ -3,7 +3,9 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { gather, packedInc, packedLength, packMatrix, unpackMatrix } from './utils';
 
 /**
  * Performs rank-1 update: A := alpha * x * y^T + A
@@ -68,23 +70,33 @@ export function dger(
     throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
   }
 
-  // Allocate memory in WASM
-  const xPtr = module._malloc(x.length * 8);
-  const yPtr = module._malloc(y.length * 8);
-  const aPtr = module._malloc(a.length * 8);
+  const native = getNative();
+  if (native) {
+    native.dger(m, n, alpha, x, incx, y, incy, a, lda);
+    return;
+  }
+
+  // Allocate memory in WASM; A gets an aligned block with a padded leading
+  // dimension, the vectors are packed contiguously
+  const xCount = packedLength(m, incx);
+  const yCount = packedLength(n, incy);
+  const ldaHeap = paddedLd(m);
+  checkBudget((xCount + yCount + ldaHeap * n) * 8);
+  const xPtr = module._malloc(xCount * 8);
+  const yPtr = module._malloc(yCount * 8);
+  const aPtr = module._malloc_aligned(ldaHeap * n * 8);
 
   try {
     // Copy data to WASM memory
-    module.HEAPF64.set(x, xPtr / 8);
-    module.HEAPF64.set(y, yPtr / 8);
-    module.HEAPF64.set(a, aPtr / 8);
+    gather(module, x, m, incx, xPtr);
+    gather(module, y, n, incy, yPtr);
+    packMatrix(module, a, lda, m, n, aPtr, ldaHeap);
 
     // Call the WASM function
-    module._dger(m, n, alpha, xPtr, incx, yPtr, incy, aPtr, lda);
+    module._dger(m, n, alpha, xPtr, packedInc(incx), yPtr, packedInc(incy), aPtr, ldaHeap);
 
     // Copy result back to a
-    const result = module.HEAPF64.subarray(aPtr / 8, aPtr / 8 + a.length);
-    a.set(result);
+    unpackMatrix(module, aPtr, ldaHeap, a, lda, m, n);
   } finally {
     // Free WASM memory
     module._free(xPtr);
@@ -0,0 +1,244 @@
+/**
+ * DGER_BATCH - Batched double precision general rank-1 update
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packedInc, packedLength } from './utils';
+import {
+  BatchOperand,
+  batchMembers,
+  checkBatchOperand,
+  isStrided,
+  packMatrices,
+  packVectors,
+  unpackMatrices,
+} from './batch';
+
+/**
+ * Performs the rank-1 update A_b := alpha * x_b * y_b^T + A_b for every
+ * problem b of a batch, in one call
+ *
+ * The problems are given as arrays of operands, one per problem; x and y may
+ * instead hold a single vector that all problems share. See dgemv_batch()
+ * for the execution.
+ *
+ * @param m - Number of rows of each A_b
+ * @param n - Number of columns of each A_b
+ * @param alpha - Scalar multiplier
+ * @param x - Input vectors x_b of m elements, one or a.length of them
+ * @param incx - Storage spacing between elements of each x_b
+ * @param y - Input vectors y_b of n elements, one or a.length of them
+ * @param incy - Storage spacing between elements of each y_b
+ * @param a - Input/output matrices A_b in column-major order, one per problem
+ * @param lda - Leading dimension of each A_b
+ * @modifies a - Each A_b is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { dger_batch, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const x = new Float64Array([1, 2]); // shared
+ * const ys = [new Float64Array([1, 0]), new Float64Array([0, 1])];
+ * const As = [new Float64Array(4), new Float64Array(4)];
+ *
+ * dger_batch(2, 2, 1.0, [x], 1, ys, 1, As, 2);
+ * // As = [[1, 2, 0, 0], [0, 0, 1, 2]]
+ * ```
+ */
+export function dger_batch(
+  m: number,
+  n: number,
+  alpha: number,
+  x: Float64Array[],
+  incx: number,
+  y: Float64Array[],
+  incy: number,
+  a: Float64Array[],
+  lda: number
+): void {
+  gerBatch(m, n, alpha, x, incx, y, incy, a, lda, a.length);
+}
+
+/**
+ * Performs the rank-1 update A_b := alpha * x_b * y_b^T + A_b for
+ * b = 0, ..., batch - 1, where the operands of problem b start at
+ * b * stride in x, y and a
+ *
+ * A stride of 0 for x or y shares that vector between all problems. See
+ * dgemv_batch() for the execution.
+ *
+ * @param m - Number of rows of each A_b
+ * @param n - Number of columns of each A_b
+ * @param alpha - Scalar multiplier
+ * @param x - Input vectors x_b (Float64Array)
+ * @param incx - Storage spacing between elements of each x_b
+ * @param strideX - Elements between successive x_b (0: shared)
+ * @param y - Input vectors y_b (Float64Array)
+ * @param incy - Storage spacing between elements of each y_b
+ * @param strideY - Elements between successive y_b (0: shared)
+ * @param a - Input/output matrices A_b in column-major order (Float64Array)
+ * @param lda - Leading dimension of each A_b
+ * @param strideA - Elements between successive A_b
+ * @param batch - Number of problems
+ * @modifies a - Each A_b is modified in-place
+ */
+export function dger_batch_strided(
+  m: number,
+  n: number,
+  alpha: number,
+  x: Float64Array,
+  incx: number,
+  strideX: number,
+  y: Float64Array,
+  incy: number,
+  strideY: number,
+  a: Float64Array,
+  lda: number,
+  strideA: number,
+  batch: number
+): void {
+  gerBatch(
+    m,
+    n,
+    alpha,
+    { array: x, stride: strideX },
+    incx,
+    { array: y, stride: strideY },
+    incy,
+    { array: a, stride: strideA },
+    lda,
+    batch
+  );
+}
+
+function gerBatch(
+  m: number,
+  n: number,
+  alpha: number,
+  x: BatchOperand,
+  incx: number,
+  y: BatchOperand,
+  incy: number,
+  a: BatchOperand,
+  lda: number,
+  batch: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (!Number.isInteger(batch) || batch < 0) {
+    throw new Error(`batch must be a non-negative integer, got ${batch}`);
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+
+  checkBatchOperand('x', x, batch, 1 + (m - 1) * Math.abs(incx), false);
+  checkBatchOperand('y', y, batch, 1 + (n - 1) * Math.abs(incy), false);
+  checkBatchOperand('a', a, batch, lda * n, true);
+  if (batch === 0 || m === 0 || n === 0) {
+    return;
+  }
+
+  const native = getNative();
+  if (native && isStrided(x) && isStrided(y) && isStrided(a)) {
+    native.dger_batch_strided(
+      m,
+      n,
+      alpha,
+      x.array,
+      incx,
+      x.stride,
+      y.array,
+      incy,
+      y.stride,
+      a.array,
+      lda,
+      a.stride,
+      batch
+    );
+    return;
+  }
+
+  // Pack the distinct members of each operand back to back; A gets padded
+  // columns in the WASM heap
+  const ld = native ? m : paddedLd(m);
+  const xMembers = batchMembers(x, batch);
+  const yMembers = batchMembers(y, batch);
+  const xSize = packedLength(m, incx);
+  const ySize = packedLength(n, incy);
+  const aSize = ld * n;
+  const xStride = xMembers > 1 ? xSize : 0;
+  const yStride = yMembers > 1 ? ySize : 0;
+
+  if (native) {
+    const xData = new Float64Array(xMembers * xSize);
+    const yData = new Float64Array(yMembers * ySize);
+    const aData = new Float64Array(batch * aSize);
+    packVectors(xData, 0, x, xMembers, m, incx);
+    packVectors(yData, 0, y, yMembers, n, incy);
+    packMatrices(aData, 0, a, batch, lda, m, n, ld);
+    native.dger_batch_strided(
+      m,
+      n,
+      alpha,
+      xData,
+      packedInc(incx),
+      xStride,
+      yData,
+      packedInc(incy),
+      yStride,
+      aData,
+      ld,
+      aSize,
+      batch
+    );
+    unpackMatrices(aData, 0, a, batch, lda, m, n, ld);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget((xMembers * xSize + yMembers * ySize + batch * aSize) * 8);
+  const xPtr = module._malloc(xMembers * xSize * 8);
+  const yPtr = module._malloc(yMembers * ySize * 8);
+  const aPtr = module._malloc_aligned(batch * aSize * 8);
+
+  try {
+    // Copy data to WASM memory
+    packVectors(module.HEAPF64, xPtr / 8, x, xMembers, m, incx);
+    packVectors(module.HEAPF64, yPtr / 8, y, yMembers, n, incy);
+    packMatrices(module.HEAPF64, aPtr / 8, a, batch, lda, m, n, ld);
+
+    // Call the WASM function
+    module._dger_batch_strided(
+      m,
+      n,
+      alpha,
+      xPtr,
+      packedInc(incx),
+      xStride,
+      yPtr,
+      packedInc(incy),
+      yStride,
+      aPtr,
+      ld,
+      aSize,
+      batch
+    );
+
+    // Copy result back to a
+    unpackMatrices(module.HEAPF64, aPtr / 8, a, batch, lda, m, n, ld);
+  } finally {
+    // Free WASM memory
+    module._free(xPtr);
+    module._free(yPtr);
+    module._free(aPtr);
+  }
+}
@@ -0,0 +1,96 @@
+/**
+ * DGETRF - Double precision LU factorization of a general matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Computes the LU factorization A = P*L*U of an m x n matrix with partial
+ * pivoting, where L has a unit diagonal and P is a permutation
+ *
+ * Panels of 64 columns are factored with rank-1 updates and the rest of the
+ * matrix is updated with dtrsm and dgemm, so large factorizations run at
+ * Level 3 speed (and on all threads of the native backend).
+ *
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param a - Input matrix A, output factors L and U in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @param ipiv - Output pivot indices (Int32Array of length min(m, n)), 1-based as in
+ *               LAPACK: row i was interchanged with row ipiv[i] - 1
+ * @returns 0 on success, i > 0 if U(i-1, i-1) is exactly zero (the factorization is
+ *          completed, but U is singular)
+ * @modifies a - The a matrix is overwritten by L and U
+ * @modifies ipiv - The pivot indices
+ *
+ * @example
+ * ```typescript
+ * import { dgetrf, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([1, 4, 2, 3]); // [[1,2], [4,3]]
+ * const ipiv = new Int32Array(2);
+ *
+ * dgetrf(2, 2, A, 2, ipiv); // 0
+ * // ipiv = [2, 2], A = [4, 0.25, 3, 1.25]: L = [[1,0], [0.25,1]], U = [[4,3], [0,1.25]]
+ * ```
+ */
+export function dgetrf(
+  m: number,
+  n: number,
+  a: Float64Array,
+  lda: number,
+  ipiv: Int32Array
+): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  const mn = Math.min(m, n);
+  if (ipiv.length < mn) {
+    throw new Error(`ipiv array too small: expected at least ${mn}, got ${ipiv.length}`);
+  }
+  if (mn === 0) {
+    return 0;
+  }
+
+  const native = getNative();
+  if (native) {
+    return native.dgetrf(m, n, a, lda, ipiv);
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget(ld * n * 8 + mn * 4);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+  const ipivPtr = module._malloc(mn * 4);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, m, n, aPtr, ld);
+
+    // Call the WASM function
+    const info = module._dgetrf(m, n, aPtr, ld, ipivPtr);
+
+    // Copy the factors and pivots back
+    unpackMatrix(module, aPtr, ld, a, lda, m, n);
+    ipiv.set(module.HEAP32.subarray(ipivPtr / 4, ipivPtr / 4 + mn));
+    return info;
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(ipivPtr);
+  }
+}
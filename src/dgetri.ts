@@ -0,0 +1,93 @@
+/**
+ * DGETRI - Double precision inverse of a general matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Computes the inverse of a matrix A in place from its LU factorization
+ * computed by dgetrf
+ *
+ * inv(U) is formed by dtrtri, then inv(A) * L = inv(U) is solved a block of
+ * 64 columns at a time with dgemm and dtrsm; the only workspace is one block
+ * column of L. Solving with dgetrs is cheaper and more accurate than
+ * multiplying by the inverse; use dgetri when the inverse itself is needed.
+ *
+ * @param n - Order of A
+ * @param a - Input factors L and U from dgetrf, output inv(A) in column-major order
+ *            (Float64Array)
+ * @param lda - Leading dimension of A
+ * @param ipiv - The pivot indices from dgetrf (Int32Array of length n)
+ * @returns 0 on success, i > 0 if U(i-1, i-1) is exactly zero (A is then unchanged)
+ * @modifies a - The a matrix is overwritten by the inverse
+ *
+ * @example
+ * ```typescript
+ * import { dgetrf, dgetri, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([1, 4, 2, 3]); // [[1,2], [4,3]]
+ * const ipiv = new Int32Array(2);
+ *
+ * dgetrf(2, 2, A, 2, ipiv);
+ * dgetri(2, A, 2, ipiv); // 0
+ * // A = [-0.6, 0.8, 0.4, -0.2]
+ * ```
+ */
+export function dgetri(n: number, a: Float64Array, lda: number, ipiv: Int32Array): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least ${Math.max(1, n)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (ipiv.length < n) {
+    throw new Error(`ipiv array too small: expected at least ${n}, got ${ipiv.length}`);
+  }
+  for (let i = 0; i < n; i++) {
+    if (ipiv[i] < 1 || ipiv[i] > n) {
+      throw new Error(`ipiv[${i}] must be between 1 and ${n}, got ${ipiv[i]}`);
+    }
+  }
+  if (n === 0) {
+    return 0;
+  }
+
+  const native = getNative();
+  if (native) {
+    return native.dgetri(n, a, lda, ipiv);
+  }
+
+  // Allocate memory in WASM; the kernel adds one block column of workspace
+  const ld = paddedLd(n);
+  checkBudget((ld + Math.min(n, 64)) * n * 8 + n * 4);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+  const ipivPtr = module._malloc(n * 4);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, n, n, aPtr, ld);
+    module.HEAP32.set(ipiv.subarray(0, n), ipivPtr / 4);
+
+    // Call the WASM function
+    const info = module._dgetri(n, aPtr, ld, ipivPtr);
+
+    // Copy result back to a
+    unpackMatrix(module, aPtr, ld, a, lda, n, n);
+    return info;
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(ipivPtr);
+  }
+}
@@ -0,0 +1,113 @@
+/**
+ * DGETRS - Double precision solve with an LU factorization
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Transpose } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Solves op(A)*X = B with the LU factorization of A computed by dgetrf,
+ * where op(A) = A or A^T and X overwrites B
+ *
+ * @param trans - 'N': A*X = B, 'T'/'C': A^T*X = B
+ * @param n - Order of A
+ * @param nrhs - Number of columns of B
+ * @param a - The factors L and U from dgetrf in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @param ipiv - The pivot indices from dgetrf (Int32Array of length n)
+ * @param b - Input right-hand sides, output solution X in column-major order (Float64Array)
+ * @param ldb - Leading dimension of B
+ * @modifies b - The b matrix is modified in-place with the solution
+ *
+ * @example
+ * ```typescript
+ * import { dgetrf, dgetrs, initWasm, Transpose } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([1, 4, 2, 3]); // [[1,2], [4,3]]
+ * const ipiv = new Int32Array(2);
+ * const B = new Float64Array([5, 10]);
+ *
+ * dgetrf(2, 2, A, 2, ipiv);
+ * dgetrs(Transpose.NoTranspose, 2, 1, A, 2, ipiv, B, 2);
+ * // B = [1, 2]
+ * ```
+ */
+export function dgetrs(
+  trans: Transpose,
+  n: number,
+  nrhs: number,
+  a: Float64Array,
+  lda: number,
+  ipiv: Int32Array,
+  b: Float64Array,
+  ldb: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0 || nrhs < 0) {
+    throw new Error('n and nrhs must be non-negative');
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least ${Math.max(1, n)}, got ${lda}`);
+  }
+  if (ldb < Math.max(1, n)) {
+    throw new Error(`ldb must be at least ${Math.max(1, n)}, got ${ldb}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (ipiv.length < n) {
+    throw new Error(`ipiv array too small: expected at least ${n}, got ${ipiv.length}`);
+  }
+  if (b.length < ldb * nrhs) {
+    throw new Error(`b array too small: expected at least ${ldb * nrhs}, got ${b.length}`);
+  }
+  for (let i = 0; i < n; i++) {
+    if (ipiv[i] < 1 || ipiv[i] > n) {
+      throw new Error(`ipiv[${i}] must be between 1 and ${n}, got ${ipiv[i]}`);
+    }
+  }
+  if (n === 0 || nrhs === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const transChar = trans.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dgetrs(transChar, n, nrhs, a, lda, ipiv, b, ldb);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(n);
+  checkBudget(ld * (n + nrhs) * 8 + n * 4);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+  const bPtr = module._malloc_aligned(ld * nrhs * 8);
+  const ipivPtr = module._malloc(n * 4);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, n, n, aPtr, ld);
+    packMatrix(module, b, ldb, n, nrhs, bPtr, ld);
+    module.HEAP32.set(ipiv.subarray(0, n), ipivPtr / 4);
+
+    // Call the WASM function
+    module._dgetrs(transChar, n, nrhs, aPtr, ld, ipivPtr, bPtr, ld);
+
+    // Copy result back to b
+    unpackMatrix(module, bPtr, ld, b, ldb, n, nrhs);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(bPtr);
+    module._free(ipivPtr);
+  }
+}
@@ -0,0 +1,289 @@
+/**
+ * DKRONMV / DKRONSV - Double precision Kronecker product matrix-vector
+ * multiplication and solve
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Transpose } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrixAt } from './utils';
+
+/**
+ * One factor of a Kronecker product
+ */
+export interface KronFactor {
+  /** Rows of the factor */
+  m: number;
+  /** Columns of the factor */
+  n: number;
+  /** The factor in column-major order */
+  a: Float64Array;
+  /** Leading dimension of the factor */
+  lda: number;
+}
+
+/** The factors packed back to back, with their leading dimensions and offsets */
+interface PackedFactors {
+  m: Int32Array;
+  n: Int32Array;
+  lda: Int32Array;
+  offa: Int32Array;
+  total: number;
+}
+
+// Validate the factors and lay out their packed copies
+function layoutFactors(factors: KronFactor[], native: boolean): PackedFactors {
+  const d = factors.length;
+  if (d === 0) {
+    throw new Error('at least one factor is required');
+  }
+  const m = new Int32Array(d);
+  const n = new Int32Array(d);
+  const lda = new Int32Array(d);
+  const offa = new Int32Array(d);
+  let total = 0;
+  factors.forEach((factor, k) => {
+    if (factor.m < 0 || factor.n < 0) {
+      throw new Error(`factors[${k}]: m and n must be non-negative`);
+    }
+    if (factor.lda < Math.max(1, factor.m)) {
+      throw new Error(
+        `factors[${k}]: lda must be at least ${Math.max(1, factor.m)}, got ${factor.lda}`
+      );
+    }
+    if (factor.a.length < factor.lda * factor.n) {
+      throw new Error(
+        `factors[${k}]: a array too small: expected at least ${factor.lda * factor.n}, ` +
+          `got ${factor.a.length}`
+      );
+    }
+    m[k] = factor.m;
+    n[k] = factor.n;
+    lda[k] = native ? Math.max(1, factor.m) : paddedLd(factor.m);
+    offa[k] = total;
+    total += lda[k] * factor.n;
+  });
+  return { m, n, lda, offa, total };
+}
+
+// Copy the factors to dst at index k
+function packFactors(
+  dst: Float64Array,
+  k: number,
+  factors: KronFactor[],
+  packed: PackedFactors
+): void {
+  factors.forEach((factor, i) => {
+    const { a, lda, m, n } = factor;
+    packMatrixAt(dst, k + packed.offa[i], a, lda, m, n, packed.lda[i]);
+  });
+}
+
+const product = (dims: Int32Array) => dims.reduce((p, v) => p * v, 1);
+
+/**
+ * Computes y = alpha * op(A_0 ⊗ A_1 ⊗ ... ⊗ A_{d-1}) * x + beta * y
+ * where ⊗ is the Kronecker product and op(X) = X or X^T
+ *
+ * The Kronecker product is never formed: each factor is applied in turn as
+ * one dgemm on a reshaped view of the vector (a mode product), so d factors
+ * of order n cost about 2 d n^(d+1) flops and n^d memory instead of n^(2d).
+ * Element i_0 * (n_1 ... n_{d-1}) + ... + i_{d-1} of x belongs to the
+ * columns i_0, ..., i_{d-1} of the factors, as for the explicit product.
+ *
+ * @param trans - 'N': op = the product, 'T'/'C': op = its transpose
+ * @param factors - The factors A_0, ..., A_{d-1} (see KronFactor), at least one
+ * @param alpha - Scalar multiplier for the product
+ * @param x - Input vector of prod(n_k) elements ('N') or prod(m_k) elements ('T')
+ * @param beta - Scalar multiplier for y
+ * @param y - Input/output vector of prod(m_k) elements ('N') or prod(n_k) elements ('T')
+ * @modifies y - The y vector is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { dkronmv, initWasm, Transpose } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * // (A ⊗ B) * x with A = [[1,2],[3,4]] and B = [[0,1],[1,0]]
+ * const A = { m: 2, n: 2, a: new Float64Array([1, 3, 2, 4]), lda: 2 };
+ * const B = { m: 2, n: 2, a: new Float64Array([0, 1, 1, 0]), lda: 2 };
+ * const x = new Float64Array([1, 2, 3, 4]);
+ * const y = new Float64Array(4);
+ *
+ * dkronmv(Transpose.NoTranspose, [A, B], 1.0, x, 0.0, y);
+ * // y = [10, 7, 22, 15]
+ * ```
+ */
+export function dkronmv(
+  trans: Transpose,
+  factors: KronFactor[],
+  alpha: number,
+  x: Float64Array,
+  beta: number,
+  y: Float64Array
+): void {
+  const module = getModule();
+  const native = getNative();
+
+  // Handle edge cases
+  const packed = layoutFactors(factors, native !== null);
+  const isTrans = trans === Transpose.Transpose || trans === Transpose.ConjugateTranspose;
+  const xLength = product(isTrans ? packed.m : packed.n);
+  const yLength = product(isTrans ? packed.n : packed.m);
+  if (x.length < xLength) {
+    throw new Error(`x array too small: expected at least ${xLength}, got ${x.length}`);
+  }
+  if (y.length < yLength) {
+    throw new Error(`y array too small: expected at least ${yLength}, got ${y.length}`);
+  }
+  if (yLength === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const d = factors.length;
+  const transChar = trans.charCodeAt(0);
+  const { m, n, lda, offa, total } = packed;
+
+  if (native) {
+    const aData = new Float64Array(total);
+    packFactors(aData, 0, factors, packed);
+    native.dkronmv(transChar, d, m, n, alpha, aData, lda, offa, x, beta, y);
+    return;
+  }
+
+  // The kernel ping-pongs between two buffers as long as the largest
+  // intermediate tensor
+  let work = 0;
+  if (xLength > 0 && alpha !== 0) {
+    const p = isTrans ? n : m;
+    const q = isTrans ? m : n;
+    let len = xLength;
+    for (let k = d - 1; k > 0; k--) {
+      len = (len / q[k]) * p[k];
+      work = Math.max(work, 2 * len);
+    }
+  }
+
+  // Allocate memory in WASM
+  const ints = [m, n, lda, offa];
+  checkBudget((total + xLength + yLength + work) * 8 + 4 * d * 4);
+  const aPtr = module._malloc_aligned(total * 8);
+  const xPtr = module._malloc_aligned(xLength * 8);
+  const yPtr = module._malloc_aligned(yLength * 8);
+  const intPtrs = ints.map(() => module._malloc(d * 4));
+
+  try {
+    // Copy data to WASM memory
+    packFactors(module.HEAPF64, aPtr / 8, factors, packed);
+    module.HEAPF64.set(x.subarray(0, xLength), xPtr / 8);
+    module.HEAPF64.set(y.subarray(0, yLength), yPtr / 8);
+    ints.forEach((values, i) => module.HEAP32.set(values, intPtrs[i] / 4));
+
+    // Call the WASM function
+    const [mPtr, nPtr, ldaPtr, offaPtr] = intPtrs;
+    module._dkronmv(transChar, d, mPtr, nPtr, alpha, aPtr, ldaPtr, offaPtr, xPtr, beta, yPtr);
+
+    // Copy result back to y
+    y.set(module.HEAPF64.subarray(yPtr / 8, yPtr / 8 + yLength));
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(xPtr);
+    module._free(yPtr);
+    intPtrs.forEach((ptr) => module._free(ptr));
+  }
+}
+
+/**
+ * Solves op(A_0 ⊗ A_1 ⊗ ... ⊗ A_{d-1}) * x = b for square factors,
+ * where ⊗ is the Kronecker product and op(X) = X or X^T; x overwrites b
+ *
+ * Each factor is LU factored (dgetrf) and its inverse applied as a mode
+ * product (dgetrs), so the cost is that of dkronmv plus the d small
+ * factorizations. b is left unchanged if a factor is singular.
+ *
+ * @param trans - 'N': op = the product, 'T'/'C': op = its transpose
+ * @param factors - The square factors A_0, ..., A_{d-1} (see KronFactor), at least one
+ * @param b - Input right-hand side, output solution of prod(n_k) elements
+ * @returns 0 on success, k > 0 if factors[k-1] is exactly singular
+ * @modifies b - The b vector is modified in-place with the solution
+ *
+ * @example
+ * ```typescript
+ * import { dkronsv, initWasm, Transpose } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = { m: 2, n: 2, a: new Float64Array([1, 3, 2, 4]), lda: 2 };
+ * const B = { m: 2, n: 2, a: new Float64Array([0, 1, 1, 0]), lda: 2 };
+ * const b = new Float64Array([10, 7, 22, 15]);
+ *
+ * dkronsv(Transpose.NoTranspose, [A, B], b); // 0
+ * // b = [1, 2, 3, 4]
+ * ```
+ */
+export function dkronsv(trans: Transpose, factors: KronFactor[], b: Float64Array): number {
+  const module = getModule();
+  const native = getNative();
+
+  // Handle edge cases
+  const packed = layoutFactors(factors, native !== null);
+  factors.forEach((factor, k) => {
+    if (factor.m !== factor.n) {
+      throw new Error(`factors[${k}] must be square, got ${factor.m}x${factor.n}`);
+    }
+  });
+  const length = product(packed.n);
+  if (b.length < length) {
+    throw new Error(`b array too small: expected at least ${length}, got ${b.length}`);
+  }
+  if (length === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const d = factors.length;
+  const transChar = trans.charCodeAt(0);
+  const { n, lda, offa, total } = packed;
+
+  if (native) {
+    const aData = new Float64Array(total);
+    packFactors(aData, 0, factors, packed);
+    return native.dkronsv(transChar, d, n, aData, lda, offa, b);
+  }
+
+  // The kernel factors copies of the A_k, with their pivots, and transposes
+  // b into a buffer of the same length
+  const work = n.reduce((sum, nk) => sum + nk * nk, 0) + length;
+  const pivots = n.reduce((sum, nk) => sum + nk, 0);
+
+  // Allocate memory in WASM
+  const ints = [n, lda, offa];
+  checkBudget((total + length + work) * 8 + (3 * d + pivots) * 4);
+  const aPtr = module._malloc_aligned(total * 8);
+  const bPtr = module._malloc_aligned(length * 8);
+  const intPtrs = ints.map(() => module._malloc(d * 4));
+
+  try {
+    // Copy data to WASM memory
+    packFactors(module.HEAPF64, aPtr / 8, factors, packed);
+    module.HEAPF64.set(b.subarray(0, length), bPtr / 8);
+    ints.forEach((values, i) => module.HEAP32.set(values, intPtrs[i] / 4));
+
+    // Call the WASM function
+    const [nPtr, ldaPtr, offaPtr] = intPtrs;
+    const info = module._dkronsv(transChar, d, nPtr, aPtr, ldaPtr, offaPtr, bPtr);
+
+    // Copy result back to b
+    b.set(module.HEAPF64.subarray(bPtr / 8, bPtr / 8 + length));
+    return info;
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(bPtr);
+    intPtrs.forEach((ptr) => module._free(ptr));
+  }
+}
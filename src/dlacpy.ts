@@ -0,0 +1,100 @@
+/**
+ * DLACPY - Double precision matrix copy
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { MatrixType } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Copies all of a matrix A, or its upper or lower triangle, to B: B := A
+ *
+ * @param uplo - 'U': upper triangle and diagonal, 'L': lower triangle and diagonal,
+ *               'G': the whole matrix
+ * @param m - Number of rows of A and B
+ * @param n - Number of columns of A and B
+ * @param a - Matrix A in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @param b - Output matrix B in column-major order (Float64Array)
+ * @param ldb - Leading dimension of B
+ * @modifies b - The selected part of b is overwritten; the rest is left unchanged
+ *
+ * @example
+ * ```typescript
+ * import { dlacpy, initWasm, MatrixType } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([1, 2, 3, 4]); // [[1,3], [2,4]]
+ * const B = new Float64Array(4);
+ *
+ * dlacpy(MatrixType.Upper, 2, 2, A, 2, B, 2);
+ * // B = [[1,3], [0,4]]
+ * ```
+ */
+export function dlacpy(
+  uplo: MatrixType,
+  m: number,
+  n: number,
+  a: Float64Array,
+  lda: number,
+  b: Float64Array,
+  ldb: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (ldb < Math.max(1, m)) {
+    throw new Error(`ldb must be at least max(1, m) = ${Math.max(1, m)}, got ${ldb}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (b.length < ldb * n) {
+    throw new Error(`b array too small: expected at least ${ldb * n}, got ${b.length}`);
+  }
+  if (m === 0 || n === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dlacpy(uploChar, m, n, a, lda, b, ldb);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget(2 * ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+  const bPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory; B keeps its values outside a copied triangle
+    packMatrix(module, a, lda, m, n, aPtr, ld);
+    if (uplo !== MatrixType.General) {
+      packMatrix(module, b, ldb, m, n, bPtr, ld);
+    }
+
+    // Call the WASM function
+    module._dlacpy(uploChar, m, n, aPtr, ld, bPtr, ld);
+
+    // Copy result back to b
+    unpackMatrix(module, bPtr, ld, b, ldb, m, n);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(bPtr);
+  }
+}
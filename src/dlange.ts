@@ -0,0 +1,79 @@
+/**
+ * DLANGE - Double precision norm of a general matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Norm } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix } from './utils';
+
+/**
+ * Computes the max-abs, 1-, infinity- or Frobenius norm of a matrix A
+ *
+ * The Frobenius norm is accumulated with Blue's scaling, as in dnrm2, so it
+ * neither overflows nor underflows for elements of any magnitude. A NaN
+ * element makes the result NaN.
+ *
+ * @param norm - Norm.Max: max |A(i,j)|, Norm.One: maximum column sum of |A(i,j)|,
+ *               Norm.Infinity: maximum row sum, Norm.Frobenius: sqrt(sum A(i,j)^2)
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param a - Matrix A in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @returns The norm of A, 0 if m or n is 0
+ *
+ * @example
+ * ```typescript
+ * import { dlange, initWasm, Norm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([1, -2, 3, 4]); // [[1,3], [-2,4]]
+ *
+ * dlange(Norm.One, 2, 2, A, 2); // 7 (column 2)
+ * dlange(Norm.Infinity, 2, 2, A, 2); // 6 (row 2)
+ * dlange(Norm.Frobenius, 2, 2, A, 2); // sqrt(30)
+ * ```
+ */
+export function dlange(norm: Norm, m: number, n: number, a: Float64Array, lda: number): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (m === 0 || n === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const normChar = norm.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    return native.dlange(normChar, m, n, a, lda);
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, m, n, aPtr, ld);
+
+    // Call the WASM function
+    return module._dlange(normChar, m, n, aPtr, ld);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
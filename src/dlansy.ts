@@ -0,0 +1,83 @@
+/**
+ * DLANSY - Double precision norm of a symmetric matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Norm, Triangular } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix } from './utils';
+
+/**
+ * Computes the max-abs, 1-, infinity- or Frobenius norm of a symmetric matrix A
+ * stored in its upper or lower triangle
+ *
+ * The 1- and infinity-norms of a symmetric matrix are equal. The other
+ * triangle of a is not referenced.
+ *
+ * @param norm - Norm.Max, Norm.One, Norm.Infinity or Norm.Frobenius (see dlange)
+ * @param uplo - Whether the upper or lower triangle of A is stored
+ * @param n - Order of A
+ * @param a - Symmetric matrix A in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @returns The norm of A, 0 if n is 0
+ *
+ * @example
+ * ```typescript
+ * import { dlansy, initWasm, Norm, Triangular } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([2, 0, -1, 3]); // [[2,-1], [-1,3]], upper stored
+ *
+ * dlansy(Norm.One, Triangular.Upper, 2, A, 2); // 4
+ * ```
+ */
+export function dlansy(
+  norm: Norm,
+  uplo: Triangular,
+  n: number,
+  a: Float64Array,
+  lda: number
+): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least max(1, n) = ${Math.max(1, n)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (n === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const normChar = norm.charCodeAt(0);
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    return native.dlansy(normChar, uploChar, n, a, lda);
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(n);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, n, n, aPtr, ld);
+
+    // Call the WASM function
+    return module._dlansy(normChar, uploChar, n, aPtr, ld);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
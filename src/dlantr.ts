@@ -0,0 +1,88 @@
+/**
+ * DLANTR - Double precision norm of a triangular matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Diagonal, Norm, Triangular } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix } from './utils';
+
+/**
+ * Computes the max-abs, 1-, infinity- or Frobenius norm of an upper or lower
+ * trapezoidal matrix A (triangular if m = n)
+ *
+ * Only the selected triangle of a is referenced, and with a unit diagonal
+ * not the diagonal either: its elements are taken to be 1.
+ *
+ * @param norm - Norm.Max, Norm.One, Norm.Infinity or Norm.Frobenius (see dlange)
+ * @param uplo - Whether A is upper or lower trapezoidal
+ * @param diag - Whether A has a unit diagonal
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param a - Matrix A in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @returns The norm of A, 0 if m or n is 0
+ *
+ * @example
+ * ```typescript
+ * import { Diagonal, dlantr, initWasm, Norm, Triangular } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([5, 9, -2, 5]); // [[*,-2], [9,*]], unit diagonal
+ *
+ * dlantr(Norm.Infinity, Triangular.Upper, Diagonal.Unit, 2, 2, A, 2); // 3
+ * ```
+ */
+export function dlantr(
+  norm: Norm,
+  uplo: Triangular,
+  diag: Diagonal,
+  m: number,
+  n: number,
+  a: Float64Array,
+  lda: number
+): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (m === 0 || n === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const normChar = norm.charCodeAt(0);
+  const uploChar = uplo.charCodeAt(0);
+  const diagChar = diag.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    return native.dlantr(normChar, uploChar, diagChar, m, n, a, lda);
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, m, n, aPtr, ld);
+
+    // Call the WASM function
+    return module._dlantr(normChar, uploChar, diagChar, m, n, aPtr, ld);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
@@ -0,0 +1,96 @@
+/**
+ * DLASCL - Double precision matrix scaling by cto/cfrom
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { MatrixType } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Multiplies A, or its upper or lower triangle, by cto/cfrom: A := (cto / cfrom) * A
+ *
+ * The factor is applied in steps if cto/cfrom would overflow or underflow,
+ * so cfrom and cto may each be as large or small as any double.
+ *
+ * @param type - 'G': the whole matrix, 'U': upper triangle and diagonal,
+ *               'L': lower triangle and diagonal
+ * @param cfrom - Denominator of the scale factor (nonzero)
+ * @param cto - Numerator of the scale factor
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param a - Input/output matrix A in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @modifies a - The selected part of a is scaled in-place
+ *
+ * @example
+ * ```typescript
+ * import { dlascl, initWasm, MatrixType } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([1e-300, 2e-300]);
+ * dlascl(MatrixType.General, 1e-310, 1, 2, 1, A, 2);
+ * // A ≈ [1e10, 2e10], although 1 / 1e-310 overflows
+ * ```
+ */
+export function dlascl(
+  type: MatrixType,
+  cfrom: number,
+  cto: number,
+  m: number,
+  n: number,
+  a: Float64Array,
+  lda: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (cfrom === 0 || Number.isNaN(cfrom)) {
+    throw new Error(`cfrom must be nonzero and not NaN, got ${cfrom}`);
+  }
+  if (Number.isNaN(cto)) {
+    throw new Error('cto must not be NaN');
+  }
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (m === 0 || n === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const typeChar = type.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dlascl(typeChar, cfrom, cto, m, n, a, lda);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, m, n, aPtr, ld);
+
+    // Call the WASM function
+    module._dlascl(typeChar, cfrom, cto, m, n, aPtr, ld);
+
+    // Copy result back to a
+    unpackMatrix(module, aPtr, ld, a, lda, m, n);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
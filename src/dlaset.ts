@@ -0,0 +1,89 @@
+/**
+ * DLASET - Double precision matrix initialization
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { MatrixType } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Sets the off-diagonal elements of A to alpha and the diagonal to beta
+ *
+ * @param uplo - 'U': strictly upper triangle, 'L': strictly lower triangle,
+ *               'G': the whole matrix; the diagonal is always set
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param alpha - Value of the off-diagonal elements
+ * @param beta - Value of the diagonal elements
+ * @param a - Input/output matrix A in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @modifies a - The selected part of a is overwritten; the rest is left unchanged
+ *
+ * @example
+ * ```typescript
+ * import { dlaset, initWasm, MatrixType } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array(9);
+ * dlaset(MatrixType.General, 3, 3, 0, 1, A, 3);
+ * // A is the 3x3 identity
+ * ```
+ */
+export function dlaset(
+  uplo: MatrixType,
+  m: number,
+  n: number,
+  alpha: number,
+  beta: number,
+  a: Float64Array,
+  lda: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (m === 0 || n === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dlaset(uploChar, m, n, alpha, beta, a, lda);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory, unless all of A is overwritten
+    if (uplo !== MatrixType.General) {
+      packMatrix(module, a, lda, m, n, aPtr, ld);
+    }
+
+    // Call the WASM function
+    module._dlaset(uploChar, m, n, alpha, beta, aPtr, ld);
+
+    // Copy result back to a
+    unpackMatrix(module, aPtr, ld, a, lda, m, n);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
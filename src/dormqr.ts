@@ -0,0 +1,134 @@
+/**
+ * DORMQR - Double precision multiplication by Q from a QR factorization
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Side, Transpose } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+import { QR_BLOCK } from './dgeqrf';
+
+/**
+ * Elements of workspace the dormqr kernel allocates to apply k reflectors to
+ * an m x n matrix: the triangular factor of one block and its update
+ * @internal
+ */
+export function dormqrWorkspace(left: boolean, m: number, n: number, k: number): number {
+  const nb = Math.min(k, QR_BLOCK);
+  return nb * nb + (left ? n : m) * nb;
+}
+
+/**
+ * Computes C = op(Q)*C or C = C*op(Q), where op(Q) = Q or Q^T and Q is the
+ * product of the first k Householder reflectors computed by dgeqrf
+ *
+ * The reflectors are applied 32 at a time as block reflectors with dtrmm
+ * and dgemm; Q is never formed.
+ *
+ * @param side - 'L': op(Q)*C, 'R': C*op(Q)
+ * @param trans - 'N': op(Q) = Q, 'T'/'C': op(Q) = Q^T
+ * @param m - Number of rows of C
+ * @param n - Number of columns of C
+ * @param k - Number of reflectors, at most m ('L') or n ('R')
+ * @param a - The reflectors from dgeqrf in column-major order (Float64Array), m x k ('L') or
+ *            n x k ('R')
+ * @param lda - Leading dimension of A
+ * @param tau - The scalar factors from dgeqrf (Float64Array of length k)
+ * @param c - Input/output matrix C in column-major order (Float64Array)
+ * @param ldc - Leading dimension of C
+ * @modifies c - The c matrix is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { dgeqrf, dormqr, initWasm, Side, Transpose } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([3, 4, 1, 2]); // [[3,1], [4,2]]
+ * const tau = new Float64Array(2);
+ * dgeqrf(2, 2, A, 2, tau);
+ *
+ * const b = new Float64Array([5, 0]);
+ * dormqr(Side.Left, Transpose.Transpose, 2, 1, 2, A, 2, tau, b, 2);
+ * // b = Q^T * [5, 0] = [-3, -4]
+ * ```
+ */
+export function dormqr(
+  side: Side,
+  trans: Transpose,
+  m: number,
+  n: number,
+  k: number,
+  a: Float64Array,
+  lda: number,
+  tau: Float64Array,
+  c: Float64Array,
+  ldc: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  const nq = side === Side.Left ? m : n; // Order of Q
+  if (k < 0 || k > nq) {
+    throw new Error(`k must be between 0 and ${nq}, got ${k}`);
+  }
+  if (lda < Math.max(1, nq)) {
+    throw new Error(`lda must be at least ${Math.max(1, nq)}, got ${lda}`);
+  }
+  if (ldc < Math.max(1, m)) {
+    throw new Error(`ldc must be at least ${Math.max(1, m)}, got ${ldc}`);
+  }
+  if (a.length < lda * k) {
+    throw new Error(`a array too small: expected at least ${lda * k}, got ${a.length}`);
+  }
+  if (tau.length < k) {
+    throw new Error(`tau array too small: expected at least ${k}, got ${tau.length}`);
+  }
+  if (c.length < ldc * n) {
+    throw new Error(`c array too small: expected at least ${ldc * n}, got ${c.length}`);
+  }
+  if (m === 0 || n === 0 || k === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const sideChar = side.charCodeAt(0);
+  const transChar = trans.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dormqr(sideChar, transChar, m, n, k, a, lda, tau, c, ldc);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ldaHeap = paddedLd(nq);
+  const ldcHeap = paddedLd(m);
+  const left = side === Side.Left;
+  checkBudget((ldaHeap * k + k + ldcHeap * n + dormqrWorkspace(left, m, n, k)) * 8);
+  const aPtr = module._malloc_aligned(ldaHeap * k * 8);
+  const tauPtr = module._malloc(k * 8);
+  const cPtr = module._malloc_aligned(ldcHeap * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, nq, k, aPtr, ldaHeap);
+    module.HEAPF64.set(tau.subarray(0, k), tauPtr / 8);
+    packMatrix(module, c, ldc, m, n, cPtr, ldcHeap);
+
+    // Call the WASM function
+    module._dormqr(sideChar, transChar, m, n, k, aPtr, ldaHeap, tauPtr, cPtr, ldcHeap);
+
+    // Copy result back to c
+    unpackMatrix(module, cPtr, ldcHeap, c, ldc, m, n);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(tauPtr);
+    module._free(cPtr);
+  }
+}
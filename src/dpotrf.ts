@@ -0,0 +1,85 @@
+/**
+ * DPOTRF - Double precision Cholesky factorization
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Triangular } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Computes the Cholesky factorization A = U^T*U or A = L*L^T of a symmetric
+ * positive definite matrix A in place
+ *
+ * Blocks of 64 columns are updated with dsyrk, dgemm and dtrsm, so large
+ * factorizations run at Level 3 speed (and on all threads of the native
+ * backend).
+ *
+ * @param uplo - 'U': the upper triangle of A is stored and U is computed,
+ *               'L': the lower triangle is stored and L is computed
+ * @param n - Order of A
+ * @param a - Input symmetric matrix, output its Cholesky factor in column-major order
+ *            (Float64Array); the other triangle is not referenced
+ * @param lda - Leading dimension of A
+ * @returns 0 on success, i > 0 if the leading minor of order i is not positive definite
+ *          (the factorization stops there)
+ * @modifies a - The triangle of a is overwritten by the factor
+ *
+ * @example
+ * ```typescript
+ * import { dpotrf, initWasm, Triangular } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([4, 2, 2, 5]); // [[4,2], [2,5]]
+ *
+ * dpotrf(Triangular.Lower, 2, A, 2); // 0
+ * // lower triangle of A = L = [[2,0], [1,2]]
+ * ```
+ */
+export function dpotrf(uplo: Triangular, n: number, a: Float64Array, lda: number): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least ${Math.max(1, n)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (n === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    return native.dpotrf(uploChar, n, a, lda);
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(n);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, n, n, aPtr, ld);
+
+    // Call the WASM function
+    const info = module._dpotrf(uploChar, n, aPtr, ld);
+
+    // Copy result back to a
+    unpackMatrix(module, aPtr, ld, a, lda, n, n);
+    return info;
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
@@ -0,0 +1,84 @@
+/**
+ * DPOTRI - Double precision inverse of a symmetric positive definite matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Triangular } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Computes the inverse of a symmetric positive definite matrix A in place
+ * from its Cholesky factorization computed by dpotrf
+ *
+ * The factor is inverted by dtrtri and multiplied by its transpose a block
+ * of 64 columns at a time with dtrmm, dgemm and dsyrk; no workspace beyond
+ * A is needed. Only the upper or lower triangle of the inverse is formed.
+ *
+ * @param uplo - 'U': A holds the factor U, 'L': A holds the factor L
+ * @param n - Order of A
+ * @param a - Input Cholesky factor, output the same triangle of inv(A) in column-major order
+ *            (Float64Array); the other triangle is not referenced
+ * @param lda - Leading dimension of A
+ * @returns 0 on success, i > 0 if the factor has a zero at (i-1, i-1) (A is then unchanged)
+ * @modifies a - The triangle of a is overwritten by the inverse
+ *
+ * @example
+ * ```typescript
+ * import { dpotrf, dpotri, initWasm, Triangular } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([4, 2, 2, 5]); // [[4,2], [2,5]]
+ *
+ * dpotrf(Triangular.Lower, 2, A, 2);
+ * dpotri(Triangular.Lower, 2, A, 2); // 0
+ * // lower triangle of A = inv(A) = [[0.3125,-0.125], [-0.125,0.25]]
+ * ```
+ */
+export function dpotri(uplo: Triangular, n: number, a: Float64Array, lda: number): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least ${Math.max(1, n)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (n === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    return native.dpotri(uploChar, n, a, lda);
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(n);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, n, n, aPtr, ld);
+
+    // Call the WASM function
+    const info = module._dpotri(uploChar, n, aPtr, ld);
+
+    // Copy result back to a
+    unpackMatrix(module, aPtr, ld, a, lda, n, n);
+    return info;
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
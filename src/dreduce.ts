@@ -0,0 +1,108 @@
+/**
+ * DREDUCE - Double precision reduction of a matrix along its rows or columns
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Axis, Reduction } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix } from './utils';
+
+/**
+ * Reduces each column or each row of a matrix A to one value
+ *
+ * Reductions along rows take a single pass over A, column by column, instead
+ * of a strided pass per row. Norm2 uses Blue's scaling like dnrm2 and does
+ * not overflow or underflow; MaxAbs is NaN where the column or row has a NaN.
+ * For means, divide the sums by m (Axis.Columns) or n (Axis.Rows).
+ *
+ * @param op - Reduction.Sum, AbsSum (sum of |A(i,j)|), SumSquares, Norm2 or MaxAbs
+ * @param axis - Axis.Columns: r[j] reduces column j, Axis.Rows: r[i] reduces row i
+ * @param m - Number of rows of A
+ * @param n - Number of columns of A
+ * @param a - Matrix A in column-major order (Float64Array)
+ * @param lda - Leading dimension of A
+ * @param r - Output vector of n (Axis.Columns) or m (Axis.Rows) elements (Float64Array)
+ * @modifies r - Overwritten with the reductions
+ *
+ * @example
+ * ```typescript
+ * import { Axis, dreduce, initWasm, Reduction } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([1, 2, 3, 4, 5, 6]); // [[1,3,5], [2,4,6]]
+ * const colSums = new Float64Array(3);
+ * const rowMax = new Float64Array(2);
+ *
+ * dreduce(Reduction.Sum, Axis.Columns, 2, 3, A, 2, colSums);
+ * // colSums = [3, 7, 11]
+ * dreduce(Reduction.MaxAbs, Axis.Rows, 2, 3, A, 2, rowMax);
+ * // rowMax = [5, 6]
+ * ```
+ */
+export function dreduce(
+  op: Reduction,
+  axis: Axis,
+  m: number,
+  n: number,
+  a: Float64Array,
+  lda: number,
+  r: Float64Array
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  const rLen = axis === Axis.Columns ? n : m;
+  if (r.length < rLen) {
+    throw new Error(`r array too small: expected at least ${rLen}, got ${r.length}`);
+  }
+  if (rLen === 0) {
+    return;
+  }
+  if (m === 0 || n === 0) {
+    // Reductions over no elements
+    r.fill(0, 0, rLen);
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const opChar = op.charCodeAt(0);
+  const axisChar = axis.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dreduce(opChar, axisChar, m, n, a, lda, r);
+    return;
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(m);
+  checkBudget((ld * n + rLen) * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+  const rPtr = module._malloc(rLen * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, m, n, aPtr, ld);
+
+    // Call the WASM function
+    module._dreduce(opChar, axisChar, m, n, aPtr, ld, rPtr);
+
+    // Copy result back to r
+    r.set(module.HEAPF64.subarray(rPtr / 8, rPtr / 8 + rLen));
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(rPtr);
+  }
+}
@@ -3,7 +3,9 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { gather, packedInc, packedLength, scatter } from './utils';
 
 /**
  * Applies a plane rotation to vectors x and y:
@@ -64,23 +66,30 @@ export function drot(
     throw new Error(`y array too small: expected at least ${yLen}, got ${y.length}`);
   }
 
-  // Allocate memory in WASM
-  const xPtr = module._malloc(x.length * 8); // 8 bytes per double
-  const yPtr = module._malloc(y.length * 8);
+  const native = getNative();
+  if (native) {
+    native.drot(n, x, incx, y, incy, c, s);
+    return;
+  }
+
+  // Allocate memory in WASM for the elements used, packed contiguously
+  const xCount = packedLength(n, incx);
+  const yCount = packedLength(n, incy);
+  checkBudget((xCount + yCount) * 8);
+  const xPtr = module._malloc(xCount * 8); // 8 bytes per double
+  const yPtr = module._malloc(yCount * 8);
 
   try {
-    // Copy data to WASM memory
-    module.HEAPF64.set(x, xPtr / 8);
-    module.HEAPF64.set(y, yPtr / 8);
+    // Gather the operands into WASM memory
+    gather(module, x, n, incx, xPtr);
+    gather(module, y, n, incy, yPtr);
 
-    // Call the WASM function
-    module._drot(n, xPtr, incx, yPtr, incy, c, s);
+    // Call the WASM function on the packed operands
+    module._drot(n, xPtr, packedInc(incx), yPtr, packedInc(incy), c, s);
 
-    // Copy results back to original arrays
-    const resultX = module.HEAPF64.subarray(xPtr / 8, xPtr / 8 + x.length);
-    const resultY = module.HEAPF64.subarray(yPtr / 8, yPtr / 8 + y.length);
-    x.set(resultX);
-    y.set(resultY);
+    // Scatter the results back to the original arrays
+    scatter(module, xPtr, x, n, incx);
+    scatter(module, yPtr, y, n, incy);
   } finally {
     // Free WASM memory
     module._free(xPtr);
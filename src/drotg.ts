@@ -3,7 +3,7 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
 
 /**
  * Constructs a Givens plane rotation that eliminates the second component of a vector
@@ -28,6 +28,13 @@ import { getModule } from './wasm-module';
 export function drotg(a: number, b: number): { r: number; z: number; c: number; s: number } {
   const module = getModule();
 
+  const native = getNative();
+  if (native) {
+    const v = new Float64Array([a, b, 0, 0]);
+    native.drotg(v.subarray(0, 1), v.subarray(1, 2), v.subarray(2, 3), v.subarray(3, 4));
+    return { r: v[0], z: v[1], c: v[2], s: v[3] };
+  }
+
   // Allocate memory for the scalars in WASM
   const aPtr = module._malloc(8); // 8 bytes per double
   const bPtr = module._malloc(8);
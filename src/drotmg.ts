@@ -3,7 +3,7 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
 
 /**
  * Constructs a modified Givens transformation matrix H
@@ -32,6 +32,14 @@ export function drotmg(
 ): { dd1: number; dd2: number; dx1: number; param: Float64Array } {
   const module = getModule();
 
+  const native = getNative();
+  if (native) {
+    const v = new Float64Array([dd1, dd2, dx1]);
+    const param = new Float64Array(5);
+    native.drotmg(v.subarray(0, 1), v.subarray(1, 2), v.subarray(2, 3), dy1, param);
+    return { dd1: v[0], dd2: v[1], dx1: v[2], param };
+  }
+
   // Allocate memory for the scalars and parameter array in WASM
   const dd1Ptr = module._malloc(8); // 8 bytes per double
   const dd2Ptr = module._malloc(8);
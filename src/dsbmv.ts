@@ -4,7 +4,8 @@
  */
 
 import { Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric band matrix-vector multiplication: y := alpha * A * x + beta * y
@@ -76,7 +77,17 @@ export function dsbmv(
     throw new Error(`y array is too small: expected at least ${minYSize}, got ${y.length}`);
   }
 
+  // Convert uplo to integer
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+
+  const native = getNative();
+  if (native) {
+    native.dsbmv(uploInt, n, k, alpha, a, lda, x, incx, beta, y, incy);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((a.length + x.length + y.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const xPtr = module._malloc(x.length * 8);
   const yPtr = module._malloc(y.length * 8);
@@ -87,9 +98,6 @@ export function dsbmv(
     module.HEAPF64.set(x, xPtr / 8);
     module.HEAPF64.set(y, yPtr / 8);
 
-    // Convert uplo to integer
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-
     // Call BLAS function
     module._dsbmv(uploInt, n, k, alpha, aPtr, lda, xPtr, incx, beta, yPtr, incy);
 
@@ -3,7 +3,9 @@
  * TypeScript wrapper for WebAssembly implementation
  */
 
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { gather, packedInc, packedLength, scatter } from './utils';
 
 /**
  * Scales a vector by a constant: x = alpha * x
@@ -44,19 +46,31 @@ export function dscal(n: number, alpha: number, x: Float64Array, incx: number =
     throw new Error(`x array too small: expected at least ${xLen}, got ${x.length}`);
   }
 
-  // Allocate memory in WASM
-  const xPtr = module._malloc(x.length * 8); // 8 bytes per double
+  // Like the reference BLAS, non-positive increments leave x unchanged
+  if (incx <= 0) {
+    return;
+  }
+
+  const native = getNative();
+  if (native) {
+    native.dscal(n, alpha, x, incx);
+    return;
+  }
+
+  // Allocate memory in WASM for the elements used, packed contiguously
+  const xCount = packedLength(n, incx);
+  checkBudget(xCount * 8);
+  const xPtr = module._malloc(xCount * 8); // 8 bytes per double
 
   try {
-    // Copy data to WASM memory
-    module.HEAPF64.set(x, xPtr / 8);
+    // Gather the operand into WASM memory
+    gather(module, x, n, incx, xPtr);
 
-    // Call the WASM function
-    module._dscal(n, alpha, xPtr, incx);
+    // Call the WASM function on the packed operand
+    module._dscal(n, alpha, xPtr, packedInc(incx));
 
-    // Copy result back to x
-    const result = module.HEAPF64.subarray(xPtr / 8, xPtr / 8 + x.length);
-    x.set(result);
+    // Scatter the result back to x
+    scatter(module, xPtr, x, n, incx);
   } finally {
     // Free WASM memory
     module._free(xPtr);
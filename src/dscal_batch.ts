@@ -0,0 +1,117 @@
+/**
+ * DSCAL_BATCH - Batched double precision vector scaling
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+import { packedInc, packedLength } from './utils';
+import { BatchOperand, checkBatchOperand, isStrided, packVectors, unpackVectors } from './batch';
+
+/**
+ * Computes x_b = alpha * x_b for every vector x_b of a batch, in one call
+ *
+ * Problems run in parallel on the native backend, and short vectors (up to
+ * 16 elements) two at a time in SIMD lanes on WebAssembly.
+ *
+ * @param n - Number of elements in each vector
+ * @param alpha - Scalar multiplier
+ * @param x - Input/output vectors x_b, one per problem
+ * @param incx - Storage spacing between elements of each x_b
+ * @modifies x - Each x_b is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { dscal_batch, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const xs = [new Float64Array([1, 2]), new Float64Array([3, 4])];
+ *
+ * dscal_batch(2, 0.5, xs, 1);
+ * // xs = [[0.5, 1], [1.5, 2]]
+ * ```
+ */
+export function dscal_batch(n: number, alpha: number, x: Float64Array[], incx: number): void {
+  scalBatch(n, alpha, x, incx, x.length);
+}
+
+/**
+ * Computes x_b = alpha * x_b for b = 0, ..., batch - 1, where x_b starts at
+ * b * strideX in x
+ *
+ * Vectors that lie back to back (unit increment and a stride of n) are
+ * scaled as one long vector; see dscal_batch() for the execution otherwise.
+ *
+ * @param n - Number of elements in each vector
+ * @param alpha - Scalar multiplier
+ * @param x - Input/output vectors x_b (Float64Array)
+ * @param incx - Storage spacing between elements of each x_b
+ * @param strideX - Elements between successive x_b
+ * @param batch - Number of problems
+ * @modifies x - Each x_b is modified in-place
+ */
+export function dscal_batch_strided(
+  n: number,
+  alpha: number,
+  x: Float64Array,
+  incx: number,
+  strideX: number,
+  batch: number
+): void {
+  scalBatch(n, alpha, { array: x, stride: strideX }, incx, batch);
+}
+
+function scalBatch(n: number, alpha: number, x: BatchOperand, incx: number, batch: number): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (!Number.isInteger(batch) || batch < 0) {
+    throw new Error(`batch must be a non-negative integer, got ${batch}`);
+  }
+
+  checkBatchOperand('x', x, batch, 1 + (n - 1) * Math.abs(incx), true);
+
+  // Like the reference BLAS, non-positive increments leave x unchanged
+  if (batch === 0 || n === 0 || incx <= 0) {
+    return;
+  }
+
+  const native = getNative();
+  if (native && isStrided(x)) {
+    native.dscal_batch_strided(n, alpha, x.array, incx, x.stride, batch);
+    return;
+  }
+
+  // Pack the vectors back to back
+  const xSize = packedLength(n, incx);
+
+  if (native) {
+    const xData = new Float64Array(batch * xSize);
+    packVectors(xData, 0, x, batch, n, incx);
+    native.dscal_batch_strided(n, alpha, xData, packedInc(incx), xSize, batch);
+    unpackVectors(xData, 0, x, batch, n, incx);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget(batch * xSize * 8);
+  const xPtr = module._malloc(batch * xSize * 8);
+
+  try {
+    // Copy data to WASM memory
+    packVectors(module.HEAPF64, xPtr / 8, x, batch, n, incx);
+
+    // Call the WASM function
+    module._dscal_batch_strided(n, alpha, xPtr, packedInc(incx), xSize, batch);
+
+    // Copy result back to x
+    unpackVectors(module.HEAPF64, xPtr / 8, x, batch, n, incx);
+  } finally {
+    // Free WASM memory
+    module._free(xPtr);
+  }
+}
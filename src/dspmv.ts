@@ -4,7 +4,8 @@
  */
 
 import { Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric packed matrix-vector multiplication: y := alpha * A * x + beta * y
@@ -75,7 +76,17 @@ export function dspmv(
     throw new Error(`y array is too small: expected at least ${minYSize}, got ${y.length}`);
   }
 
+  // Convert uplo to integer
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+
+  const native = getNative();
+  if (native) {
+    native.dspmv(uploInt, n, alpha, ap, x, incx, beta, y, incy);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((ap.length + x.length + y.length) * 8);
   const apPtr = module._malloc(ap.length * 8);
   const xPtr = module._malloc(x.length * 8);
   const yPtr = module._malloc(y.length * 8);
@@ -86,9 +97,6 @@ export function dspmv(
     module.HEAPF64.set(x, xPtr / 8);
     module.HEAPF64.set(y, yPtr / 8);
 
-    // Convert uplo to integer
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-
     // Call BLAS function
     module._dspmv(uploInt, n, alpha, apPtr, xPtr, incx, beta, yPtr, incy);
 
@@ -1,5 +1,6 @@
 import { Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * DSPR - Double precision symmetric packed rank-1 update
@@ -63,7 +64,17 @@ export function dspr(
     throw new Error(`x array is too small: expected at least ${minXSize}, got ${x.length}`);
   }
 
+  // Convert uplo to integer
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+
+  const native = getNative();
+  if (native) {
+    native.dspr(uploInt, n, alpha, x, incx, ap);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((x.length + ap.length) * 8);
   const xPtr = module._malloc(x.length * 8);
   const apPtr = module._malloc(ap.length * 8);
 
@@ -72,9 +83,6 @@ export function dspr(
     module.HEAPF64.set(x, xPtr / 8);
     module.HEAPF64.set(ap, apPtr / 8);
 
-    // Convert uplo to integer
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-
     // Call BLAS function
     module._dspr(uploInt, n, alpha, xPtr, incx, apPtr);
 
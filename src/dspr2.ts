@@ -4,7 +4,8 @@
  */
 
 import { Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric packed rank-2 update: A := alpha * x * y^T + alpha * y * x^T + A
@@ -74,7 +75,17 @@ export function dspr2(
     throw new Error(`y array is too small: expected at least ${minYSize}, got ${y.length}`);
   }
 
+  // Convert uplo to integer
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+
+  const native = getNative();
+  if (native) {
+    native.dspr2(uploInt, n, alpha, x, incx, y, incy, ap);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((x.length + y.length + ap.length) * 8);
   const xPtr = module._malloc(x.length * 8);
   const yPtr = module._malloc(y.length * 8);
   const apPtr = module._malloc(ap.length * 8);
@@ -85,9 +96,6 @@ export function dspr2(
     module.HEAPF64.set(y, yPtr / 8);
     module.HEAPF64.set(ap, apPtr / 8);
 
-    // Convert uplo to integer
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-
     // Call BLAS function
     module._dspr2(uploInt, n, alpha, xPtr, incx, yPtr, incy, apPtr);
 
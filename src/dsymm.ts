@@ -4,7 +4,8 @@
  */
 
 import { Side, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric matrix-matrix multiplication:
@@ -83,7 +84,18 @@ export function dsymm(
     throw new Error(`c array too small: expected at least ${ldc * n}, got ${c.length}`);
   }
 
+  // Convert parameters for the kernel
+  const sideChar = side.charCodeAt(0);
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dsymm(sideChar, uploChar, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((a.length + b.length + c.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const bPtr = module._malloc(b.length * 8);
   const cPtr = module._malloc(c.length * 8);
@@ -95,8 +107,6 @@ export function dsymm(
     module.HEAPF64.set(c, cPtr / 8);
 
     // Call the WASM function
-    const sideChar = side === Side.Left ? 0 : 1;
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
     module._dsymm(sideChar, uploChar, m, n, alpha, aPtr, lda, bPtr, ldb, beta, cPtr, ldc);
 
     // Copy result back to c
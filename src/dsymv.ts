@@ -4,7 +4,8 @@
  */
 
 import { Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric matrix-vector multiplication: y := alpha * A * x + beta * y
@@ -71,7 +72,17 @@ export function dsymv(
     throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
   }
 
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dsymv(uploChar, n, alpha, a, lda, x, incx, beta, y, incy);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((a.length + x.length + y.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const xPtr = module._malloc(x.length * 8);
   const yPtr = module._malloc(y.length * 8);
@@ -83,7 +94,6 @@ export function dsymv(
     module.HEAPF64.set(y, yPtr / 8);
 
     // Call the WASM function
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
     module._dsymv(uploChar, n, alpha, aPtr, lda, xPtr, incx, beta, yPtr, incy);
 
     // Copy result back to y
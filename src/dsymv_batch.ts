@@ -0,0 +1,257 @@
+/**
+ * DSYMV_BATCH - Batched double precision symmetric matrix-vector multiplication
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { Triangular } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packedInc, packedLength } from './utils';
+import {
+  BatchOperand,
+  batchMembers,
+  checkBatchOperand,
+  isStrided,
+  packMatrices,
+  packVectors,
+  unpackVectors,
+} from './batch';
+
+/**
+ * Performs y_b = alpha * A_b * x_b + beta * y_b with symmetric A_b for every problem b
+ * of a batch, in one call
+ *
+ * The problems are given as arrays of operands, one per problem; a and x may
+ * instead hold a single array that all problems share. See dgemv_batch() for
+ * the execution.
+ *
+ * @param uplo - 'U': use the upper triangles of A_b, 'L': the lower triangles
+ * @param n - Order of each A_b
+ * @param alpha - Scalar multiplier for A*x
+ * @param a - Symmetric matrices A_b in column-major order, one or y.length of them
+ * @param lda - Leading dimension of each A_b (>= max(1,n))
+ * @param x - Input vectors x_b, one or y.length of them
+ * @param incx - Storage spacing between elements of each x_b
+ * @param beta - Scalar multiplier for y
+ * @param y - Input/output vectors y_b, one per problem
+ * @param incy - Storage spacing between elements of each y_b
+ * @modifies y - Each y_b is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { dsymv_batch, initWasm, Triangular } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const As = [new Float64Array([2, 0, 1, 3]), new Float64Array([1, 0, 0, 1])];
+ * const x = new Float64Array([1, 1]); // shared
+ * const ys = [new Float64Array(2), new Float64Array(2)];
+ *
+ * dsymv_batch(Triangular.Upper, 2, 1.0, As, 2, [x], 1, 0.0, ys, 1);
+ * // ys = [[3, 4], [1, 1]]
+ * ```
+ */
+export function dsymv_batch(
+  uplo: Triangular,
+  n: number,
+  alpha: number,
+  a: Float64Array[],
+  lda: number,
+  x: Float64Array[],
+  incx: number,
+  beta: number,
+  y: Float64Array[],
+  incy: number
+): void {
+  symvBatch(uplo, n, alpha, a, lda, x, incx, beta, y, incy, y.length);
+}
+
+/**
+ * Performs y_b = alpha * A_b * x_b + beta * y_b with symmetric A_b for
+ * b = 0, ..., batch - 1, where the operands of problem b start at b * stride
+ * in a, x and y
+ *
+ * A stride of 0 for a or x shares that operand between all problems. See
+ * dgemv_batch() for the execution.
+ *
+ * @param uplo - 'U': use the upper triangles of A_b, 'L': the lower triangles
+ * @param n - Order of each A_b
+ * @param alpha - Scalar multiplier for A*x
+ * @param a - Symmetric matrices A_b in column-major order (Float64Array)
+ * @param lda - Leading dimension of each A_b (>= max(1,n))
+ * @param strideA - Elements between successive A_b (0: shared)
+ * @param x - Input vectors x_b (Float64Array)
+ * @param incx - Storage spacing between elements of each x_b
+ * @param strideX - Elements between successive x_b (0: shared)
+ * @param beta - Scalar multiplier for y
+ * @param y - Input/output vectors y_b (Float64Array)
+ * @param incy - Storage spacing between elements of each y_b
+ * @param strideY - Elements between successive y_b
+ * @param batch - Number of problems
+ * @modifies y - Each y_b is modified in-place
+ */
+export function dsymv_batch_strided(
+  uplo: Triangular,
+  n: number,
+  alpha: number,
+  a: Float64Array,
+  lda: number,
+  strideA: number,
+  x: Float64Array,
+  incx: number,
+  strideX: number,
+  beta: number,
+  y: Float64Array,
+  incy: number,
+  strideY: number,
+  batch: number
+): void {
+  symvBatch(
+    uplo,
+    n,
+    alpha,
+    { array: a, stride: strideA },
+    lda,
+    { array: x, stride: strideX },
+    incx,
+    beta,
+    { array: y, stride: strideY },
+    incy,
+    batch
+  );
+}
+
+function symvBatch(
+  uplo: Triangular,
+  n: number,
+  alpha: number,
+  a: BatchOperand,
+  lda: number,
+  x: BatchOperand,
+  incx: number,
+  beta: number,
+  y: BatchOperand,
+  incy: number,
+  batch: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (!Number.isInteger(batch) || batch < 0) {
+    throw new Error(`batch must be a non-negative integer, got ${batch}`);
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least max(1, n) = ${Math.max(1, n)}, got ${lda}`);
+  }
+
+  checkBatchOperand('a', a, batch, lda * n, false);
+  checkBatchOperand('x', x, batch, 1 + (n - 1) * Math.abs(incx), false);
+  checkBatchOperand('y', y, batch, 1 + (n - 1) * Math.abs(incy), true);
+  if (batch === 0 || n === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native && isStrided(a) && isStrided(x) && isStrided(y)) {
+    native.dsymv_batch_strided(
+      uploChar,
+      n,
+      alpha,
+      a.array,
+      lda,
+      a.stride,
+      x.array,
+      incx,
+      x.stride,
+      beta,
+      y.array,
+      incy,
+      y.stride,
+      batch
+    );
+    return;
+  }
+
+  // Pack the distinct members of each operand back to back; A gets padded
+  // columns in the WASM heap
+  const ld = native ? n : paddedLd(n);
+  const aMembers = batchMembers(a, batch);
+  const xMembers = batchMembers(x, batch);
+  const aSize = ld * n;
+  const xSize = packedLength(n, incx);
+  const ySize = packedLength(n, incy);
+  const aStride = aMembers > 1 ? aSize : 0;
+  const xStride = xMembers > 1 ? xSize : 0;
+
+  if (native) {
+    const aData = new Float64Array(aMembers * aSize);
+    const xData = new Float64Array(xMembers * xSize);
+    const yData = new Float64Array(batch * ySize);
+    packMatrices(aData, 0, a, aMembers, lda, n, n, ld);
+    packVectors(xData, 0, x, xMembers, n, incx);
+    packVectors(yData, 0, y, batch, n, incy);
+    native.dsymv_batch_strided(
+      uploChar,
+      n,
+      alpha,
+      aData,
+      ld,
+      aStride,
+      xData,
+      packedInc(incx),
+      xStride,
+      beta,
+      yData,
+      packedInc(incy),
+      ySize,
+      batch
+    );
+    unpackVectors(yData, 0, y, batch, n, incy);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget((aMembers * aSize + xMembers * xSize + batch * ySize) * 8);
+  const aPtr = module._malloc_aligned(aMembers * aSize * 8);
+  const xPtr = module._malloc(xMembers * xSize * 8);
+  const yPtr = module._malloc(batch * ySize * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrices(module.HEAPF64, aPtr / 8, a, aMembers, lda, n, n, ld);
+    packVectors(module.HEAPF64, xPtr / 8, x, xMembers, n, incx);
+    packVectors(module.HEAPF64, yPtr / 8, y, batch, n, incy);
+
+    // Call the WASM function
+    module._dsymv_batch_strided(
+      uploChar,
+      n,
+      alpha,
+      aPtr,
+      ld,
+      aStride,
+      xPtr,
+      packedInc(incx),
+      xStride,
+      beta,
+      yPtr,
+      packedInc(incy),
+      ySize,
+      batch
+    );
+
+    // Copy result back to y
+    unpackVectors(module.HEAPF64, yPtr / 8, y, batch, n, incy);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(xPtr);
+    module._free(yPtr);
+  }
+}
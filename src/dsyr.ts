@@ -4,7 +4,8 @@
  */
 
 import { Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric rank-1 update: A := alpha * x * x^T + A
@@ -60,7 +61,17 @@ export function dsyr(
     throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
   }
 
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dsyr(uploChar, n, alpha, x, incx, a, lda);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((x.length + a.length) * 8);
   const xPtr = module._malloc(x.length * 8);
   const aPtr = module._malloc(a.length * 8);
 
@@ -70,7 +81,6 @@ export function dsyr(
     module.HEAPF64.set(a, aPtr / 8);
 
     // Call the WASM function
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
     module._dsyr(uploChar, n, alpha, xPtr, incx, aPtr, lda);
 
     // Copy result back to a
@@ -4,7 +4,8 @@
  */
 
 import { Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric rank-2 update: A := alpha * x * y^T + alpha * y * x^T + A
@@ -69,7 +70,17 @@ export function dsyr2(
     throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
   }
 
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dsyr2(uploChar, n, alpha, x, incx, y, incy, a, lda);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((x.length + y.length + a.length) * 8);
   const xPtr = module._malloc(x.length * 8);
   const yPtr = module._malloc(y.length * 8);
   const aPtr = module._malloc(a.length * 8);
@@ -81,7 +92,6 @@ export function dsyr2(
     module.HEAPF64.set(a, aPtr / 8);
 
     // Call the WASM function
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
     module._dsyr2(uploChar, n, alpha, xPtr, incx, yPtr, incy, aPtr, lda);
 
     // Copy result back to a
@@ -4,7 +4,8 @@
  */
 
 import { Transpose, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric rank-2k update:
@@ -86,7 +87,18 @@ export function dsyr2k(
     throw new Error(`c array too small: expected at least ${ldc * n}, got ${c.length}`);
   }
 
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+  const transChar = trans.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dsyr2k(uploChar, transChar, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((a.length + b.length + c.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const bPtr = module._malloc(b.length * 8);
   const cPtr = module._malloc(c.length * 8);
@@ -98,8 +110,6 @@ export function dsyr2k(
     module.HEAPF64.set(c, cPtr / 8);
 
     // Call the WASM function
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
-    const transChar = trans === Transpose.NoTranspose ? 0 : 1;
     module._dsyr2k(uploChar, transChar, n, k, alpha, aPtr, lda, bPtr, ldb, beta, cPtr, ldc);
 
     // Copy result back to c
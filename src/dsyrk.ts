@@ -4,7 +4,8 @@
  */
 
 import { Transpose, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs symmetric rank-k update:
@@ -73,7 +74,18 @@ export function dsyrk(
     throw new Error(`c array too small: expected at least ${ldc * n}, got ${c.length}`);
   }
 
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+  const transChar = trans.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dsyrk(uploChar, transChar, n, k, alpha, a, lda, beta, c, ldc);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((a.length + c.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const cPtr = module._malloc(c.length * 8);
 
@@ -83,8 +95,6 @@ export function dsyrk(
     module.HEAPF64.set(c, cPtr / 8);
 
     // Call the WASM function
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
-    const transChar = trans === Transpose.NoTranspose ? 0 : 1;
     module._dsyrk(uploChar, transChar, n, k, alpha, aPtr, lda, beta, cPtr, ldc);
 
     // Copy result back to c
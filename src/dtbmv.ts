@@ -4,7 +4,8 @@
  */
 
 import { Diagonal, Transpose, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Performs triangular band matrix-vector multiplication: x := op(A) * x
@@ -55,7 +56,19 @@ export function dtbmv(
     throw new Error(`x array is too small: expected at least ${minXSize}, got ${x.length}`);
   }
 
+  // Convert parameters to integers
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+  const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
+  const diagInt = diag === Diagonal.NonUnit ? 0 : 1;
+
+  const native = getNative();
+  if (native) {
+    native.dtbmv(uploInt, transInt, diagInt, n, k, a, lda, x, incx);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((a.length + x.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const xPtr = module._malloc(x.length * 8);
 
@@ -64,11 +77,6 @@ export function dtbmv(
     module.HEAPF64.set(a, aPtr / 8);
     module.HEAPF64.set(x, xPtr / 8);
 
-    // Convert parameters to integers
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-    const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
-    const diagInt = diag === Diagonal.NonUnit ? 0 : 1;
-
     // Call BLAS function
     module._dtbmv(uploInt, transInt, diagInt, n, k, aPtr, lda, xPtr, incx);
 
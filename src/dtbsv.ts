@@ -4,7 +4,8 @@
  */
 
 import { Diagonal, Transpose, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Solves triangular band system: A*x = b where A is triangular and banded
@@ -54,7 +55,19 @@ export function dtbsv(
     throw new Error(`x array is too small: expected at least ${minXSize}, got ${x.length}`);
   }
 
+  // Convert parameters to integers
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+  const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
+  const diagInt = diag === Diagonal.NonUnit ? 0 : 1;
+
+  const native = getNative();
+  if (native) {
+    native.dtbsv(uploInt, transInt, diagInt, n, k, a, lda, x, incx);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((a.length + x.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const xPtr = module._malloc(x.length * 8);
 
@@ -63,11 +76,6 @@ export function dtbsv(
     module.HEAPF64.set(a, aPtr / 8);
     module.HEAPF64.set(x, xPtr / 8);
 
-    // Convert parameters to integers
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-    const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
-    const diagInt = diag === Diagonal.NonUnit ? 0 : 1;
-
     // Call BLAS function
     module._dtbsv(uploInt, transInt, diagInt, n, k, aPtr, lda, xPtr, incx);
 
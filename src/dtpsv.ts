@@ -4,7 +4,8 @@
  */
 
 import { Triangular, Transpose, Diagonal } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Solves triangular packed system: A*x = b where A is triangular and packed
@@ -53,7 +54,19 @@ export function dtpsv(
     throw new Error(`x array is too small: expected at least ${minXSize}, got ${x.length}`);
   }
 
+  // Convert parameters to integers
+  const uploInt = uplo === Triangular.Upper ? 0 : 1;
+  const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
+  const diagInt = diag === Diagonal.NonUnit ? 0 : 1;
+
+  const native = getNative();
+  if (native) {
+    native.dtpsv(uploInt, transInt, diagInt, n, ap, x, incx);
+    return;
+  }
+
   // Allocate memory
+  checkBudget((ap.length + x.length) * 8);
   const apPtr = module._malloc(ap.length * 8);
   const xPtr = module._malloc(x.length * 8);
 
@@ -62,11 +75,6 @@ export function dtpsv(
     module.HEAPF64.set(ap, apPtr / 8);
     module.HEAPF64.set(x, xPtr / 8);
 
-    // Convert parameters to integers
-    const uploInt = uplo === Triangular.Upper ? 0 : 1;
-    const transInt = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
-    const diagInt = diag === Diagonal.NonUnit ? 0 : 1;
-
     // Call BLAS function
     module._dtpsv(uploInt, transInt, diagInt, n, apPtr, xPtr, incx);
 
@@ -0,0 +1,224 @@
+/**
+ * DTRMV_BATCH - Batched double precision triangular matrix-vector multiplication
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { Diagonal, Transpose, Triangular } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packedInc, packedLength } from './utils';
+import {
+  BatchOperand,
+  batchMembers,
+  checkBatchOperand,
+  isStrided,
+  packMatrices,
+  packVectors,
+  unpackVectors,
+} from './batch';
+
+/**
+ * Performs x_b = op(A_b) * x_b with triangular A_b for every problem b of a batch, in one call
+ *
+ * The problems are given as arrays of operands, one per problem; a may
+ * instead hold a single matrix that all problems share. See dgemv_batch()
+ * for the execution.
+ *
+ * @param uplo - 'U': upper triangular, 'L': lower triangular
+ * @param trans - 'N': x = A*x, 'T'/'C': x = A^T*x
+ * @param diag - 'U': unit triangular, 'N': non-unit triangular
+ * @param n - Order of each A_b
+ * @param a - Triangular matrices A_b in column-major order, one or x.length of them
+ * @param lda - Leading dimension of each A_b (>= max(1,n))
+ * @param x - Input/output vectors x_b, one per problem
+ * @param incx - Storage spacing between elements of each x_b
+ * @modifies x - Each x_b is overwritten with op(A_b) * x_b
+ *
+ * @example
+ * ```typescript
+ * import { Diagonal, dtrmv_batch, initWasm, Transpose, Triangular } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([2, 0, 1, 4]); // [[2,1], [0,4]], shared
+ * const xs = [new Float64Array([1, 1]), new Float64Array([0, 1])];
+ *
+ * dtrmv_batch(Triangular.Upper, Transpose.NoTranspose, Diagonal.NonUnit, 2, [A], 2, xs, 1);
+ * // xs = [[3, 4], [1, 4]]
+ * ```
+ */
+export function dtrmv_batch(
+  uplo: Triangular,
+  trans: Transpose,
+  diag: Diagonal,
+  n: number,
+  a: Float64Array[],
+  lda: number,
+  x: Float64Array[],
+  incx: number
+): void {
+  trmvBatch(uplo, trans, diag, n, a, lda, x, incx, x.length);
+}
+
+/**
+ * Performs x_b = op(A_b) * x_b with triangular A_b for b = 0, ..., batch - 1,
+ * where the operands of problem b start at b * stride in a and x
+ *
+ * A stride of 0 for a shares the matrix between all problems. See
+ * dgemv_batch() for the execution.
+ *
+ * @param uplo - 'U': upper triangular, 'L': lower triangular
+ * @param trans - 'N': x = A*x, 'T'/'C': x = A^T*x
+ * @param diag - 'U': unit triangular, 'N': non-unit triangular
+ * @param n - Order of each A_b
+ * @param a - Triangular matrices A_b in column-major order (Float64Array)
+ * @param lda - Leading dimension of each A_b (>= max(1,n))
+ * @param strideA - Elements between successive A_b (0: shared)
+ * @param x - Input/output vectors x_b (Float64Array)
+ * @param incx - Storage spacing between elements of each x_b
+ * @param strideX - Elements between successive x_b
+ * @param batch - Number of problems
+ * @modifies x - Each x_b is overwritten with op(A_b) * x_b
+ */
+export function dtrmv_batch_strided(
+  uplo: Triangular,
+  trans: Transpose,
+  diag: Diagonal,
+  n: number,
+  a: Float64Array,
+  lda: number,
+  strideA: number,
+  x: Float64Array,
+  incx: number,
+  strideX: number,
+  batch: number
+): void {
+  trmvBatch(
+    uplo,
+    trans,
+    diag,
+    n,
+    { array: a, stride: strideA },
+    lda,
+    { array: x, stride: strideX },
+    incx,
+    batch
+  );
+}
+
+function trmvBatch(
+  uplo: Triangular,
+  trans: Transpose,
+  diag: Diagonal,
+  n: number,
+  a: BatchOperand,
+  lda: number,
+  x: BatchOperand,
+  incx: number,
+  batch: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (!Number.isInteger(batch) || batch < 0) {
+    throw new Error(`batch must be a non-negative integer, got ${batch}`);
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least max(1, n) = ${Math.max(1, n)}, got ${lda}`);
+  }
+
+  checkBatchOperand('a', a, batch, lda * n, false);
+  checkBatchOperand('x', x, batch, 1 + (n - 1) * Math.abs(incx), true);
+  if (batch === 0 || n === 0) {
+    return;
+  }
+
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+  const transChar = trans.charCodeAt(0);
+  const diagChar = diag.charCodeAt(0);
+
+  const native = getNative();
+  if (native && isStrided(a) && isStrided(x)) {
+    native.dtrmv_batch_strided(
+      uploChar,
+      transChar,
+      diagChar,
+      n,
+      a.array,
+      lda,
+      a.stride,
+      x.array,
+      incx,
+      x.stride,
+      batch
+    );
+    return;
+  }
+
+  // Pack the distinct members of each operand back to back; A gets padded
+  // columns in the WASM heap
+  const ld = native ? n : paddedLd(n);
+  const aMembers = batchMembers(a, batch);
+  const aSize = ld * n;
+  const xSize = packedLength(n, incx);
+  const aStride = aMembers > 1 ? aSize : 0;
+
+  if (native) {
+    const aData = new Float64Array(aMembers * aSize);
+    const xData = new Float64Array(batch * xSize);
+    packMatrices(aData, 0, a, aMembers, lda, n, n, ld);
+    packVectors(xData, 0, x, batch, n, incx);
+    native.dtrmv_batch_strided(
+      uploChar,
+      transChar,
+      diagChar,
+      n,
+      aData,
+      ld,
+      aStride,
+      xData,
+      packedInc(incx),
+      xSize,
+      batch
+    );
+    unpackVectors(xData, 0, x, batch, n, incx);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget((aMembers * aSize + batch * xSize) * 8);
+  const aPtr = module._malloc_aligned(aMembers * aSize * 8);
+  const xPtr = module._malloc(batch * xSize * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrices(module.HEAPF64, aPtr / 8, a, aMembers, lda, n, n, ld);
+    packVectors(module.HEAPF64, xPtr / 8, x, batch, n, incx);
+
+    // Call the WASM function
+    module._dtrmv_batch_strided(
+      uploChar,
+      transChar,
+      diagChar,
+      n,
+      aPtr,
+      ld,
+      aStride,
+      xPtr,
+      packedInc(incx),
+      xSize,
+      batch
+    );
+
+    // Copy result back to x
+    unpackVectors(module.HEAPF64, xPtr / 8, x, batch, n, incx);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(xPtr);
+  }
+}
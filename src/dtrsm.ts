@@ -4,7 +4,8 @@
  */
 
 import { Diagonal, Side, Transpose, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Solves triangular system with multiple RHS:
@@ -75,7 +76,20 @@ export function dtrsm(
     throw new Error(`b array too small: expected at least ${ldb * n}, got ${b.length}`);
   }
 
+  // Convert parameters for the kernel
+  const sideChar = side.charCodeAt(0);
+  const uploChar = uplo.charCodeAt(0);
+  const transaChar = transa.charCodeAt(0);
+  const diagChar = diag.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dtrsm(sideChar, uploChar, transaChar, diagChar, m, n, alpha, a, lda, b, ldb);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((a.length + b.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const bPtr = module._malloc(b.length * 8);
 
@@ -85,11 +99,6 @@ export function dtrsm(
     module.HEAPF64.set(b, bPtr / 8);
 
     // Call the WASM function
-    const sideChar = side === Side.Left ? 0 : 1;
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
-    const transaChar =
-      transa === Transpose.NoTranspose ? 0 : transa === Transpose.Transpose ? 1 : 2;
-    const diagChar = diag === Diagonal.NonUnit ? 0 : 1;
     module._dtrsm(sideChar, uploChar, transaChar, diagChar, m, n, alpha, aPtr, lda, bPtr, ldb);
 
     // Copy result back to b
@@ -4,7 +4,8 @@
  */
 
 import { Diagonal, Transpose, Triangular } from './types';
-import { getModule } from './wasm-module';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
 
 /**
  * Solves triangular system: A*x = b or A^T*x = b (b is overwritten by x)
@@ -62,7 +63,19 @@ export function dtrsv(
     throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
   }
 
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+  const transChar = trans.charCodeAt(0);
+  const diagChar = diag.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.dtrsv(uploChar, transChar, diagChar, n, a, lda, x, incx);
+    return;
+  }
+
   // Allocate memory in WASM
+  checkBudget((a.length + x.length) * 8);
   const aPtr = module._malloc(a.length * 8);
   const xPtr = module._malloc(x.length * 8);
 
@@ -72,9 +85,6 @@ export function dtrsv(
     module.HEAPF64.set(x, xPtr / 8);
 
     // Call the WASM function
-    const uploChar = uplo === Triangular.Upper ? 0 : 1;
-    const transChar = trans === Transpose.NoTranspose ? 0 : trans === Transpose.Transpose ? 1 : 2;
-    const diagChar = diag === Diagonal.NonUnit ? 0 : 1;
     module._dtrsv(uploChar, transChar, diagChar, n, aPtr, lda, xPtr, incx);
 
     // Copy result back to x
@@ -0,0 +1,89 @@
+/**
+ * DTRTRI - Double precision inverse of a triangular matrix
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Diagonal, Triangular } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { packMatrix, unpackMatrix } from './utils';
+
+/**
+ * Computes the inverse of an upper or lower triangular matrix A in place
+ *
+ * Blocks of 64 columns are computed with dtrmm and dtrsm, so no workspace
+ * beyond A is needed.
+ *
+ * @param uplo - 'U': A is upper triangular, 'L': A is lower triangular
+ * @param diag - 'U': unit diagonal (not referenced), 'N': non-unit diagonal
+ * @param n - Order of A
+ * @param a - Input triangular matrix, output its inverse in column-major order (Float64Array);
+ *            the other triangle is not referenced
+ * @param lda - Leading dimension of A
+ * @returns 0 on success, i > 0 if A(i-1, i-1) is exactly zero (A is then unchanged)
+ * @modifies a - The triangle of a is overwritten by the inverse
+ *
+ * @example
+ * ```typescript
+ * import { Diagonal, dtrtri, initWasm, Triangular } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Float64Array([2, 0, 1, 4]); // [[2,1], [0,4]]
+ *
+ * dtrtri(Triangular.Upper, Diagonal.NonUnit, 2, A, 2); // 0
+ * // A = [0.5, 0, -0.125, 0.25]
+ * ```
+ */
+export function dtrtri(
+  uplo: Triangular,
+  diag: Diagonal,
+  n: number,
+  a: Float64Array,
+  lda: number
+): number {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (lda < Math.max(1, n)) {
+    throw new Error(`lda must be at least ${Math.max(1, n)}, got ${lda}`);
+  }
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (n === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const uploChar = uplo.charCodeAt(0);
+  const diagChar = diag.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    return native.dtrtri(uploChar, diagChar, n, a, lda);
+  }
+
+  // Allocate memory in WASM
+  const ld = paddedLd(n);
+  checkBudget(ld * n * 8);
+  const aPtr = module._malloc_aligned(ld * n * 8);
+
+  try {
+    // Copy data to WASM memory
+    packMatrix(module, a, lda, n, n, aPtr, ld);
+
+    // Call the WASM function
+    const info = module._dtrtri(uploChar, diagChar, n, aPtr, ld);
+
+    // Copy result back to a
+    unpackMatrix(module, aPtr, ld, a, lda, n, n);
+    return info;
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+  }
+}
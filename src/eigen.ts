@@ -0,0 +1,404 @@
+/**
+ * DPOWER / DLANCZOS - Double precision eigensolvers for large operators
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Triangular, Which } from './types';
+import { BlasModule, getModule, getNative } from './wasm-module';
+import { checkBudget, paddedLd } from './memory';
+import { unpackMatrix } from './utils';
+
+/**
+ * The n x n matrix of an eigensolver, by its storage. The whole solve runs
+ * inside one kernel call, which applies the matrix with:
+ * - 'dense': dgemv on the full matrix (a, lda)
+ * - 'band': dsbmv on the symmetric band with k super- or subdiagonals (a, lda)
+ * - 'packed': dspmv on the packed symmetric triangle (ap)
+ * - 'sparse': a compressed sparse row product with zero-based row pointers (n + 1) and
+ *   column indices
+ */
+export type LinearOperator =
+  | { kind: 'dense'; n: number; a: Float64Array; lda: number }
+  | { kind: 'band'; n: number; k: number; uplo: Triangular; a: Float64Array; lda: number }
+  | { kind: 'packed'; n: number; uplo: Triangular; ap: Float64Array }
+  | { kind: 'sparse'; n: number; rowPtr: Int32Array; colInd: Int32Array; values: Float64Array };
+
+/** Result of dpower */
+export interface PowerResult {
+  /** The eigenvalue of largest magnitude */
+  lambda: number;
+  /** Whether the residual reached the tolerance within maxit iterations */
+  converged: boolean;
+}
+
+/** The kernel arguments of an operator */
+interface OperatorArgs {
+  kind: number;
+  uplo: number;
+  n: number;
+  k: number;
+  a: Float64Array;
+  lda: number;
+  ia: Int32Array | null;
+  ja: Int32Array | null;
+}
+
+// Validate the operator and lay out its kernel arguments
+function operatorArgs(op: LinearOperator): OperatorArgs {
+  const n = op.n;
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  const upper = Triangular.Upper.charCodeAt(0);
+  switch (op.kind) {
+    case 'dense': {
+      if (op.lda < Math.max(1, n)) {
+        throw new Error(`lda must be at least ${Math.max(1, n)}, got ${op.lda}`);
+      }
+      const length = op.lda * n;
+      if (op.a.length < length) {
+        throw new Error(`a array too small: expected at least ${length}, got ${op.a.length}`);
+      }
+      const a = op.a.subarray(0, length);
+      return { kind: 'D'.charCodeAt(0), uplo: upper, n, k: 0, a, lda: op.lda, ia: null, ja: null };
+    }
+    case 'band': {
+      if (op.k < 0) {
+        throw new Error('k must be non-negative');
+      }
+      if (op.lda < op.k + 1) {
+        throw new Error(`lda must be at least ${op.k + 1}, got ${op.lda}`);
+      }
+      const length = op.lda * n;
+      if (op.a.length < length) {
+        throw new Error(`a array too small: expected at least ${length}, got ${op.a.length}`);
+      }
+      const a = op.a.subarray(0, length);
+      const uplo = op.uplo.charCodeAt(0);
+      return { kind: 'B'.charCodeAt(0), uplo, n, k: op.k, a, lda: op.lda, ia: null, ja: null };
+    }
+    case 'packed': {
+      const length = (n * (n + 1)) / 2;
+      if (op.ap.length < length) {
+        throw new Error(`ap array too small: expected at least ${length}, got ${op.ap.length}`);
+      }
+      const a = op.ap.subarray(0, length);
+      const uplo = op.uplo.charCodeAt(0);
+      return { kind: 'P'.charCodeAt(0), uplo, n, k: 0, a, lda: 1, ia: null, ja: null };
+    }
+    case 'sparse': {
+      const { rowPtr, colInd, values } = op;
+      if (rowPtr.length < n + 1) {
+        throw new Error(
+          `rowPtr array too small: expected at least ${n + 1}, got ${rowPtr.length}`
+        );
+      }
+      if (rowPtr[0] !== 0) {
+        throw new Error(`rowPtr[0] must be 0, got ${rowPtr[0]}`);
+      }
+      for (let i = 0; i < n; i++) {
+        if (rowPtr[i + 1] < rowPtr[i]) {
+          throw new Error(`rowPtr must be non-decreasing, got ${rowPtr[i + 1]} at ${i + 1}`);
+        }
+      }
+      const nnz = rowPtr[n];
+      if (colInd.length < nnz || values.length < nnz) {
+        throw new Error(`colInd and values must hold ${nnz} nonzeros`);
+      }
+      for (let p = 0; p < nnz; p++) {
+        if (colInd[p] < 0 || colInd[p] >= n) {
+          throw new Error(`colInd[${p}] out of range: expected 0 to ${n - 1}, got ${colInd[p]}`);
+        }
+      }
+      const a = values.subarray(0, nnz);
+      const ia = rowPtr.subarray(0, n + 1);
+      const ja = colInd.subarray(0, nnz);
+      return { kind: 'S'.charCodeAt(0), uplo: upper, n, k: 0, a, lda: 1, ia, ja };
+    }
+  }
+}
+
+// Copy the operator into the heap and run fn with its pointers; the copies
+// are freed afterwards
+function withOperator<T>(
+  module: BlasModule,
+  args: OperatorArgs,
+  extraBytes: number,
+  fn: (aPtr: number, iaPtr: number, jaPtr: number) => T
+): T {
+  const iaLength = args.ia ? args.ia.length : 0;
+  const jaLength = args.ja ? args.ja.length : 0;
+  checkBudget(args.a.length * 8 + (iaLength + jaLength) * 4 + extraBytes);
+  const aPtr = module._malloc_aligned(Math.max(1, args.a.length) * 8);
+  const iaPtr = args.ia ? module._malloc(Math.max(1, iaLength) * 4) : 0;
+  const jaPtr = args.ja ? module._malloc(Math.max(1, jaLength) * 4) : 0;
+
+  try {
+    // Copy data to WASM memory
+    module.HEAPF64.set(args.a, aPtr / 8);
+    if (args.ia) {
+      module.HEAP32.set(args.ia, iaPtr / 4);
+    }
+    if (args.ja) {
+      module.HEAP32.set(args.ja, jaPtr / 4);
+    }
+    return fn(aPtr, iaPtr, jaPtr);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    if (iaPtr) {
+      module._free(iaPtr);
+    }
+    if (jaPtr) {
+      module._free(jaPtr);
+    }
+  }
+}
+
+/**
+ * Computes the eigenvalue of largest magnitude of A and its eigenvector by
+ * power iteration: x = A*x / ||A*x|| until ||A*x - lambda*x|| <= tol * ||A*x||,
+ * with the Rayleigh quotient lambda = x^T*A*x
+ *
+ * A need not be symmetric, as for the column-stochastic link matrix of
+ * PageRank. The iteration runs entirely inside one kernel call: the
+ * operator is applied in WebAssembly (or natively) and each step's dot
+ * products, updates and norms are fused, with no calls back to JavaScript.
+ *
+ * @param op - The matrix A (see LinearOperator)
+ * @param x - Input starting vector of n elements (all ones if zero), output the unit
+ *            eigenvector
+ * @param maxit - Maximum number of iterations (default 1000)
+ * @param tol - Relative residual tolerance (default 1e-10)
+ * @returns The eigenvalue and whether the iteration converged
+ * @modifies x - The x vector is overwritten by the eigenvector
+ *
+ * @example
+ * ```typescript
+ * import { dpower, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * // A = [[2, 1], [1, 2]]
+ * const op = { kind: 'dense' as const, n: 2, a: new Float64Array([2, 1, 1, 2]), lda: 2 };
+ * const x = new Float64Array([1, 0]);
+ *
+ * dpower(op, x); // { lambda: 3, converged: true }
+ * // x = [0.7071..., 0.7071...]
+ * ```
+ */
+export function dpower(
+  op: LinearOperator,
+  x: Float64Array,
+  maxit: number = 1000,
+  tol: number = 1e-10
+): PowerResult {
+  const module = getModule();
+
+  // Handle edge cases
+  const args = operatorArgs(op);
+  const n = args.n;
+  if (maxit < 0) {
+    throw new Error('maxit must be non-negative');
+  }
+  if (x.length < n) {
+    throw new Error(`x array too small: expected at least ${n}, got ${x.length}`);
+  }
+  if (n === 0) {
+    return { lambda: 0, converged: true };
+  }
+
+  const { kind, uplo, k, a, lda, ia, ja } = args;
+
+  const native = getNative();
+  if (native) {
+    const lambda = new Float64Array(1);
+    const info = native.dpower(kind, uplo, n, k, a, lda, ia, ja, maxit, tol, x, lambda);
+    return { lambda: lambda[0], converged: info === 0 };
+  }
+
+  // x and lambda, plus the kernel's own workspace of n elements
+  return withOperator(module, args, (2 * n + 1) * 8, (aPtr, iaPtr, jaPtr) => {
+    const xPtr = module._malloc_aligned(n * 8);
+    const lambdaPtr = module._malloc(8);
+    try {
+      module.HEAPF64.set(x.subarray(0, n), xPtr / 8);
+
+      // Call the WASM function
+      const info = module._dpower(
+        kind,
+        uplo,
+        n,
+        k,
+        aPtr,
+        lda,
+        iaPtr,
+        jaPtr,
+        maxit,
+        tol,
+        xPtr,
+        lambdaPtr
+      );
+
+      // Copy the eigenvector back to x
+      x.set(module.HEAPF64.subarray(xPtr / 8, xPtr / 8 + n));
+      return { lambda: module.HEAPF64[lambdaPtr / 8], converged: info === 0 };
+    } finally {
+      module._free(xPtr);
+      module._free(lambdaPtr);
+    }
+  });
+}
+
+/**
+ * Computes nev eigenvalues of the symmetric matrix A, the largest, the
+ * smallest or those of largest magnitude, and their orthonormal
+ * eigenvectors by the thick-restart Lanczos method
+ *
+ * The Krylov basis of ncv vectors is built with one product with A per
+ * step, the three-term recurrence in fused dot/axpy/norm passes and full
+ * reorthogonalization; when it is full, the basis restarts from the best
+ * Ritz vectors. A pair has converged when its residual is at most
+ * tol * ||A|| (estimated by the largest Ritz value). The whole solve runs
+ * inside one kernel call, with no calls back to JavaScript, and the result
+ * is reproducible (the starting vector is fixed).
+ *
+ * @param op - The symmetric matrix A (see LinearOperator); 'dense' and 'sparse' operators
+ *             must store both triangles
+ * @param which - Which eigenvalues to compute (see Which)
+ * @param nev - Number of eigenpairs, less than n
+ * @param w - Output the nev eigenvalues, largest first for Largest and LargestMagnitude,
+ *            smallest first for Smallest (Float64Array)
+ * @param z - Output the eigenvectors in column-major order (n x nev)
+ * @param ldz - Leading dimension of z
+ * @param ncv - Number of basis vectors, nev < ncv <= n (default min(n, max(2*nev + 1, 20)))
+ * @param maxit - Maximum number of restarts (default 300)
+ * @param tol - Relative residual tolerance (default 1e-10)
+ * @returns 0 on convergence, or the number of eigenpairs that did not converge (w and z
+ *          then hold the current approximations)
+ * @modifies w - The w vector is overwritten by the eigenvalues
+ * @modifies z - The z matrix is overwritten by the eigenvectors
+ *
+ * @example
+ * ```typescript
+ * import { dlanczos, initWasm, Triangular, Which } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * // 1-D Laplacian tridiag(-1, 2, -1) of order 400 in band storage
+ * const n = 400;
+ * const a = new Float64Array(2 * n);
+ * for (let j = 0; j < n; j++) {
+ *   a[2 * j] = -1;
+ *   a[2 * j + 1] = 2;
+ * }
+ * const op = { kind: 'band' as const, n, k: 1, uplo: Triangular.Upper, a, lda: 2 };
+ * const w = new Float64Array(4);
+ * const z = new Float64Array(n * 4);
+ *
+ * dlanczos(op, Which.Largest, 4, w, z, n); // 0
+ * // w[0] = 2 + 2 * cos(pi / 401) = 3.99993...
+ * ```
+ */
+export function dlanczos(
+  op: LinearOperator,
+  which: Which,
+  nev: number,
+  w: Float64Array,
+  z: Float64Array,
+  ldz: number,
+  ncv: number = Math.min(op.n, Math.max(2 * nev + 1, 20)),
+  maxit: number = 300,
+  tol: number = 1e-10
+): number {
+  const module = getModule();
+
+  // Handle edge cases
+  const args = operatorArgs(op);
+  const n = args.n;
+  if (nev < 0 || (nev > 0 && nev >= n)) {
+    throw new Error(`nev must be non-negative and less than n = ${n}, got ${nev}`);
+  }
+  if (nev > 0 && (ncv <= nev || ncv > n)) {
+    throw new Error(`ncv must be greater than nev and at most n = ${n}, got ${ncv}`);
+  }
+  if (maxit < 0) {
+    throw new Error('maxit must be non-negative');
+  }
+  if (ldz < Math.max(1, n)) {
+    throw new Error(`ldz must be at least ${Math.max(1, n)}, got ${ldz}`);
+  }
+  if (w.length < nev) {
+    throw new Error(`w array too small: expected at least ${nev}, got ${w.length}`);
+  }
+  if (z.length < ldz * nev) {
+    throw new Error(`z array too small: expected at least ${ldz * nev}, got ${z.length}`);
+  }
+  if (nev === 0) {
+    return 0;
+  }
+
+  // Convert parameters for the kernel
+  const whichChar = which.charCodeAt(0);
+  const { kind, uplo, k, a, lda, ia, ja } = args;
+
+  const native = getNative();
+  if (native) {
+    return native.dlanczos(
+      kind,
+      uplo,
+      n,
+      k,
+      a,
+      lda,
+      ia,
+      ja,
+      whichChar,
+      nev,
+      ncv,
+      maxit,
+      tol,
+      w,
+      z,
+      ldz
+    );
+  }
+
+  // w and z, plus the workspace the kernel allocates: the basis, T and its
+  // eigenvectors, the restart workspace and a few ncv-element vectors
+  const ldzHeap = paddedLd(n);
+  const workspace = (n * (2 * ncv + 1) + 3 * ncv * ncv + 2 * ncv + 1) * 8 + ncv * 4;
+  return withOperator(module, args, (nev + ldzHeap * nev) * 8 + workspace, (aPtr, iaPtr, jaPtr) => {
+    const wPtr = module._malloc(nev * 8);
+    const zPtr = module._malloc_aligned(ldzHeap * nev * 8);
+    try {
+      // Call the WASM function
+      const info = module._dlanczos(
+        kind,
+        uplo,
+        n,
+        k,
+        aPtr,
+        lda,
+        iaPtr,
+        jaPtr,
+        whichChar,
+        nev,
+        ncv,
+        maxit,
+        tol,
+        wPtr,
+        zPtr,
+        ldzHeap
+      );
+
+      // Copy the eigenpairs back to w and z
+      w.set(module.HEAPF64.subarray(wPtr / 8, wPtr / 8 + nev));
+      unpackMatrix(module, zPtr, ldzHeap, z, ldz, n, nev);
+      return info;
+    } finally {
+      module._free(wPtr);
+      module._free(zPtr);
+    }
+  });
+}
@@ -0,0 +1,201 @@
+/**
+ * GEMM_U8S8U8 - Quantized uint8 x int8 matrix multiplication with requantized uint8 output
+ * TypeScript wrapper for WebAssembly implementation
+ */
+
+import { Transpose } from './types';
+import { getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+
+/**
+ * Performs quantized matrix-matrix multiplication with a fused requantization epilogue:
+ * C(i,j) = clamp(round((acc(i,j) + bias(j)) * scale(j)) + cZero, 0, 255)
+ * where acc = (op(A) - aZero) * (op(B) - bZero) is accumulated in int32
+ *
+ * @param transa - 'N': op(A) = A, 'T'/'C': op(A) = A^T
+ * @param transb - 'N': op(B) = B, 'T'/'C': op(B) = B^T
+ * @param m - Number of rows of op(A) and C
+ * @param n - Number of columns of op(B) and C
+ * @param k - Number of columns of op(A) and rows of op(B)
+ * @param a - Matrix A in column-major order (Uint8Array)
+ * @param lda - Leading dimension of A
+ * @param aZero - Zero point of A (0..255)
+ * @param b - Matrix B in column-major order (Int8Array)
+ * @param ldb - Leading dimension of B
+ * @param bZero - Zero point of B (-128..127)
+ * @param bias - Per-column int32 bias added before scaling (Int32Array of length n), or null
+ * @param scale - Requantization scale: one value (per-tensor) or n values (per-channel)
+ * @param cZero - Zero point of C (0..255)
+ * @param c - Output matrix C in column-major order (Uint8Array)
+ * @param ldc - Leading dimension of C
+ * @modifies c - The c matrix is overwritten in-place
+ *
+ * @example
+ * ```typescript
+ * import { gemm_u8s8u8, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Uint8Array([129, 131, 130, 132]); // [[1,2], [3,4]] with zero point 128
+ * const B = new Int8Array([5, 7, 6, 8]); // [[5,6], [7,8]]
+ * const C = new Uint8Array(4);
+ *
+ * gemm_u8s8u8('N', 'N', 2, 2, 2, A, 2, 128, B, 2, 0, null, new Float32Array([0.5]), 10, C, 2);
+ * // C = [[20,21], [32,35]] (round half to even)
+ * ```
+ */
+export function gemm_u8s8u8(
+  transa: Transpose,
+  transb: Transpose,
+  m: number,
+  n: number,
+  k: number,
+  a: Uint8Array,
+  lda: number,
+  aZero: number,
+  b: Int8Array,
+  ldb: number,
+  bZero: number,
+  bias: Int32Array | null,
+  scale: Float32Array,
+  cZero: number,
+  c: Uint8Array,
+  ldc: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0 || k < 0) {
+    throw new Error('m, n, and k must be non-negative');
+  }
+  if (!Number.isInteger(aZero) || aZero < 0 || aZero > 255) {
+    throw new Error(`aZero must be an integer in [0, 255], got ${aZero}`);
+  }
+  if (!Number.isInteger(bZero) || bZero < -128 || bZero > 127) {
+    throw new Error(`bZero must be an integer in [-128, 127], got ${bZero}`);
+  }
+  if (!Number.isInteger(cZero) || cZero < 0 || cZero > 255) {
+    throw new Error(`cZero must be an integer in [0, 255], got ${cZero}`);
+  }
+
+  const isTransA = transa === Transpose.Transpose || transa === Transpose.ConjugateTranspose;
+  const isTransB = transb === Transpose.Transpose || transb === Transpose.ConjugateTranspose;
+
+  const aRows = isTransA ? k : m;
+  const aCols = isTransA ? m : k;
+  const bRows = isTransB ? n : k;
+  const bCols = isTransB ? k : n;
+
+  if (lda < Math.max(1, aRows)) {
+    throw new Error(`lda must be at least ${Math.max(1, aRows)}, got ${lda}`);
+  }
+  if (ldb < Math.max(1, bRows)) {
+    throw new Error(`ldb must be at least ${Math.max(1, bRows)}, got ${ldb}`);
+  }
+  if (ldc < Math.max(1, m)) {
+    throw new Error(`ldc must be at least ${Math.max(1, m)}, got ${ldc}`);
+  }
+
+  if (a.length < lda * aCols) {
+    throw new Error(`a array too small: expected at least ${lda * aCols}, got ${a.length}`);
+  }
+  if (b.length < ldb * bCols) {
+    throw new Error(`b array too small: expected at least ${ldb * bCols}, got ${b.length}`);
+  }
+  if (c.length < ldc * n) {
+    throw new Error(`c array too small: expected at least ${ldc * n}, got ${c.length}`);
+  }
+  if (bias !== null && bias.length < n) {
+    throw new Error(`bias array too small: expected at least ${n}, got ${bias.length}`);
+  }
+
+  // A single scale is per-tensor, otherwise one scale per column of C
+  const perChannel = scale.length !== 1;
+  if (perChannel && scale.length < n) {
+    throw new Error(`scale must have 1 or at least ${n} elements, got ${scale.length}`);
+  }
+
+  if (m === 0 || n === 0) {
+    return;
+  }
+
+  const transaChar = transa.charCodeAt(0);
+  const transbChar = transb.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    native.gemm_u8s8u8(
+      transaChar,
+      transbChar,
+      m,
+      n,
+      k,
+      a,
+      lda,
+      aZero,
+      b,
+      ldb,
+      bZero,
+      bias,
+      scale,
+      perChannel ? 1 : 0,
+      cZero,
+      c,
+      ldc
+    );
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget(a.length + b.length + c.length + scale.length * 4 + (bias?.length ?? 0) * 4);
+  const aPtr = module._malloc(a.length);
+  const bPtr = module._malloc(b.length);
+  const cPtr = module._malloc(c.length);
+  const scalePtr = module._malloc(scale.length * 4);
+  const biasPtr = bias !== null ? module._malloc(bias.length * 4) : 0;
+
+  try {
+    // Copy data to WASM memory
+    module.HEAPU8.set(a, aPtr);
+    module.HEAP8.set(b, bPtr);
+    module.HEAPU8.set(c, cPtr);
+    module.HEAPF32.set(scale, scalePtr / 4);
+    if (bias !== null) {
+      module.HEAP32.set(bias, biasPtr / 4);
+    }
+
+    // Call the WASM function
+    module._gemm_u8s8u8(
+      transaChar,
+      transbChar,
+      m,
+      n,
+      k,
+      aPtr,
+      lda,
+      aZero,
+      bPtr,
+      ldb,
+      bZero,
+      biasPtr,
+      scalePtr,
+      perChannel ? 1 : 0,
+      cZero,
+      cPtr,
+      ldc
+    );
+
+    // Copy result back to c
+    const result = module.HEAPU8.subarray(cPtr, cPtr + c.length);
+    c.set(result);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(bPtr);
+    module._free(cPtr);
+    module._free(scalePtr);
+    if (bias !== null) {
+      module._free(biasPtr);
+    }
+  }
+}
@@ -0,0 +1,339 @@
+/**
+ * Conversions between 16-bit storage (bfloat16 / fp16) and Float32Array / Float64Array
+ * TypeScript wrappers for WebAssembly implementation
+ *
+ * 16-bit values are held as raw bit patterns in a Uint16Array. Narrowing conversions
+ * round to nearest even; widening conversions are exact.
+ */
+
+import { NativeModule } from './native';
+import { BlasModule, getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+
+type ConvertArray = Float32Array | Float64Array | Uint16Array;
+
+type ConvertKernel = (
+  module: BlasModule,
+  n: number,
+  inPtr: number,
+  incin: number,
+  outPtr: number,
+  incout: number
+) => void;
+
+function heapFor(module: BlasModule, array: ConvertArray): ConvertArray {
+  if (array instanceof Float64Array) {
+    return module.HEAPF64;
+  }
+  if (array instanceof Float32Array) {
+    return module.HEAPF32;
+  }
+  return module.HEAPU16;
+}
+
+function convert(
+  kernel: ConvertKernel,
+  nativeKernel: (native: NativeModule) => void,
+  n: number,
+  x: ConvertArray,
+  incx: number,
+  y: ConvertArray,
+  incy: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (n < 0) {
+    throw new Error('n must be non-negative');
+  }
+  if (n === 0) {
+    return;
+  }
+
+  const xLen = 1 + (n - 1) * Math.abs(incx);
+  const yLen = 1 + (n - 1) * Math.abs(incy);
+
+  if (x.length < xLen) {
+    throw new Error(`x array too small: expected at least ${xLen}, got ${x.length}`);
+  }
+  if (y.length < yLen) {
+    throw new Error(`y array too small: expected at least ${yLen}, got ${y.length}`);
+  }
+
+  const native = getNative();
+  if (native) {
+    nativeKernel(native);
+    return;
+  }
+
+  const xBytes = x.BYTES_PER_ELEMENT;
+  const yBytes = y.BYTES_PER_ELEMENT;
+
+  // Allocate memory in WASM
+  checkBudget(x.length * xBytes + y.length * yBytes);
+  const xPtr = module._malloc(x.length * xBytes);
+  const yPtr = module._malloc(y.length * yBytes);
+
+  try {
+    // Copy data to WASM memory; y is copied too so that strided gaps are preserved
+    heapFor(module, x).set(x, xPtr / xBytes);
+    heapFor(module, y).set(y, yPtr / yBytes);
+
+    // Call the WASM function
+    kernel(module, n, xPtr, incx, yPtr, incy);
+
+    // Copy result back to y (re-read the heap view in case memory grew)
+    const result = heapFor(module, y).subarray(yPtr / yBytes, yPtr / yBytes + y.length);
+    y.set(result);
+  } finally {
+    // Free WASM memory
+    module._free(xPtr);
+    module._free(yPtr);
+  }
+}
+
+/**
+ * Converts single precision values to bfloat16: y = bf16(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector (Float32Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector of bfloat16 bit patterns (Uint16Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { sbstobf16, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const y = new Uint16Array(2);
+ * sbstobf16(2, new Float32Array([1, -2]), 1, y, 1);
+ * // y is [0x3f80, 0xc000]
+ * ```
+ */
+export function sbstobf16(
+  n: number,
+  x: Float32Array,
+  incx: number = 1,
+  y: Uint16Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._sbstobf16(...args),
+    (native) => native.sbstobf16(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
+
+/**
+ * Converts double precision values to bfloat16: y = bf16(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector (Float64Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector of bfloat16 bit patterns (Uint16Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ */
+export function sbdtobf16(
+  n: number,
+  x: Float64Array,
+  incx: number = 1,
+  y: Uint16Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._sbdtobf16(...args),
+    (native) => native.sbdtobf16(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
+
+/**
+ * Converts bfloat16 values to single precision: y = float(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector of bfloat16 bit patterns (Uint16Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector (Float32Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ */
+export function sbf16tos(
+  n: number,
+  x: Uint16Array,
+  incx: number = 1,
+  y: Float32Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._sbf16tos(...args),
+    (native) => native.sbf16tos(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
+
+/**
+ * Converts bfloat16 values to double precision: y = double(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector of bfloat16 bit patterns (Uint16Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector (Float64Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ */
+export function dbf16tod(
+  n: number,
+  x: Uint16Array,
+  incx: number = 1,
+  y: Float64Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._dbf16tod(...args),
+    (native) => native.dbf16tod(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
+
+/**
+ * Converts single precision values to IEEE fp16: y = f16(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector (Float32Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector of fp16 bit patterns (Uint16Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { shstof16, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const y = new Uint16Array(2);
+ * shstof16(2, new Float32Array([1, 65520]), 1, y, 1);
+ * // y is [0x3c00, 0x7c00] (65520 rounds to +Infinity)
+ * ```
+ */
+export function shstof16(
+  n: number,
+  x: Float32Array,
+  incx: number = 1,
+  y: Uint16Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._shstof16(...args),
+    (native) => native.shstof16(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
+
+/**
+ * Converts double precision values to IEEE fp16: y = f16(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector (Float64Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector of fp16 bit patterns (Uint16Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ */
+export function shdtof16(
+  n: number,
+  x: Float64Array,
+  incx: number = 1,
+  y: Uint16Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._shdtof16(...args),
+    (native) => native.shdtof16(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
+
+/**
+ * Converts IEEE fp16 values to single precision: y = float(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector of fp16 bit patterns (Uint16Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector (Float32Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ */
+export function shf16tos(
+  n: number,
+  x: Uint16Array,
+  incx: number = 1,
+  y: Float32Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._shf16tos(...args),
+    (native) => native.shf16tos(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
+
+/**
+ * Converts IEEE fp16 values to double precision: y = double(x)
+ *
+ * @param n - Number of elements to convert
+ * @param x - Input vector of fp16 bit patterns (Uint16Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param y - Output vector (Float64Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ */
+export function df16tod(
+  n: number,
+  x: Uint16Array,
+  incx: number = 1,
+  y: Float64Array,
+  incy: number = 1
+): void {
+  convert(
+    (module, ...args) => module._df16tod(...args),
+    (native) => native.df16tod(n, x, incx, y, incy),
+    n,
+    x,
+    incx,
+    y,
+    incy
+  );
+}
@@ -4,7 +4,28 @@
  * A high-performance linear algebra library using WebAssembly
  */
 
-export { initWasm, getModule } from './wasm-module';
+export {
+  initWasm,
+  getModule,
+  getFlavour,
+  detectFlavour,
+  getBackend,
+  getNative,
+  getNumThreads,
+  setNumThreads,
+} from './wasm-module';
+export {
+  getHeapStats,
+  resetHeapStats,
+  setMemoryBudget,
+  getMemoryBudget,
+  mallocAligned,
+  allocMatrix,
+  paddedLd,
+  HEAP_ALIGNMENT,
+} from './memory';
+export { raw, RawFlag } from './raw';
+export { startTrace, stopTrace, parseTrace, replayTrace } from './trace';
 
 // Level 1 BLAS functions
 export { daxpy } from './daxpy';
@@ -38,6 +59,20 @@ export { dtbsv } from './dtbsv';
 export { dtpmv } from './dtpmv';
 export { dtpsv } from './dtpsv';
 
+// Batched Level 1 BLAS functions
+export { ddot_batch, ddot_batch_strided } from './ddot_batch';
+export { dnrm2_batch, dnrm2_batch_strided } from './dnrm2_batch';
+export { dasum_batch, dasum_batch_strided } from './dasum_batch';
+export { daxpy_batch, daxpy_batch_strided } from './daxpy_batch';
+export { dscal_batch, dscal_batch_strided } from './dscal_batch';
+
+// Batched Level 2 BLAS functions
+export { dgemv_batch, dgemv_batch_strided } from './dgemv_batch';
+export { dsymv_batch, dsymv_batch_strided } from './dsymv_batch';
+export { dtrmv_batch, dtrmv_batch_strided } from './dtrmv_batch';
+export { dtrsv_batch, dtrsv_batch_strided } from './dtrsv_batch';
+export { dger_batch, dger_batch_strided } from './dger_batch';
+
 // Level 3 BLAS functions
 export { dgemm } from './dgemm';
 export { dsymm } from './dsymm';
@@ -46,7 +81,69 @@ export { dsyr2k } from './dsyr2k';
 export { dtrmm } from './dtrmm';
 export { dtrsm } from './dtrsm';
 export { dgemmtr } from './dgemmtr';
+export { dgemm_batch } from './dgemm_batch';
+
+// LAPACK auxiliary routines
+export { dlacpy } from './dlacpy';
+export { dlaset } from './dlaset';
+export { dlascl } from './dlascl';
+export { dlange } from './dlange';
+export { dlansy } from './dlansy';
+export { dlantr } from './dlantr';
+export { dreduce } from './dreduce';
+
+// LAPACK routines
+export { dgetrf } from './dgetrf';
+export { dgetrs } from './dgetrs';
+export { dgetri } from './dgetri';
+export { dtrtri } from './dtrtri';
+export { dpotrf } from './dpotrf';
+export { dpotri } from './dpotri';
+export { dgeqrf } from './dgeqrf';
+export { dormqr } from './dormqr';
+export { dgels, dgels_normal } from './dgels';
+
+// Kronecker products
+export { dkronmv, dkronsv } from './dkron';
+
+// Eigensolvers
+export { dpower, dlanczos } from './eigen';
+
+// Quantized (int8) functions
+export { gemm_u8s8s32 } from './gemm_u8s8s32';
+export { gemm_u8s8u8 } from './gemm_u8s8u8';
+
+// 16-bit storage (bfloat16 / fp16) functions
+export { sbgemm, shgemm } from './sbgemm';
+export { sbgemv, shgemv } from './sbgemv';
+export {
+  sbstobf16,
+  sbdtobf16,
+  sbf16tos,
+  dbf16tod,
+  shstof16,
+  shdtof16,
+  shf16tos,
+  df16tod,
+} from './half';
 
 // Re-export types
-export type { BlasModule } from './wasm-module';
-export { Side, Transpose, Triangular, Diagonal } from './types';
+export type { Backend, BlasModule, Flavour, InitOptions } from './wasm-module';
+export type { GemmGroup } from './dgemm_batch';
+export type { KronFactor } from './dkron';
+export type { LinearOperator, PowerResult } from './eigen';
+export type { HeapMatrix, HeapStats } from './memory';
+export type { NativeModule } from './native';
+export type { RawApi } from './raw';
+export type { TraceArray, TraceCall, TraceOptions, TraceReport } from './trace';
+export {
+  Side,
+  Transpose,
+  Triangular,
+  Diagonal,
+  MatrixType,
+  Norm,
+  Reduction,
+  Axis,
+  Which,
+} from './types';
@@ -0,0 +1,217 @@
+/**
+ * WebAssembly heap telemetry and memory budget
+ *
+ * The WebAssembly heap can grow but never shrinks, so the transient copies a
+ * BLAS function makes of its operands permanently raise the memory footprint
+ * to the largest call seen. The allocations made through the module are
+ * tracked here, and an optional budget caps how much a call may allocate:
+ * dgemm then runs tiled with bounded scratch buffers, the other functions
+ * throw instead of growing the heap.
+ *
+ * Matrices are placed in cache-line aligned blocks with a padded leading
+ * dimension (see paddedLd()), both by the wrappers and for raw API callers.
+ */
+
+import { BlasModule } from './wasm-module';
+
+/** Heap usage of the WebAssembly backend */
+export interface HeapStats {
+  /** Current size of the WebAssembly heap in bytes (it never shrinks) */
+  heapBytes: number;
+  /** Bytes currently allocated through the module */
+  inUseBytes: number;
+  /** High-water mark of inUseBytes since initialization or resetHeapStats() */
+  peakBytes: number;
+  /** Number of allocations */
+  allocations: number;
+  /** Number of allocations that grew the heap */
+  growths: number;
+  /** Number of calls that ran tiled to stay within the memory budget */
+  tiledCalls: number;
+  /** Memory budget in bytes, or null if unlimited */
+  budget: number | null;
+}
+
+let tracked: BlasModule | null = null;
+const sizes = new Map<number, number>();
+let inUseBytes = 0;
+let peakBytes = 0;
+let allocations = 0;
+let growths = 0;
+let tiledCalls = 0;
+let budget: number | null = null;
+
+/**
+ * Route the module's _malloc and _free through the allocation tracker
+ * @internal
+ */
+export function trackHeap(module: BlasModule): void {
+  const free = module._free;
+
+  const track =
+    (malloc: (size: number) => number) =>
+    (size: number): number => {
+      const heapBytes = module.HEAPU8.length;
+      const ptr = malloc(size);
+      if (ptr) {
+        sizes.set(ptr, size);
+        inUseBytes += size;
+        peakBytes = Math.max(peakBytes, inUseBytes);
+        allocations++;
+        if (module.HEAPU8.length !== heapBytes) {
+          growths++;
+        }
+      }
+      return ptr;
+    };
+
+  module._malloc = track(module._malloc);
+  module._malloc_aligned = track(module._malloc_aligned);
+
+  module._free = (ptr: number): void => {
+    const size = sizes.get(ptr);
+    if (size !== undefined) {
+      sizes.delete(ptr);
+      inUseBytes -= size;
+    }
+    free(ptr);
+  };
+
+  tracked = module;
+}
+
+/**
+ * Get the heap usage of the WebAssembly backend
+ */
+export function getHeapStats(): HeapStats {
+  if (!tracked) {
+    throw new Error('WASM module not initialized. Call initWasm() first.');
+  }
+  return {
+    heapBytes: tracked.HEAPU8.length,
+    inUseBytes,
+    peakBytes,
+    allocations,
+    growths,
+    tiledCalls,
+    budget,
+  };
+}
+
+/**
+ * Reset the high-water mark and the counters of getHeapStats()
+ */
+export function resetHeapStats(): void {
+  peakBytes = inUseBytes;
+  allocations = 0;
+  growths = 0;
+  tiledCalls = 0;
+}
+
+/**
+ * Limit the bytes the BLAS functions may allocate in the WebAssembly heap
+ *
+ * Calls whose operands do not fit run tiled where supported (dgemm) and
+ * throw otherwise. Pass null to remove the limit (default). The native
+ * backend works on the caller's arrays and is not affected.
+ */
+export function setMemoryBudget(bytes: number | null): void {
+  if (bytes !== null && (!Number.isInteger(bytes) || bytes < 0)) {
+    throw new Error(`memory budget must be a non-negative integer or null, got ${bytes}`);
+  }
+  budget = bytes;
+}
+
+/**
+ * Get the memory budget in bytes, or null if unlimited
+ */
+export function getMemoryBudget(): number | null {
+  return budget;
+}
+
+/**
+ * Bytes a call may still allocate within the budget
+ * @internal
+ */
+export function availableBytes(): number {
+  return budget === null ? Infinity : Math.max(0, budget - inUseBytes);
+}
+
+/**
+ * Throw if allocating `bytes` would exceed the memory budget
+ * @internal
+ */
+export function checkBudget(bytes: number): void {
+  if (bytes > availableBytes()) {
+    throw new Error(
+      `operation needs ${bytes} bytes of WASM memory, over the memory budget of ${budget} bytes`
+    );
+  }
+}
+
+/**
+ * Count a call that ran tiled to stay within the budget
+ * @internal
+ */
+export function countTiledCall(): void {
+  tiledCalls++;
+}
+
+/** Alignment in bytes of mallocAligned() and allocMatrix() blocks (a cache line) */
+export const HEAP_ALIGNMENT = 64;
+
+/**
+ * Leading dimension to store a matrix with `rows` rows in the WASM heap
+ *
+ * Columns of 64 rows or more are padded to a multiple of 8 doubles, so that
+ * each starts on a cache line in an aligned block. A column length that is a
+ * multiple of 512 bytes (64 doubles, e.g. 1024 or 2048 rows) gets 8 more:
+ * otherwise successive columns map to the same cache sets and a kernel
+ * walking along a row evicts its own data. Smaller matrices are not padded.
+ */
+export function paddedLd(rows: number): number {
+  if (rows < 64) {
+    return Math.max(1, rows);
+  }
+  const ld = Math.ceil(rows / 8) * 8;
+  return ld % 64 === 0 ? ld + 8 : ld;
+}
+
+/**
+ * Allocate `bytes` in the WASM heap at a 64-byte boundary; release the
+ * block with raw.free()
+ */
+export function mallocAligned(bytes: number): number {
+  if (!tracked) {
+    throw new Error('WASM module not initialized. Call initWasm() first.');
+  }
+  checkBudget(bytes);
+  const ptr = tracked._malloc_aligned(bytes);
+  if (!ptr) {
+    throw new Error(`failed to allocate ${bytes} bytes of WASM memory`);
+  }
+  return ptr;
+}
+
+/** A column-major matrix in the WASM heap */
+export interface HeapMatrix {
+  /** Byte offset of the first element, 64-byte aligned */
+  ptr: number;
+  rows: number;
+  cols: number;
+  /** Leading dimension, as chosen by paddedLd() */
+  ld: number;
+}
+
+/**
+ * Allocate a rows x cols matrix of doubles in the WASM heap with an aligned
+ * start and a padded leading dimension, for use with the raw API; release
+ * it with raw.free(matrix.ptr)
+ */
+export function allocMatrix(rows: number, cols: number): HeapMatrix {
+  if (!Number.isInteger(rows) || !Number.isInteger(cols) || rows < 0 || cols < 0) {
+    throw new Error(`matrix dimensions must be non-negative integers, got ${rows} x ${cols}`);
+  }
+  const ld = paddedLd(rows);
+  return { ptr: mallocAligned(ld * cols * 8), rows, cols, ld };
+}
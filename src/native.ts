@@ -0,0 +1,678 @@
+/**
+ * Native Node.js addon backend
+ *
+ * The addon is built from the same C++ kernels as the WebAssembly module and
+ * exports them under their C names. Arrays are passed as typed arrays and the
+ * kernels work directly on their backing stores, so nothing is copied.
+ */
+
+type F64 = Float64Array;
+type F32 = Float32Array;
+type U16 = Uint16Array;
+type I32 = Int32Array;
+
+export interface NativeModule {
+  // Level 1 BLAS functions
+  daxpy(n: number, alpha: number, x: F64, incx: number, y: F64, incy: number): void;
+  daxpby(n: number, alpha: number, x: F64, incx: number, beta: number, y: F64, incy: number): void;
+  dcopy(n: number, x: F64, incx: number, y: F64, incy: number): void;
+  ddot(n: number, x: F64, incx: number, y: F64, incy: number): number;
+  dscal(n: number, alpha: number, x: F64, incx: number): void;
+  dasum(n: number, x: F64, incx: number): number;
+  dnrm2(n: number, x: F64, incx: number): number;
+  dswap(n: number, x: F64, incx: number, y: F64, incy: number): void;
+  drot(n: number, x: F64, incx: number, y: F64, incy: number, c: number, s: number): void;
+  drotg(a: F64, b: F64, c: F64, s: F64): void;
+  drotm(n: number, x: F64, incx: number, y: F64, incy: number, param: F64): void;
+  drotmg(dd1: F64, dd2: F64, dx1: F64, dy1: number, param: F64): void;
+
+  // Level 2 BLAS functions
+  dgemv(
+    trans: number,
+    m: number,
+    n: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number,
+    beta: number,
+    y: F64,
+    incy: number
+  ): void;
+  dgbmv(
+    trans: number,
+    m: number,
+    n: number,
+    kl: number,
+    ku: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number,
+    beta: number,
+    y: F64,
+    incy: number
+  ): void;
+  dger(
+    m: number,
+    n: number,
+    alpha: number,
+    x: F64,
+    incx: number,
+    y: F64,
+    incy: number,
+    a: F64,
+    lda: number
+  ): void;
+  dsymv(
+    uplo: number,
+    n: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number,
+    beta: number,
+    y: F64,
+    incy: number
+  ): void;
+  dsbmv(
+    uplo: number,
+    n: number,
+    k: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number,
+    beta: number,
+    y: F64,
+    incy: number
+  ): void;
+  dspmv(
+    uplo: number,
+    n: number,
+    alpha: number,
+    ap: F64,
+    x: F64,
+    incx: number,
+    beta: number,
+    y: F64,
+    incy: number
+  ): void;
+  dsyr(uplo: number, n: number, alpha: number, x: F64, incx: number, a: F64, lda: number): void;
+  dsyr2(
+    uplo: number,
+    n: number,
+    alpha: number,
+    x: F64,
+    incx: number,
+    y: F64,
+    incy: number,
+    a: F64,
+    lda: number
+  ): void;
+  dspr(uplo: number, n: number, alpha: number, x: F64, incx: number, ap: F64): void;
+  dspr2(
+    uplo: number,
+    n: number,
+    alpha: number,
+    x: F64,
+    incx: number,
+    y: F64,
+    incy: number,
+    ap: F64
+  ): void;
+  dtrmv(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number
+  ): void;
+  dtrsv(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number
+  ): void;
+  dtbmv(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    k: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number
+  ): void;
+  dtbsv(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    k: number,
+    a: F64,
+    lda: number,
+    x: F64,
+    incx: number
+  ): void;
+  dtpmv(uplo: number, trans: number, diag: number, n: number, ap: F64, x: F64, incx: number): void;
+  dtpsv(uplo: number, trans: number, diag: number, n: number, ap: F64, x: F64, incx: number): void;
+
+  // Batched Level 1 BLAS functions
+  ddot_batch_strided(
+    n: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    y: F64,
+    incy: number,
+    stridey: number,
+    result: F64,
+    batch: number
+  ): void;
+  dnrm2_batch_strided(
+    n: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    result: F64,
+    batch: number
+  ): void;
+  dasum_batch_strided(
+    n: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    result: F64,
+    batch: number
+  ): void;
+  daxpy_batch_strided(
+    n: number,
+    alpha: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    y: F64,
+    incy: number,
+    stridey: number,
+    batch: number
+  ): void;
+  dscal_batch_strided(
+    n: number,
+    alpha: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    batch: number
+  ): void;
+
+  // Batched Level 2 BLAS functions
+  dgemv_batch_strided(
+    trans: number,
+    m: number,
+    n: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    stridea: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    beta: number,
+    y: F64,
+    incy: number,
+    stridey: number,
+    batch: number
+  ): void;
+  dsymv_batch_strided(
+    uplo: number,
+    n: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    stridea: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    beta: number,
+    y: F64,
+    incy: number,
+    stridey: number,
+    batch: number
+  ): void;
+  dtrmv_batch_strided(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    a: F64,
+    lda: number,
+    stridea: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    batch: number
+  ): void;
+  dtrsv_batch_strided(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    a: F64,
+    lda: number,
+    stridea: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    batch: number
+  ): void;
+  dger_batch_strided(
+    m: number,
+    n: number,
+    alpha: number,
+    x: F64,
+    incx: number,
+    stridex: number,
+    y: F64,
+    incy: number,
+    stridey: number,
+    a: F64,
+    lda: number,
+    stridea: number,
+    batch: number
+  ): void;
+
+  // Level 3 BLAS functions
+  dgemm(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number,
+    beta: number,
+    c: F64,
+    ldc: number
+  ): void;
+  dgemmtr(
+    uplo: number,
+    transa: number,
+    transb: number,
+    n: number,
+    k: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number,
+    beta: number,
+    c: F64,
+    ldc: number
+  ): void;
+  dgemm_batch(
+    group_count: number,
+    group_size: I32,
+    transa: I32,
+    transb: I32,
+    m: I32,
+    n: I32,
+    k: I32,
+    alpha: F64,
+    a: F64,
+    lda: I32,
+    offa: I32,
+    b: F64,
+    ldb: I32,
+    offb: I32,
+    beta: F64,
+    c: F64,
+    ldc: I32,
+    offc: I32
+  ): void;
+  dsymm(
+    side: number,
+    uplo: number,
+    m: number,
+    n: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number,
+    beta: number,
+    c: F64,
+    ldc: number
+  ): void;
+  dsyrk(
+    uplo: number,
+    trans: number,
+    n: number,
+    k: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    beta: number,
+    c: F64,
+    ldc: number
+  ): void;
+  dsyr2k(
+    uplo: number,
+    trans: number,
+    n: number,
+    k: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number,
+    beta: number,
+    c: F64,
+    ldc: number
+  ): void;
+  dtrmm(
+    side: number,
+    uplo: number,
+    transa: number,
+    diag: number,
+    m: number,
+    n: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number
+  ): void;
+  dtrsm(
+    side: number,
+    uplo: number,
+    transa: number,
+    diag: number,
+    m: number,
+    n: number,
+    alpha: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number
+  ): void;
+
+  // Quantized (int8) functions
+  gemm_u8s8s32(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    a: Uint8Array,
+    lda: number,
+    aZero: number,
+    b: Int8Array,
+    ldb: number,
+    bZero: number,
+    c: Int32Array,
+    ldc: number
+  ): void;
+  gemm_u8s8u8(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    a: Uint8Array,
+    lda: number,
+    aZero: number,
+    b: Int8Array,
+    ldb: number,
+    bZero: number,
+    bias: Int32Array | null,
+    scale: F32,
+    perChannel: number,
+    cZero: number,
+    c: Uint8Array,
+    ldc: number
+  ): void;
+
+  // 16-bit storage (bfloat16 / fp16) functions
+  sbstobf16(n: number, x: F32, incx: number, y: U16, incy: number): void;
+  sbdtobf16(n: number, x: F64, incx: number, y: U16, incy: number): void;
+  sbf16tos(n: number, x: U16, incx: number, y: F32, incy: number): void;
+  dbf16tod(n: number, x: U16, incx: number, y: F64, incy: number): void;
+  shstof16(n: number, x: F32, incx: number, y: U16, incy: number): void;
+  shdtof16(n: number, x: F64, incx: number, y: U16, incy: number): void;
+  shf16tos(n: number, x: U16, incx: number, y: F32, incy: number): void;
+  df16tod(n: number, x: U16, incx: number, y: F64, incy: number): void;
+  sbgemm(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    alpha: number,
+    a: U16,
+    lda: number,
+    b: U16,
+    ldb: number,
+    beta: number,
+    c: F32,
+    ldc: number
+  ): void;
+  shgemm(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    alpha: number,
+    a: U16,
+    lda: number,
+    b: U16,
+    ldb: number,
+    beta: number,
+    c: F32,
+    ldc: number
+  ): void;
+  sbgemv(
+    trans: number,
+    m: number,
+    n: number,
+    alpha: number,
+    a: U16,
+    lda: number,
+    x: U16,
+    incx: number,
+    beta: number,
+    y: F32,
+    incy: number
+  ): void;
+  shgemv(
+    trans: number,
+    m: number,
+    n: number,
+    alpha: number,
+    a: U16,
+    lda: number,
+    x: U16,
+    incx: number,
+    beta: number,
+    y: F32,
+    incy: number
+  ): void;
+
+  // LAPACK auxiliary routines
+  dlacpy(uplo: number, m: number, n: number, a: F64, lda: number, b: F64, ldb: number): void;
+  dlaset(
+    uplo: number,
+    m: number,
+    n: number,
+    alpha: number,
+    beta: number,
+    a: F64,
+    lda: number
+  ): void;
+  dlascl(type: number, cfrom: number, cto: number, m: number, n: number, a: F64, lda: number): void;
+  dlange(norm: number, m: number, n: number, a: F64, lda: number): number;
+  dlansy(norm: number, uplo: number, n: number, a: F64, lda: number): number;
+  dlantr(
+    norm: number,
+    uplo: number,
+    diag: number,
+    m: number,
+    n: number,
+    a: F64,
+    lda: number
+  ): number;
+  dreduce(op: number, axis: number, m: number, n: number, a: F64, lda: number, r: F64): void;
+
+  // LAPACK routines
+  dgetrf(m: number, n: number, a: F64, lda: number, ipiv: I32): number;
+  dgetrs(
+    trans: number,
+    n: number,
+    nrhs: number,
+    a: F64,
+    lda: number,
+    ipiv: I32,
+    b: F64,
+    ldb: number
+  ): void;
+  dgetri(n: number, a: F64, lda: number, ipiv: I32): number;
+  dtrtri(uplo: number, diag: number, n: number, a: F64, lda: number): number;
+  dpotrf(uplo: number, n: number, a: F64, lda: number): number;
+  dpotri(uplo: number, n: number, a: F64, lda: number): number;
+  dgeqrf(m: number, n: number, a: F64, lda: number, tau: F64): void;
+  dormqr(
+    side: number,
+    trans: number,
+    m: number,
+    n: number,
+    k: number,
+    a: F64,
+    lda: number,
+    tau: F64,
+    c: F64,
+    ldc: number
+  ): void;
+  dgels(
+    trans: number,
+    m: number,
+    n: number,
+    nrhs: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number
+  ): number;
+  dgels_normal(
+    m: number,
+    n: number,
+    nrhs: number,
+    a: F64,
+    lda: number,
+    b: F64,
+    ldb: number
+  ): number;
+
+  // Kronecker products
+  dkronmv(
+    trans: number,
+    d: number,
+    m: I32,
+    n: I32,
+    alpha: number,
+    a: F64,
+    lda: I32,
+    offa: I32,
+    x: F64,
+    beta: number,
+    y: F64
+  ): void;
+  dkronsv(trans: number, d: number, n: I32, a: F64, lda: I32, offa: I32, b: F64): number;
+
+  // Eigensolvers
+  dpower(
+    kind: number,
+    uplo: number,
+    n: number,
+    k: number,
+    a: F64,
+    lda: number,
+    ia: I32 | null,
+    ja: I32 | null,
+    maxit: number,
+    tol: number,
+    x: F64,
+    lambda: F64
+  ): number;
+  dlanczos(
+    kind: number,
+    uplo: number,
+    n: number,
+    k: number,
+    a: F64,
+    lda: number,
+    ia: I32 | null,
+    ja: I32 | null,
+    which: number,
+    nev: number,
+    ncv: number,
+    maxit: number,
+    tol: number,
+    w: F64,
+    z: F64,
+    ldz: number
+  ): number;
+
+  // Runtime
+  /** Highest x86-64 micro-architecture level supported by the CPU (0, 2, 3 or 4) */
+  cpuLevel(): number;
+  getNumThreads(): number;
+  setNumThreads(n: number): void;
+  /** Instruction set the addon was compiled for, e.g. 'x86-64-v3' or 'generic' */
+  readonly isa: string;
+}
+
+function dlopen(file: string): NativeModule {
+  const addon = { exports: {} };
+  process.dlopen(addon, file);
+  return addon.exports as NativeModule;
+}
+
+/**
+ * Load the native addon best suited to this CPU
+ *
+ * The baseline build (blas-native.node) is opened first to query the CPU;
+ * the most specific x86-64 level build present in the same directory is then
+ * loaded in its place. Throws if not running under Node.js or if the
+ * baseline build is missing.
+ */
+export function loadNative(dir: string): NativeModule {
+  if (typeof process === 'undefined' || !process.versions?.node) {
+    throw new Error('the native backend requires Node.js');
+  }
+
+  const baseline = dlopen(`${dir}/blas-native.node`);
+  for (let level = baseline.cpuLevel(); level >= 2; level--) {
+    try {
+      return dlopen(`${dir}/blas-native-x86-64-v${level}.node`);
+    } catch {
+      // Build for this level not present; try the next one down
+    }
+  }
+  return baseline;
+}
@@ -0,0 +1,81 @@
+/**
+ * Unchecked low-level API
+ *
+ * `raw` exposes the WebAssembly kernels themselves, named as in the C API
+ * (src/cpp/blas.h): arrays are byte offsets into the module's heap, flags are
+ * passed pre-encoded and nothing is validated, allocated or copied. This
+ * removes the per-call overhead of the regular functions for hot loops over
+ * small operands that can stay in the heap:
+ *
+ * ```typescript
+ * await initWasm();
+ * const x = raw.malloc(3 * 8);
+ * const y = raw.malloc(3 * 8);
+ * getModule().HEAPF64.set([1, 2, 3], x / 8);
+ * getModule().HEAPF64.set([4, 5, 6], y / 8);
+ * for (let i = 0; i < 1e6; i++) raw.ddot(3, x, 1, y, 1);
+ * raw.free(x);
+ * raw.free(y);
+ * ```
+ *
+ * Flags are character codes (see RawFlag) for the kernels taking `char` and
+ * 0/1/2 for those taking `int` (dgemv, dgbmv, dsbmv, dspmv, dspr, dspr2,
+ * dtbmv, dtbsv, dtpmv, dtpsv, dgemmtr). Invalid arguments are undefined
+ * behaviour; load the 'debug' flavour to have the kernels check them.
+ *
+ * The raw API always runs on the WebAssembly module, also when the native
+ * backend is active. Heap views must be re-read after any allocation, which
+ * may grow the memory.
+ */
+
+import { BlasModule } from './wasm-module';
+
+/** Kernels of the WebAssembly module without their leading underscore */
+export type RawApi = {
+  [K in keyof BlasModule as K extends `_${infer Name}` ? Name : never]: BlasModule[K];
+};
+
+/** Character codes of the flags taken by the `char` kernels */
+export const RawFlag = {
+  NoTranspose: 78, // 'N'
+  Transpose: 84, // 'T'
+  ConjugateTranspose: 67, // 'C'
+  Upper: 85, // 'U'
+  Lower: 76, // 'L'
+  Unit: 85, // 'U'
+  NonUnit: 78, // 'N'
+  Left: 76, // 'L'
+  Right: 82, // 'R'
+  General: 71, // 'G'
+  Max: 77, // 'M'
+  One: 49, // '1'
+  Infinity: 73, // 'I'
+  Frobenius: 70, // 'F'
+  Sum: 83, // 'S'
+  AbsSum: 65, // 'A'
+  SumSquares: 81, // 'Q'
+  Norm2: 78, // 'N'
+  MaxAbs: 77, // 'M'
+  Columns: 67, // 'C'
+  Rows: 82, // 'R'
+} as const;
+
+/**
+ * The kernels of the initialized WebAssembly module
+ * (empty until initWasm() has resolved)
+ */
+export const raw = {} as RawApi;
+
+/**
+ * Point `raw` at the kernels of the given module
+ * @internal
+ */
+export function bindRaw(module: BlasModule): void {
+  const kernels = raw as unknown as Record<string, unknown>;
+  for (const key of Object.keys(module)) {
+    const value = (module as unknown as Record<string, unknown>)[key];
+    if (key.startsWith('_') && typeof value === 'function') {
+      kernels[key.slice(1)] = value;
+    }
+  }
+}
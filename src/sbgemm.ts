@@ -0,0 +1,254 @@
+/**
+ * SBGEMM / SHGEMM - Matrix-matrix multiplication with 16-bit (bfloat16 / fp16) storage
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { Transpose } from './types';
+import { NativeModule } from './native';
+import { BlasModule, getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+
+type Gemm16Kernel = (
+  module: BlasModule,
+  transa: number,
+  transb: number,
+  m: number,
+  n: number,
+  k: number,
+  alpha: number,
+  aPtr: number,
+  lda: number,
+  bPtr: number,
+  ldb: number,
+  beta: number,
+  cPtr: number,
+  ldc: number
+) => void;
+
+type NativeGemm16Kernel = (
+  native: NativeModule,
+  transa: number,
+  transb: number,
+  m: number,
+  n: number,
+  k: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  b: Uint16Array,
+  ldb: number,
+  beta: number,
+  c: Float32Array,
+  ldc: number
+) => void;
+
+function gemm16(
+  kernel: Gemm16Kernel,
+  nativeKernel: NativeGemm16Kernel,
+  transa: Transpose,
+  transb: Transpose,
+  m: number,
+  n: number,
+  k: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  b: Uint16Array,
+  ldb: number,
+  beta: number,
+  c: Float32Array,
+  ldc: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0 || k < 0) {
+    throw new Error('m, n, and k must be non-negative');
+  }
+
+  const isTransA = transa === Transpose.Transpose || transa === Transpose.ConjugateTranspose;
+  const isTransB = transb === Transpose.Transpose || transb === Transpose.ConjugateTranspose;
+
+  const aRows = isTransA ? k : m;
+  const aCols = isTransA ? m : k;
+  const bRows = isTransB ? n : k;
+  const bCols = isTransB ? k : n;
+
+  if (lda < Math.max(1, aRows)) {
+    throw new Error(`lda must be at least ${Math.max(1, aRows)}, got ${lda}`);
+  }
+  if (ldb < Math.max(1, bRows)) {
+    throw new Error(`ldb must be at least ${Math.max(1, bRows)}, got ${ldb}`);
+  }
+  if (ldc < Math.max(1, m)) {
+    throw new Error(`ldc must be at least ${Math.max(1, m)}, got ${ldc}`);
+  }
+
+  if (a.length < lda * aCols) {
+    throw new Error(`a array too small: expected at least ${lda * aCols}, got ${a.length}`);
+  }
+  if (b.length < ldb * bCols) {
+    throw new Error(`b array too small: expected at least ${ldb * bCols}, got ${b.length}`);
+  }
+  if (c.length < ldc * n) {
+    throw new Error(`c array too small: expected at least ${ldc * n}, got ${c.length}`);
+  }
+
+  const transaChar = transa.charCodeAt(0);
+  const transbChar = transb.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    nativeKernel(native, transaChar, transbChar, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget(a.length * 2 + b.length * 2 + c.length * 4);
+  const aPtr = module._malloc(a.length * 2);
+  const bPtr = module._malloc(b.length * 2);
+  const cPtr = module._malloc(c.length * 4);
+
+  try {
+    // Copy data to WASM memory
+    module.HEAPU16.set(a, aPtr / 2);
+    module.HEAPU16.set(b, bPtr / 2);
+    module.HEAPF32.set(c, cPtr / 4);
+
+    // Call the WASM function
+    kernel(module, transaChar, transbChar, m, n, k, alpha, aPtr, lda, bPtr, ldb, beta, cPtr, ldc);
+
+    // Copy result back to c
+    const result = module.HEAPF32.subarray(cPtr / 4, cPtr / 4 + c.length);
+    c.set(result);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(bPtr);
+    module._free(cPtr);
+  }
+}
+
+/**
+ * Performs matrix-matrix multiplication with bfloat16 storage:
+ * C = alpha * op(A) * op(B) + beta * C, where op(X) = X or X^T
+ * and C and the arithmetic are single precision
+ *
+ * @param transa - 'N': op(A) = A, 'T'/'C': op(A) = A^T
+ * @param transb - 'N': op(B) = B, 'T'/'C': op(B) = B^T
+ * @param m - Number of rows of op(A) and C
+ * @param n - Number of columns of op(B) and C
+ * @param k - Number of columns of op(A) and rows of op(B)
+ * @param alpha - Scalar multiplier for op(A)*op(B)
+ * @param a - Matrix A of bfloat16 bit patterns in column-major order (Uint16Array)
+ * @param lda - Leading dimension of A
+ * @param b - Matrix B of bfloat16 bit patterns in column-major order (Uint16Array)
+ * @param ldb - Leading dimension of B
+ * @param beta - Scalar multiplier for C
+ * @param c - Input/output matrix C in column-major order (Float32Array)
+ * @param ldc - Leading dimension of C
+ * @modifies c - The c matrix is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { sbgemm, sbstobf16, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Uint16Array(4);
+ * const B = new Uint16Array(4);
+ * sbstobf16(4, new Float32Array([1, 3, 2, 4]), 1, A, 1);
+ * sbstobf16(4, new Float32Array([5, 7, 6, 8]), 1, B, 1);
+ * const C = new Float32Array(4);
+ *
+ * sbgemm('N', 'N', 2, 2, 2, 1.0, A, 2, B, 2, 0.0, C, 2);
+ * // C = [[19,22], [43,50]]
+ * ```
+ */
+export function sbgemm(
+  transa: Transpose,
+  transb: Transpose,
+  m: number,
+  n: number,
+  k: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  b: Uint16Array,
+  ldb: number,
+  beta: number,
+  c: Float32Array,
+  ldc: number
+): void {
+  gemm16(
+    (module, ...args) => module._sbgemm(...args),
+    (native, ...args) => native.sbgemm(...args),
+    transa,
+    transb,
+    m,
+    n,
+    k,
+    alpha,
+    a,
+    lda,
+    b,
+    ldb,
+    beta,
+    c,
+    ldc
+  );
+}
+
+/**
+ * Performs matrix-matrix multiplication with IEEE fp16 storage:
+ * C = alpha * op(A) * op(B) + beta * C, where op(X) = X or X^T
+ * and C and the arithmetic are single precision
+ *
+ * @param transa - 'N': op(A) = A, 'T'/'C': op(A) = A^T
+ * @param transb - 'N': op(B) = B, 'T'/'C': op(B) = B^T
+ * @param m - Number of rows of op(A) and C
+ * @param n - Number of columns of op(B) and C
+ * @param k - Number of columns of op(A) and rows of op(B)
+ * @param alpha - Scalar multiplier for op(A)*op(B)
+ * @param a - Matrix A of fp16 bit patterns in column-major order (Uint16Array)
+ * @param lda - Leading dimension of A
+ * @param b - Matrix B of fp16 bit patterns in column-major order (Uint16Array)
+ * @param ldb - Leading dimension of B
+ * @param beta - Scalar multiplier for C
+ * @param c - Input/output matrix C in column-major order (Float32Array)
+ * @param ldc - Leading dimension of C
+ * @modifies c - The c matrix is modified in-place
+ */
+export function shgemm(
+  transa: Transpose,
+  transb: Transpose,
+  m: number,
+  n: number,
+  k: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  b: Uint16Array,
+  ldb: number,
+  beta: number,
+  c: Float32Array,
+  ldc: number
+): void {
+  gemm16(
+    (module, ...args) => module._shgemm(...args),
+    (native, ...args) => native.shgemm(...args),
+    transa,
+    transb,
+    m,
+    n,
+    k,
+    alpha,
+    a,
+    lda,
+    b,
+    ldb,
+    beta,
+    c,
+    ldc
+  );
+}
@@ -0,0 +1,228 @@
+/**
+ * SBGEMV / SHGEMV - Matrix-vector multiplication with 16-bit (bfloat16 / fp16) storage
+ * TypeScript wrappers for WebAssembly implementation
+ */
+
+import { Transpose } from './types';
+import { NativeModule } from './native';
+import { BlasModule, getModule, getNative } from './wasm-module';
+import { checkBudget } from './memory';
+
+type Gemv16Kernel = (
+  module: BlasModule,
+  trans: number,
+  m: number,
+  n: number,
+  alpha: number,
+  aPtr: number,
+  lda: number,
+  xPtr: number,
+  incx: number,
+  beta: number,
+  yPtr: number,
+  incy: number
+) => void;
+
+type NativeGemv16Kernel = (
+  native: NativeModule,
+  trans: number,
+  m: number,
+  n: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  x: Uint16Array,
+  incx: number,
+  beta: number,
+  y: Float32Array,
+  incy: number
+) => void;
+
+function gemv16(
+  kernel: Gemv16Kernel,
+  nativeKernel: NativeGemv16Kernel,
+  trans: Transpose,
+  m: number,
+  n: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  x: Uint16Array,
+  incx: number,
+  beta: number,
+  y: Float32Array,
+  incy: number
+): void {
+  const module = getModule();
+
+  // Handle edge cases
+  if (m < 0 || n < 0) {
+    throw new Error('m and n must be non-negative');
+  }
+  if (lda < Math.max(1, m)) {
+    throw new Error(`lda must be at least max(1, m) = ${Math.max(1, m)}, got ${lda}`);
+  }
+  if (m === 0 || n === 0) {
+    return;
+  }
+
+  const isTrans = trans === Transpose.Transpose || trans === Transpose.ConjugateTranspose;
+  const lenx = isTrans ? m : n;
+  const leny = isTrans ? n : m;
+
+  const xLen = 1 + (lenx - 1) * Math.abs(incx);
+  const yLen = 1 + (leny - 1) * Math.abs(incy);
+
+  if (a.length < lda * n) {
+    throw new Error(`a array too small: expected at least ${lda * n}, got ${a.length}`);
+  }
+  if (x.length < xLen) {
+    throw new Error(`x array too small: expected at least ${xLen}, got ${x.length}`);
+  }
+  if (y.length < yLen) {
+    throw new Error(`y array too small: expected at least ${yLen}, got ${y.length}`);
+  }
+
+  const transChar = trans.charCodeAt(0);
+
+  const native = getNative();
+  if (native) {
+    nativeKernel(native, transChar, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    return;
+  }
+
+  // Allocate memory in WASM
+  checkBudget(a.length * 2 + x.length * 2 + y.length * 4);
+  const aPtr = module._malloc(a.length * 2);
+  const xPtr = module._malloc(x.length * 2);
+  const yPtr = module._malloc(y.length * 4);
+
+  try {
+    // Copy data to WASM memory
+    module.HEAPU16.set(a, aPtr / 2);
+    module.HEAPU16.set(x, xPtr / 2);
+    module.HEAPF32.set(y, yPtr / 4);
+
+    // Call the WASM function
+    kernel(module, transChar, m, n, alpha, aPtr, lda, xPtr, incx, beta, yPtr, incy);
+
+    // Copy result back to y
+    const result = module.HEAPF32.subarray(yPtr / 4, yPtr / 4 + y.length);
+    y.set(result);
+  } finally {
+    // Free WASM memory
+    module._free(aPtr);
+    module._free(xPtr);
+    module._free(yPtr);
+  }
+}
+
+/**
+ * Performs matrix-vector multiplication with bfloat16 storage:
+ * y = alpha * op(A) * x + beta * y, where op(A) = A or A^T
+ *
+ * @param trans - 'N': y = alpha*A*x + beta*y, 'T'/'C': y = alpha*A^T*x + beta*y
+ * @param m - Number of rows of matrix A
+ * @param n - Number of columns of matrix A
+ * @param alpha - Scalar multiplier for op(A)*x
+ * @param a - Matrix A of bfloat16 bit patterns in column-major order (Uint16Array)
+ * @param lda - Leading dimension of A
+ * @param x - Input vector x of bfloat16 bit patterns (Uint16Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param beta - Scalar multiplier for y
+ * @param y - Input/output vector y (Float32Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ *
+ * @example
+ * ```typescript
+ * import { sbgemv, sbstobf16, initWasm } from 'wasm-blas-ts';
+ *
+ * await initWasm();
+ *
+ * const A = new Uint16Array(4);
+ * const x = new Uint16Array(2);
+ * sbstobf16(4, new Float32Array([1, 3, 2, 4]), 1, A, 1); // [[1,2], [3,4]]
+ * sbstobf16(2, new Float32Array([1, 1]), 1, x, 1);
+ * const y = new Float32Array(2);
+ *
+ * sbgemv('N', 2, 2, 1.0, A, 2, x, 1, 0.0, y, 1);
+ * // y = [3, 7]
+ * ```
+ */
+export function sbgemv(
+  trans: Transpose,
+  m: number,
+  n: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  x: Uint16Array,
+  incx: number = 1,
+  beta: number,
+  y: Float32Array,
+  incy: number = 1
+): void {
+  gemv16(
+    (module, ...args) => module._sbgemv(...args),
+    (native, ...args) => native.sbgemv(...args),
+    trans,
+    m,
+    n,
+    alpha,
+    a,
+    lda,
+    x,
+    incx,
+    beta,
+    y,
+    incy
+  );
+}
+
+/**
+ * Performs matrix-vector multiplication with IEEE fp16 storage:
+ * y = alpha * op(A) * x + beta * y, where op(A) = A or A^T
+ *
+ * @param trans - 'N': y = alpha*A*x + beta*y, 'T'/'C': y = alpha*A^T*x + beta*y
+ * @param m - Number of rows of matrix A
+ * @param n - Number of columns of matrix A
+ * @param alpha - Scalar multiplier for op(A)*x
+ * @param a - Matrix A of fp16 bit patterns in column-major order (Uint16Array)
+ * @param lda - Leading dimension of A
+ * @param x - Input vector x of fp16 bit patterns (Uint16Array)
+ * @param incx - Storage spacing between elements of x (default: 1)
+ * @param beta - Scalar multiplier for y
+ * @param y - Input/output vector y (Float32Array)
+ * @param incy - Storage spacing between elements of y (default: 1)
+ * @modifies y - The y vector is modified in-place
+ */
+export function shgemv(
+  trans: Transpose,
+  m: number,
+  n: number,
+  alpha: number,
+  a: Uint16Array,
+  lda: number,
+  x: Uint16Array,
+  incx: number = 1,
+  beta: number,
+  y: Float32Array,
+  incy: number = 1
+): void {
+  gemv16(
+    (module, ...args) => module._shgemv(...args),
+    (native, ...args) => native.shgemv(...args),
+    trans,
+    m,
+    n,
+    alpha,
+    a,
+    lda,
+    x,
+    incx,
+    beta,
+    y,
+    incy
+  );
+}
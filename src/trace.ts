@@ -0,0 +1,573 @@
+/**
+ * Call trace recording and replay
+ *
+ * While a trace is being recorded every kernel call made by the BLAS functions
+ * is logged with its flags, dimensions, strides and scalars, plus the length
+ * of each array operand (and optionally a hash or the first elements). The
+ * trace can be replayed later with random data of the same shapes, here via
+ * replayTrace() or natively with bench/replay.cpp, to benchmark kernels
+ * against a real workload.
+ *
+ * Binary format (little endian):
+ *
+ *   header   'BLTR'  u16 version  u8 flags (1 = hashes)  u8 0  u32 sample
+ *   define   u8 1  u8 id  u8 name length  name  u8 signature length  signature
+ *   call     u8 2  u8 id  f32 elapsed microseconds  arguments
+ *
+ * A routine is defined before its first call. Its signature has one character
+ * per C parameter: 'i' integer or flag (i32), 'd' floating point scalar (f64),
+ * and for arrays 'D' double, 'S' float, 'I' int32, 'H' uint16, 'b' int8 and
+ * 'B' uint8. An array is recorded as its u32 element count (0xffffffff for
+ * null), followed by its u32 FNV-1a hash if enabled and by its first `sample`
+ * elements. 'N' is an int32 array of dimensions, offsets or indices: all its
+ * elements are recorded whatever the sample size, and replay passes them as
+ * they are instead of random data.
+ */
+
+import { NativeModule } from './native';
+import { BlasModule, getModule, getNative, setRecorder } from './wasm-module';
+import { checkBudget } from './memory';
+
+/** C signature of each kernel, in the encoding described above */
+const SIGNATURES: Record<string, string> = {
+  // Level 1 BLAS
+  daxpy: 'idDiDi',
+  daxpby: 'idDidDi',
+  dcopy: 'iDiDi',
+  ddot: 'iDiDi',
+  dscal: 'idDi',
+  dasum: 'iDi',
+  dnrm2: 'iDi',
+  dswap: 'iDiDi',
+  drot: 'iDiDidd',
+  drotg: 'DDDD',
+  drotm: 'iDiDiD',
+  drotmg: 'DDDdD',
+  // Level 2 BLAS
+  dgemv: 'iiidDiDidDi',
+  dgbmv: 'iiiiidDiDidDi',
+  dger: 'iidDiDiDi',
+  dsymv: 'iidDiDidDi',
+  dsbmv: 'iiidDiDidDi',
+  dspmv: 'iidDDidDi',
+  dsyr: 'iidDiDi',
+  dsyr2: 'iidDiDiDi',
+  dspr: 'iidDiD',
+  dspr2: 'iidDiDiD',
+  dtrmv: 'iiiiDiDi',
+  dtrsv: 'iiiiDiDi',
+  dtbmv: 'iiiiiDiDi',
+  dtbsv: 'iiiiiDiDi',
+  dtpmv: 'iiiiDDi',
+  dtpsv: 'iiiiDDi',
+  // Batched Level 1 BLAS
+  ddot_batch_strided: 'iDiiDiiDi',
+  dnrm2_batch_strided: 'iDiiDi',
+  dasum_batch_strided: 'iDiiDi',
+  daxpy_batch_strided: 'idDiiDiii',
+  dscal_batch_strided: 'idDiii',
+  // Batched Level 2 BLAS
+  dgemv_batch_strided: 'iiidDiiDiidDiii',
+  dsymv_batch_strided: 'iidDiiDiidDiii',
+  dtrmv_batch_strided: 'iiiiDiiDiii',
+  dtrsv_batch_strided: 'iiiiDiiDiii',
+  dger_batch_strided: 'iidDiiDiiDiii',
+  // Level 3 BLAS
+  dgemm: 'iiiiidDiDidDi',
+  dgemmtr: 'iiiiidDiDidDi',
+  dgemm_batch: 'iNNNNNNDDNNDNNDDNN',
+  dsymm: 'iiiidDiDidDi',
+  dsyrk: 'iiiidDidDi',
+  dsyr2k: 'iiiidDiDidDi',
+  dtrmm: 'iiiiiidDiDi',
+  dtrsm: 'iiiiiidDiDi',
+  // Low precision extensions
+  gemm_u8s8s32: 'iiiiiBiibiiIi',
+  gemm_u8s8u8: 'iiiiiBiibiiISiiBi',
+  sbstobf16: 'iSiHi',
+  sbdtobf16: 'iDiHi',
+  sbf16tos: 'iHiSi',
+  dbf16tod: 'iHiDi',
+  shstof16: 'iSiHi',
+  shdtof16: 'iDiHi',
+  shf16tos: 'iHiSi',
+  df16tod: 'iHiDi',
+  sbgemm: 'iiiiidHiHidSi',
+  shgemm: 'iiiiidHiHidSi',
+  sbgemv: 'iiidHiHidSi',
+  shgemv: 'iiidHiHidSi',
+  // LAPACK auxiliary routines
+  dlacpy: 'iiiDiDi',
+  dlaset: 'iiiddDi',
+  dlascl: 'iddiiDi',
+  dlange: 'iiiDi',
+  dlansy: 'iiiDi',
+  dlantr: 'iiiiiDi',
+  dreduce: 'iiiiDiD',
+  // LAPACK routines
+  dgetrf: 'iiDiI',
+  dgetrs: 'iiiDiNDi',
+  dgetri: 'iDiN',
+  dtrtri: 'iiiDi',
+  dpotrf: 'iiDi',
+  dpotri: 'iiDi',
+  dgeqrf: 'iiDiD',
+  dormqr: 'iiiiiDiDDi',
+  dgels: 'iiiiDiDi',
+  dgels_normal: 'iiiDiDi',
+  // Kronecker products
+  dkronmv: 'iiNNdDNNDdD',
+  dkronsv: 'iiNDNND',
+  // Eigensolvers
+  dpower: 'iiiiDiNNidDD',
+  dlanczos: 'iiiiDiNNiiiidDDi',
+};
+
+type KernelArray = Float64Array | Float32Array | Int32Array | Uint16Array | Int8Array | Uint8Array;
+type KernelArg = number | KernelArray | null;
+type Kernel = (...args: KernelArg[]) => number | void;
+
+const ARRAY_TYPES: Record<string, new (length: number) => KernelArray> = {
+  D: Float64Array,
+  S: Float32Array,
+  I: Int32Array,
+  N: Int32Array,
+  H: Uint16Array,
+  b: Int8Array,
+  B: Uint8Array,
+};
+
+const MAGIC = [0x42, 0x4c, 0x54, 0x52]; // 'BLTR'
+const VERSION = 1;
+const FLAG_HASH = 1;
+const TAG_DEFINE = 1;
+const TAG_CALL = 2;
+const NULL_ARRAY = 0xffffffff;
+
+export interface TraceOptions {
+  /** Record a 32-bit FNV-1a hash of every array operand (default false) */
+  hash?: boolean;
+  /** Number of leading elements of every array operand to store (default 0) */
+  sample?: number;
+}
+
+/** One array operand of a recorded call */
+export interface TraceArray {
+  /** Element type code, see the format description */
+  type: string;
+  /** Number of elements, or -1 for a null array */
+  length: number;
+  hash?: number;
+  sample?: KernelArray;
+}
+
+/** One recorded kernel call */
+export interface TraceCall {
+  routine: string;
+  /** Time spent in the call (including marshalling) when it was recorded, in microseconds */
+  elapsed: number;
+  /** Arguments in C parameter order */
+  args: (number | TraceArray)[];
+}
+
+/** Replay timings of one routine */
+export interface TraceReport {
+  routine: string;
+  calls: number;
+  /** Total time of the recorded calls, in milliseconds */
+  recordedMs: number;
+  /** Total time of the replayed calls, in milliseconds */
+  replayMs: number;
+}
+
+// Growable little endian byte buffer
+class Writer {
+  private bytes = new Uint8Array(1 << 16);
+  private view = new DataView(this.bytes.buffer);
+  length = 0;
+
+  private reserve(n: number): void {
+    if (this.length + n <= this.bytes.length) {
+      return;
+    }
+    const grown = new Uint8Array(Math.max(this.bytes.length * 2, this.length + n));
+    grown.set(this.bytes.subarray(0, this.length));
+    this.bytes = grown;
+    this.view = new DataView(grown.buffer);
+  }
+
+  u8(v: number): void {
+    this.reserve(1);
+    this.view.setUint8(this.length, v);
+    this.length += 1;
+  }
+
+  u16(v: number): void {
+    this.reserve(2);
+    this.view.setUint16(this.length, v, true);
+    this.length += 2;
+  }
+
+  u32(v: number): void {
+    this.reserve(4);
+    this.view.setUint32(this.length, v, true);
+    this.length += 4;
+  }
+
+  i32(v: number): void {
+    this.reserve(4);
+    this.view.setInt32(this.length, v, true);
+    this.length += 4;
+  }
+
+  f32(v: number): void {
+    this.reserve(4);
+    this.view.setFloat32(this.length, v, true);
+    this.length += 4;
+  }
+
+  f64(v: number): void {
+    this.reserve(8);
+    this.view.setFloat64(this.length, v, true);
+    this.length += 8;
+  }
+
+  raw(data: Uint8Array): void {
+    this.reserve(data.length);
+    this.bytes.set(data, this.length);
+    this.length += data.length;
+  }
+
+  ascii(s: string): void {
+    this.u8(s.length);
+    for (let i = 0; i < s.length; i++) {
+      this.u8(s.charCodeAt(i));
+    }
+  }
+
+  finish(): Uint8Array {
+    return this.bytes.slice(0, this.length);
+  }
+}
+
+function isArray(arg: KernelArg): arg is KernelArray {
+  return arg !== null && typeof arg === 'object';
+}
+
+function asBytes(array: KernelArray): Uint8Array {
+  return new Uint8Array(array.buffer, array.byteOffset, array.byteLength);
+}
+
+function fnv1a(bytes: Uint8Array): number {
+  let h = 0x811c9dc5;
+  for (let i = 0; i < bytes.length; i++) {
+    h = Math.imul(h ^ bytes[i], 0x01000193);
+  }
+  return h >>> 0;
+}
+
+/**
+ * Run a kernel on the WebAssembly module with typed array arguments:
+ * arrays are copied into the heap, the kernel is called and they are copied back
+ */
+function callWasm(module: BlasModule, routine: string, args: KernelArg[]): number | void {
+  const signature = SIGNATURES[routine];
+  checkBudget(args.reduce((bytes: number, arg) => bytes + (isArray(arg) ? arg.byteLength : 0), 0));
+  const ptrs = args.map((arg) => (isArray(arg) ? module._malloc(Math.max(arg.byteLength, 1)) : 0));
+
+  // Heap views are taken after all allocations, which may grow the memory
+  const heap = (ptr: number, array: KernelArray): Uint8Array =>
+    module.HEAPU8.subarray(ptr, ptr + array.byteLength);
+
+  try {
+    const cArgs = args.map((arg, i) => {
+      if (isArray(arg)) {
+        heap(ptrs[i], arg).set(asBytes(arg));
+        return ptrs[i];
+      }
+      return signature[i] in ARRAY_TYPES ? 0 : (arg as number);
+    });
+
+    const kernel = (module as unknown as Record<string, Kernel>)[`_${routine}`];
+    const result = kernel(...cArgs);
+
+    args.forEach((arg, i) => {
+      if (isArray(arg)) {
+        asBytes(arg).set(heap(ptrs[i], arg));
+      }
+    });
+    return result;
+  } finally {
+    ptrs.forEach((ptr) => ptr && module._free(ptr));
+  }
+}
+
+// Recorder installed while a trace is active
+class Recorder {
+  private readonly out = new Writer();
+  private readonly ids = new Map<string, number>();
+
+  constructor(
+    private readonly options: TraceOptions,
+    private readonly native: NativeModule | null
+  ) {
+    MAGIC.forEach((b) => this.out.u8(b));
+    this.out.u16(VERSION);
+    this.out.u8(options.hash ? FLAG_HASH : 0);
+    this.out.u8(0);
+    this.out.u32(options.sample ?? 0);
+  }
+
+  /** NativeModule-shaped object whose kernels record and then execute each call */
+  kernels(): NativeModule {
+    // Non-kernel members (cpuLevel, isa, ...) come from the addon, if any
+    const kernels: Record<string, unknown> = { ...this.native };
+    for (const routine of Object.keys(SIGNATURES)) {
+      kernels[routine] = (...args: KernelArg[]) => this.call(routine, args);
+    }
+    return kernels as unknown as NativeModule;
+  }
+
+  private call(routine: string, args: KernelArg[]): number | void {
+    const start = performance.now();
+    const result = this.native
+      ? (this.native as unknown as Record<string, Kernel>)[routine](...args)
+      : callWasm(getModule(), routine, args);
+    this.record(routine, args, (performance.now() - start) * 1e3);
+    return result;
+  }
+
+  private record(routine: string, args: KernelArg[], elapsed: number): void {
+    const out = this.out;
+    const signature = SIGNATURES[routine];
+
+    let id = this.ids.get(routine);
+    if (id === undefined) {
+      id = this.ids.size;
+      if (id > 0xff) {
+        throw new Error('too many routines in one trace');
+      }
+      this.ids.set(routine, id);
+      out.u8(TAG_DEFINE);
+      out.u8(id);
+      out.ascii(routine);
+      out.ascii(signature);
+    }
+
+    out.u8(TAG_CALL);
+    out.u8(id);
+    out.f32(elapsed);
+    for (let i = 0; i < signature.length; i++) {
+      const arg = args[i];
+      if (signature[i] === 'i') {
+        out.i32(arg as number);
+      } else if (signature[i] === 'd') {
+        out.f64(arg as number);
+      } else if (!isArray(arg)) {
+        out.u32(NULL_ARRAY);
+      } else {
+        out.u32(arg.length);
+        if (this.options.hash) {
+          out.u32(fnv1a(asBytes(arg)));
+        }
+        const sample =
+          signature[i] === 'N' ? arg.length : Math.min(this.options.sample ?? 0, arg.length);
+        if (sample > 0) {
+          out.raw(asBytes(arg.subarray(0, sample)));
+        }
+      }
+    }
+  }
+
+  finish(): Uint8Array {
+    return this.out.finish();
+  }
+}
+
+let recorder: Recorder | null = null;
+
+/**
+ * Start recording every kernel call made by the BLAS functions
+ *
+ * Calls keep producing the same results; on the WebAssembly backend they are
+ * marshalled through a generic path while recording, so recorded times include
+ * that overhead. Call stopTrace() to get the trace.
+ */
+export function startTrace(options: TraceOptions = {}): void {
+  if (recorder) {
+    throw new Error('a trace is already being recorded');
+  }
+  const sample = options.sample ?? 0;
+  if (!Number.isInteger(sample) || sample < 0) {
+    throw new Error(`sample must be a non-negative integer, got ${sample}`);
+  }
+  recorder = new Recorder(options, getNative());
+  setRecorder(recorder.kernels());
+}
+
+/**
+ * Stop recording and return the binary trace
+ */
+export function stopTrace(): Uint8Array {
+  if (!recorder) {
+    throw new Error('no trace is being recorded');
+  }
+  const trace = recorder.finish();
+  recorder = null;
+  setRecorder(null);
+  return trace;
+}
+
+/**
+ * Decode a binary trace
+ */
+export function parseTrace(trace: Uint8Array): TraceCall[] {
+  const view = new DataView(trace.buffer, trace.byteOffset, trace.byteLength);
+  let pos = 0;
+  const ascii = (): string => {
+    const len = view.getUint8(pos++);
+    const s = String.fromCharCode(...trace.subarray(pos, pos + len));
+    pos += len;
+    return s;
+  };
+
+  if (trace.length < 12 || MAGIC.some((b, i) => trace[i] !== b)) {
+    throw new Error('not a BLAS trace');
+  }
+  if (view.getUint16(4, true) !== VERSION) {
+    throw new Error(`unsupported trace version ${view.getUint16(4, true)}`);
+  }
+  const hashed = (view.getUint8(6) & FLAG_HASH) !== 0;
+  const sample = view.getUint32(8, true);
+  pos = 12;
+
+  const routines: { name: string; signature: string }[] = [];
+  const calls: TraceCall[] = [];
+  while (pos < trace.length) {
+    const tag = view.getUint8(pos++);
+    const id = view.getUint8(pos++);
+    if (tag === TAG_DEFINE) {
+      routines[id] = { name: ascii(), signature: ascii() };
+      continue;
+    }
+    if (tag !== TAG_CALL || !routines[id]) {
+      throw new Error(`corrupt trace at byte ${pos - 2}`);
+    }
+
+    const { name, signature } = routines[id];
+    const elapsed = view.getFloat32(pos, true);
+    pos += 4;
+    const args: (number | TraceArray)[] = [];
+    for (const type of signature) {
+      if (type === 'i') {
+        args.push(view.getInt32(pos, true));
+        pos += 4;
+      } else if (type === 'd') {
+        args.push(view.getFloat64(pos, true));
+        pos += 8;
+      } else {
+        const length = view.getUint32(pos, true);
+        pos += 4;
+        if (length === NULL_ARRAY) {
+          args.push({ type, length: -1 });
+          continue;
+        }
+        const array: TraceArray = { type, length };
+        if (hashed) {
+          array.hash = view.getUint32(pos, true);
+          pos += 4;
+        }
+        const count = type === 'N' ? length : Math.min(sample, length);
+        if (count > 0) {
+          const ctor = ARRAY_TYPES[type];
+          const bytes = trace.slice(pos, pos + count * new ctor(0).BYTES_PER_ELEMENT);
+          array.sample = new (ctor as unknown as new (buffer: ArrayBuffer) => KernelArray)(
+            bytes.buffer
+          );
+          pos += bytes.length;
+        }
+        args.push(array);
+      }
+    }
+    calls.push({ routine: name, elapsed, args });
+  }
+  return calls;
+}
+
+function randomArray(type: string, length: number): KernelArray {
+  const array = new ARRAY_TYPES[type](length);
+  for (let i = 0; i < length; i++) {
+    if (type === 'D' || type === 'S') {
+      array[i] = Math.random() * 2 - 1;
+    } else if (type === 'H') {
+      // Normal numbers in both bfloat16 and fp16
+      array[i] = 0x3000 + Math.floor(Math.random() * 0x0c00);
+    } else {
+      array[i] = Math.floor(Math.random() * 256) - (type === 'b' ? 128 : 0);
+    }
+  }
+  return array;
+}
+
+/**
+ * Re-execute a trace on the active backend with random data of the recorded
+ * shapes and report the time per routine, sorted by replay time
+ *
+ * @param trace - Binary trace from stopTrace()
+ * @param repeat - Number of times to replay the whole trace (default 1)
+ */
+export function replayTrace(trace: Uint8Array, repeat: number = 1): TraceReport[] {
+  if (!Number.isInteger(repeat) || repeat < 1) {
+    throw new Error(`repeat must be a positive integer, got ${repeat}`);
+  }
+  if (recorder) {
+    throw new Error('stop the trace before replaying it');
+  }
+  const calls = parseTrace(trace);
+  const native = getNative() as unknown as Record<string, Kernel> | null;
+  const module = getModule();
+
+  const reports = new Map<string, TraceReport>();
+  for (const call of calls) {
+    // A trace from an older signature may lack the values of its integer arrays
+    const signature = SIGNATURES[call.routine] ?? '';
+    const mismatch = (arg: number | TraceArray, i: number): boolean =>
+      typeof arg === 'number' ? signature[i] in ARRAY_TYPES : arg.type !== signature[i];
+    if (signature.length !== call.args.length || call.args.some(mismatch)) {
+      throw new Error(`signature mismatch for ${call.routine}`);
+    }
+    const args = call.args.map((arg) => {
+      if (typeof arg === 'number') {
+        return arg;
+      }
+      if (arg.length < 0) {
+        return null;
+      }
+      return arg.type === 'N'
+        ? Int32Array.from(arg.sample ?? [])
+        : randomArray(arg.type, arg.length);
+    });
+
+    const start = performance.now();
+    for (let r = 0; r < repeat; r++) {
+      if (native) {
+        native[call.routine](...args);
+      } else {
+        callWasm(module, call.routine, args);
+      }
+    }
+    const elapsed = performance.now() - start;
+
+    const report = reports.get(call.routine) ?? {
+      routine: call.routine,
+      calls: 0,
+      recordedMs: 0,
+      replayMs: 0,
+    };
+    report.calls += repeat;
+    report.recordedMs += (call.elapsed * repeat) / 1e3;
+    report.replayMs += elapsed;
+    reports.set(call.routine, report);
+  }
+  return [...reports.values()].sort((a, b) => b.replayMs - a.replayMs);
+}
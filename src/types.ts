@@ -14,7 +14,52 @@ export enum Diagonal {
   NonUnit = 'N',
 }
 
+/** Part of a matrix accessed by the LAPACK auxiliary routines */
+export enum MatrixType {
+  General = 'G',
+  Upper = 'U',
+  Lower = 'L',
+}
+
+/** Matrix norm computed by dlange, dlansy and dlantr */
+export enum Norm {
+  /** Largest absolute value */
+  Max = 'M',
+  /** Maximum column sum of absolute values */
+  One = '1',
+  /** Maximum row sum of absolute values */
+  Infinity = 'I',
+  /** Square root of the sum of squares */
+  Frobenius = 'F',
+}
+
+/** Reduction computed by dreduce */
+export enum Reduction {
+  Sum = 'S',
+  AbsSum = 'A',
+  SumSquares = 'Q',
+  /** Euclidean norm, without overflow or underflow */
+  Norm2 = 'N',
+  MaxAbs = 'M',
+}
+
+/** Whether dreduce produces one result per column or one per row */
+export enum Axis {
+  Columns = 'C',
+  Rows = 'R',
+}
+
 export enum Side {
   Left = 'L',
   Right = 'R',
 }
+
+/** Eigenvalues computed by dlanczos */
+export enum Which {
+  /** Largest algebraic */
+  Largest = 'L',
+  /** Smallest algebraic */
+  Smallest = 'S',
+  /** Largest magnitude */
+  LargestMagnitude = 'M',
+}
@@ -0,0 +1,192 @@
+/**
+ * Helpers shared by the wrappers
+ */
+
+import { BlasModule } from './wasm-module';
+
+/**
+ * Strided vector operands are packed into the WASM heap contiguously: only
+ * the n elements the routine uses are copied, in the order the kernel visits
+ * them (a negative increment walks the array backwards, as in BLAS), and the
+ * kernel is called with increment 1 so that it takes its unit-stride SIMD
+ * path. An increment of 0 addresses a single element, which is copied as is
+ * and passed with increment 0.
+ */
+
+/**
+ * Number of elements of the packed copy of an n-vector with increment inc
+ * @internal
+ */
+export function packedLength(n: number, inc: number): number {
+  return inc === 0 ? 1 : n;
+}
+
+/**
+ * Increment to pass to the kernel for a packed operand
+ * @internal
+ */
+export function packedInc(inc: number): number {
+  return inc === 0 ? 0 : 1;
+}
+
+/**
+ * Copy the n elements of x with increment inc contiguously into the heap at ptr
+ * @internal
+ */
+export function gather(
+  module: BlasModule,
+  x: Float64Array,
+  n: number,
+  inc: number,
+  ptr: number
+): void {
+  gatherAt(module.HEAPF64, ptr / 8, x, n, inc);
+}
+
+/**
+ * Copy the n elements of x with increment inc contiguously into dst at index k
+ * @internal
+ */
+export function gatherAt(
+  dst: Float64Array,
+  k: number,
+  x: Float64Array,
+  n: number,
+  inc: number
+): void {
+  if (inc === 0) {
+    dst[k] = x[0];
+  } else if (inc === 1) {
+    dst.set(x.subarray(0, n), k);
+  } else {
+    let ix = inc < 0 ? (1 - n) * inc : 0;
+    for (let i = 0; i < n; i++, ix += inc) {
+      dst[k + i] = x[ix];
+    }
+  }
+}
+
+/**
+ * Copy a packed operand from the heap at ptr back to the n elements of x
+ * with increment inc
+ * @internal
+ */
+export function scatter(
+  module: BlasModule,
+  ptr: number,
+  x: Float64Array,
+  n: number,
+  inc: number
+): void {
+  scatterAt(module.HEAPF64, ptr / 8, x, n, inc);
+}
+
+/**
+ * Copy a packed operand from src at index k back to the n elements of x
+ * with increment inc
+ * @internal
+ */
+export function scatterAt(
+  src: Float64Array,
+  k: number,
+  x: Float64Array,
+  n: number,
+  inc: number
+): void {
+  if (inc === 0) {
+    x[0] = src[k];
+  } else if (inc === 1) {
+    x.set(src.subarray(k, k + n));
+  } else {
+    let ix = inc < 0 ? (1 - n) * inc : 0;
+    for (let i = 0; i < n; i++, ix += inc) {
+      x[ix] = src[k + i];
+    }
+  }
+}
+
+/**
+ * Copy the rows x cols matrix a (leading dimension lda) into the heap at ptr
+ * with leading dimension ld
+ * @internal
+ */
+export function packMatrix(
+  module: BlasModule,
+  a: Float64Array,
+  lda: number,
+  rows: number,
+  cols: number,
+  ptr: number,
+  ld: number
+): void {
+  packMatrixAt(module.HEAPF64, ptr / 8, a, lda, rows, cols, ld);
+}
+
+/**
+ * Copy the rows x cols matrix a (leading dimension lda) into dst at index k
+ * with leading dimension ld
+ * @internal
+ */
+export function packMatrixAt(
+  dst: Float64Array,
+  k: number,
+  a: Float64Array,
+  lda: number,
+  rows: number,
+  cols: number,
+  ld: number
+): void {
+  if (rows === 0 || cols === 0) {
+    return;
+  }
+  if (lda === ld) {
+    dst.set(a.subarray(0, (cols - 1) * lda + rows), k);
+    return;
+  }
+  for (let j = 0; j < cols; j++) {
+    dst.set(a.subarray(j * lda, j * lda + rows), k + j * ld);
+  }
+}
+
+/**
+ * Copy a rows x cols matrix with leading dimension ld from the heap at ptr
+ * back to a (leading dimension lda)
+ * @internal
+ */
+export function unpackMatrix(
+  module: BlasModule,
+  ptr: number,
+  ld: number,
+  a: Float64Array,
+  lda: number,
+  rows: number,
+  cols: number
+): void {
+  unpackMatrixAt(module.HEAPF64, ptr / 8, ld, a, lda, rows, cols);
+}
+
+/**
+ * Copy a rows x cols matrix with leading dimension ld from src at index k
+ * back to a (leading dimension lda)
+ * @internal
+ */
+export function unpackMatrixAt(
+  src: Float64Array,
+  k: number,
+  ld: number,
+  a: Float64Array,
+  lda: number,
+  rows: number,
+  cols: number
+): void {
+  if (rows === 0 || cols === 0) {
+    return;
+  }
+  if (lda === ld) {
+    a.set(src.subarray(k, k + (cols - 1) * ld + rows));
+    return;
+  }
+  for (let j = 0; j < cols; j++) {
+    a.set(src.subarray(k + j * ld, k + j * ld + rows), j * lda);
+  }
+}
@@ -2,6 +2,10 @@
  * WebAssembly module interface and initialization
  */
 
+import { loadNative, NativeModule } from './native';
+import { setMemoryBudget, trackHeap } from './memory';
+import { bindRaw } from './raw';
+
 export interface BlasModule {
   // Level 1 BLAS functions
   _daxpy(n: number, alpha: number, xPtr: number, incx: number, yPtr: number, incy: number): void;
@@ -201,6 +205,130 @@ export interface BlasModule {
     incx: number
   ): void;
 
+  // Batched Level 1 BLAS functions
+  _ddot_batch_strided(
+    n: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    yPtr: number,
+    incy: number,
+    stridey: number,
+    resultPtr: number,
+    batch: number
+  ): void;
+  _dnrm2_batch_strided(
+    n: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    resultPtr: number,
+    batch: number
+  ): void;
+  _dasum_batch_strided(
+    n: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    resultPtr: number,
+    batch: number
+  ): void;
+  _daxpy_batch_strided(
+    n: number,
+    alpha: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    yPtr: number,
+    incy: number,
+    stridey: number,
+    batch: number
+  ): void;
+  _dscal_batch_strided(
+    n: number,
+    alpha: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    batch: number
+  ): void;
+
+  // Batched Level 2 BLAS functions
+  _dgemv_batch_strided(
+    trans: number,
+    m: number,
+    n: number,
+    alpha: number,
+    aPtr: number,
+    lda: number,
+    stridea: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    beta: number,
+    yPtr: number,
+    incy: number,
+    stridey: number,
+    batch: number
+  ): void;
+  _dsymv_batch_strided(
+    uplo: number,
+    n: number,
+    alpha: number,
+    aPtr: number,
+    lda: number,
+    stridea: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    beta: number,
+    yPtr: number,
+    incy: number,
+    stridey: number,
+    batch: number
+  ): void;
+  _dtrmv_batch_strided(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    aPtr: number,
+    lda: number,
+    stridea: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    batch: number
+  ): void;
+  _dtrsv_batch_strided(
+    uplo: number,
+    trans: number,
+    diag: number,
+    n: number,
+    aPtr: number,
+    lda: number,
+    stridea: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    batch: number
+  ): void;
+  _dger_batch_strided(
+    m: number,
+    n: number,
+    alpha: number,
+    xPtr: number,
+    incx: number,
+    stridex: number,
+    yPtr: number,
+    incy: number,
+    stridey: number,
+    aPtr: number,
+    lda: number,
+    stridea: number,
+    batch: number
+  ): void;
+
   // Level 3 BLAS functions
   _dgemm(
     transa: number,
@@ -298,54 +426,487 @@ export interface BlasModule {
     cPtr: number,
     ldc: number
   ): void;
+  _dgemm_batch(
+    group_count: number,
+    group_sizePtr: number,
+    transaPtr: number,
+    transbPtr: number,
+    mPtr: number,
+    nPtr: number,
+    kPtr: number,
+    alphaPtr: number,
+    aPtr: number,
+    ldaPtr: number,
+    offaPtr: number,
+    bPtr: number,
+    ldbPtr: number,
+    offbPtr: number,
+    betaPtr: number,
+    cPtr: number,
+    ldcPtr: number,
+    offcPtr: number
+  ): void;
+
+  // Quantized (int8) functions
+  _gemm_u8s8s32(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    aPtr: number,
+    lda: number,
+    aZero: number,
+    bPtr: number,
+    ldb: number,
+    bZero: number,
+    cPtr: number,
+    ldc: number
+  ): void;
+  _gemm_u8s8u8(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    aPtr: number,
+    lda: number,
+    aZero: number,
+    bPtr: number,
+    ldb: number,
+    bZero: number,
+    biasPtr: number,
+    scalePtr: number,
+    perChannel: number,
+    cZero: number,
+    cPtr: number,
+    ldc: number
+  ): void;
+
+  // 16-bit storage (bfloat16 / fp16) functions
+  _sbstobf16(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _sbdtobf16(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _sbf16tos(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _dbf16tod(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _shstof16(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _shdtof16(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _shf16tos(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _df16tod(n: number, inPtr: number, incin: number, outPtr: number, incout: number): void;
+  _sbgemm(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    alpha: number,
+    aPtr: number,
+    lda: number,
+    bPtr: number,
+    ldb: number,
+    beta: number,
+    cPtr: number,
+    ldc: number
+  ): void;
+  _shgemm(
+    transa: number,
+    transb: number,
+    m: number,
+    n: number,
+    k: number,
+    alpha: number,
+    aPtr: number,
+    lda: number,
+    bPtr: number,
+    ldb: number,
+    beta: number,
+    cPtr: number,
+    ldc: number
+  ): void;
+  _sbgemv(
+    trans: number,
+    m: number,
+    n: number,
+    alpha: number,
+    aPtr: number,
+    lda: number,
+    xPtr: number,
+    incx: number,
+    beta: number,
+    yPtr: number,
+    incy: number
+  ): void;
+  _shgemv(
+    trans: number,
+    m: number,
+    n: number,
+    alpha: number,
+    aPtr: number,
+    lda: number,
+    xPtr: number,
+    incx: number,
+    beta: number,
+    yPtr: number,
+    incy: number
+  ): void;
+
+  // LAPACK auxiliary routines
+  _dlacpy(
+    uplo: number,
+    m: number,
+    n: number,
+    aPtr: number,
+    lda: number,
+    bPtr: number,
+    ldb: number
+  ): void;
+  _dlaset(
+    uplo: number,
+    m: number,
+    n: number,
+    alpha: number,
+    beta: number,
+    aPtr: number,
+    lda: number
+  ): void;
+  _dlascl(
+    type: number,
+    cfrom: number,
+    cto: number,
+    m: number,
+    n: number,
+    aPtr: number,
+    lda: number
+  ): void;
+  _dlange(norm: number, m: number, n: number, aPtr: number, lda: number): number;
+  _dlansy(norm: number, uplo: number, n: number, aPtr: number, lda: number): number;
+  _dlantr(
+    norm: number,
+    uplo: number,
+    diag: number,
+    m: number,
+    n: number,
+    aPtr: number,
+    lda: number
+  ): number;
+  _dreduce(
+    op: number,
+    axis: number,
+    m: number,
+    n: number,
+    aPtr: number,
+    lda: number,
+    rPtr: number
+  ): void;
+
+  // LAPACK routines
+  _dgetrf(m: number, n: number, aPtr: number, lda: number, ipivPtr: number): number;
+  _dgetrs(
+    trans: number,
+    n: number,
+    nrhs: number,
+    aPtr: number,
+    lda: number,
+    ipivPtr: number,
+    bPtr: number,
+    ldb: number
+  ): void;
+  _dgetri(n: number, aPtr: number, lda: number, ipivPtr: number): number;
+  _dtrtri(uplo: number, diag: number, n: number, aPtr: number, lda: number): number;
+  _dpotrf(uplo: number, n: number, aPtr: number, lda: number): number;
+  _dpotri(uplo: number, n: number, aPtr: number, lda: number): number;
+  _dgeqrf(m: number, n: number, aPtr: number, lda: number, tauPtr: number): void;
+  _dormqr(
+    side: number,
+    trans: number,
+    m: number,
+    n: number,
+    k: number,
+    aPtr: number,
+    lda: number,
+    tauPtr: number,
+    cPtr: number,
+    ldc: number
+  ): void;
+  _dgels(
+    trans: number,
+    m: number,
+    n: number,
+    nrhs: number,
+    aPtr: number,
+    lda: number,
+    bPtr: number,
+    ldb: number
+  ): number;
+  _dgels_normal(
+    m: number,
+    n: number,
+    nrhs: number,
+    aPtr: number,
+    lda: number,
+    bPtr: number,
+    ldb: number
+  ): number;
+
+  // Kronecker products
+  _dkronmv(
+    trans: number,
+    d: number,
+    mPtr: number,
+    nPtr: number,
+    alpha: number,
+    aPtr: number,
+    ldaPtr: number,
+    offaPtr: number,
+    xPtr: number,
+    beta: number,
+    yPtr: number
+  ): void;
+  _dkronsv(
+    trans: number,
+    d: number,
+    nPtr: number,
+    aPtr: number,
+    ldaPtr: number,
+    offaPtr: number,
+    bPtr: number
+  ): number;
+
+  // Eigensolvers
+  _dpower(
+    kind: number,
+    uplo: number,
+    n: number,
+    k: number,
+    aPtr: number,
+    lda: number,
+    iaPtr: number,
+    jaPtr: number,
+    maxit: number,
+    tol: number,
+    xPtr: number,
+    lambdaPtr: number
+  ): number;
+  _dlanczos(
+    kind: number,
+    uplo: number,
+    n: number,
+    k: number,
+    aPtr: number,
+    lda: number,
+    iaPtr: number,
+    jaPtr: number,
+    which: number,
+    nev: number,
+    ncv: number,
+    maxit: number,
+    tol: number,
+    wPtr: number,
+    zPtr: number,
+    ldz: number
+  ): number;
 
   // Memory management
   _malloc(size: number): number;
+  _malloc_aligned(size: number): number;
   _free(ptr: number): void;
 
   // Memory views
   HEAPF64: Float64Array;
+  HEAPF32: Float32Array;
+  HEAP32: Int32Array;
+  HEAPU16: Uint16Array;
   HEAP8: Int8Array;
   HEAPU8: Uint8Array;
   wasmMemory: WebAssembly.Memory;
 }
 
+/**
+ * Build flavour of the WebAssembly module:
+ * - 'scalar': no SIMD, runs on every engine
+ * - 'simd': 128-bit WebAssembly SIMD kernels
+ * - 'relaxed-simd': SIMD kernels using relaxed fused multiply-add. Results may
+ *   differ in the last bits between CPUs, and from the other flavours
+ * - 'debug': unoptimized build whose kernels check their arguments and throw
+ *   on invalid ones; for testing code that uses the raw API, never auto-selected
+ */
+export type Flavour = 'scalar' | 'simd' | 'relaxed-simd' | 'debug';
+
+/**
+ * Backend executing the kernels:
+ * - 'wasm': the WebAssembly module (default)
+ * - 'native': the Node.js addon, built for the host CPU and multi-threaded.
+ *   Kernels work directly on the caller's typed arrays without copies
+ */
+export type Backend = 'wasm' | 'native';
+
+export interface InitOptions {
+  /** Flavour to load; 'auto' (default) picks the best one the engine supports */
+  flavour?: Flavour | 'auto';
+  /** Backend to use; 'native' falls back to 'wasm' if the addon cannot be loaded */
+  backend?: Backend;
+  /** Directory containing the blas-native*.node addons (default: the package's dist/) */
+  nativeDir?: string;
+  /** Bytes the BLAS functions may allocate in the WASM heap, see setMemoryBudget() */
+  memoryBudget?: number | null;
+}
+
+// Minimal modules that validate only if the engine supports the feature:
+// () -> v128 { i32.const 0; i8x16.splat; i8x16.popcnt }
+const SIMD_PROBE = new Uint8Array([
+  0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1, 8, 0, 65, 0, 253, 15,
+  253, 98, 11,
+]);
+// () -> v128 { i32.const 0; i8x16.splat; i32.const 0; i8x16.splat; i8x16.relaxed_swizzle }
+const RELAXED_SIMD_PROBE = new Uint8Array([
+  0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 15, 1, 13, 0, 65, 0, 253, 15,
+  65, 0, 253, 15, 253, 128, 2, 11,
+]);
+
+// Flavours in order of preference
+const FLAVOURS: Flavour[] = ['relaxed-simd', 'simd', 'scalar'];
+
+const loaders: Record<Flavour, () => Promise<{ default: typeof import('../dist/blas.js') }>> = {
+  'relaxed-simd': () => import('../dist/blas-relaxed.js'),
+  simd: () => import('../dist/blas.js'),
+  scalar: () => import('../dist/blas-scalar.js'),
+  debug: () => import('../dist/blas-debug.js'),
+};
+
+/**
+ * Detect the best flavour supported by the current WebAssembly engine
+ */
+export function detectFlavour(): Flavour {
+  if (WebAssembly.validate(RELAXED_SIMD_PROBE)) {
+    return 'relaxed-simd';
+  }
+  if (WebAssembly.validate(SIMD_PROBE)) {
+    return 'simd';
+  }
+  return 'scalar';
+}
+
 let moduleInstance: BlasModule | null = null;
+let moduleFlavour: Flavour | null = null;
+let nativeInstance: NativeModule | null = null;
+let recorderInstance: NativeModule | null = null;
 
 /**
  * Initialize the WebAssembly module
+ *
+ * By default the best flavour supported by the engine is loaded; if its build
+ * is missing the next one down is tried. Pass `{ flavour }` to force one.
+ *
+ * With `{ backend: 'native' }` the BLAS functions run in the native addon
+ * when it can be loaded. The WebAssembly module is initialized either way
+ * and remains available through getModule().
  */
-export async function initWasm(): Promise<BlasModule> {
+export async function initWasm(options: InitOptions = {}): Promise<BlasModule> {
+  if (options.memoryBudget !== undefined) {
+    setMemoryBudget(options.memoryBudget);
+  }
+
+  if (options.backend === 'native' && !nativeInstance) {
+    try {
+      nativeInstance = loadNative(options.nativeDir ?? `${__dirname}/../dist`);
+    } catch {
+      // Fall back to the WebAssembly backend
+      nativeInstance = null;
+    }
+  }
+
   if (moduleInstance) {
     return moduleInstance;
   }
 
-  try {
-    // Import the Emscripten-generated module
-    const { default: createBlasModule } = await import('../dist/blas.js');
+  const requested = options.flavour ?? 'auto';
+  const candidates =
+    requested === 'auto' ? FLAVOURS.slice(FLAVOURS.indexOf(detectFlavour())) : [requested];
+
+  let lastError: unknown = null;
+  for (const flavour of candidates) {
+    try {
+      // Import the Emscripten-generated module
+      const { default: createBlasModule } = await loaders[flavour]();
+
+      // Create module instance with proper initialization
+      const module = await createBlasModule({
+        onRuntimeInitialized: function () {
+          // This ensures heap arrays are available
+          // Emscripten calls updateMemoryViews() internally
+        },
+      });
 
-    // Create module instance with proper initialization
-    const module = await createBlasModule({
-      onRuntimeInitialized: function () {
-        // This ensures heap arrays are available
-        // Emscripten calls updateMemoryViews() internally
-      },
-    });
+      if (!module) {
+        throw new Error('Failed to initialize WASM module');
+      }
 
-    if (!module) {
-      throw new Error('Failed to initialize WASM module');
+      // The createBlasModule returns a promise that resolves to the module
+      // Cast to BlasModule interface
+      moduleInstance = module as BlasModule;
+      moduleFlavour = flavour;
+      trackHeap(moduleInstance);
+      bindRaw(moduleInstance);
+
+      return moduleInstance;
+    } catch (error) {
+      lastError = error;
     }
+  }
 
-    // The createBlasModule returns a promise that resolves to the module
-    // Cast to BlasModule interface
-    moduleInstance = module as BlasModule;
+  const message = lastError instanceof Error ? lastError.message : String(lastError);
+  throw new Error(`Failed to load WASM module: ${message}`);
+}
 
-    return moduleInstance;
-  } catch (error) {
-    throw new Error(
-      `Failed to load WASM module: ${error instanceof Error ? error.message : String(error)}`
-    );
+/**
+ * Get the flavour of the initialized WASM module
+ */
+export function getFlavour(): Flavour {
+  if (!moduleFlavour) {
+    throw new Error('WASM module not initialized. Call initWasm() first.');
   }
+  return moduleFlavour;
+}
+/**
+ * Get the backend the BLAS functions run on
+ */
+export function getBackend(): Backend {
+  return nativeInstance ? 'native' : 'wasm';
+}
+
+/**
+ * Get the native addon if the native backend is active, otherwise null
+ *
+ * While a trace is being recorded (see startTrace()) this returns the
+ * recording kernels instead, on either backend.
+ */
+export function getNative(): NativeModule | null {
+  return recorderInstance ?? nativeInstance;
+}
+
+/**
+ * Install (or with null, remove) the kernels returned by getNative() while tracing
+ * @internal
+ */
+export function setRecorder(recorder: NativeModule | null): void {
+  recorderInstance = recorder;
+}
+
+/**
+ * Set the number of threads used by the native backend
+ * (the WebAssembly backend is single-threaded and ignores it)
+ */
+export function setNumThreads(n: number): void {
+  if (!Number.isInteger(n) || n < 1) {
+    throw new Error(`number of threads must be a positive integer, got ${n}`);
+  }
+  nativeInstance?.setNumThreads(n);
+}
+
+/**
+ * Get the number of threads used by the BLAS functions
+ */
+export function getNumThreads(): number {
+  return nativeInstance ? nativeInstance.getNumThreads() : 1;
 }
 
 /**
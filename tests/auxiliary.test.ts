@@ -0,0 +1,61 @@
+/**
+ * Tests for the LAPACK auxiliary routines dlacpy, dlaset and dlascl
+ */
+
+import { dlacpy, dlascl, dlaset, initWasm, MatrixType } from '../src/index';
+
+describe('LAPACK auxiliary routines', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  // 3x3 column-major matrix with lda = 4; the padding row holds -1
+  function matrix(): Float64Array {
+    return new Float64Array([1, 2, 3, -1, 4, 5, 6, -1, 7, 8, 9, -1]);
+  }
+
+  test('dlacpy copies the whole matrix', () => {
+    const b = new Float64Array(9);
+    dlacpy(MatrixType.General, 3, 3, matrix(), 4, b, 3);
+    expect(Array.from(b)).toEqual([1, 2, 3, 4, 5, 6, 7, 8, 9]);
+  });
+
+  test('dlacpy copies one triangle and keeps the rest of B', () => {
+    const upper = new Float64Array(9).fill(0);
+    dlacpy(MatrixType.Upper, 3, 3, matrix(), 4, upper, 3);
+    expect(Array.from(upper)).toEqual([1, 0, 0, 4, 5, 0, 7, 8, 9]);
+
+    const lower = new Float64Array(9).fill(0);
+    dlacpy(MatrixType.Lower, 3, 3, matrix(), 4, lower, 3);
+    expect(Array.from(lower)).toEqual([1, 2, 3, 0, 5, 6, 0, 0, 9]);
+  });
+
+  test('dlaset sets the off-diagonal part and the diagonal', () => {
+    const a = matrix();
+    dlaset(MatrixType.General, 3, 3, 0, 1, a, 4);
+    expect(Array.from(a)).toEqual([1, 0, 0, -1, 0, 1, 0, -1, 0, 0, 1, -1]);
+
+    const b = matrix();
+    dlaset(MatrixType.Lower, 3, 3, 0, 2, b, 4);
+    expect(Array.from(b)).toEqual([2, 0, 0, -1, 4, 2, 0, -1, 7, 8, 2, -1]);
+
+    const c = new Float64Array(6);
+    dlaset(MatrixType.Upper, 2, 3, 5, 1, c, 2);
+    expect(Array.from(c)).toEqual([1, 0, 5, 1, 5, 5]);
+  });
+
+  test('dlascl scales a triangle by cto/cfrom', () => {
+    const a = matrix();
+    dlascl(MatrixType.Upper, 2, 3, 3, 3, a, 4);
+    expect(Array.from(a)).toEqual([1.5, 2, 3, -1, 6, 7.5, 6, -1, 10.5, 12, 13.5, -1]);
+  });
+
+  test('dlascl avoids overflow in the scale factor', () => {
+    const a = new Float64Array([1e-300, -2e-300]);
+    dlascl(MatrixType.General, 1e-310, 1, 2, 1, a, 2);
+    expect(a[0] / 1e10).toBeCloseTo(1, 12);
+    expect(a[1] / 1e10).toBeCloseTo(-2, 12);
+
+    expect(() => dlascl(MatrixType.General, 0, 1, 2, 1, a, 2)).toThrow('cfrom must be nonzero');
+  });
+});
@@ -0,0 +1,376 @@
+/**
+ * Tests for the batched Level 1, 2 and 3 routines: every problem of a
+ * batch must match a separate call of the single-problem routine
+ */
+
+import {
+  dasum,
+  dasum_batch,
+  dasum_batch_strided,
+  daxpy,
+  daxpy_batch,
+  daxpy_batch_strided,
+  ddot,
+  ddot_batch,
+  ddot_batch_strided,
+  Diagonal,
+  dgemm,
+  dgemm_batch,
+  dgemv,
+  dgemv_batch,
+  dgemv_batch_strided,
+  dger,
+  dger_batch,
+  dger_batch_strided,
+  dnrm2,
+  dnrm2_batch,
+  dnrm2_batch_strided,
+  dscal,
+  dscal_batch,
+  dscal_batch_strided,
+  dsymv,
+  dsymv_batch,
+  dsymv_batch_strided,
+  dtrmv,
+  dtrmv_batch,
+  dtrmv_batch_strided,
+  dtrsv,
+  dtrsv_batch,
+  dtrsv_batch_strided,
+  GemmGroup,
+  initWasm,
+  Transpose,
+  Triangular,
+} from '../src/index';
+
+describe('batched BLAS', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  function random(length: number): Float64Array {
+    const x = new Float64Array(length);
+    for (let i = 0; i < length; i++) {
+      x[i] = Math.round((Math.random() - 0.5) * 200) / 10;
+    }
+    return x;
+  }
+
+  // Random n x n matrix with lda = n, made well conditioned for dtrsv
+  function triangular(n: number): Float64Array {
+    const a = random(n * n);
+    for (let i = 0; i < n; i++) {
+      a[i + i * n] = 20 + i;
+    }
+    return a;
+  }
+
+  function copies(arrays: Float64Array[]): Float64Array[] {
+    return arrays.map((a) => a.slice());
+  }
+
+  // Concatenate arrays of equal length, for the strided form
+  function concat(arrays: Float64Array[]): Float64Array {
+    const out = new Float64Array(arrays.reduce((s, a) => s + a.length, 0));
+    let k = 0;
+    for (const a of arrays) {
+      out.set(a, k);
+      k += a.length;
+    }
+    return out;
+  }
+
+  // Short (paired SIMD path) and longer vectors, odd batch counts
+  const lengths: [number, number][] = [
+    [5, 7],
+    [16, 4],
+    [21, 3],
+  ];
+
+  it('ddot_batch, dnrm2_batch and dasum_batch match the single routines', () => {
+    for (const [n, batch] of lengths) {
+      const xs = Array.from({ length: batch }, () => random(n));
+      const ys = Array.from({ length: batch }, () => random(2 * n));
+      xs[1][0] = 1e300; // needs scaling in dnrm2
+
+      const r = new Float64Array(batch);
+      ddot_batch(n, xs, 1, ys, 2, r);
+      expect(Array.from(r)).toEqual(xs.map((x, b) => ddot(n, x, 1, ys[b], 2)));
+      ddot_batch(n, xs, 1, [ys[0]], 2, r);
+      expect(Array.from(r)).toEqual(xs.map((x) => ddot(n, x, 1, ys[0], 2)));
+      dnrm2_batch(n, xs, 1, r);
+      expect(Array.from(r)).toEqual(xs.map((x) => dnrm2(n, x, 1)));
+      dasum_batch(n, ys, 2, r);
+      expect(Array.from(r)).toEqual(ys.map((y) => dasum(n, y, 2)));
+
+      // Strided: rows of a row-major table against a shared query
+      const table = concat(xs);
+      ddot_batch_strided(n, table, 1, n, ys[0], 1, 0, r, batch);
+      expect(Array.from(r)).toEqual(xs.map((x) => ddot(n, x, 1, ys[0], 1)));
+      dnrm2_batch_strided(n, table, 1, n, r, batch);
+      expect(Array.from(r)).toEqual(xs.map((x) => dnrm2(n, x, 1)));
+      dasum_batch_strided(n, table, 1, n, r, batch);
+      expect(Array.from(r)).toEqual(xs.map((x) => dasum(n, x, 1)));
+    }
+  });
+
+  it('daxpy_batch and dscal_batch match the single routines', () => {
+    for (const [n, batch] of lengths) {
+      const xs = Array.from({ length: batch }, () => random(n));
+      const ys = Array.from({ length: batch }, () => random(2 * n));
+
+      const expected = copies(ys);
+      expected.forEach((y, b) => daxpy(n, -0.75, xs[b], 1, y, 2));
+      const actual = copies(ys);
+      daxpy_batch(n, -0.75, xs, 1, actual, 2);
+      expect(actual).toEqual(expected);
+
+      // Back to back, and with a shared x
+      const backToBack = copies(xs);
+      backToBack.forEach((z, b) => daxpy(n, 3.0, ys[b], 2, z, 1));
+      const y = concat(xs);
+      daxpy_batch_strided(n, 3.0, concat(ys), 2, 2 * n, y, 1, n, batch);
+      expect(y).toEqual(concat(backToBack));
+
+      const shared = copies(ys);
+      shared.forEach((z) => daxpy(n, 3.0, xs[0], 1, z, 2));
+      const y2 = concat(ys);
+      daxpy_batch_strided(n, 3.0, xs[0], 1, 0, y2, 2, 2 * n, batch);
+      expect(y2).toEqual(concat(shared));
+
+      const scaled = copies(ys);
+      scaled.forEach((v) => dscal(n, 1.25, v, 2));
+      const batched = copies(ys);
+      dscal_batch(n, 1.25, batched, 2);
+      expect(batched).toEqual(scaled);
+      const x = concat(ys);
+      dscal_batch_strided(n, 1.25, x, 2, 2 * n, batch);
+      expect(x).toEqual(concat(scaled));
+    }
+  });
+
+  // Tiny (paired SIMD path), odd-sized and larger problems, odd batch counts
+  const shapes: [number, number, number][] = [
+    [3, 2, 5],
+    [8, 8, 7],
+    [13, 9, 3],
+  ];
+
+  it('dgemv_batch matches dgemv', () => {
+    for (const [m, n, batch] of shapes) {
+      for (const trans of [Transpose.NoTranspose, Transpose.Transpose]) {
+        const xLen = trans === Transpose.NoTranspose ? n : m;
+        const yLen = trans === Transpose.NoTranspose ? m : n;
+        const as = Array.from({ length: batch }, () => random(m * n));
+        const xs = Array.from({ length: batch }, () => random(2 * xLen));
+        const ys = Array.from({ length: batch }, () => random(yLen));
+
+        const expected = copies(ys);
+        for (let b = 0; b < batch; b++) {
+          dgemv(trans, m, n, 1.5, as[b], m, xs[b], 2, 0.5, expected[b], 1);
+        }
+        const actual = copies(ys);
+        dgemv_batch(trans, m, n, 1.5, as, m, xs, 2, 0.5, actual, 1);
+        expect(actual).toEqual(expected);
+
+        // Strided, with a shared matrix
+        const shared = copies(ys);
+        for (let b = 0; b < batch; b++) {
+          dgemv(trans, m, n, 1.5, as[0], m, xs[b], 2, 0.5, shared[b], 1);
+        }
+        const y = concat(ys);
+        const x = concat(xs);
+        dgemv_batch_strided(trans, m, n, 1.5, as[0], m, 0, x, 2, 2 * xLen, 0.5, y, 1, yLen, batch);
+        expect(y).toEqual(concat(shared));
+      }
+    }
+  });
+
+  it('dsymv_batch matches dsymv', () => {
+    for (const [n, , batch] of shapes) {
+      for (const uplo of [Triangular.Upper, Triangular.Lower]) {
+        const as = Array.from({ length: batch }, () => random(n * n));
+        const x = random(n);
+        const ys = Array.from({ length: batch }, () => random(2 * n));
+
+        const expected = copies(ys);
+        for (let b = 0; b < batch; b++) {
+          dsymv(uplo, n, -1.0, as[b], n, x, 1, 2.0, expected[b], 2);
+        }
+        const actual = copies(ys);
+        dsymv_batch(uplo, n, -1.0, as, n, [x], 1, 2.0, actual, 2);
+        expect(actual).toEqual(expected);
+
+        const y = concat(ys);
+        dsymv_batch_strided(uplo, n, -1.0, concat(as), n, n * n, x, 1, 0, 2.0, y, 2, 2 * n, batch);
+        expect(y).toEqual(concat(expected));
+      }
+    }
+  });
+
+  it('dtrmv_batch and dtrsv_batch match', () => {
+    for (const [n, , batch] of shapes) {
+      for (const uplo of [Triangular.Upper, Triangular.Lower]) {
+        for (const trans of [Transpose.NoTranspose, Transpose.Transpose]) {
+          for (const diag of [Diagonal.NonUnit, Diagonal.Unit]) {
+            const as = Array.from({ length: batch }, () => triangular(n));
+            const xs = Array.from({ length: batch }, () => random(n));
+
+            const trmv = copies(xs);
+            const trsv = copies(xs);
+            for (let b = 0; b < batch; b++) {
+              dtrmv(uplo, trans, diag, n, as[b], n, trmv[b], 1);
+              dtrsv(uplo, trans, diag, n, as[b], n, trsv[b], 1);
+            }
+
+            const actual = copies(xs);
+            dtrmv_batch(uplo, trans, diag, n, as, n, actual, 1);
+            expect(actual).toEqual(trmv);
+
+            const x = concat(xs);
+            dtrsv_batch_strided(uplo, trans, diag, n, concat(as), n, n * n, x, 1, n, batch);
+            expect(x).toEqual(concat(trsv));
+
+            const x2 = concat(xs);
+            dtrmv_batch_strided(uplo, trans, diag, n, concat(as), n, n * n, x2, 1, n, batch);
+            expect(x2).toEqual(concat(trmv));
+
+            const solved = copies(xs);
+            dtrsv_batch(uplo, trans, diag, n, as, n, solved, 1);
+            expect(solved).toEqual(trsv);
+          }
+        }
+      }
+    }
+  });
+
+  it('dger_batch matches dger', () => {
+    for (const [m, n, batch] of shapes) {
+      const xs = Array.from({ length: batch }, () => random(m));
+      const y = random(n);
+      const as = Array.from({ length: batch }, () => random((m + 1) * n));
+
+      const expected = copies(as);
+      for (let b = 0; b < batch; b++) {
+        dger(m, n, 0.25, xs[b], 1, y, 1, expected[b], m + 1);
+      }
+      const actual = copies(as);
+      dger_batch(m, n, 0.25, xs, 1, [y], 1, actual, m + 1);
+      expect(actual).toEqual(expected);
+
+      const a = concat(as);
+      dger_batch_strided(m, n, 0.25, concat(xs), 1, m, y, 1, 0, a, m + 1, (m + 1) * n, batch);
+      expect(a).toEqual(concat(expected));
+    }
+  });
+
+  it('dgemm_batch matches dgemm for groups of different sizes', () => {
+    const N = Transpose.NoTranspose;
+    const T = Transpose.Transpose;
+    // [transa, transb, m, n, k, group size, shared A]
+    const shapes: [Transpose, Transpose, number, number, number, number, boolean][] = [
+      [N, N, 3, 2, 4, 5, false],
+      [T, N, 40, 33, 27, 2, true],
+      [N, T, 1, 7, 5, 3, false],
+      [T, T, 9, 9, 0, 1, false],
+      [N, N, 4, 4, 4, 0, false],
+    ];
+
+    const groups: GemmGroup[] = shapes.map(([transa, transb, m, n, k, size, shared]) => {
+      const lda = (transa === N ? m : k) + 1;
+      const ldb = transb === N ? k : n;
+      const ldc = m + 2;
+      const aCount = shared ? 1 : size;
+      return {
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        alpha: 1.5,
+        a: Array.from({ length: aCount }, () => random(lda * (transa === N ? k : m))),
+        lda,
+        b: Array.from({ length: size }, () => random(ldb * (transb === N ? n : k))),
+        ldb,
+        beta: -0.5,
+        c: Array.from({ length: size }, () => random(ldc * n)),
+        ldc,
+      };
+    });
+
+    const expected = groups.map((group) => {
+      const { transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, ldc } = group;
+      const c = copies(group.c);
+      c.forEach((cp, p) => {
+        const ap = a[a.length > 1 ? p : 0];
+        dgemm(transa, transb, m, n, k, alpha, ap, lda, b[p], ldb, beta, cp, ldc);
+      });
+      return c;
+    });
+    dgemm_batch(groups);
+    groups.forEach((group, g) => expect(group.c).toEqual(expected[g]));
+  });
+
+  it('handles empty batches and validates operands', () => {
+    const a = new Float64Array(4);
+    const x = new Float64Array(2);
+    const r = new Float64Array(2).fill(7);
+    ddot_batch(0, [x], 1, [x, x], 1, r);
+    expect(Array.from(r)).toEqual([0, 0]);
+    expect(() => dnrm2_batch_strided(2, new Float64Array(6), 1, 2, r, 3)).toThrow(
+      'r array too small: expected at least 3, got 2'
+    );
+    expect(() => dscal_batch_strided(2, 2, a, 1, 0, 2)).toThrow(
+      'stride of x must be at least 2, got 0'
+    );
+    expect(() =>
+      dgemv_batch(Transpose.NoTranspose, 2, 2, 1, [a], 2, [x], 1, 0, [], 1)
+    ).not.toThrow();
+    expect(() =>
+      dgemv_batch(Transpose.NoTranspose, 2, 2, 1, [a, a], 2, [x], 1, 0, [x, x, x], 1)
+    ).toThrow('a must hold 1 or 3 arrays, got 2');
+    expect(() =>
+      dgemv_batch(Transpose.NoTranspose, 2, 2, 1, [a], 2, [x], 1, 0, [x, new Float64Array(1)], 1)
+    ).toThrow('y[1] array too small');
+    expect(() =>
+      dtrmv_batch_strided(
+        Triangular.Upper,
+        Transpose.NoTranspose,
+        Diagonal.Unit,
+        2,
+        a,
+        2,
+        0,
+        x,
+        1,
+        1,
+        2
+      )
+    ).toThrow('stride of x must be at least 2, got 1');
+    expect(() =>
+      dgemm_batch([
+        {
+          transa: Transpose.NoTranspose,
+          transb: Transpose.NoTranspose,
+          m: 2,
+          n: 2,
+          k: 2,
+          alpha: 1,
+          a: [a],
+          lda: 1,
+          b: [a],
+          ldb: 2,
+          beta: 0,
+          c: [a.slice()],
+          ldc: 2,
+        },
+      ])
+    ).toThrow('groups[0]: lda must be at least 2, got 1');
+    expect(() => dger_batch_strided(2, 2, 1, x, 1, 0, x, 1, 0, a, 2, 4, 2)).toThrow(
+      'a array too small: expected at least 8, got 4'
+    );
+    expect(() =>
+      dsymv_batch_strided(Triangular.Upper, 2, 1, a, 2, 0, x, 1, 0, 0, x, 1, 2, -1)
+    ).toThrow('batch must be a non-negative integer, got -1');
+  });
+});
@@ -193,6 +193,16 @@ describe('DAXPY - Vector Scale and Add', () => {
     expect(y).toEqual(new Float64Array([12, 24]));
   });
 
+  it('should handle mixed-sign and large increments', () => {
+    const n = 3;
+    const x = new Float64Array([1, 0, 0, 2, 0, 0, 3]); // incx = 3
+    const y = new Float64Array([10, 20, 30, 40, 50]); // incy = -2 visits y[4], y[2], y[0]
+
+    daxpy(n, 1, x, 3, y, -2);
+
+    expect(y).toEqual(new Float64Array([13, 20, 32, 40, 51]));
+  });
+
   it('should handle unrolled loop optimization (n >= 4)', () => {
     const n = 8;
     const alpha = 0.5;
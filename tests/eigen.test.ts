@@ -0,0 +1,214 @@
+/**
+ * Tests for the eigensolvers dpower and dlanczos
+ */
+
+import { dlanczos, dpower, initWasm, LinearOperator, Triangular, Which } from '../src/index';
+
+describe('Eigensolvers', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  // The dense n x n matrix of an operator, column-major
+  function toDense(op: LinearOperator): Float64Array {
+    const n = op.n;
+    const d = new Float64Array(n * n);
+    switch (op.kind) {
+      case 'dense':
+        for (let j = 0; j < n; j++) {
+          for (let i = 0; i < n; i++) {
+            d[i + j * n] = op.a[i + j * op.lda];
+          }
+        }
+        break;
+      case 'sparse':
+        for (let i = 0; i < n; i++) {
+          for (let p = op.rowPtr[i]; p < op.rowPtr[i + 1]; p++) {
+            d[i + op.colInd[p] * n] += op.values[p];
+          }
+        }
+        break;
+      default:
+        throw new Error('unsupported');
+    }
+    return d;
+  }
+
+  // The tridiagonal matrix tridiag(-1, 2, -1) of order n in every storage
+  function laplacian(n: number): LinearOperator[] {
+    const dense = new Float64Array(n * n);
+    const bandUpper = new Float64Array(2 * n);
+    const bandLower = new Float64Array(2 * n);
+    const packedUpper = new Float64Array((n * (n + 1)) / 2);
+    const packedLower = new Float64Array((n * (n + 1)) / 2);
+    const rowPtr = new Int32Array(n + 1);
+    const colInd: number[] = [];
+    const values: number[] = [];
+    for (let j = 0; j < n; j++) {
+      dense[j + j * n] = 2;
+      bandUpper[1 + 2 * j] = 2;
+      bandLower[2 * j] = 2;
+      if (j > 0) {
+        dense[j - 1 + j * n] = -1;
+        dense[j + (j - 1) * n] = -1;
+        bandUpper[2 * j] = -1;
+        bandLower[1 + 2 * (j - 1)] = -1;
+      }
+    }
+    let p = 0;
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i <= j; i++) {
+        packedUpper[p++] = dense[i + j * n];
+      }
+    }
+    p = 0;
+    for (let j = 0; j < n; j++) {
+      for (let i = j; i < n; i++) {
+        packedLower[p++] = dense[i + j * n];
+      }
+    }
+    for (let i = 0; i < n; i++) {
+      rowPtr[i] = colInd.length;
+      for (let j = Math.max(0, i - 1); j <= Math.min(n - 1, i + 1); j++) {
+        colInd.push(j);
+        values.push(dense[i + j * n]);
+      }
+    }
+    rowPtr[n] = colInd.length;
+    return [
+      { kind: 'dense', n, a: dense, lda: n },
+      { kind: 'band', n, k: 1, uplo: Triangular.Upper, a: bandUpper, lda: 2 },
+      { kind: 'band', n, k: 1, uplo: Triangular.Lower, a: bandLower, lda: 2 },
+      { kind: 'packed', n, uplo: Triangular.Upper, ap: packedUpper },
+      { kind: 'packed', n, uplo: Triangular.Lower, ap: packedLower },
+      {
+        kind: 'sparse',
+        n,
+        rowPtr,
+        colInd: new Int32Array(colInd),
+        values: new Float64Array(values),
+      },
+    ];
+  }
+
+  // ||A*x - lambda*x|| for the dense n x n matrix A
+  function residual(n: number, a: Float64Array, lambda: number, x: Float64Array): number {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+      let r = -lambda * x[i];
+      for (let j = 0; j < n; j++) {
+        r += a[i + j * n] * x[j];
+      }
+      sum += r * r;
+    }
+    return Math.sqrt(sum);
+  }
+
+  test('dpower finds the PageRank vector of a link graph', () => {
+    // Column-stochastic link matrix of 6 pages, each linking to the next two, as a
+    // sparse matrix and as the dense Google matrix with damping 0.85
+    const n = 6;
+    const rowPtr = new Int32Array(n + 1);
+    const colInd: number[] = [];
+    for (let i = 0; i < n; i++) {
+      // Row i has the links from pages i - 2 and i - 1
+      rowPtr[i] = colInd.length;
+      colInd.push(...[(i + n - 2) % n, (i + n - 1) % n].sort((p, q) => p - q));
+    }
+    rowPtr[n] = colInd.length;
+    const values = new Float64Array(colInd.length).fill(0.5);
+    const sparse: LinearOperator = {
+      kind: 'sparse',
+      n,
+      rowPtr,
+      colInd: new Int32Array(colInd),
+      values,
+    };
+    const google = toDense(sparse).map((v) => 0.85 * v + 0.15 / n);
+    const dense: LinearOperator = { kind: 'dense', n, a: google, lda: n };
+
+    for (const op of [sparse, dense]) {
+      const x = new Float64Array(n).fill(1);
+      const { lambda, converged } = dpower(op, x);
+      expect(converged).toBe(true);
+      expect(lambda).toBeCloseTo(1, 10);
+      expect(residual(n, toDense(op), lambda, x)).toBeLessThan(1e-9);
+      // The graph is symmetric under rotation, so every page has the same rank
+      for (let i = 0; i < n; i++) {
+        expect(x[i]).toBeCloseTo(1 / Math.sqrt(n), 9);
+      }
+    }
+  });
+
+  test('dpower finds a negative dominant eigenvalue and reports non-convergence', () => {
+    // diag(-5, 1, 2) in packed storage
+    const op: LinearOperator = {
+      kind: 'packed',
+      n: 3,
+      uplo: Triangular.Upper,
+      ap: new Float64Array([-5, 0, 1, 0, 0, 2]),
+    };
+    const x = new Float64Array(3);
+    const { lambda, converged } = dpower(op, x);
+    expect(converged).toBe(true);
+    expect(lambda).toBeCloseTo(-5, 12);
+    expect(Math.abs(x[0])).toBeCloseTo(1, 12);
+
+    const y = new Float64Array([1, 1, 1]);
+    expect(dpower(op, y, 2).converged).toBe(false);
+  });
+
+  test('dlanczos computes extreme eigenpairs in every storage', () => {
+    const n = 200;
+    const nev = 4;
+    const ops = laplacian(n);
+    const a = toDense(ops[0]);
+    for (const op of ops) {
+      for (const which of [Which.Largest, Which.Smallest, Which.LargestMagnitude]) {
+        const w = new Float64Array(nev);
+        const z = new Float64Array(n * nev);
+        expect(dlanczos(op, which, nev, w, z, n)).toBe(0);
+
+        for (let i = 0; i < nev; i++) {
+          // The eigenvalues of tridiag(-1, 2, -1) are 2 - 2 cos(k pi / (n + 1))
+          const k = which === Which.Smallest ? i + 1 : n - i;
+          expect(w[i]).toBeCloseTo(2 - 2 * Math.cos((k * Math.PI) / (n + 1)), 10);
+          const zi = z.subarray(i * n, (i + 1) * n);
+          expect(residual(n, a, w[i], zi)).toBeLessThan(1e-8);
+          for (let j = 0; j <= i; j++) {
+            let dot = 0;
+            for (let l = 0; l < n; l++) {
+              dot += zi[l] * z[l + j * n];
+            }
+            expect(Math.abs(dot - (i === j ? 1 : 0))).toBeLessThan(1e-12);
+          }
+        }
+      }
+    }
+  });
+
+  test('dlanczos reports eigenpairs that did not converge', () => {
+    const n = 200;
+    const [op] = laplacian(n);
+    const w = new Float64Array(4);
+    const z = new Float64Array(n * 4);
+    expect(dlanczos(op, Which.Smallest, 4, w, z, n, 8, 0)).toBeGreaterThan(0);
+  });
+
+  test('eigensolvers reject invalid operators and sizes', () => {
+    const op: LinearOperator = {
+      kind: 'sparse',
+      n: 2,
+      rowPtr: new Int32Array([0, 1, 2]),
+      colInd: new Int32Array([0, 2]),
+      values: new Float64Array([1, 1]),
+    };
+    expect(() => dpower(op, new Float64Array(2))).toThrow('colInd[1] out of range');
+
+    const [dense] = laplacian(4);
+    const w = new Float64Array(4);
+    const z = new Float64Array(16);
+    expect(() => dlanczos(dense, Which.Largest, 4, w, z, 4)).toThrow('nev must be');
+    expect(() => dlanczos(dense, Which.Largest, 2, w, z, 4, 2)).toThrow('ncv must be');
+  });
+});
@@ -0,0 +1,267 @@
+/**
+ * Tests for the triangle, side and transpose flags of the symmetric and
+ * triangular Level 2 and 3 routines: every combination against a plain
+ * JavaScript reference
+ */
+
+import {
+  Diagonal,
+  dsymm,
+  dsymv,
+  dsyr,
+  dsyr2,
+  dsyr2k,
+  dsyrk,
+  dtrmm,
+  dtrmv,
+  dtrsm,
+  dtrsv,
+  initWasm,
+  Side,
+  Transpose,
+  Triangular,
+} from '../src/index';
+
+describe('triangle and transpose flags', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  const N = Transpose.NoTranspose;
+  const T = Transpose.Transpose;
+  const triangles = [Triangular.Upper, Triangular.Lower];
+  const transposes = [N, T];
+  const inTriangle = (uplo: Triangular, i: number, j: number) =>
+    uplo === Triangular.Upper ? i <= j : i >= j;
+
+  function random(length: number): Float64Array {
+    const x = new Float64Array(length);
+    for (let i = 0; i < length; i++) {
+      x[i] = Math.round((Math.random() - 0.5) * 200) / 10;
+    }
+    return x;
+  }
+
+  // Dense n x n matrix (ld n) from the `uplo` triangle of a: mirrored for a
+  // symmetric matrix, zero outside the triangle for a triangular one
+  function expand(
+    uplo: Triangular,
+    n: number,
+    a: Float64Array,
+    lda: number,
+    kind: 'symmetric' | Diagonal
+  ): Float64Array {
+    const full = new Float64Array(n * n);
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < n; i++) {
+        if (inTriangle(uplo, i, j)) {
+          full[i + j * n] = a[i + j * lda];
+          if (kind === 'symmetric') full[j + i * n] = a[i + j * lda];
+        }
+      }
+      if (kind === Diagonal.Unit) full[j + j * n] = 1;
+    }
+    return full;
+  }
+
+  // op(A) * op(B) for an m x k op(A) and a k x n op(B), as an m x n matrix (ld m)
+  function multiply(
+    ta: Transpose,
+    tb: Transpose,
+    m: number,
+    n: number,
+    k: number,
+    a: Float64Array,
+    lda: number,
+    b: Float64Array,
+    ldb: number
+  ): Float64Array {
+    const c = new Float64Array(m * n);
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < m; i++) {
+        let sum = 0;
+        for (let l = 0; l < k; l++) {
+          const ail = ta === N ? a[i + l * lda] : a[l + i * lda];
+          const blj = tb === N ? b[l + j * ldb] : b[j + l * ldb];
+          sum += ail * blj;
+        }
+        c[i + j * m] = sum;
+      }
+    }
+    return c;
+  }
+
+  // Compare the m x n matrix c (ld ldc) with expected (ld m), only in the
+  // `triangle` if given; the other elements must equal `before`
+  function expectMatrix(
+    m: number,
+    n: number,
+    c: Float64Array,
+    ldc: number,
+    expected: Float64Array,
+    before?: Float64Array,
+    triangle?: Triangular
+  ) {
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < ldc; i++) {
+        const value = c[i + j * ldc];
+        if (i < m && (triangle === undefined || inTriangle(triangle, i, j))) {
+          expect(value).toBeCloseTo(expected[i + j * m], 8);
+        } else if (before) {
+          expect(value).toBe(before[i + j * ldc]);
+        }
+      }
+    }
+  }
+
+  const n = 5;
+  const lda = n + 2;
+
+  it('dsymv reads the given triangle', () => {
+    for (const uplo of triangles) {
+      const a = random(lda * n);
+      const x = random(2 * n);
+      const y = random(n);
+      const s = expand(uplo, n, a, lda, 'symmetric');
+      const xs = Float64Array.from({ length: n }, (_, i) => x[2 * i]);
+      const expected = multiply(N, N, n, 1, n, s, n, xs, n).map((v, i) => 2 * v + 0.5 * y[i]);
+
+      dsymv(uplo, n, 2, a, lda, x, 2, 0.5, y, 1);
+      expectMatrix(n, 1, y, n, expected);
+    }
+  });
+
+  it('dsyr and dsyr2 update only the given triangle', () => {
+    const a = random(lda * n);
+    const x = random(n);
+    const y = random(n);
+    const expected1 = new Float64Array(n * n);
+    const expected2 = new Float64Array(n * n);
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < n; i++) {
+        expected1[i + j * n] = a[i + j * lda] + 2 * x[i] * x[j];
+        expected2[i + j * n] = a[i + j * lda] + 2 * (x[i] * y[j] + y[i] * x[j]);
+      }
+    }
+
+    for (const uplo of triangles) {
+      const rank1 = a.slice();
+      dsyr(uplo, n, 2, x, 1, rank1, lda);
+      expectMatrix(n, n, rank1, lda, expected1, a, uplo);
+
+      const rank2 = a.slice();
+      dsyr2(uplo, n, 2, x, 1, y, 1, rank2, lda);
+      expectMatrix(n, n, rank2, lda, expected2, a, uplo);
+    }
+  });
+
+  it('dtrmv and dtrsv apply the given triangle, transposed or not', () => {
+    const a = random(lda * n);
+    for (let i = 0; i < n; i++) a[i + i * lda] = 10 + i;
+    for (const uplo of triangles) {
+      for (const trans of transposes) {
+        for (const diag of [Diagonal.NonUnit, Diagonal.Unit]) {
+          const t = expand(uplo, n, a, lda, diag);
+          const x = random(n);
+          const expected = multiply(trans, N, n, 1, n, t, n, x, n);
+
+          const y = x.slice();
+          dtrmv(uplo, trans, diag, n, a, lda, y, 1);
+          expectMatrix(n, 1, y, n, expected);
+
+          // And back, with a non-unit increment
+          const strided = new Float64Array(2 * n);
+          expected.forEach((v, i) => (strided[2 * i] = v));
+          dtrsv(uplo, trans, diag, n, a, lda, strided, 2);
+          for (let i = 0; i < n; i++) {
+            expect(strided[2 * i]).toBeCloseTo(x[i], 8);
+          }
+        }
+      }
+    }
+  });
+
+  it('dsymm reads the given triangle on either side', () => {
+    const m = 4;
+    for (const side of [Side.Left, Side.Right]) {
+      for (const uplo of triangles) {
+        const ka = side === Side.Left ? m : n;
+        const a = random((ka + 1) * ka);
+        const b = random((m + 1) * n);
+        const c = random((m + 1) * n);
+        const s = expand(uplo, ka, a, ka + 1, 'symmetric');
+        const product =
+          side === Side.Left
+            ? multiply(N, N, m, n, m, s, m, b, m + 1)
+            : multiply(N, N, m, n, n, b, m + 1, s, n);
+        const old = (k: number) => c[(k % m) + Math.floor(k / m) * (m + 1)];
+        const expected = product.map((v, k) => 2 * v + 0.5 * old(k));
+
+        const before = c.slice();
+        dsymm(side, uplo, m, n, 2, a, ka + 1, b, m + 1, 0.5, c, m + 1);
+        expectMatrix(m, n, c, m + 1, expected, before);
+      }
+    }
+  });
+
+  it('dsyrk and dsyr2k update the given triangle, transposed or not', () => {
+    const k = 3;
+    for (const trans of transposes) {
+      // op(A) and op(B) are n x k
+      const ld = trans === N ? n + 1 : k + 1;
+      const cols = trans === N ? k : n;
+      const a = random(ld * cols);
+      const b = random(ld * cols);
+      const c = random(lda * n);
+      const other = trans === N ? T : N;
+      const aa = multiply(trans, other, n, n, k, a, ld, a, ld);
+      const ab = multiply(trans, other, n, n, k, a, ld, b, ld);
+      const ba = multiply(trans, other, n, n, k, b, ld, a, ld);
+      const old = (i: number) => c[(i % n) + Math.floor(i / n) * lda];
+
+      for (const uplo of triangles) {
+        const rankk = c.slice();
+        dsyrk(uplo, trans, n, k, 2, a, ld, 0.5, rankk, lda);
+        const expectedk = aa.map((v, i) => 2 * v + 0.5 * old(i));
+        expectMatrix(n, n, rankk, lda, expectedk, c, uplo);
+
+        const rank2k = c.slice();
+        dsyr2k(uplo, trans, n, k, 2, a, ld, b, ld, 0.5, rank2k, lda);
+        const expected2k = ab.map((v, i) => 2 * (v + ba[i]) + 0.5 * old(i));
+        expectMatrix(n, n, rank2k, lda, expected2k, c, uplo);
+      }
+    }
+  });
+
+  it('dtrmm and dtrsm apply the given triangle on either side, transposed or not', () => {
+    const m = 4;
+    for (const side of [Side.Left, Side.Right]) {
+      for (const uplo of triangles) {
+        for (const trans of transposes) {
+          const ka = side === Side.Left ? m : n;
+          const a = random((ka + 1) * ka);
+          for (let i = 0; i < ka; i++) a[i + i * (ka + 1)] = 10 + i;
+          const t = expand(uplo, ka, a, ka + 1, Diagonal.NonUnit);
+          const b = random((m + 1) * n);
+          const product =
+            side === Side.Left
+              ? multiply(trans, N, m, n, m, t, m, b, m + 1)
+              : multiply(N, trans, m, n, n, b, m + 1, t, n);
+          const expected = product.map((v) => 2 * v);
+
+          const before = b.slice();
+          dtrmm(side, uplo, trans, Diagonal.NonUnit, m, n, 2, a, ka + 1, b, m + 1);
+          expectMatrix(m, n, b, m + 1, expected, before);
+
+          // Solving with alpha = 1/2 gives back the original B
+          const original = new Float64Array(m * n);
+          for (let j = 0; j < n; j++) {
+            for (let i = 0; i < m; i++) original[i + j * m] = before[i + j * (m + 1)];
+          }
+          dtrsm(side, uplo, trans, Diagonal.NonUnit, m, n, 0.5, a, ka + 1, b, m + 1);
+          expectMatrix(m, n, b, m + 1, original, before);
+        }
+      }
+    }
+  });
+});
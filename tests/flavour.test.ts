@@ -0,0 +1,30 @@
+/**
+ * Tests for build flavour detection and selection
+ */
+
+import { ddot, detectFlavour, getFlavour, initWasm } from '../src/index';
+
+describe('initWasm flavours', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  test('loads a flavour the engine supports', () => {
+    const order = ['scalar', 'simd', 'relaxed-simd'];
+    expect(order).toContain(getFlavour());
+    expect(order.indexOf(getFlavour())).toBeLessThanOrEqual(order.indexOf(detectFlavour()));
+  });
+
+  test('kernels agree with a reference on long vectors', () => {
+    const n = 1001;
+    const x = new Float64Array(n);
+    const y = new Float64Array(n);
+    let expected = 0;
+    for (let i = 0; i < n; i++) {
+      x[i] = Math.sin(i);
+      y[i] = Math.cos(i);
+      expected += x[i] * y[i];
+    }
+    expect(ddot(n, x, 1, y, 1)).toBeCloseTo(expected, 10);
+  });
+});
@@ -0,0 +1,271 @@
+/**
+ * Tests for GEMM_U8S8S32 and GEMM_U8S8U8 functions
+ */
+
+import { gemm_u8s8s32, gemm_u8s8u8, initWasm, Transpose } from '../src/index';
+
+// Reference int32 product of (op(A) - aZero) * (op(B) - bZero)
+function referenceProduct(
+  transA: boolean,
+  transB: boolean,
+  m: number,
+  n: number,
+  k: number,
+  a: Uint8Array,
+  lda: number,
+  aZero: number,
+  b: Int8Array,
+  ldb: number,
+  bZero: number
+): Int32Array {
+  const c = new Int32Array(m * n);
+  for (let j = 0; j < n; j++) {
+    for (let i = 0; i < m; i++) {
+      let sum = 0;
+      for (let l = 0; l < k; l++) {
+        const av = transA ? a[l + i * lda] : a[i + l * lda];
+        const bv = transB ? b[j + l * ldb] : b[l + j * ldb];
+        sum += (av - aZero) * (bv - bZero);
+      }
+      c[i + j * m] = sum;
+    }
+  }
+  return c;
+}
+
+function randomOperands(m: number, n: number, k: number) {
+  const a = new Uint8Array(m * k);
+  const b = new Int8Array(k * n);
+  for (let i = 0; i < a.length; i++) a[i] = Math.floor(Math.random() * 256);
+  for (let i = 0; i < b.length; i++) b[i] = Math.floor(Math.random() * 256) - 128;
+  return { a, b };
+}
+
+describe('GEMM_U8S8S32 - Quantized Matrix-Matrix Multiplication', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  test('basic operation with zero points', () => {
+    const A = new Uint8Array([129, 131, 130, 132]); // [[1,2], [3,4]] + 128
+    const B = new Int8Array([5, 7, 6, 8]); // [[5,6], [7,8]]
+    const C = new Int32Array(4);
+
+    gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, 2, 2, 2, A, 2, 128, B, 2, 0, C, 2);
+
+    expect(Array.from(C)).toEqual([19, 43, 22, 50]);
+  });
+
+  test('odd k and sizes that are not multiples of the tile', () => {
+    const m = 13,
+      n = 7,
+      k = 21;
+    const { a, b } = randomOperands(m, n, k);
+    const C = new Int32Array(m * n);
+
+    gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, m, n, k, a, m, 100, b, k, -3, C, m);
+
+    const expected = referenceProduct(false, false, m, n, k, a, m, 100, b, k, -3);
+
+    expect(Array.from(C)).toEqual(Array.from(expected));
+  });
+
+  test('transposed operands', () => {
+    const m = 9,
+      n = 6,
+      k = 70;
+    const { a, b } = randomOperands(m, n, k);
+    const C = new Int32Array(m * n);
+
+    gemm_u8s8s32(Transpose.Transpose, Transpose.Transpose, m, n, k, a, k, 7, b, n, 5, C, m);
+
+    const expected = referenceProduct(true, true, m, n, k, a, k, 7, b, n, 5);
+
+    expect(Array.from(C)).toEqual(Array.from(expected));
+  });
+
+  test('larger matrices spanning several packed blocks', () => {
+    const m = 70,
+      n = 67,
+      k = 600;
+    const { a, b } = randomOperands(m, n, k);
+    const C = new Int32Array(m * n);
+
+    gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, m, n, k, a, m, 128, b, k, 0, C, m);
+
+    const expected = referenceProduct(false, false, m, n, k, a, m, 128, b, k, 0);
+
+    expect(Array.from(C)).toEqual(Array.from(expected));
+  });
+
+  test('leading dimension padding is preserved', () => {
+    const A = new Uint8Array([1, 2, 3, 4]);
+    const B = new Int8Array([1, 1]);
+    const C = new Int32Array([0, 0, -1, 0, 0, -1]); // ldc = 3, padding row holds -1
+
+    gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, 2, 1, 2, A, 2, 0, B, 2, 0, C, 3);
+
+    expect(C[0]).toBe(4);
+    expect(C[1]).toBe(6);
+    expect(C[2]).toBe(-1);
+  });
+
+  test('error handling', () => {
+    const A = new Uint8Array(4);
+    const B = new Int8Array(4);
+    const C = new Int32Array(4);
+
+    expect(() =>
+      gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, -1, 2, 2, A, 2, 0, B, 2, 0, C, 2)
+    ).toThrow('m, n, and k must be non-negative');
+    expect(() =>
+      gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, 2, 2, 2, A, 2, 256, B, 2, 0, C, 2)
+    ).toThrow('aZero must be an integer in [0, 255]');
+    expect(() =>
+      gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, 2, 2, 2, A, 2, 0, B, 2, 128, C, 2)
+    ).toThrow('bZero must be an integer in [-128, 127]');
+    expect(() =>
+      gemm_u8s8s32(Transpose.NoTranspose, Transpose.NoTranspose, 3, 2, 2, A, 3, 0, B, 2, 0, C, 3)
+    ).toThrow('a array too small');
+  });
+});
+
+describe('GEMM_U8S8U8 - Quantized Matrix-Matrix Multiplication with Requantization', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  test('per-tensor scale rounds half to even and adds the output zero point', () => {
+    const A = new Uint8Array([129, 131, 130, 132]);
+    const B = new Int8Array([5, 7, 6, 8]);
+    const C = new Uint8Array(4);
+
+    gemm_u8s8u8(
+      Transpose.NoTranspose,
+      Transpose.NoTranspose,
+      2,
+      2,
+      2,
+      A,
+      2,
+      128,
+      B,
+      2,
+      0,
+      null,
+      new Float32Array([0.5]),
+      10,
+      C,
+      2
+    );
+
+    // [[19,22], [43,50]] * 0.5 = [[9.5,11], [21.5,25]] -> [[10,11], [22,25]] + 10
+    expect(Array.from(C)).toEqual([20, 32, 21, 35]);
+  });
+
+  test('per-channel scales and bias with saturation', () => {
+    const m = 11,
+      n = 5,
+      k = 33;
+    const { a, b } = randomOperands(m, n, k);
+    const bias = new Int32Array([0, 1000, -1000, 50, -7]);
+    const scale = new Float32Array([0.001, 0.002, 0.0005, 1.0, 0.01]);
+    const C = new Uint8Array(m * n);
+
+    gemm_u8s8u8(
+      Transpose.NoTranspose,
+      Transpose.NoTranspose,
+      m,
+      n,
+      k,
+      a,
+      m,
+      128,
+      b,
+      k,
+      0,
+      bias,
+      scale,
+      128,
+      C,
+      m
+    );
+
+    const acc = referenceProduct(false, false, m, n, k, a, m, 128, b, k, 0);
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < m; i++) {
+        const q = Math.fround(Math.fround(acc[i + j * m] + bias[j]) * scale[j]);
+        const expected = Math.min(255, Math.max(0, Math.round(q) + 128));
+        // Allow for round-half-even differences on exact ties
+        expect(Math.abs(C[i + j * m] - expected)).toBeLessThanOrEqual(1);
+      }
+    }
+  });
+
+  test('error handling', () => {
+    const A = new Uint8Array(4);
+    const B = new Int8Array(4);
+    const C = new Uint8Array(4);
+
+    expect(() =>
+      gemm_u8s8u8(
+        Transpose.NoTranspose,
+        Transpose.NoTranspose,
+        2,
+        2,
+        2,
+        A,
+        2,
+        0,
+        B,
+        2,
+        0,
+        null,
+        new Float32Array(3),
+        0,
+        C,
+        2
+      )
+    ).not.toThrow();
+    expect(() =>
+      gemm_u8s8u8(
+        Transpose.NoTranspose,
+        Transpose.NoTranspose,
+        2,
+        3,
+        2,
+        A,
+        2,
+        0,
+        new Int8Array(6),
+        2,
+        0,
+        null,
+        new Float32Array(2),
+        0,
+        new Uint8Array(6),
+        2
+      )
+    ).toThrow('scale must have 1 or at least 3 elements');
+    expect(() =>
+      gemm_u8s8u8(
+        Transpose.NoTranspose,
+        Transpose.NoTranspose,
+        2,
+        2,
+        2,
+        A,
+        2,
+        0,
+        B,
+        2,
+        0,
+        new Int32Array(1),
+        new Float32Array([1]),
+        0,
+        C,
+        2
+      )
+    ).toThrow('bias array too small');
+  });
+});
@@ -0,0 +1,184 @@
+/**
+ * Tests for bfloat16 / fp16 conversions and 16-bit storage GEMM/GEMV
+ */
+
+import {
+  dbf16tod,
+  df16tod,
+  initWasm,
+  sbf16tos,
+  sbgemm,
+  sbgemv,
+  sbstobf16,
+  shdtof16,
+  shf16tos,
+  shgemm,
+  shgemv,
+  shstof16,
+  Transpose,
+} from '../src/index';
+
+describe('16-bit conversions', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  test('float to bfloat16 rounds to nearest even', () => {
+    const x = new Float32Array([1, -2, 3.14159, 0, Infinity, 1 + 2 ** -8, 1 + 3 * 2 ** -8]);
+    const y = new Uint16Array(x.length);
+
+    sbstobf16(x.length, x, 1, y, 1);
+
+    expect(y[0]).toBe(0x3f80);
+    expect(y[1]).toBe(0xc000);
+    expect(y[2]).toBe(0x4049);
+    expect(y[3]).toBe(0x0000);
+    expect(y[4]).toBe(0x7f80);
+    expect(y[5]).toBe(0x3f80); // tie rounds down to even
+    expect(y[6]).toBe(0x3f82); // tie rounds up to even
+  });
+
+  test('float to fp16 handles overflow, subnormals and NaN', () => {
+    const x = new Float32Array([1, -0.5, 65504, 65520, 2 ** -24, NaN, 0.1]);
+    const y = new Uint16Array(x.length);
+
+    shstof16(x.length, x, 1, y, 1);
+
+    expect(y[0]).toBe(0x3c00);
+    expect(y[1]).toBe(0xb800);
+    expect(y[2]).toBe(0x7bff); // largest finite fp16
+    expect(y[3]).toBe(0x7c00); // overflows to +Infinity
+    expect(y[4]).toBe(0x0001); // smallest subnormal
+    expect(y[5] & 0x7c00).toBe(0x7c00);
+    expect(y[5] & 0x03ff).not.toBe(0);
+    expect(y[6]).toBe(0x2e66);
+  });
+
+  test('round trip through bfloat16 and fp16 (long vectors use the vector path)', () => {
+    const n = 1003;
+    const x = new Float32Array(n);
+    for (let i = 0; i < n; i++) x[i] = Math.sin(i) * 100;
+
+    const bf = new Uint16Array(n);
+    const hf = new Uint16Array(n);
+    const xb = new Float32Array(n);
+    const xh = new Float32Array(n);
+    sbstobf16(n, x, 1, bf, 1);
+    sbf16tos(n, bf, 1, xb, 1);
+    shstof16(n, x, 1, hf, 1);
+    shf16tos(n, hf, 1, xh, 1);
+
+    for (let i = 0; i < n; i++) {
+      expect(Math.abs(xb[i] - x[i])).toBeLessThanOrEqual(Math.abs(x[i]) * 2 ** -8);
+      expect(Math.abs(xh[i] - x[i])).toBeLessThanOrEqual(Math.abs(x[i]) * 2 ** -11);
+    }
+  });
+
+  test('double precision conversions with strides', () => {
+    const x = new Float64Array([1.5, 99, -0.25, 99, 1024]);
+    const h = new Uint16Array(3);
+    const back = new Float64Array(3);
+
+    shdtof16(3, x, 2, h, 1);
+    df16tod(3, h, 1, back, 1);
+    expect(Array.from(back)).toEqual([1.5, -0.25, 1024]);
+
+    const bf = new Uint16Array([0x3f80, 0xc040]);
+    const d = new Float64Array(2);
+    dbf16tod(2, bf, 1, d, -1);
+    expect(Array.from(d)).toEqual([-3, 1]);
+  });
+
+  test('error handling', () => {
+    expect(() => sbstobf16(-1, new Float32Array(1), 1, new Uint16Array(1), 1)).toThrow(
+      'n must be non-negative'
+    );
+    expect(() => sbstobf16(3, new Float32Array(2), 1, new Uint16Array(3), 1)).toThrow(
+      'x array too small'
+    );
+  });
+});
+
+describe('SBGEMM / SHGEMM - 16-bit storage matrix-matrix multiplication', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  test('bfloat16 basic operation', () => {
+    const A = new Uint16Array(4);
+    const B = new Uint16Array(4);
+    sbstobf16(4, new Float32Array([1, 3, 2, 4]), 1, A, 1);
+    sbstobf16(4, new Float32Array([5, 7, 6, 8]), 1, B, 1);
+    const C = new Float32Array([1, 1, 1, 1]);
+
+    sbgemm(Transpose.NoTranspose, Transpose.NoTranspose, 2, 2, 2, 1.0, A, 2, B, 2, 2.0, C, 2);
+
+    expect(Array.from(C)).toEqual([21, 45, 24, 52]);
+  });
+
+  test('fp16 transposed operands match a float reference', () => {
+    const m = 37,
+      n = 21,
+      k = 300;
+    const af = new Float32Array(k * m);
+    const bf = new Float32Array(n * k);
+    for (let i = 0; i < af.length; i++) af[i] = Math.cos(i) * 0.5;
+    for (let i = 0; i < bf.length; i++) bf[i] = Math.sin(i) * 0.5;
+
+    const A = new Uint16Array(af.length);
+    const B = new Uint16Array(bf.length);
+    shstof16(af.length, af, 1, A, 1);
+    shstof16(bf.length, bf, 1, B, 1);
+    shf16tos(af.length, A, 1, af, 1);
+    shf16tos(bf.length, B, 1, bf, 1);
+
+    const C = new Float32Array(m * n);
+    shgemm(Transpose.Transpose, Transpose.Transpose, m, n, k, 1.0, A, k, B, n, 0.0, C, m);
+
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < m; i++) {
+        let sum = 0;
+        for (let l = 0; l < k; l++) sum += af[l + i * k] * bf[j + l * n];
+        expect(C[i + j * m]).toBeCloseTo(sum, 3);
+      }
+    }
+  });
+});
+
+describe('SBGEMV / SHGEMV - 16-bit storage matrix-vector multiplication', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  test('bfloat16 no transpose', () => {
+    const A = new Uint16Array(4);
+    const x = new Uint16Array(2);
+    sbstobf16(4, new Float32Array([1, 3, 2, 4]), 1, A, 1);
+    sbstobf16(2, new Float32Array([1, 1]), 1, x, 1);
+    const y = new Float32Array([10, 10]);
+
+    sbgemv(Transpose.NoTranspose, 2, 2, 1.0, A, 2, x, 1, 0.5, y, 1);
+
+    expect(Array.from(y)).toEqual([8, 12]);
+  });
+
+  test('fp16 transpose with a long column', () => {
+    const m = 77,
+      n = 3;
+    const af = new Float32Array(m * n);
+    for (let i = 0; i < af.length; i++) af[i] = (i % 7) - 3;
+    const A = new Uint16Array(af.length);
+    const x = new Uint16Array(m);
+    shstof16(af.length, af, 1, A, 1);
+    shstof16(m, new Float32Array(m).fill(1), 1, x, 1);
+    const y = new Float32Array(n);
+
+    shgemv(Transpose.Transpose, m, n, 1.0, A, m, x, 1, 0.0, y, 1);
+
+    for (let j = 0; j < n; j++) {
+      let sum = 0;
+      for (let i = 0; i < m; i++) sum += af[i + j * m];
+      expect(y[j]).toBeCloseTo(sum);
+    }
+  });
+});
@@ -0,0 +1,141 @@
+/**
+ * Tests for the Kronecker product routines dkronmv and dkronsv
+ */
+
+import { dkronmv, dkronsv, initWasm, KronFactor, Transpose } from '../src/index';
+
+describe('Kronecker products', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  // Deterministic m x n factor with leading dimension lda
+  function factor(m: number, n: number, lda: number, seed: number): KronFactor {
+    const a = new Float64Array(lda * n);
+    let s = seed;
+    for (let i = 0; i < a.length; i++) {
+      s = (s * 16807) % 2147483647;
+      a[i] = s / 2147483647 - 0.5;
+    }
+    // Diagonally dominant when square, so the solves are well conditioned
+    if (m === n) {
+      for (let i = 0; i < n; i++) {
+        a[i + i * lda] += n;
+      }
+    }
+    return { m, n, a, lda };
+  }
+
+  // The explicit Kronecker product as a dense column-major matrix
+  function explicit(factors: KronFactor[]): { rows: number; cols: number; k: Float64Array } {
+    let rows = 1;
+    let cols = 1;
+    let k = new Float64Array([1]);
+    for (const f of factors) {
+      const next = new Float64Array(rows * f.m * cols * f.n);
+      const ld = rows * f.m;
+      for (let j = 0; j < cols; j++) {
+        for (let i = 0; i < rows; i++) {
+          for (let q = 0; q < f.n; q++) {
+            for (let p = 0; p < f.m; p++) {
+              next[i * f.m + p + (j * f.n + q) * ld] = k[i + j * rows] * f.a[p + q * f.lda];
+            }
+          }
+        }
+      }
+      rows *= f.m;
+      cols *= f.n;
+      k = next;
+    }
+    return { rows, cols, k };
+  }
+
+  function vector(n: number, seed: number): Float64Array {
+    return Float64Array.from({ length: n }, (_, i) => Math.sin(seed + i));
+  }
+
+  test('dkronmv matches the example', () => {
+    const A = { m: 2, n: 2, a: new Float64Array([1, 3, 2, 4]), lda: 2 };
+    const B = { m: 2, n: 2, a: new Float64Array([0, 1, 1, 0]), lda: 2 };
+    const y = new Float64Array(4);
+    dkronmv(Transpose.NoTranspose, [A, B], 1.0, new Float64Array([1, 2, 3, 4]), 0.0, y);
+    expect(Array.from(y)).toEqual([10, 7, 22, 15]);
+  });
+
+  test('dkronmv matches the explicit product', () => {
+    const shapes = [
+      [[3, 4]],
+      [
+        [2, 3],
+        [4, 2],
+      ],
+      [
+        [3, 2],
+        [1, 4],
+        [2, 3],
+      ],
+      [
+        [2, 2],
+        [3, 3],
+        [2, 2],
+        [3, 3],
+      ],
+    ];
+    for (const dims of shapes) {
+      const factors = dims.map(([m, n], k) => factor(m, n, m + (k % 2), k + 1));
+      const { rows, cols, k } = explicit(factors);
+
+      for (const trans of [Transpose.NoTranspose, Transpose.Transpose]) {
+        const notrans = trans === Transpose.NoTranspose;
+        const xLength = notrans ? cols : rows;
+        const yLength = notrans ? rows : cols;
+        const x = vector(xLength, 1);
+        const y = vector(yLength, 2);
+        const expected = Float64Array.from(y, (yi, i) => {
+          let sum = 0;
+          for (let j = 0; j < xLength; j++) {
+            sum += (notrans ? k[i + j * rows] : k[j + i * rows]) * x[j];
+          }
+          return 2 * sum - yi;
+        });
+
+        dkronmv(trans, factors, 2, x, -1, y);
+        for (let i = 0; i < yLength; i++) {
+          expect(y[i]).toBeCloseTo(expected[i], 12);
+        }
+      }
+    }
+  });
+
+  test('dkronsv inverts dkronmv', () => {
+    const factors = [factor(3, 3, 4, 1), factor(5, 5, 5, 2), factor(4, 4, 6, 3)];
+    for (const trans of [Transpose.NoTranspose, Transpose.Transpose]) {
+      const x = vector(60, 3);
+      const b = new Float64Array(60);
+      dkronmv(trans, factors, 1, x, 0, b);
+
+      expect(dkronsv(trans, factors, b)).toBe(0);
+      for (let i = 0; i < 60; i++) {
+        expect(b[i]).toBeCloseTo(x[i], 12);
+      }
+    }
+  });
+
+  test('dkronsv reports a singular factor and leaves b unchanged', () => {
+    const singular = { m: 2, n: 2, a: new Float64Array([1, 2, 2, 4]), lda: 2 };
+    const b = vector(6, 4);
+    const copy = b.slice();
+    expect(dkronsv(Transpose.NoTranspose, [factor(3, 3, 3, 1), singular], b)).toBe(2);
+    expect(Array.from(b)).toEqual(Array.from(copy));
+  });
+
+  test('validates the factors', () => {
+    const y = new Float64Array(4);
+    expect(() => dkronmv(Transpose.NoTranspose, [], 1, y, 0, y)).toThrow(
+      'at least one factor is required'
+    );
+    expect(() => dkronsv(Transpose.NoTranspose, [factor(2, 3, 2, 1)], y)).toThrow(
+      'factors[0] must be square, got 2x3'
+    );
+  });
+});
@@ -0,0 +1,411 @@
+/**
+ * Tests for the LAPACK routines dgetrf, dgetrs, dgetri, dtrtri, dpotrf and dpotri, the QR
+ * factorization dgeqrf and dormqr and the least squares drivers dgels and dgels_normal
+ */
+
+import {
+  Diagonal,
+  dgels,
+  dgels_normal,
+  dgeqrf,
+  dgetrf,
+  dgetri,
+  dgetrs,
+  dormqr,
+  dpotrf,
+  dpotri,
+  dtrtri,
+  initWasm,
+  Side,
+  Transpose,
+  Triangular,
+} from '../src/index';
+
+describe('LAPACK routines', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  // Deterministic m x n column-major matrix with leading dimension ld
+  function random(m: number, n: number, ld: number, seed: number): Float64Array {
+    const a = new Float64Array(ld * n);
+    let s = seed;
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < m; i++) {
+        s = (s * 16807) % 2147483647;
+        a[i + j * ld] = s / 2147483647 - 0.5;
+      }
+    }
+    return a;
+  }
+
+  // P * L * U from the output of dgetrf, as an m x n matrix with leading dimension m
+  function reconstruct(m: number, n: number, lu: Float64Array, lda: number, ipiv: Int32Array) {
+    const mn = Math.min(m, n);
+    const r = new Float64Array(m * n);
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < m; i++) {
+        let sum = 0;
+        for (let k = 0; k <= Math.min(i, j, mn - 1); k++) {
+          const l = k === i ? 1 : lu[i + k * lda];
+          sum += l * lu[k + j * lda];
+        }
+        r[i + j * m] = sum;
+      }
+    }
+    for (let i = mn - 1; i >= 0; i--) {
+      const p = ipiv[i] - 1;
+      for (let j = 0; j < n; j++) {
+        const t = r[i + j * m];
+        r[i + j * m] = r[p + j * m];
+        r[p + j * m] = t;
+      }
+    }
+    return r;
+  }
+
+  test('dgetrf factors a small matrix with partial pivoting', () => {
+    const a = new Float64Array([1, 4, 2, 3]);
+    const ipiv = new Int32Array(2);
+    expect(dgetrf(2, 2, a, 2, ipiv)).toBe(0);
+    expect(Array.from(ipiv)).toEqual([2, 2]);
+    expect(Array.from(a)).toEqual([4, 0.25, 3, 1.25]);
+  });
+
+  test('dgetrf reproduces square, tall and wide matrices as P*L*U', () => {
+    const shapes = [
+      [5, 5],
+      [100, 100],
+      [150, 70],
+      [70, 150],
+    ];
+    for (const [m, n] of shapes) {
+      const lda = m + 3;
+      const a = random(m, n, lda, m * 31 + n);
+      const lu = a.slice();
+      const ipiv = new Int32Array(Math.min(m, n));
+      expect(dgetrf(m, n, lu, lda, ipiv)).toBe(0);
+
+      // Padding rows are untouched
+      expect(lu[m]).toBe(a[m]);
+
+      const r = reconstruct(m, n, lu, lda, ipiv);
+      for (let j = 0; j < n; j++) {
+        for (let i = 0; i < m; i++) {
+          expect(r[i + j * m]).toBeCloseTo(a[i + j * lda], 10);
+        }
+      }
+    }
+  });
+
+  test('dgetrf reports an exactly singular U', () => {
+    const a = new Float64Array([1, 2, 2, 4]);
+    const ipiv = new Int32Array(2);
+    expect(dgetrf(2, 2, a, 2, ipiv)).toBe(2);
+  });
+
+  test('dgetrs solves op(A)*X = B', () => {
+    const n = 90;
+    const nrhs = 3;
+    const a = random(n, n, n, 7);
+    const x = random(n, nrhs, n, 11);
+    const ipiv = new Int32Array(n);
+    const lu = a.slice();
+    expect(dgetrf(n, n, lu, n, ipiv)).toBe(0);
+
+    for (const trans of [Transpose.NoTranspose, Transpose.Transpose]) {
+      // B = op(A) * X, with ldb = n + 1
+      const ldb = n + 1;
+      const b = new Float64Array(ldb * nrhs);
+      for (let c = 0; c < nrhs; c++) {
+        for (let i = 0; i < n; i++) {
+          let sum = 0;
+          for (let k = 0; k < n; k++) {
+            const aik = trans === Transpose.NoTranspose ? a[i + k * n] : a[k + i * n];
+            sum += aik * x[k + c * n];
+          }
+          b[i + c * ldb] = sum;
+        }
+      }
+
+      dgetrs(trans, n, nrhs, lu, n, ipiv, b, ldb);
+      for (let c = 0; c < nrhs; c++) {
+        for (let i = 0; i < n; i++) {
+          expect(b[i + c * ldb]).toBeCloseTo(x[i + c * n], 8);
+        }
+      }
+    }
+  });
+
+  test('dgetrs rejects pivot indices out of range', () => {
+    const a = new Float64Array([4, 0.25, 3, 1.25]);
+    const b = new Float64Array(2);
+    expect(() => dgetrs(Transpose.NoTranspose, 2, 1, a, 2, new Int32Array([0, 2]), b, 2)).toThrow(
+      'ipiv[0] must be between 1 and 2'
+    );
+  });
+
+  // Largest |A*B - I| for n x n matrices with leading dimensions lda and ldb
+  function identityError(n: number, a: Float64Array, lda: number, b: Float64Array, ldb: number) {
+    let err = 0;
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < n; i++) {
+        let sum = 0;
+        for (let k = 0; k < n; k++) {
+          sum += a[i + k * lda] * b[k + j * ldb];
+        }
+        err = Math.max(err, Math.abs(sum - (i === j ? 1 : 0)));
+      }
+    }
+    return err;
+  }
+
+  test('dgetri inverts a general matrix', () => {
+    for (const n of [2, 70, 130]) {
+      const lda = n + 1;
+      const a = random(n, n, lda, n);
+      const inv = a.slice();
+      const ipiv = new Int32Array(n);
+      expect(dgetrf(n, n, inv, lda, ipiv)).toBe(0);
+      expect(dgetri(n, inv, lda, ipiv)).toBe(0);
+      expect(identityError(n, a, lda, inv, lda)).toBeLessThan(1e-10);
+    }
+  });
+
+  test('dgetri reports a singular matrix and leaves A unchanged', () => {
+    const a = new Float64Array([1, 2, 2, 4]);
+    const ipiv = new Int32Array(2);
+    expect(dgetrf(2, 2, a, 2, ipiv)).toBe(2);
+    const lu = a.slice();
+    expect(dgetri(2, a, 2, ipiv)).toBe(2);
+    expect(Array.from(a)).toEqual(Array.from(lu));
+  });
+
+  test('dtrtri inverts a triangle and keeps the other one', () => {
+    const n = 100;
+    for (const uplo of [Triangular.Upper, Triangular.Lower]) {
+      for (const diag of [Diagonal.NonUnit, Diagonal.Unit]) {
+        // Well conditioned triangle; the other triangle holds -7
+        const a = random(n, n, n, 5);
+        for (let j = 0; j < n; j++) {
+          for (let i = 0; i < n; i++) {
+            const inside = uplo === Triangular.Upper ? i <= j : i >= j;
+            a[i + j * n] = !inside ? -7 : i === j ? 2 : a[i + j * n] / n;
+          }
+        }
+        const inv = a.slice();
+        expect(dtrtri(uplo, diag, n, inv, n)).toBe(0);
+
+        // The full triangular matrices, with the unit diagonal filled in
+        const full = (m: Float64Array) =>
+          m.map((v, k) => {
+            const i = k % n;
+            const j = Math.floor(k / n);
+            const inside = uplo === Triangular.Upper ? i <= j : i >= j;
+            return !inside ? 0 : i === j && diag === Diagonal.Unit ? 1 : v;
+          });
+        expect(identityError(n, full(a), n, full(inv), n)).toBeLessThan(1e-12);
+        for (let k = 0; k < n * n; k++) {
+          if (a[k] === -7) {
+            expect(inv[k]).toBe(-7);
+          }
+        }
+      }
+    }
+  });
+
+  test('dtrtri reports a zero on the diagonal', () => {
+    const a = new Float64Array([2, 0, 1, 0]);
+    expect(dtrtri(Triangular.Upper, Diagonal.NonUnit, 2, a, 2)).toBe(2);
+    expect(Array.from(a)).toEqual([2, 0, 1, 0]);
+  });
+
+  test('dpotrf and dpotri invert a symmetric positive definite matrix', () => {
+    for (const n of [3, 100]) {
+      // A = B*B^T + n*I
+      const b = random(n, n, n, 9);
+      const a = new Float64Array(n * n);
+      for (let j = 0; j < n; j++) {
+        for (let i = 0; i < n; i++) {
+          let sum = i === j ? n : 0;
+          for (let k = 0; k < n; k++) {
+            sum += b[i + k * n] * b[j + k * n];
+          }
+          a[i + j * n] = sum;
+        }
+      }
+
+      for (const uplo of [Triangular.Upper, Triangular.Lower]) {
+        const c = a.slice();
+        expect(dpotrf(uplo, n, c, n)).toBe(0);
+        expect(dpotri(uplo, n, c, n)).toBe(0);
+
+        // Mirror the computed triangle to the full inverse
+        const inv = new Float64Array(n * n);
+        for (let j = 0; j < n; j++) {
+          for (let i = 0; i < n; i++) {
+            const upper = uplo === Triangular.Upper;
+            inv[i + j * n] = (upper ? i <= j : i >= j) ? c[i + j * n] : c[j + i * n];
+          }
+        }
+        expect(identityError(n, a, n, inv, n)).toBeLessThan(1e-12);
+      }
+    }
+  });
+
+  test('dpotrf reports a matrix that is not positive definite', () => {
+    const a = new Float64Array([1, 2, 2, 1]);
+    expect(dpotrf(Triangular.Lower, 2, a, 2)).toBe(2);
+  });
+
+  // op(A) * x - b, with op(A) = A (m x n) or A^T
+  function residual(
+    trans: boolean,
+    m: number,
+    n: number,
+    a: Float64Array,
+    x: Float64Array,
+    b: Float64Array
+  ): Float64Array {
+    const rows = trans ? n : m;
+    const cols = trans ? m : n;
+    const r = new Float64Array(rows);
+    for (let i = 0; i < rows; i++) {
+      let sum = -b[i];
+      for (let k = 0; k < cols; k++) {
+        sum += (trans ? a[k + i * m] : a[i + k * m]) * x[k];
+      }
+      r[i] = sum;
+    }
+    return r;
+  }
+
+  test('dgeqrf and dormqr reproduce A as Q*R', () => {
+    for (const [m, n] of [
+      [5, 3],
+      [4, 4],
+      [3, 5],
+      [90, 70],
+    ]) {
+      const a = random(m, n, m, 17);
+      const qr = a.slice();
+      const tau = new Float64Array(Math.min(m, n));
+      dgeqrf(m, n, qr, m, tau);
+
+      // C = R, then C = Q*C
+      const c = new Float64Array(m * n);
+      for (let j = 0; j < n; j++) {
+        for (let i = 0; i <= Math.min(j, m - 1); i++) {
+          c[i + j * m] = qr[i + j * m];
+        }
+      }
+      dormqr(Side.Left, Transpose.NoTranspose, m, n, tau.length, qr, m, tau, c, m);
+      let err = 0;
+      for (let i = 0; i < m * n; i++) {
+        err = Math.max(err, Math.abs(c[i] - a[i]));
+      }
+      expect(err).toBeLessThan(1e-13);
+
+      // A^T * Q * Q^T = A^T from the right
+      const at = new Float64Array(n * m);
+      for (let j = 0; j < n; j++) {
+        for (let i = 0; i < m; i++) {
+          at[j + i * n] = a[i + j * m];
+        }
+      }
+      const d = at.slice();
+      dormqr(Side.Right, Transpose.NoTranspose, n, m, tau.length, qr, m, tau, d, n);
+      dormqr(Side.Right, Transpose.Transpose, n, m, tau.length, qr, m, tau, d, n);
+      err = 0;
+      for (let i = 0; i < m * n; i++) {
+        err = Math.max(err, Math.abs(d[i] - at[i]));
+      }
+      expect(err).toBeLessThan(1e-13);
+    }
+  });
+
+  test('dgels solves least squares and minimum norm problems', () => {
+    for (const [m, n] of [
+      [8, 5],
+      [5, 8],
+      [100, 40],
+      [40, 100],
+    ]) {
+      const a = random(m, n, m, 23);
+      const ldb = Math.max(m, n);
+      for (const trans of [false, true]) {
+        const rows = trans ? n : m;
+        const cols = trans ? m : n;
+        const b = random(rows, 2, ldb, 29);
+        const x = b.slice();
+        const f = a.slice();
+        const op = trans ? Transpose.Transpose : Transpose.NoTranspose;
+        expect(dgels(op, m, n, 2, f, m, x, ldb)).toBe(0);
+
+        for (let j = 0; j < 2; j++) {
+          const xj = x.subarray(j * ldb, j * ldb + cols);
+          const r = residual(trans, m, n, a, xj, b.subarray(j * ldb));
+          if (rows >= cols) {
+            // Least squares: the residual is orthogonal to the range of op(A)
+            const g = residual(!trans, m, n, a, r, new Float64Array(cols));
+            expect(Math.max(...g.map(Math.abs))).toBeLessThan(1e-12);
+          } else {
+            // Minimum norm: op(A)*x = b and x is in the range of op(A)^T
+            expect(Math.max(...r.map(Math.abs))).toBeLessThan(1e-12);
+            const y = new Float64Array(ldb);
+            y.set(xj);
+            const back = trans ? Transpose.NoTranspose : Transpose.Transpose;
+            expect(dgels(back, m, n, 1, a.slice(), m, y, ldb)).toBe(0);
+            const p = residual(!trans, m, n, a, y, xj);
+            expect(Math.max(...p.map(Math.abs))).toBeLessThan(1e-12);
+          }
+        }
+      }
+    }
+  });
+
+  test('dgels reports a rank deficient matrix', () => {
+    // The second column is zero
+    const a = new Float64Array([1, 2, 3, 0, 0, 0]);
+    const b = new Float64Array([1, 2, 3]);
+    expect(dgels(Transpose.NoTranspose, 3, 2, 1, a, 3, b, 3)).toBe(2);
+  });
+
+  test('dgels_normal agrees with dgels and falls back on ill-conditioned problems', () => {
+    for (const scale of [1, 1e-7]) {
+      const m = 60;
+      const n = 20;
+      // The last column is the first plus a perturbation of size scale
+      const a = random(m, n, m, 31);
+      for (let i = 0; i < m; i++) {
+        a[i + (n - 1) * m] = a[i] + scale * a[i + (n - 1) * m];
+      }
+      const b = random(m, 3, m, 37);
+
+      const x = b.slice();
+      dgels(Transpose.NoTranspose, m, n, 3, a.slice(), m, x, m);
+      const y = b.slice();
+      const f = a.slice();
+      expect(dgels_normal(m, n, 3, f, m, y, m)).toBe(0);
+
+      let err = 0;
+      let norm = 0;
+      for (let j = 0; j < 3; j++) {
+        for (let i = 0; i < n; i++) {
+          err = Math.max(err, Math.abs(x[i + j * m] - y[i + j * m]));
+          norm = Math.max(norm, Math.abs(x[i + j * m]));
+        }
+      }
+      expect(err / norm).toBeLessThan(1e-10);
+
+      // A is only overwritten when the normal equations are not used
+      expect(f.every((v, i) => v === a[i])).toBe(scale === 1);
+    }
+  });
+
+  test('dgels_normal rejects wide matrices', () => {
+    const a = new Float64Array(6);
+    const b = new Float64Array(3);
+    expect(() => dgels_normal(2, 3, 1, a, 2, b, 3)).toThrow('n must be at most m');
+  });
+});
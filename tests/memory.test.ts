@@ -0,0 +1,202 @@
+/**
+ * Tests for heap telemetry and the memory budget
+ */
+
+import {
+  allocMatrix,
+  ddot,
+  dgels,
+  dgemm,
+  dgetri,
+  dkronmv,
+  dkronsv,
+  dlanczos,
+  dpower,
+  getHeapStats,
+  HEAP_ALIGNMENT,
+  initWasm,
+  paddedLd,
+  raw,
+  resetHeapStats,
+  setMemoryBudget,
+  Transpose,
+  Triangular,
+  Which,
+} from '../src/index';
+
+function random(n: number): Float64Array {
+  return Float64Array.from({ length: n }, (_, i) => Math.sin(i * 1.7));
+}
+
+describe('heap telemetry and memory budget', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  afterEach(() => {
+    setMemoryBudget(null);
+  });
+
+  test('tracks the high-water mark of allocations', () => {
+    resetHeapStats();
+    ddot(1000, random(1000), 1, random(1000), 1);
+
+    const stats = getHeapStats();
+    expect(stats.inUseBytes).toBe(0);
+    expect(stats.peakBytes).toBeGreaterThanOrEqual(16000);
+    expect(stats.allocations).toBe(2);
+    expect(stats.heapBytes).toBeGreaterThan(0);
+  });
+
+  test('copies only the elements of strided operands', () => {
+    resetHeapStats();
+    const x = random(1000);
+    const used = x.filter((_, i) => i % 10 === 0);
+    const reversed = used.slice().reverse();
+    const expected = used.reduce((sum, v, i) => sum + v * reversed[i], 0);
+
+    expect(ddot(100, x, 10, x, -10)).toBeCloseTo(expected, 12);
+    expect(getHeapStats().peakBytes).toBe(1600);
+  });
+
+  test('dgemm runs tiled within the budget with the same result', () => {
+    const m = 37;
+    const n = 23;
+    const k = 51;
+    const a = random(k * m);
+    const b = random(k * n);
+    const expected = random(m * n);
+    const tiled = expected.slice();
+
+    dgemm(Transpose.Transpose, Transpose.NoTranspose, m, n, k, 1.5, a, k, b, k, 0.5, expected, m);
+
+    resetHeapStats();
+    setMemoryBudget(4096);
+    dgemm(Transpose.Transpose, Transpose.NoTranspose, m, n, k, 1.5, a, k, b, k, 0.5, tiled, m);
+
+    const stats = getHeapStats();
+    expect(stats.tiledCalls).toBe(1);
+    expect(stats.peakBytes).toBeLessThanOrEqual(4096);
+    for (let i = 0; i < m * n; i++) {
+      expect(tiled[i]).toBeCloseTo(expected[i], 12);
+    }
+  });
+
+  test('dgemm tiles with padded leading dimensions stay within the budget', () => {
+    // Tiles of 64 rows or more get a padded leading dimension
+    const m = 130;
+    const n = 20;
+    const k = 40;
+    const a = random(m * k);
+    const b = random(n * k);
+    const expected = random(m * n);
+    const tiled = expected.slice();
+
+    dgemm(Transpose.NoTranspose, Transpose.Transpose, m, n, k, 1.5, a, m, b, n, 0.5, expected, m);
+
+    resetHeapStats();
+    setMemoryBudget(48000);
+    dgemm(Transpose.NoTranspose, Transpose.Transpose, m, n, k, 1.5, a, m, b, n, 0.5, tiled, m);
+
+    const stats = getHeapStats();
+    expect(stats.tiledCalls).toBe(1);
+    expect(stats.peakBytes).toBeLessThanOrEqual(48000);
+    for (let i = 0; i < m * n; i++) {
+      expect(tiled[i]).toBeCloseTo(expected[i], 12);
+    }
+  });
+
+  test('pads power-of-two leading dimensions and aligns matrices', () => {
+    expect(paddedLd(10)).toBe(10);
+    expect(paddedLd(100)).toBe(104);
+    expect(paddedLd(1024)).toBe(1032);
+    expect(paddedLd(2048)).toBe(2056);
+
+    const matrix = allocMatrix(1024, 4);
+    expect(matrix.ld).toBe(1032);
+    expect(matrix.ptr % HEAP_ALIGNMENT).toBe(0);
+    expect(getHeapStats().inUseBytes).toBe(1032 * 4 * 8);
+    raw.free(matrix.ptr);
+    expect(getHeapStats().inUseBytes).toBe(0);
+  });
+
+  test('dgemm keeps the caller layout with padded operands', () => {
+    const m = 128;
+    const n = 3;
+    const k = 2;
+    const lda = 130;
+    const a = random(lda * k);
+    const b = random(k * n);
+    const c = random(m * n);
+    const expected = c.map((v, idx) => {
+      const i = idx % m;
+      const j = Math.floor(idx / m);
+      let sum = 0;
+      for (let p = 0; p < k; p++) {
+        sum += a[p * lda + i] * b[j * k + p];
+      }
+      return sum + 2 * v;
+    });
+
+    dgemm(Transpose.NoTranspose, Transpose.NoTranspose, m, n, k, 1, a, lda, b, k, 2, c, m);
+    for (let i = 0; i < m * n; i++) {
+      expect(c[i]).toBeCloseTo(expected[i], 12);
+    }
+  });
+
+  test('other functions throw instead of exceeding the budget', () => {
+    setMemoryBudget(1024);
+    expect(() => ddot(1000, random(1000), 1, random(1000), 1)).toThrow('memory budget');
+    expect(getHeapStats().inUseBytes).toBe(0);
+    expect(() => setMemoryBudget(-1)).toThrow('memory budget must be');
+  });
+
+  test('drivers count the workspace of their kernels against the budget', () => {
+    // Operands of 24 KB: a tridiagonal band of order 1000 and one vector
+    const n = 1000;
+    const op = {
+      kind: 'band' as const,
+      n,
+      k: 1,
+      uplo: Triangular.Upper,
+      a: new Float64Array(2 * n).fill(1),
+      lda: 2,
+    };
+    setMemoryBudget(30000);
+    expect(() => dpower(op, new Float64Array(n))).toThrow('memory budget');
+    expect(() =>
+      dlanczos(op, Which.Largest, 1, new Float64Array(1), new Float64Array(n), n)
+    ).toThrow('memory budget');
+
+    // A wide dgels copies A^T: 80 KB of operands, 144 KB with the copy
+    setMemoryBudget(100000);
+    const m = 4;
+    const wide = random(m * 2000);
+    expect(() =>
+      dgels(Transpose.NoTranspose, m, 2000, 1, wide, m, new Float64Array(2000), 2000)
+    ).toThrow('memory budget');
+
+    // (A ⊗ B) * x with a 1 x 400 A and a 400 x 1 B: 13 KB of operands, but
+    // the intermediate B * X is 400 x 400
+    setMemoryBudget(20000);
+    const row = { m: 1, n: 400, a: random(400), lda: 1 };
+    const col = { m: 400, n: 1, a: random(400), lda: 400 };
+    const x = random(400);
+    expect(() =>
+      dkronmv(Transpose.NoTranspose, [row, col], 1, x, 0, new Float64Array(400))
+    ).toThrow('memory budget');
+
+    // dkronsv factors copies of two 50 x 50 factors: 60 KB of operands, 120 KB in all
+    setMemoryBudget(70000);
+    const square = { m: 50, n: 50, a: random(2500), lda: 50 };
+    expect(() => dkronsv(Transpose.NoTranspose, [square, square], random(2500))).toThrow(
+      'memory budget'
+    );
+
+    // dgetri works on block columns of 64: 321 KB of operands, 423 KB in all
+    setMemoryBudget(400000);
+    const ipiv = Int32Array.from({ length: 200 }, (_, i) => i + 1);
+    expect(() => dgetri(200, random(40000), 200, ipiv)).toThrow('memory budget');
+    expect(getHeapStats().inUseBytes).toBe(0);
+  });
+});
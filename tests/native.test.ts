@@ -0,0 +1,55 @@
+/**
+ * Tests for backend selection and the native addon fallback
+ */
+
+import {
+  dgemm,
+  drotg,
+  getBackend,
+  getNumThreads,
+  initWasm,
+  setNumThreads,
+  Transpose,
+} from '../src/index';
+
+describe('native backend', () => {
+  beforeAll(async () => {
+    // No addon in this directory, so initialization falls back to WebAssembly
+    await initWasm({ backend: 'native', nativeDir: '/nonexistent' });
+  });
+
+  test('falls back to the WebAssembly backend', () => {
+    expect(getBackend()).toBe('wasm');
+    expect(getNumThreads()).toBe(1);
+  });
+
+  test('BLAS functions work after the fallback', () => {
+    const C = new Float64Array(4);
+    dgemm(
+      Transpose.NoTranspose,
+      Transpose.NoTranspose,
+      2,
+      2,
+      2,
+      1.0,
+      new Float64Array([1, 3, 2, 4]),
+      2,
+      new Float64Array([5, 7, 6, 8]),
+      2,
+      0.0,
+      C,
+      2
+    );
+    expect(Array.from(C)).toEqual([19, 43, 22, 50]);
+
+    const { r, c, s } = drotg(3, 4);
+    expect(r).toBeCloseTo(5);
+    expect(c).toBeCloseTo(0.6);
+    expect(s).toBeCloseTo(0.8);
+  });
+
+  test('setNumThreads validates its argument', () => {
+    expect(() => setNumThreads(0)).toThrow('number of threads must be a positive integer');
+    expect(() => setNumThreads(2)).not.toThrow();
+  });
+});
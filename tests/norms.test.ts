@@ -0,0 +1,183 @@
+/**
+ * Tests for the matrix norms dlange, dlansy and dlantr and the axis
+ * reductions of dreduce
+ */
+
+import {
+  Axis,
+  Diagonal,
+  dlange,
+  dlansy,
+  dlantr,
+  dreduce,
+  initWasm,
+  Norm,
+  Reduction,
+  Triangular,
+} from '../src/index';
+
+describe('matrix norms and reductions', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  // m x n column-major matrix with lda = m + 1; the padding row holds 1e6
+  function random(m: number, n: number): Float64Array {
+    const a = new Float64Array((m + 1) * n).fill(1e6);
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < m; i++) {
+        a[i + j * (m + 1)] = Math.round((Math.random() - 0.5) * 200) / 10;
+      }
+    }
+    return a;
+  }
+
+  // Reference norm of the m x n matrix with elements get(i, j)
+  function reference(norm: Norm, m: number, n: number, get: (i: number, j: number) => number) {
+    const cols = new Array(n).fill(0);
+    const rows = new Array(m).fill(0);
+    let max = 0;
+    let sumsq = 0;
+    for (let j = 0; j < n; j++) {
+      for (let i = 0; i < m; i++) {
+        const v = Math.abs(get(i, j));
+        cols[j] += v;
+        rows[i] += v;
+        max = Math.max(max, v);
+        sumsq += v * v;
+      }
+    }
+    switch (norm) {
+      case Norm.Max:
+        return max;
+      case Norm.One:
+        return Math.max(...cols);
+      case Norm.Infinity:
+        return Math.max(...rows);
+      default:
+        return Math.sqrt(sumsq);
+    }
+  }
+
+  const norms = [Norm.Max, Norm.One, Norm.Infinity, Norm.Frobenius];
+
+  test('dlange computes the norms of a general matrix', () => {
+    const a = new Float64Array([1, -2, 3, 4]);
+    expect(dlange(Norm.Max, 2, 2, a, 2)).toBe(4);
+    expect(dlange(Norm.One, 2, 2, a, 2)).toBe(7);
+    expect(dlange(Norm.Infinity, 2, 2, a, 2)).toBe(6);
+    expect(dlange(Norm.Frobenius, 2, 2, a, 2)).toBeCloseTo(Math.sqrt(30), 14);
+
+    for (const [m, n] of [
+      [1, 1],
+      [7, 5],
+      [33, 17],
+    ]) {
+      const b = random(m, n);
+      for (const norm of norms) {
+        const expected = reference(norm, m, n, (i, j) => b[i + j * (m + 1)]);
+        expect(dlange(norm, m, n, b, m + 1)).toBeCloseTo(expected, 10);
+      }
+    }
+  });
+
+  test('dlansy reads one triangle of a symmetric matrix', () => {
+    const n = 9;
+    const a = random(n, n);
+    const get = (i: number, j: number) => a[i + j * (n + 1)];
+    for (const norm of norms) {
+      const upper = reference(norm, n, n, (i, j) => (i <= j ? get(i, j) : get(j, i)));
+      const lower = reference(norm, n, n, (i, j) => (i >= j ? get(i, j) : get(j, i)));
+      expect(dlansy(norm, Triangular.Upper, n, a, n + 1)).toBeCloseTo(upper, 10);
+      expect(dlansy(norm, Triangular.Lower, n, a, n + 1)).toBeCloseTo(lower, 10);
+    }
+  });
+
+  test('dlantr reads one trapezoid and takes a unit diagonal as ones', () => {
+    for (const [m, n] of [
+      [6, 6],
+      [8, 5],
+      [5, 8],
+    ]) {
+      const a = random(m, n);
+      const get = (i: number, j: number) => a[i + j * (m + 1)];
+      for (const norm of norms) {
+        for (const uplo of [Triangular.Upper, Triangular.Lower]) {
+          const inside = (i: number, j: number) => (uplo === Triangular.Upper ? i <= j : i >= j);
+          const nonUnit = reference(norm, m, n, (i, j) => (inside(i, j) ? get(i, j) : 0));
+          const unit = reference(norm, m, n, (i, j) =>
+            i === j ? 1 : inside(i, j) ? get(i, j) : 0
+          );
+          expect(dlantr(norm, uplo, Diagonal.NonUnit, m, n, a, m + 1)).toBeCloseTo(nonUnit, 10);
+          expect(dlantr(norm, uplo, Diagonal.Unit, m, n, a, m + 1)).toBeCloseTo(unit, 10);
+        }
+      }
+    }
+  });
+
+  test('the Frobenius norm neither overflows nor underflows', () => {
+    const big = new Float64Array([3e200, 4e200, 0, 0]);
+    expect(dlange(Norm.Frobenius, 2, 2, big, 2) / 5e200).toBeCloseTo(1, 14);
+    const tiny = new Float64Array([3e-200, 0, 4e-200, 0]);
+    // [[3,4], [4,0]] * 1e-200
+    expect(dlansy(Norm.Frobenius, Triangular.Upper, 2, tiny, 2) / 1e-200).toBeCloseTo(
+      Math.sqrt(41),
+      14
+    );
+  });
+
+  test('the max norms propagate NaN', () => {
+    const a = new Float64Array([1, NaN, 3, 4, 5, 6]);
+    expect(dlange(Norm.Max, 6, 1, a, 6)).toBeNaN();
+    expect(dlange(Norm.One, 2, 3, a, 2)).toBeNaN();
+    const r = new Float64Array(3);
+    dreduce(Reduction.MaxAbs, Axis.Columns, 2, 3, a, 2, r);
+    expect(r[0]).toBeNaN();
+    expect(Array.from(r.subarray(1))).toEqual([4, 6]);
+  });
+
+  test('dreduce reduces columns and rows', () => {
+    const a = new Float64Array([1, 2, 3, 4, 5, 6]);
+    const cols = new Float64Array(3);
+    const rows = new Float64Array(2);
+
+    dreduce(Reduction.Sum, Axis.Columns, 2, 3, a, 2, cols);
+    expect(Array.from(cols)).toEqual([3, 7, 11]);
+    dreduce(Reduction.MaxAbs, Axis.Rows, 2, 3, a, 2, rows);
+    expect(Array.from(rows)).toEqual([5, 6]);
+
+    const m = 13;
+    const n = 11;
+    const b = random(m, n);
+    const get = (i: number, j: number) => b[i + j * (m + 1)];
+    const ops: [Reduction, (v: number[]) => number][] = [
+      [Reduction.Sum, (v) => v.reduce((s, x) => s + x, 0)],
+      [Reduction.AbsSum, (v) => v.reduce((s, x) => s + Math.abs(x), 0)],
+      [Reduction.SumSquares, (v) => v.reduce((s, x) => s + x * x, 0)],
+      [Reduction.Norm2, (v) => Math.sqrt(v.reduce((s, x) => s + x * x, 0))],
+      [Reduction.MaxAbs, (v) => Math.max(...v.map(Math.abs))],
+    ];
+    for (const [op, f] of ops) {
+      const c = new Float64Array(n);
+      dreduce(op, Axis.Columns, m, n, b, m + 1, c);
+      const r = new Float64Array(m);
+      dreduce(op, Axis.Rows, m, n, b, m + 1, r);
+      for (let j = 0; j < n; j++) {
+        expect(c[j]).toBeCloseTo(f(Array.from({ length: m }, (_, i) => get(i, j))), 10);
+      }
+      for (let i = 0; i < m; i++) {
+        expect(r[i]).toBeCloseTo(f(Array.from({ length: n }, (_, j) => get(i, j))), 10);
+      }
+    }
+  });
+
+  test('dreduce computes safe Euclidean norms along rows', () => {
+    // Row 0 overflows when squared, row 1 underflows
+    const a = new Float64Array([3e200, 3e-200, 1, 4e200, 4e-200, 1]);
+    const r = new Float64Array(3);
+    dreduce(Reduction.Norm2, Axis.Rows, 3, 2, a, 3, r);
+    expect(r[0] / 5e200).toBeCloseTo(1, 14);
+    expect(r[1] / 5e-200).toBeCloseTo(1, 14);
+    expect(r[2]).toBeCloseTo(Math.SQRT2, 14);
+  });
+});
@@ -0,0 +1,74 @@
+/**
+ * Tests for the unchecked raw API, run on the debug flavour so that invalid
+ * arguments are caught by the kernels
+ */
+
+import {
+  Diagonal,
+  dtrsv,
+  getFlavour,
+  getModule,
+  initWasm,
+  raw,
+  RawFlag,
+  Transpose,
+  Triangular,
+} from '../src/index';
+
+describe('raw API', () => {
+  beforeAll(async () => {
+    await initWasm({ flavour: 'debug' });
+  });
+
+  function alloc(values: number[]): number {
+    const ptr = raw.malloc(values.length * 8);
+    getModule().HEAPF64.set(values, ptr / 8);
+    return ptr;
+  }
+
+  test('loads the debug flavour', () => {
+    expect(getFlavour()).toBe('debug');
+  });
+
+  test('calls the kernels on heap pointers', () => {
+    const x = alloc([1, 2, 3]);
+    const y = alloc([4, 5, 6]);
+    expect(raw.ddot(3, x, 1, y, 1)).toBe(32);
+    raw.free(x);
+    raw.free(y);
+  });
+
+  test('takes char flags as character codes', () => {
+    // C = A^T * B with A = [1 3; 2 4], B = I (column-major)
+    const a = alloc([1, 2, 3, 4]);
+    const b = alloc([1, 0, 0, 1]);
+    const c = alloc([0, 0, 0, 0]);
+    raw.dgemm(RawFlag.Transpose, RawFlag.NoTranspose, 2, 2, 2, 1, a, 2, b, 2, 0, c, 2);
+    expect(Array.from(getModule().HEAPF64.subarray(c / 8, c / 8 + 4))).toEqual([1, 3, 2, 4]);
+    raw.free(a);
+    raw.free(b);
+    raw.free(c);
+  });
+
+  test('the debug kernels reject invalid arguments', () => {
+    const a = alloc([1, 0, 0, 1]);
+    const x = alloc([1, 1]);
+    expect(() => raw.dtrsv(0, RawFlag.NoTranspose, RawFlag.NonUnit, 2, a, 2, x, 1)).toThrow(
+      /DTRSV parameter number 1/
+    );
+    expect(() =>
+      raw.dtrsv(RawFlag.Upper, RawFlag.NoTranspose, RawFlag.NonUnit, 2, a, 1, x, 1)
+    ).toThrow(/parameter number 6/);
+    expect(() => raw.dgemv(3, 2, 2, 1, a, 2, x, 1, 0, x, 1)).toThrow(/parameter number 1/);
+    raw.free(a);
+    raw.free(x);
+  });
+
+  test('the checked functions pass valid flags to the kernels', () => {
+    // Upper triangular [2 1; 0 4] x = [4 8]
+    const a = new Float64Array([2, 0, 1, 4]);
+    const x = new Float64Array([4, 8]);
+    dtrsv(Triangular.Upper, Transpose.NoTranspose, Diagonal.NonUnit, 2, a, 2, x, 1);
+    expect(Array.from(x)).toEqual([1, 2]);
+  });
+});
@@ -0,0 +1,244 @@
+/**
+ * Tests for call trace recording and replay
+ */
+
+import {
+  ddot,
+  dgemm,
+  dgemm_batch,
+  dgetrf,
+  dgetri,
+  dgetrs,
+  dkronmv,
+  dkronsv,
+  dlanczos,
+  dpower,
+  initWasm,
+  parseTrace,
+  replayTrace,
+  startTrace,
+  stopTrace,
+  Transpose,
+  Which,
+} from '../src/index';
+
+describe('call traces', () => {
+  beforeAll(async () => {
+    await initWasm();
+  });
+
+  test('records calls without changing their results', () => {
+    startTrace({ hash: true, sample: 2 });
+    const C = new Float64Array(4);
+    dgemm(
+      Transpose.NoTranspose,
+      Transpose.Transpose,
+      2,
+      2,
+      2,
+      1.0,
+      new Float64Array([1, 3, 2, 4]),
+      2,
+      new Float64Array([5, 6, 7, 8]),
+      2,
+      0.0,
+      C,
+      2
+    );
+    const dot = ddot(3, new Float64Array([1, 2, 3]), 1, new Float64Array([4, 5, 6]), 1);
+    const trace = stopTrace();
+
+    expect(Array.from(C)).toEqual([19, 43, 22, 50]);
+    expect(dot).toBe(32);
+
+    const calls = parseTrace(trace);
+    expect(calls.map((call) => call.routine)).toEqual(['dgemm', 'ddot']);
+    expect(calls[0].args.slice(0, 6)).toEqual([78, 84, 2, 2, 2, 1.0]);
+    expect(calls[0].args[6]).toMatchObject({ type: 'D', length: 4 });
+    expect(Array.from((calls[1].args[1] as { sample: Float64Array }).sample)).toEqual([1, 2]);
+  });
+
+  test('replays a trace and reports time per routine', () => {
+    startTrace();
+    for (let i = 0; i < 3; i++) {
+      ddot(100, new Float64Array(100), 1, new Float64Array(100), 1);
+    }
+    const reports = replayTrace(stopTrace(), 2);
+
+    expect(reports).toHaveLength(1);
+    expect(reports[0]).toMatchObject({ routine: 'ddot', calls: 6 });
+    expect(reports[0].replayMs).toBeGreaterThanOrEqual(0);
+  });
+
+  test('records the integer arrays of dgemm_batch by value and replays them', () => {
+    const N = Transpose.NoTranspose;
+    const I2 = new Float64Array([1, 0, 0, 1]);
+    startTrace();
+    dgemm_batch([
+      {
+        transa: N,
+        transb: Transpose.Transpose,
+        m: 2,
+        n: 2,
+        k: 2,
+        alpha: 1,
+        a: [I2],
+        lda: 2,
+        b: [new Float64Array([1, 2, 3, 4]), new Float64Array([5, 6, 7, 8])],
+        ldb: 2,
+        beta: 0,
+        c: [new Float64Array(4), new Float64Array(4)],
+        ldc: 2,
+      },
+      {
+        transa: N,
+        transb: N,
+        m: 3,
+        n: 1,
+        k: 2,
+        alpha: 1,
+        a: [new Float64Array(6)],
+        lda: 3,
+        b: [new Float64Array(2)],
+        ldb: 2,
+        beta: 0,
+        c: [new Float64Array(3)],
+        ldc: 3,
+      },
+    ]);
+    const trace = stopTrace();
+
+    // Group sizes, flags, dimensions and offsets are kept even with sample 0
+    const [call] = parseTrace(trace);
+    const values = (i: number): number[] =>
+      Array.from((call.args[i] as { sample: Int32Array }).sample);
+    expect(call.args[0]).toBe(2);
+    expect(values(1)).toEqual([2, 1]);
+    expect(values(3)).toEqual([84, 78]);
+    expect(values(4)).toEqual([2, 3]);
+    expect(values(9)).toEqual([2, 3]);
+    expect(call.args[8]).toMatchObject({ type: 'D' });
+    expect((call.args[8] as { sample?: Float64Array }).sample).toBeUndefined();
+
+    const reports = replayTrace(trace, 3);
+    expect(reports).toHaveLength(1);
+    expect(reports[0]).toMatchObject({ routine: 'dgemm_batch', calls: 3 });
+  });
+
+  test('replays dkronmv and dkronsv with the recorded factor shapes', () => {
+    // Three factors, rectangular for dkronmv, with padded leading dimensions and
+    // dominant diagonals for dkronsv
+    const factor = (m: number, n: number, lda: number) => ({
+      m,
+      n,
+      a: Float64Array.from({ length: lda * n }, (_, i) => (i % (lda + 1) === 0 ? 10 : (i % 7) - 3)),
+      lda,
+    });
+    const rectangular = [factor(2, 3, 3), factor(3, 2, 4), factor(2, 2, 2)];
+    const square = [factor(2, 2, 3), factor(3, 3, 3), factor(2, 2, 2)];
+    startTrace();
+    dkronmv(Transpose.NoTranspose, rectangular, 1, new Float64Array(12), 0, new Float64Array(12));
+    dkronsv(Transpose.Transpose, square, new Float64Array(12).fill(1));
+    const trace = stopTrace();
+
+    // The dimensions of every factor are kept even with sample 0
+    const [mv, sv] = parseTrace(trace);
+    const values = (i: number, args: unknown[]): number[] =>
+      Array.from((args[i] as { sample: Int32Array }).sample);
+    expect(mv.args[1]).toBe(3);
+    expect(values(2, mv.args)).toEqual([2, 3, 2]);
+    expect(values(3, mv.args)).toEqual([3, 2, 2]);
+    expect(values(6, mv.args).every((ld, k) => ld >= rectangular[k].m)).toBe(true);
+    expect(sv.args[1]).toBe(3);
+    expect(values(2, sv.args)).toEqual([2, 3, 2]);
+    expect(values(4, sv.args).every((ld, k) => ld >= square[k].m)).toBe(true);
+
+    const reports = replayTrace(trace, 2);
+    // Sorted by replay time, so compare them by routine name
+    const calls = reports.map((report) => [report.routine, report.calls]).sort();
+    expect(calls).toEqual([
+      ['dkronmv', 2],
+      ['dkronsv', 2],
+    ]);
+  });
+
+  test('replays dgetrs and dgetri with the recorded pivots', () => {
+    // Largest elements on the anti-diagonal, so that every column pivots
+    const n = 6;
+    const a = Float64Array.from({ length: n * n }, (_, k) => {
+      const [i, j] = [k % n, Math.floor(k / n)];
+      return i + j === n - 1 ? 10 + i : (i * j) % 3;
+    });
+    const ipiv = new Int32Array(n);
+    expect(dgetrf(n, n, a, n, ipiv)).toBe(0);
+    expect(Array.from(ipiv).some((p, i) => p !== i + 1)).toBe(true);
+
+    startTrace();
+    dgetrs(Transpose.Transpose, n, 2, a, n, ipiv, new Float64Array(2 * n).fill(1), n);
+    dgetri(n, a, n, ipiv);
+    const trace = stopTrace();
+
+    const [trs, tri] = parseTrace(trace);
+    const pivots = (arg: unknown): number[] => Array.from((arg as { sample: Int32Array }).sample);
+    expect(pivots(trs.args[5])).toEqual(Array.from(ipiv));
+    expect(pivots(tri.args[3])).toEqual(Array.from(ipiv));
+
+    const reports = replayTrace(trace, 2);
+    // Sorted by replay time, so compare them by routine name
+    const calls = reports.map((report) => [report.routine, report.calls]).sort();
+    expect(calls).toEqual([
+      ['dgetri', 2],
+      ['dgetrs', 2],
+    ]);
+  });
+
+  test('replays dpower and dlanczos with the recorded sparse structure', () => {
+    // 1-D Laplacian tridiag(-1, 2, -1) in compressed sparse row storage
+    const n = 16;
+    const rowPtr = new Int32Array(n + 1);
+    const colInd: number[] = [];
+    const values: number[] = [];
+    for (let i = 0; i < n; i++) {
+      for (let j = Math.max(0, i - 1); j <= Math.min(n - 1, i + 1); j++) {
+        colInd.push(j);
+        values.push(i === j ? 2 : -1);
+      }
+      rowPtr[i + 1] = colInd.length;
+    }
+    const op = {
+      kind: 'sparse' as const,
+      n,
+      rowPtr,
+      colInd: Int32Array.from(colInd),
+      values: Float64Array.from(values),
+    };
+
+    startTrace();
+    dpower(op, new Float64Array(n).fill(1), 50, 0);
+    dlanczos(op, Which.Largest, 2, new Float64Array(2), new Float64Array(2 * n), n, 8);
+    const trace = stopTrace();
+
+    const structure = (arg: unknown): number[] =>
+      Array.from((arg as { sample: Int32Array }).sample);
+    for (const call of parseTrace(trace)) {
+      expect(structure(call.args[6])).toEqual(Array.from(rowPtr));
+      expect(structure(call.args[7])).toEqual(colInd);
+    }
+
+    const reports = replayTrace(trace, 2);
+    // Sorted by replay time, so compare them by routine name
+    const calls = reports.map((report) => [report.routine, report.calls]).sort();
+    expect(calls).toEqual([
+      ['dlanczos', 2],
+      ['dpower', 2],
+    ]);
+  });
+
+  test('validates its state and input', () => {
+    expect(() => stopTrace()).toThrow('no trace is being recorded');
+    expect(() => parseTrace(new Uint8Array(16))).toThrow('not a BLAS trace');
+    startTrace();
+    expect(() => startTrace()).toThrow('a trace is already being recorded');
+    stopTrace();
+  });
+});